@@ -30,8 +30,10 @@
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Quaternion.h"
 #include "Magnum/Math/Packing.h"
+#include "Magnum/Animation/Compression.h"
 #include "Magnum/Animation/Easing.h"
 #include "Magnum/Animation/Player.h"
+#include "Magnum/Animation/TrackBatch.h"
 
 using namespace Magnum;
 using namespace Magnum::Math::Literals;
@@ -291,6 +293,22 @@ player.addRawCallback(track,
 #endif
 }
 
+{
+std::vector<Animation::TrackView<const Float, const Vector3>> tracks;
+std::vector<Vector3> translations;
+Float time{};
+/* [TrackBatch-usage] */
+Animation::TrackBatch<Float, Vector3> batch;
+for(const Animation::TrackView<const Float, const Vector3>& track: tracks)
+    batch.add(track);
+
+// call every frame
+batch.advance(time);
+for(std::size_t i = 0; i != batch.size(); ++i)
+    translations[i] = batch.results()[i];
+/* [TrackBatch-usage] */
+}
+
 {
 /* [Track-usage] */
 const Animation::Track<Float, Vector2> jump{{
@@ -326,6 +344,56 @@ Vector2 position = jump.atStrict(2.2f, hint);   // y = 0.775, hint = 2
 static_cast<void>(position);
 }
 
+{
+const Animation::Track<Float, Vector2> jump;
+/* [Track-performance-resample] */
+/* 30 keyframes per second */
+Animation::Track<Float, Vector2> uniform = Animation::resample(jump,
+    std::size_t(jump.duration().size()*30.0f) + 1);
+
+/* Direct lookup for any time, no hint needed */
+Vector2 position = uniform.at(2.2f);
+/* [Track-performance-resample] */
+static_cast<void>(position);
+}
+
+{
+const Animation::Track<Float, Vector3> translation;
+/* [reduceKeyframes] */
+/* Drop all keyframes that are reproduced within a 0.1 mm distance */
+Animation::Track<Float, Vector3> reduced =
+    Animation::reduceKeyframes(translation, 0.0001f);
+/* [reduceKeyframes] */
+static_cast<void>(reduced);
+}
+
+{
+const Animation::Track<Float, Quaternion> rotation;
+/* [quantizeRotations] */
+/* Keyframe reduction with a 0.05° tolerance, then packing each rotation to
+   6 bytes. The track decodes the quaternions on the fly. */
+Animation::Track<Float, Vector3us, Quaternion> compressed =
+    Animation::quantizeRotations(Animation::reduceKeyframes(rotation,
+        Float(Rad(0.05_degf))));
+
+Quaternion value = compressed.at(1.5f);
+/* [quantizeRotations] */
+static_cast<void>(value);
+}
+
+{
+const Animation::Track<Float, Vector3> translation;
+/* [quantizeVectors] */
+Range3D range;
+Animation::Track<Float, Vector3us, Vector3> compressed =
+    Animation::quantizeVectors(translation, range);
+
+/* The result is in the [0, 1] range, scale it back */
+Vector3 value = range.min() + compressed.at(1.5f)*range.size();
+/* [quantizeVectors] */
+static_cast<void>(value);
+}
+
 {
 /* [Track-performance-cache] */
 struct Keyframe {
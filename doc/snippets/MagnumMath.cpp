@@ -1050,6 +1050,25 @@ static_cast<void>(a);
 static_cast<void>(b);
 }
 
+{
+/* [packOctahedral] */
+Vector2b a = Math::packOctahedral<Vector2b>(Vector3{0.0f, 0.6f, -0.8f});
+Vector2s b = Math::packOctahedral<Vector2s>(Vector3{0.0f, 0.6f, -0.8f});
+Vector2 c = Math::packOctahedral<Vector2>(Vector3{0.0f, 0.6f, -0.8f});
+/* [packOctahedral] */
+static_cast<void>(a);
+static_cast<void>(b);
+static_cast<void>(c);
+}
+
+{
+Vector2s packed;
+/* [unpackOctahedral] */
+Vector3 normal = Math::unpackOctahedral<Vector3>(packed);
+/* [unpackOctahedral] */
+static_cast<void>(normal);
+}
+
 {
 Range1D range, a, b;
 constexpr UnsignedInt dimensions = 1;
@@ -27,7 +27,10 @@
 #include <vector>
 
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/MeshTools/BuildMeshlets.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/MeshTools/Concatenate.h"
 #include "Magnum/MeshTools/Duplicate.h"
@@ -49,6 +52,33 @@ using namespace Magnum::Math::Literals;
 
 int main() {
 
+{
+Trade::MeshData mesh{MeshPrimitive::Triangles, 0};
+Matrix4 transformationProjectionMatrix;
+Vector3 cameraPosition;
+/* [buildMeshlets] */
+/* The sphere test measures distance from the planes, so they need to be
+   normalized */
+Frustum frustum = Frustum::fromMatrix(transformationProjectionMatrix);
+for(std::size_t i = 0; i != 6; ++i)
+    frustum[i] /= frustum[i].xyz().length();
+
+MeshTools::Meshlets meshlets = MeshTools::buildMeshlets(mesh);
+for(const MeshTools::Meshlet& meshlet: meshlets.meshlets) {
+    /* Outside of the view frustum */
+    if(!Math::Intersection::sphereFrustum(meshlet.center, meshlet.radius,
+        frustum)) continue;
+
+    /* All triangles facing away from the camera */
+    if(meshlet.coneAngle != Rad{0.0f} &&
+       Math::Intersection::pointCone(cameraPosition, meshlet.coneApex,
+        -meshlet.coneAxis, meshlet.coneAngle)) continue;
+
+    // draw the meshlet ...
+}
+/* [buildMeshlets] */
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 {
 CORRADE_IGNORE_DEPRECATED_PUSH
@@ -35,6 +35,7 @@
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FlatHierarchy.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/Scene.h"
 
@@ -387,4 +388,42 @@ camera.draw(drawableTransformations);
 /* [Drawable-culling] */
 }
 
+{
+struct MeshDrawable: SceneGraph::Drawable3D {
+    explicit MeshDrawable(Object3D& object, SceneGraph::DrawableGroup3D& group): SceneGraph::Drawable3D{object, &group} {}
+
+    void draw(const Matrix4&, SceneGraph::Camera3D&) override {}
+};
+Scene3D scene;
+Object3D object{&scene};
+Object3D cameraObject{&scene};
+SceneGraph::Camera3D camera{cameraObject};
+SceneGraph::DrawableGroup3D drawableGroup;
+MeshDrawable drawable{object, drawableGroup};
+/* [Drawable-bounding-volumes] */
+/* A unit cube mesh centered at the origin of the object */
+drawable.setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+
+camera.drawCulled(drawableGroup);
+Debug{} << camera.visibleDrawableCount() << "drawables visible,"
+    << camera.culledDrawableCount() << "culled";
+/* [Drawable-bounding-volumes] */
+}
+
+{
+/* [FlatHierarchy-usage] */
+SceneGraph::FlatHierarchy<SceneGraph::MatrixTransformation3D> hierarchy;
+
+UnsignedInt root = hierarchy.addNode(
+    SceneGraph::FlatHierarchy<SceneGraph::MatrixTransformation3D>::NoParent);
+UnsignedInt arm = hierarchy.addNode(root, Matrix4::translation({0.0f, 1.5f, 0.0f}));
+UnsignedInt hand = hierarchy.addNode(arm, Matrix4::rotationZ(15.0_degf));
+
+/* Calculate absolute transformations of all nodes in one pass */
+hierarchy.update();
+Matrix4 handTransformation = hierarchy.absoluteTransformation(hand);
+/* [FlatHierarchy-usage] */
+static_cast<void>(handTransformation);
+}
+
 }
@@ -24,6 +24,7 @@
 */
 
 #include <unordered_map>
+#include <vector>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Utility/Directory.h>
 #include <Corrade/Utility/Resource.h>
@@ -40,6 +41,7 @@
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImporterPool.h"
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
@@ -122,6 +124,48 @@ importer->openFile("scene.gltf"); // memory-maps all files
 }
 #endif
 
+{
+Containers::Pointer<Trade::AbstractImporter> importer;
+/* [MappedFileCallback] */
+MappedFileCallback files;
+importer->setFileCallback(&MappedFileCallback::callback, files);
+importer->setFlags(Trade::ImporterFlag::PersistentInput);
+
+/* The data may reference the mapped memory, keep `files` alive as long as the
+   image and the importer are in use */
+importer->openFile("image.tga");
+Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+/* [MappedFileCallback] */
+}
+
+{
+PluginManager::Manager<Trade::AbstractImporter> manager;
+TaskExecutor executor{};
+struct ThreadPool {} threadPool;
+/* [ImporterPool-usage] */
+Containers::Array<Containers::Pointer<Trade::AbstractImporter>> importers{4};
+for(Containers::Pointer<Trade::AbstractImporter>& importer: importers)
+    importer = manager.loadAndInstantiate("AnySceneImporter");
+
+Trade::ImporterPool pool{std::move(importers)};
+if(!pool.openFile("level.obj"))
+    Fatal{} << "Can't open level.obj";
+
+std::vector<Containers::Optional<Trade::MeshData>> meshes(
+    pool.importer(0).meshCount());
+for(UnsignedInt i = 0; i != meshes.size(); ++i)
+    pool.requestMesh(i, 0, [](UnsignedInt id,
+        Containers::Optional<Trade::MeshData>&& mesh, void* userData) {
+            (*static_cast<std::vector<Containers::Optional<Trade::MeshData>>*>(
+                userData))[id] = std::move(mesh);
+        }, &meshes);
+
+/* Imports four meshes at a time using an executor dispatching to a thread
+   pool, calls the callbacks once each four are done */
+pool.process(executor, &threadPool);
+/* [ImporterPool-usage] */
+}
+
 {
 Containers::Pointer<Trade::AbstractImporter> importer;
 Int materialIndex;
@@ -199,6 +243,24 @@ for(UnsignedInt i = 0; i != data.trackCount(); ++i) {
 /* [AnimationData-usage-mutable] */
 }
 
+{
+Trade::AnimationData data{nullptr, {}};
+/* [compressAnimation] */
+Trade::AnimationData compressed = Trade::compressAnimation(data, 0.0001f);
+
+/* Rotations are now packed, but still interpolate to a Quaternion */
+for(UnsignedInt i = 0; i != compressed.trackCount(); ++i) {
+    if(compressed.trackResultType(i) != Trade::AnimationTrackType::Quaternion)
+        continue;
+    Quaternion rotation =
+        compressed.trackType(i) == Trade::AnimationTrackType::Vector3us ?
+            compressed.track<Vector3us, Quaternion>(i).at(0.5f) :
+            compressed.track<Quaternion>(i).at(0.5f);
+    static_cast<void>(rotation);
+}
+/* [compressAnimation] */
+}
+
 {
 /* [ImageData-construction] */
 Containers::Array<char> data;
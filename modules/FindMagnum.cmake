@@ -934,7 +934,14 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # No special setup for AnySceneImporter plugin
         # No special setup for MagnumFont plugin
         # No special setup for MagnumFontConverter plugin
-        # No special setup for ObjImporter plugin
+
+        # ObjImporter plugin
+        if(_component STREQUAL ObjImporter)
+            find_package(Threads REQUIRED)
+            set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                INTERFACE_LINK_LIBRARIES Threads::Threads)
+        endif()
+
         # No special setup for TgaImageConverter plugin
         # No special setup for TgaImporter plugin
         # No special setup for WavAudioImporter plugin
@@ -0,0 +1,102 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "Compression.h"
+
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace Animation {
+
+namespace {
+    /* The three smallest components are in the [-1/√2, 1/√2] range, scaled to
+       [0, 1] for packing into 15 bits. Using an even maximum instead of 32767
+       so zero is exactly representable and axis-aligned rotations survive the
+       round trip unchanged. */
+    constexpr Float SmallestThreeMax = 32766.0f;
+}
+
+Vector3us packSmallestThree(const Quaternion& value) {
+    CORRADE_ASSERT(value.isNormalized(),
+        "Animation::packSmallestThree():" << value << "is not normalized", {});
+
+    const Vector4 components{value.vector(), value.scalar()};
+    UnsignedInt largest = 0;
+    for(UnsignedInt i = 1; i != 4; ++i)
+        if(Math::abs(components[i]) > Math::abs(components[largest]))
+            largest = i;
+
+    /* Flip the quaternion so the dropped component is positive */
+    const Float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+    Vector3us out{Magnum::NoInit};
+    for(UnsignedInt i = 0, j = 0; i != 4; ++i) {
+        if(i == largest) continue;
+        const Float normalized = components[i]*sign*Constants::sqrtHalf() + 0.5f;
+        out[j++] = UnsignedShort(Math::round(Math::clamp(normalized, 0.0f, 1.0f)*SmallestThreeMax));
+    }
+
+    /* The index of the dropped component is stored in the otherwise unused
+       top bits of the first two components */
+    out[0] |= UnsignedShort((largest & 1) << 15);
+    out[1] |= UnsignedShort((largest >> 1) << 15);
+    return out;
+}
+
+Quaternion unpackSmallestThree(const Vector3us& value) {
+    const UnsignedInt largest = (value[0] >> 15)|((value[1] >> 15) << 1);
+
+    Vector3 smallest{Magnum::NoInit};
+    for(UnsignedInt i = 0; i != 3; ++i)
+        smallest[i] = ((value[i] & 0x7fff)/SmallestThreeMax - 0.5f)*Constants::sqrt2();
+
+    Vector4 components{Magnum::NoInit};
+    for(UnsignedInt i = 0, j = 0; i != 4; ++i)
+        components[i] = i == largest ?
+            std::sqrt(Math::max(1.0f - smallest.dot(), 0.0f)) : smallest[j++];
+
+    return Quaternion{components.xyz(), components.w()};
+}
+
+Quaternion selectSmallestThree(const Vector3us& a, const Vector3us& b, const Float t) {
+    return unpackSmallestThree(Math::select(a, b, t));
+}
+
+Quaternion lerpSmallestThree(const Vector3us& a, const Vector3us& b, const Float t) {
+    return Math::lerpShortestPath(unpackSmallestThree(a), unpackSmallestThree(b), t);
+}
+
+Quaternion slerpSmallestThree(const Vector3us& a, const Vector3us& b, const Float t) {
+    return Math::slerpShortestPath(unpackSmallestThree(a), unpackSmallestThree(b), t);
+}
+
+Vector3 selectNormalized(const Vector3us& a, const Vector3us& b, const Float t) {
+    return Math::unpack<Vector3>(Math::select(a, b, t));
+}
+
+Vector3 lerpNormalized(const Vector3us& a, const Vector3us& b, const Float t) {
+    return Math::lerp(Math::unpack<Vector3>(a), Math::unpack<Vector3>(b), t);
+}
+
+}}
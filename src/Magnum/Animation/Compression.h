@@ -0,0 +1,359 @@
+#ifndef Magnum_Animation_Compression_h
+#define Magnum_Animation_Compression_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Animation::packSmallestThree(), @ref Magnum::Animation::unpackSmallestThree(), @ref Magnum::Animation::selectSmallestThree(), @ref Magnum::Animation::lerpSmallestThree(), @ref Magnum::Animation::slerpSmallestThree(), @ref Magnum::Animation::selectNormalized(), @ref Magnum::Animation::lerpNormalized(), @ref Magnum::Animation::reduceKeyframes(), @ref Magnum::Animation::quantizeRotations(), @ref Magnum::Animation::quantizeVectors()
+ * @m_since_latest
+ */
+
+#include <cmath>
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/visibility.h"
+#include "Magnum/Animation/Track.h"
+#include "Magnum/Math/Complex.h"
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Pack a quaternion using the smallest-three encoding
+@m_since_latest
+
+Drops the component with the largest absolute value and stores the remaining
+three, which are all in the @f$ [-\frac{1}{\sqrt{2}}, \frac{1}{\sqrt{2}}] @f$
+range, in 15 bits each together with a 2-bit index of the dropped component.
+The quaternion is negated if needed so the dropped component is positive,
+which still represents the same rotation, and the dropped component is then
+reconstructed from the unit length in @ref unpackSmallestThree(). The result
+takes 6 bytes instead of 16, with the maximal error of each component being
+around @f$ 2 \cdot 10^{-5} @f$. Expects that @p value is normalized.
+
+Used by @ref quantizeRotations(), see its documentation for an example.
+@see @ref Math::Quaternion::isNormalized()
+*/
+MAGNUM_EXPORT Vector3us packSmallestThree(const Quaternion& value);
+
+/**
+@brief Unpack a quaternion from the smallest-three encoding
+@m_since_latest
+
+Inverse to @ref packSmallestThree(). The returned quaternion is normalized,
+but its sign can be different from the quaternion that was packed.
+*/
+MAGNUM_EXPORT Quaternion unpackSmallestThree(const Vector3us& value);
+
+/**
+@brief Constant interpolation of smallest-three-encoded quaternions
+@m_since_latest
+
+Equivalent to calling @ref Math::select() on the @ref unpackSmallestThree()
+output. Only the value that's returned gets unpacked.
+@see @ref quantizeRotations()
+*/
+MAGNUM_EXPORT Quaternion selectSmallestThree(const Vector3us& a, const Vector3us& b, Float t);
+
+/**
+@brief Linear shortest-path interpolation of smallest-three-encoded quaternions
+@m_since_latest
+
+Equivalent to calling @ref Math::lerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T)
+on the @ref unpackSmallestThree() output. As the encoding doesn't preserve the
+quaternion sign, only the shortest-path variant is provided.
+@see @ref slerpSmallestThree(), @ref quantizeRotations()
+*/
+MAGNUM_EXPORT Quaternion lerpSmallestThree(const Vector3us& a, const Vector3us& b, Float t);
+
+/**
+@brief Spherical linear shortest-path interpolation of smallest-three-encoded quaternions
+@m_since_latest
+
+Equivalent to calling @ref Math::slerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T)
+on the @ref unpackSmallestThree() output. As the encoding doesn't preserve the
+quaternion sign, only the shortest-path variant is provided.
+@see @ref lerpSmallestThree(), @ref quantizeRotations()
+*/
+MAGNUM_EXPORT Quaternion slerpSmallestThree(const Vector3us& a, const Vector3us& b, Float t);
+
+/**
+@brief Constant interpolation of normalized vectors
+@m_since_latest
+
+Equivalent to calling @ref Math::select() on the @ref Math::unpack() output.
+Only the value that's returned gets unpacked.
+@see @ref quantizeVectors()
+*/
+MAGNUM_EXPORT Vector3 selectNormalized(const Vector3us& a, const Vector3us& b, Float t);
+
+/**
+@brief Linear interpolation of normalized vectors
+@m_since_latest
+
+Equivalent to calling @ref Math::lerp() on the @ref Math::unpack() output.
+@see @ref quantizeVectors()
+*/
+MAGNUM_EXPORT Vector3 lerpNormalized(const Vector3us& a, const Vector3us& b, Float t);
+
+namespace Implementation {
+    /* Error metrics for keyframe reduction. Distance for scalars and vectors,
+       rotation angle in radians for complex numbers and quaternions. */
+    inline Float keyframeError(Float a, Float b) {
+        return Math::abs(a - b);
+    }
+    template<std::size_t size> Float keyframeError(const Math::Vector<size, Float>& a, const Math::Vector<size, Float>& b) {
+        return (a - b).length();
+    }
+    /* Calculated from the chord length instead of an arccosine of the dot
+       product, which has a poor precision for small angles */
+    inline Float keyframeError(const Complex& a, const Complex& b) {
+        return 2.0f*std::asin(Math::min((a - b).length()*0.5f, 1.0f));
+    }
+    inline Float keyframeError(const Quaternion& a, const Quaternion& b) {
+        /* q and -q is the same rotation */
+        return 4.0f*std::asin(Math::min(Math::min((a - b).length(), (a + b).length())*0.5f, 1.0f));
+    }
+
+    /* Max distance between two kept keyframes. Every time the segment grows
+       all keyframes inside it are checked again, so this bounds the
+       complexity to O(n*ReduceKeyframesMaxSegment) instead of O(n^2) for
+       long linear or constant runs. */
+    constexpr std::size_t ReduceKeyframesMaxSegment = 64;
+
+    /* Returns indices of keyframes that are kept. Greedily extends the
+       [start, end] segment for as long as all keyframes inside it can be
+       reconstructed from the segment endpoints within the tolerance, up to
+       ReduceKeyframesMaxSegment. */
+    template<class K, class V> Containers::Array<std::size_t> reduceKeyframeIndices(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, V(*const interpolator)(const V&, const V&, Float), const Float tolerance) {
+        Containers::Array<std::size_t> indices;
+        if(keys.empty()) return indices;
+
+        arrayAppend(indices, std::size_t{});
+        std::size_t start = 0;
+        for(std::size_t end = 2; end < keys.size(); ++end) {
+            if(end - start > ReduceKeyframesMaxSegment) {
+                arrayAppend(indices, end - 1);
+                start = end - 1;
+                continue;
+            }
+
+            for(std::size_t i = start + 1; i != end; ++i) {
+                const Float t = Math::lerpInverted(Float(keys[start]), Float(keys[end]), Float(keys[i]));
+                if(keyframeError(interpolator(values[start], values[end], t), values[i]) > tolerance) {
+                    arrayAppend(indices, end - 1);
+                    start = end - 1;
+                    break;
+                }
+            }
+        }
+
+        if(keys.size() > 1) arrayAppend(indices, keys.size() - 1);
+        return indices;
+    }
+}
+
+/**
+@brief Remove keyframes that can be reconstructed by interpolation
+@param track         Track to reduce
+@param tolerance     Maximal allowed error
+@m_since_latest
+
+Drops all keyframes that are reproduced by interpolating the neighboring kept
+keyframes with an error not larger than @p tolerance, using the track
+interpolator. The first and last keyframe are always kept, so the track
+duration doesn't change. The error is a distance for scalar and vector values
+and a rotation angle in radians for @ref Magnum::Complex "Complex" and
+@ref Magnum::Quaternion "Quaternion" values, other value types are not
+supported. The result has the same interpolator and extrapolation behavior as
+@p track.
+
+The reduction is greedy and considers only the original keyframes, not the
+curve between them. With a zero @p tolerance only keyframes that are exactly
+reproduced are removed, which is useful for cleaning up densely sampled
+animations with large constant or linear parts.
+
+Every time a run of removed keyframes grows, all keyframes in it are checked
+against the new endpoints again. To keep the complexity linear in the
+keyframe count, the distance between two kept keyframes is limited to 64
+keyframes, which makes the reduction @f$ \mathcal{O}(64n) @f$ for a track of
+@f$ n @f$ keyframes. Long constant or linear runs thus keep every 64th
+keyframe.
+
+@snippet MagnumAnimation.cpp reduceKeyframes
+
+@see @ref resample(), @ref quantizeRotations(), @ref quantizeVectors()
+*/
+template<class K, class V> Track<K, V, V> reduceKeyframes(const TrackView<const K, const V, V>& track, Float tolerance) {
+    const Containers::Array<std::size_t> indices = Implementation::reduceKeyframeIndices(track.keys(), track.values(), track.interpolator(), tolerance);
+
+    Containers::Array<std::pair<K, V>> data{indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        data[i] = {track.keys()[indices[i]], track.values()[indices[i]]};
+
+    return Track<K, V, V>{std::move(data), track.interpolation(), track.interpolator(), track.before(), track.after()};
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class K, class V> Track<K, V, V> reduceKeyframes(const TrackView<K, V, V>& track, Float tolerance) {
+    return reduceKeyframes(TrackView<const K, const V, V>{track}, tolerance);
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class K, class V> Track<K, V, V> reduceKeyframes(const Track<K, V, V>& track, Float tolerance) {
+    return reduceKeyframes(TrackView<const K, const V, V>{track}, tolerance);
+}
+
+/**
+@brief Quantize a rotation track
+@m_since_latest
+
+Packs all values with @ref packSmallestThree(), which makes every keyframe
+take 6 bytes instead of 16. The returned track uses @ref selectSmallestThree()
+for @ref Interpolation::Constant and @ref slerpSmallestThree() for
+@ref Interpolation::Linear tracks, so the quaternions are decoded on the fly
+during interpolation and the results can be used directly. Other
+interpolation modes are not supported. The extrapolation behavior is
+preserved.
+
+Combined with @ref reduceKeyframes(), this is the recommended way to reduce
+memory use of large animation libraries:
+
+@snippet MagnumAnimation.cpp quantizeRotations
+
+@see @ref quantizeVectors()
+*/
+template<class K> Track<K, Vector3us, Quaternion> quantizeRotations(const TrackView<const K, const Quaternion, Quaternion>& track) {
+    CORRADE_ASSERT(track.interpolation() == Interpolation::Constant || track.interpolation() == Interpolation::Linear,
+        "Animation::quantizeRotations(): can't quantize a track with" << track.interpolation(), (Track<K, Vector3us, Quaternion>{}));
+
+    Containers::Array<std::pair<K, Vector3us>> data{track.size()};
+    for(std::size_t i = 0; i != track.size(); ++i)
+        data[i] = {track.keys()[i], packSmallestThree(track.values()[i])};
+
+    return Track<K, Vector3us, Quaternion>{std::move(data), track.interpolation(),
+        track.interpolation() == Interpolation::Constant ?
+            selectSmallestThree : slerpSmallestThree,
+        track.before(), track.after()};
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class K> Track<K, Vector3us, Quaternion> quantizeRotations(const TrackView<K, Quaternion, Quaternion>& track) {
+    return quantizeRotations(TrackView<const K, const Quaternion, Quaternion>{track});
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class K> Track<K, Vector3us, Quaternion> quantizeRotations(const Track<K, Quaternion, Quaternion>& track) {
+    return quantizeRotations(TrackView<const K, const Quaternion, Quaternion>{track});
+}
+
+/**
+@brief Quantize a vector track relative to its range
+@param[in] track    Track to quantize
+@param[out] range   Range of all values in the track
+@m_since_latest
+
+Calculates the bounding @p range of all track values and packs each value
+relative to it into a @ref Magnum::Vector3us "Vector3us", which makes every
+keyframe take 6 bytes instead of 12 while using the full 16-bit precision
+for any extent of the animation. Suitable for translation and scaling tracks.
+The returned track uses @ref selectNormalized() for
+@ref Interpolation::Constant and @ref lerpNormalized() for
+@ref Interpolation::Linear tracks, producing values in the
+@f$ [0, 1] @f$ range that are expected to be scaled back by the caller.
+Since the mapping is affine, it's equivalent to interpolating the original
+values:
+
+@f[
+    \boldsymbol{v} = \boldsymbol{r}_\text{min} + \boldsymbol{n} \circ (\boldsymbol{r}_\text{max} - \boldsymbol{r}_\text{min})
+@f]
+
+Other interpolation modes are not supported. The extrapolation behavior is
+preserved, however note that @ref Extrapolation::DefaultConstructed will give
+back @p range min instead of a zero vector after scaling back.
+
+@snippet MagnumAnimation.cpp quantizeVectors
+
+@see @ref quantizeRotations(), @ref reduceKeyframes()
+*/
+template<class K> Track<K, Vector3us, Vector3> quantizeVectors(const TrackView<const K, const Vector3, Vector3>& track, Range3D& range) {
+    CORRADE_ASSERT(track.interpolation() == Interpolation::Constant || track.interpolation() == Interpolation::Linear,
+        "Animation::quantizeVectors(): can't quantize a track with" << track.interpolation(), (Track<K, Vector3us, Vector3>{}));
+
+    range = Range3D{};
+    if(!track.values().empty()) {
+        const std::pair<Vector3, Vector3> minmax = Math::minmax(track.values());
+        range = Range3D{minmax.first, minmax.second};
+    }
+
+    /* Components that don't change at all get packed to zero */
+    const Vector3 size = range.size();
+    Vector3 invSize{Magnum::NoInit};
+    for(std::size_t i = 0; i != 3; ++i)
+        invSize[i] = size[i] > 0.0f ? 1.0f/size[i] : 0.0f;
+
+    Containers::Array<std::pair<K, Vector3us>> data{track.size()};
+    for(std::size_t i = 0; i != track.size(); ++i)
+        data[i] = {track.keys()[i], Math::pack<Vector3us>(Math::clamp((track.values()[i] - range.min())*invSize, 0.0f, 1.0f))};
+
+    return Track<K, Vector3us, Vector3>{std::move(data), track.interpolation(),
+        track.interpolation() == Interpolation::Constant ?
+            selectNormalized : lerpNormalized,
+        track.before(), track.after()};
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class K> Track<K, Vector3us, Vector3> quantizeVectors(const TrackView<K, Vector3, Vector3>& track, Range3D& range) {
+    return quantizeVectors(TrackView<const K, const Vector3, Vector3>{track}, range);
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class K> Track<K, Vector3us, Vector3> quantizeVectors(const Track<K, Vector3, Vector3>& track, Range3D& range) {
+    return quantizeVectors(TrackView<const K, const Vector3, Vector3>{track}, range);
+}
+
+}}
+
+#endif
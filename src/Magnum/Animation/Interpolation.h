@@ -175,8 +175,8 @@ MAGNUM_EXPORT Debug& operator<<(Debug& debug, Extrapolation value);
 @param frame        Frame at which to interpolate
 @param hint         Hint for keyframe search
 
-Does a linear search over the keyframes until it finds last keyframe which is
-not larger than @p frame. Once the keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
+Searches the keyframes for the last keyframe which is not larger than
+@p frame. Once the keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
 calculated interpolation factor, returning the interpolated value.
 
 -   In case the first keyframe is already larger than @p frame or @p frame is
@@ -187,9 +187,15 @@ calculated interpolation factor, returning the interpolated value.
     the interpolator.
 -   In case no keyframes are present, default-constructed value is returned.
 
-The @p hint parameter hints where to start the linear search and is updated
-with keyframe index matching @p frame. If @p frame is earlier than @p hint, the
-search is restarted from the beginning.
+The @p hint parameter hints where to start the search and is updated with
+keyframe index matching @p frame. If @p frame is at or at most a few keyframes
+after @p hint, the keyframe is found with a short linear search, which makes
+continuous playback @f$ \mathcal{O}(1) @f$. Otherwise, such as when seeking
+or going back in time, the keyframe position is guessed assuming uniform
+keyframe spacing and if the guess fails, a binary search is done. Random
+access is thus @f$ \mathcal{O}(\log n) @f$ in general and @f$ \mathcal{O}(1) @f$
+for tracks with uniformly spaced keyframes, such as produced by
+@ref resample().
 
 Used internally from @ref Track::at() / @ref TrackView::at(), see @ref Track
 documentation for more information.
@@ -203,12 +209,12 @@ template<class K, class V, class R = ResultOf<V>> R interpolate(const Containers
 /**
 @brief Interpolate animation value with strict constraints
 
-Does a linear search over the keyframes until it finds last keyframe which is
-not larger than @p frame. Once the keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
+Searches the keyframes for the last keyframe which is not larger than
+@p frame. Once the keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
 calculated interpolation factor, returning the interpolated value. The @p hint
-parameter hints where to start the linear search and is updated with keyframe
-index matching @p frame. If @p frame is earlier than @p hint, the search is
-restarted from the beginning.
+parameter hints where to start the search and is updated with keyframe index
+matching @p frame, see @ref interpolate() for details about the search
+complexity.
 
 This is a stricter but more performant version of @ref interpolate() with
 implicit @ref Extrapolation::Extrapolated behavior. Expects that there are
@@ -415,6 +421,52 @@ template<class V, class R> auto interpolatorFor(Interpolation interpolation) ->
     return Implementation::TypeTraits<typename std::remove_const<V>::type, R>::interpolator(interpolation);
 }
 
+namespace Implementation {
+
+/* Returns the largest index i in [0, keys.size() - 2] for which
+   keys[i] <= frame, or 0 if frame is before the first keyframe. Expects at
+   least two keyframes. */
+template<class K> std::size_t keyframeIndex(const Containers::StridedArrayView1D<const K>& keys, const K frame, std::size_t hint) {
+    const std::size_t last = keys.size() - 2;
+
+    /* Continuous playback -- the hint is either still valid or the frame is
+       just a few keyframes ahead */
+    if(hint <= last && frame >= keys[hint]) {
+        for(std::size_t i = 0; i != 4; ++i) {
+            if(hint == last || frame < keys[hint + 1]) return hint;
+            ++hint;
+        }
+    }
+
+    /* Seeking, guess the position assuming uniformly spaced keyframes. That's
+       exact for resampled tracks, allow for an off-by-one error due to
+       floating-point precision. */
+    std::size_t guess = 0;
+    if(frame > keys[0]) {
+        const Float range = Float(keys[last + 1]) - Float(keys[0]);
+        if(range > 0.0f)
+            guess = std::size_t(Math::min((Float(frame) - Float(keys[0]))/range*Float(last + 1), Float(last)));
+    }
+    if(frame >= keys[guess]) {
+        if(guess == last || frame < keys[guess + 1]) return guess;
+        if(guess + 1 == last || frame < keys[guess + 2]) return guess + 1;
+    } else {
+        if(!guess) return 0;
+        if(frame >= keys[guess - 1]) return guess - 1;
+    }
+
+    /* Otherwise do a binary search for the first keyframe after the frame */
+    std::size_t begin = 1, end = last + 1;
+    while(begin < end) {
+        const std::size_t middle = begin + (end - begin)/2;
+        if(frame >= keys[middle]) begin = middle + 1;
+        else end = middle;
+    }
+    return begin - 1;
+}
+
+}
+
 template<class K, class V, class R> R interpolate(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), K frame, std::size_t& hint) {
     CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolate(): keys and values don't have the same size", {});
 
@@ -430,12 +482,8 @@ template<class K, class V, class R> R interpolate(const Containers::StridedArray
         return interpolator(values[0], values[0], 0.0f);
     }
 
-    /* Rewind from the beginning if hint is too late */
-    if(hint >= keys.size() || frame < keys[hint]) hint = 0;
-
-    /* Go through the keys until we find a pair that is around given time */
-    while(hint + 2 < keys.size() && frame >= keys[hint + 1])
-        ++hint;
+    /* Find a pair of keys that is around given time */
+    hint = Implementation::keyframeIndex(keys, frame, hint);
 
     /* Special extrapolation outside of range. Usual extrapolation is handled
        below. */
@@ -455,12 +503,8 @@ template<class K, class V, class R> R interpolateStrict(const Containers::Stride
     CORRADE_ASSERT(keys.size() >= 2, "Animation::interpolateStrict(): at least two keyframes required", {});
     CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolateStrict(): keys and values don't have the same size", {});
 
-    /* Rewind from the beginning if hint is too late */
-    if(hint >= keys.size() || frame < keys[hint]) hint = 0;
-
-    /* Go through the keys until we find a pair that is around given time */
-    while(hint + 2 < keys.size() && frame >= keys[hint + 1])
-        ++hint;
+    /* Find a pair of keys that is around given time */
+    hint = Implementation::keyframeIndex(keys, frame, hint);
 
     return interpolator(values[hint], values[hint + 1],
         Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame)));
@@ -347,19 +347,31 @@ template<class T, class K
         /**
          * @brief Whether the player is empty
          *
-         * @see @ref size(), @ref add(), @ref addWithCallback(),
-         *      @ref addWithCallbackOnChange(), @ref addRawCallback()
+         * Returns @cpp true @ce if there are no tracks and no track batches.
+         * @see @ref size(), @ref batchCount(), @ref add(),
+         *      @ref addWithCallback(), @ref addWithCallbackOnChange(),
+         *      @ref addRawCallback(), @ref addBatch()
          */
         bool isEmpty() const;
 
         /**
          * @brief Count of tracks managed by this player
          *
-         * @see @ref isEmpty(), @ref add(), @ref addWithCallback(),
-         *      @ref addWithCallbackOnChange(), @ref addRawCallback()
+         * Doesn't include tracks in batches added with @ref addBatch().
+         * @see @ref isEmpty(), @ref batchCount(), @ref add(),
+         *      @ref addWithCallback(), @ref addWithCallbackOnChange(),
+         *      @ref addRawCallback()
          */
         std::size_t size() const;
 
+        /**
+         * @brief Count of track batches managed by this player
+         * @m_since_latest
+         *
+         * @see @ref isEmpty(), @ref size(), @ref addBatch()
+         */
+        std::size_t batchCount() const;
+
         /**
          * @brief Track at given position
          *
@@ -633,6 +645,26 @@ template<class T, class K
         }
         #endif
 
+        /**
+         * @brief Add a track batch
+         * @m_since_latest
+         *
+         * On every @ref advance() the whole @p batch gets advanced using
+         * @ref TrackBatch::advance() with the same key as all other tracks,
+         * updating @ref TrackBatch::results(). Batches are advanced after all
+         * tracks, in order they were added. The batch @ref TrackBatch::duration()
+         * at the time of this call is used to update @ref duration(), so all
+         * tracks are expected to be added to the batch before calling this
+         * function.
+         *
+         * Compared to adding tracks one by one, this avoids an indirect call
+         * and a scattered write for every track. See @ref TrackBatch for more
+         * information. Note that the batch ownership is *not* transferred to
+         * the @ref Player and you have to ensure that it's kept in scope
+         * (and not moved) for the whole lifetime of the @ref Player instance.
+         */
+        template<class V, class R> Player<T, K>& addBatch(TrackBatch<K, V, R>& batch);
+
         /**
          * @brief State
          *
@@ -763,7 +795,8 @@ template<class T, class K
          * tracks added with @ref add(), @ref addWithCallback() or
          * @ref addWithCallbackOnChange() in order they were added and updates
          * the destination locations and/or fires the callbacks with
-         * interpolation results.
+         * interpolation results. After that, all batches added with
+         * @ref addBatch() are advanced.
          *
          * If @ref state() is @ref State::Paused or @ref State::Stopped, the
          * function does nothing. If @p time is less than time that was passed
@@ -803,12 +836,15 @@ template<class T, class K
 
     private:
         struct Track;
+        struct Batch;
 
         Player<T, K>& addInternal(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData);
+        Player<T, K>& addBatchInternal(const Math::Range1D<K>& duration, void* batch, void(*advancer)(void*, K));
 
         Containers::Optional<std::pair<UnsignedInt, K>> elapsedInternal(T time, T& updatedStartTime, T& updatedPauseTime, State& updatedState) const;
 
         Containers::Array<Track> _tracks;
+        Containers::Array<Batch> _batches;
         Math::Range1D<K> _duration;
         UnsignedInt _playCount{1};
         State _state{State::Stopped};
@@ -823,6 +859,13 @@ template<class T, class K> template<class V, class R> Player<T, K>& Player<T, K>
         }, &destination, nullptr, nullptr);
 }
 
+template<class T, class K> template<class V, class R> Player<T, K>& Player<T, K>::addBatch(TrackBatch<K, V, R>& batch) {
+    return addBatchInternal(batch.duration(), &batch,
+        [](void* batch, K key) {
+            static_cast<TrackBatch<K, V, R>*>(batch)->advance(key);
+        });
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template<class T, class K> template<class V, class R, class Callback> Player<T, K>& Player<T, K>::addWithCallback(const TrackView<const K, const V, R>& track, Callback callback, void* userData) {
     auto callbackPtr = static_cast<void(*)(K, const R&, void*)>(callback);
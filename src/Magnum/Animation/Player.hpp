@@ -70,6 +70,11 @@ template<class T, class K> struct Player<T, K>::Track  {
     void* userCallbackData;
     std::size_t hint;
 };
+
+template<class T, class K> struct Player<T, K>::Batch {
+    void* batch;
+    void(*advancer)(void*, K);
+};
 #endif
 
 template<class T, class K> void Player<T, K>::advance(const T time, const std::initializer_list<Containers::Reference<Player<T, K>>> players) {
@@ -87,13 +92,17 @@ template<class T, class K> Player<T, K>::Player(Scaler scaler): _scaler{scaler}
 template<class T, class K> Player<T, K>::~Player() = default;
 
 template<class T, class K> bool Player<T, K>::isEmpty() const {
-    return _tracks.empty();
+    return _tracks.empty() && _batches.empty();
 }
 
 template<class T, class K> std::size_t Player<T, K>::size() const {
     return _tracks.size();
 }
 
+template<class T, class K> std::size_t Player<T, K>::batchCount() const {
+    return _batches.size();
+}
+
 template<class T, class K> const TrackViewStorage<const K>& Player<T, K>::track(std::size_t i) const {
     CORRADE_ASSERT(i < _tracks.size(),
         /* Returning track 0 so we can test this w/ MSVC debug iterators */
@@ -102,7 +111,7 @@ template<class T, class K> const TrackViewStorage<const K>& Player<T, K>::track(
 }
 
 template<class T, class K> Player<T, K>& Player<T, K>::addInternal(const TrackViewStorage<const K>& track, void(*const advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* const destination, void(*const userCallback)(), void* const userCallbackData) {
-    if(_tracks.empty() && _duration == Math::Range1D<K>{})
+    if(isEmpty() && _duration == Math::Range1D<K>{})
         _duration = track.duration();
     else
         _duration = Math::join(track.duration(), _duration);
@@ -110,6 +119,15 @@ template<class T, class K> Player<T, K>& Player<T, K>::addInternal(const TrackVi
     return *this;
 }
 
+template<class T, class K> Player<T, K>& Player<T, K>::addBatchInternal(const Math::Range1D<K>& duration, void* const batch, void(*const advancer)(void*, K)) {
+    if(isEmpty() && _duration == Math::Range1D<K>{})
+        _duration = duration;
+    else
+        _duration = Math::join(duration, _duration);
+    arrayAppend(_batches, Batch{batch, advancer});
+    return *this;
+}
+
 template<class T, class K> Player<T, K>& Player<T, K>::play(T startTime) {
     /* In case we were paused, move start time backwards by the duration that
        was already played back */
@@ -302,8 +320,11 @@ template<class T, class K> Player<T, K>& Player<T, K>::advance(const T time) {
     if(!elapsed) return *this;
 
     /* Advance all tracks. Properly handle durations that don't start at 0. */
+    const K key = _duration.min() + elapsed->second;
     for(Track& t: _tracks)
-        t.advancer(t.track, _duration.min() + elapsed->second, t.hint, t.destination, t.userCallback, t.userCallbackData);
+        t.advancer(t.track, key, t.hint, t.destination, t.userCallback, t.userCallbackData);
+    for(Batch& b: _batches)
+        b.advancer(b.batch, key);
 
     return *this;
 }
@@ -26,6 +26,8 @@
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Animation/Player.h"
+#include "Magnum/Animation/TrackBatch.h"
+#include "Magnum/Math/Vector3.h"
 
 namespace Magnum { namespace Animation { namespace Test { namespace {
 
@@ -39,6 +41,8 @@ struct Benchmark: TestSuite::Tester {
     void atEmpty();
     void at();
     void atHint();
+    void atHintReverse();
+    void atHintReverseNonUniform();
     void atStrict();
     void atStrictInterleaved();
     void atStrictInterleavedDirectInterpolator();
@@ -50,17 +54,28 @@ struct Benchmark: TestSuite::Tester {
     void playerAdvanceRawCallback();
     void playerAdvanceRawCallbackDirectInterpolator();
 
+    void playerAdvanceManyTracks();
+    void playerAdvanceManyTracksBatch();
+    void trackBatchAdvance();
+
     Containers::Array<Float> _keys;
+    Containers::Array<Float> _keysNonUniform;
     Containers::Array<Int> _values;
     Containers::Array<std::pair<Float, Int>> _interleaved;
     Containers::StridedArrayView1D<const Float> _keysInterleaved;
     Containers::StridedArrayView1D<const Int> _valuesInterleaved;
     TrackView<const Float, const Int> _track;
+    TrackView<const Float, const Int> _trackNonUniform;
     TrackView<const Float, const Int> _trackInterleaved;
+    Containers::Array<Vector3> _vectorValues;
+    TrackView<const Float, const Vector3> _vectorTrack;
 };
 
 namespace {
     enum: std::size_t { DataSize = 2000 };
+    /* The many-track benchmarks measure advancing TrackCount tracks at once,
+       divide the result by TrackCount to get a per-track cost */
+    enum: std::size_t { TrackCount = 1000 };
 }
 
 Benchmark::Benchmark() {
@@ -71,6 +86,8 @@ Benchmark::Benchmark() {
                    &Benchmark::atEmpty,
                    &Benchmark::at,
                    &Benchmark::atHint,
+                   &Benchmark::atHintReverse,
+                   &Benchmark::atHintReverseNonUniform,
                    &Benchmark::atStrict,
                    &Benchmark::atStrictInterleaved,
                    &Benchmark::atStrictInterleavedDirectInterpolator,
@@ -80,7 +97,11 @@ Benchmark::Benchmark() {
                    &Benchmark::playerAdvance,
                    &Benchmark::playerAdvanceCallback,
                    &Benchmark::playerAdvanceRawCallback,
-                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator}, 10);
+                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator,
+
+                   &Benchmark::playerAdvanceManyTracks,
+                   &Benchmark::playerAdvanceManyTracksBatch,
+                   &Benchmark::trackBatchAdvance}, 10);
 
     _keys = Containers::Array<Float>{DataSize};
     _values = Containers::Array<Int>{Containers::DirectInit, DataSize, 1};
@@ -88,12 +109,27 @@ Benchmark::Benchmark() {
     for(std::size_t i = 0; i != DataSize; ++i)
         _keys[i] = _interleaved[i].first = Float(i)*3.1254f;
 
+    /* Keyframes getting sparser over time, so the uniform position guess
+       fails and binary search is used */
+    _keysNonUniform = Containers::Array<Float>{DataSize};
+    for(std::size_t i = 0; i != DataSize; ++i)
+        _keysNonUniform[i] = Float(i*i)*0.0015f;
+
     _keysInterleaved = {_interleaved, &_interleaved[0].first, _interleaved.size(), sizeof(std::pair<Float, Int>)};
     _valuesInterleaved = {_interleaved, &_interleaved[0].second, _interleaved.size(), sizeof(std::pair<Float, Int>)};
 
     _track = TrackView<const Float, const Int>{
         Containers::arrayView(_keys), Containers::arrayView(_values), Math::select};
+    _trackNonUniform = TrackView<const Float, const Int>{
+        Containers::arrayView(_keysNonUniform), Containers::arrayView(_values), Math::select};
     _trackInterleaved = {_keysInterleaved, _valuesInterleaved, Math::select};
+
+    _vectorValues = Containers::Array<Vector3>{Containers::NoInit, DataSize};
+    for(std::size_t i = 0; i != DataSize; ++i)
+        _vectorValues[i] = Vector3{Float(i), Float(i%7), -Float(i%3)};
+    _vectorTrack = TrackView<const Float, const Vector3>{
+        Containers::arrayView(_keys), Containers::arrayView(_vectorValues),
+        Interpolation::Linear};
 }
 
 void Benchmark::interpolateEmpty() {
@@ -154,6 +190,26 @@ void Benchmark::atHint() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::atHintReverse() {
+    Int result{};
+    CORRADE_BENCHMARK(250) {
+        std::size_t hint{};
+        for(Float i = 499.0f; i >= 0.0f; i -= 1.0f)
+            result += _track.at(i, hint);
+    }
+    CORRADE_COMPARE(result, 125000);
+}
+
+void Benchmark::atHintReverseNonUniform() {
+    Int result{};
+    CORRADE_BENCHMARK(250) {
+        std::size_t hint{};
+        for(Float i = 499.0f; i >= 0.0f; i -= 1.0f)
+            result += _trackNonUniform.at(i, hint);
+    }
+    CORRADE_COMPARE(result, 125000);
+}
+
 void Benchmark::atStrict() {
     Int result{};
     CORRADE_BENCHMARK(250) {
@@ -260,6 +316,52 @@ void Benchmark::playerAdvanceRawCallbackDirectInterpolator() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::playerAdvanceManyTracks() {
+    Containers::Array<Vector3> results{TrackCount};
+    Player<Float> player;
+    for(std::size_t i = 0; i != TrackCount; ++i)
+        player.add(_vectorTrack, results[i]);
+    player.setPlayCount(0)
+        .play({});
+
+    Float time = 0.0f;
+    CORRADE_BENCHMARK(50)
+        player.advance(time += 0.125f);
+
+    CORRADE_COMPARE(results[0], _vectorTrack.at(time));
+    CORRADE_COMPARE(results[TrackCount - 1], _vectorTrack.at(time));
+}
+
+void Benchmark::playerAdvanceManyTracksBatch() {
+    TrackBatch<Float, Vector3> batch;
+    for(std::size_t i = 0; i != TrackCount; ++i)
+        batch.add(_vectorTrack);
+    Player<Float> player;
+    player.addBatch(batch)
+        .setPlayCount(0)
+        .play({});
+
+    Float time = 0.0f;
+    CORRADE_BENCHMARK(50)
+        player.advance(time += 0.125f);
+
+    CORRADE_COMPARE(batch.results()[0], _vectorTrack.at(time));
+    CORRADE_COMPARE(batch.results()[TrackCount - 1], _vectorTrack.at(time));
+}
+
+void Benchmark::trackBatchAdvance() {
+    TrackBatch<Float, Vector3> batch;
+    for(std::size_t i = 0; i != TrackCount; ++i)
+        batch.add(_vectorTrack);
+
+    Float time = 0.0f;
+    CORRADE_BENCHMARK(50)
+        batch.advance(time += 0.125f);
+
+    CORRADE_COMPARE(batch.results()[0], _vectorTrack.at(time));
+    CORRADE_COMPARE(batch.results()[TrackCount - 1], _vectorTrack.at(time));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Animation::Test::Benchmark)
@@ -0,0 +1,383 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Animation/Compression.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct CompressionTest: TestSuite::Tester {
+    explicit CompressionTest();
+
+    void packSmallestThree();
+    void packSmallestThreeExact();
+    void packSmallestThreeNotNormalized();
+    void interpolateSmallestThree();
+    void interpolateNormalized();
+
+    void reduceKeyframes();
+    void reduceKeyframesQuaternion();
+    void reduceKeyframesConstant();
+    void reduceKeyframesLongRun();
+    void reduceKeyframesEmpty();
+
+    void quantizeRotations();
+    void quantizeRotationsConstant();
+    void quantizeRotationsInvalidInterpolation();
+    void quantizeVectors();
+    void quantizeVectorsConstant();
+    void quantizeVectorsEmpty();
+    void quantizeVectorsInvalidInterpolation();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    Quaternion value;
+} PackSmallestThreeData[] {
+    {"largest W", Quaternion::rotation(35.0_degf, Vector3::xAxis())},
+    {"largest Z", Quaternion::rotation(130.0_degf, Vector3{1.0f, 2.0f, 3.0f}.normalized())},
+    {"largest Z, negative", -Quaternion::rotation(130.0_degf, Vector3{1.0f, 2.0f, 3.0f}.normalized())},
+    {"largest X, negative", Quaternion{{-0.8f, 0.36f, 0.48f}, 0.0f}},
+    {"largest Y and W", Quaternion{{0.1f, -0.7f, 0.1f}, 0.7f}}
+};
+
+CompressionTest::CompressionTest() {
+    addInstancedTests({&CompressionTest::packSmallestThree},
+        Containers::arraySize(PackSmallestThreeData));
+
+    addTests({&CompressionTest::packSmallestThreeExact,
+              &CompressionTest::packSmallestThreeNotNormalized,
+              &CompressionTest::interpolateSmallestThree,
+              &CompressionTest::interpolateNormalized,
+
+              &CompressionTest::reduceKeyframes,
+              &CompressionTest::reduceKeyframesQuaternion,
+              &CompressionTest::reduceKeyframesConstant,
+              &CompressionTest::reduceKeyframesLongRun,
+              &CompressionTest::reduceKeyframesEmpty,
+
+              &CompressionTest::quantizeRotations,
+              &CompressionTest::quantizeRotationsConstant,
+              &CompressionTest::quantizeRotationsInvalidInterpolation,
+              &CompressionTest::quantizeVectors,
+              &CompressionTest::quantizeVectorsConstant,
+              &CompressionTest::quantizeVectorsEmpty,
+              &CompressionTest::quantizeVectorsInvalidInterpolation});
+}
+
+void CompressionTest::packSmallestThree() {
+    auto&& data = PackSmallestThreeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    CORRADE_VERIFY(data.value.isNormalized());
+    const Quaternion unpacked = unpackSmallestThree(Animation::packSmallestThree(data.value));
+    CORRADE_VERIFY(unpacked.isNormalized());
+
+    /* The sign may get flipped, but it's still the same rotation */
+    CORRADE_COMPARE(Math::abs(Math::dot(unpacked, data.value)), 1.0f);
+    CORRADE_COMPARE_AS(Math::min((unpacked - data.value).length(), (unpacked + data.value).length()), 5.0e-5f, TestSuite::Compare::LessOrEqual);
+}
+
+void CompressionTest::packSmallestThreeExact() {
+    /* Index of the largest component in the top bits of the first two
+       components, zero exactly representable */
+    CORRADE_COMPARE(Animation::packSmallestThree(Quaternion{}), (Vector3us{49151, 49151, 16383}));
+    CORRADE_COMPARE(Animation::packSmallestThree(Quaternion{{1.0f, 0.0f, 0.0f}, 0.0f}), (Vector3us{16383, 16383, 16383}));
+    CORRADE_COMPARE(Animation::packSmallestThree(Quaternion{{0.0f, 0.0f, -1.0f}, 0.0f}), (Vector3us{16383, 49151, 16383}));
+
+    CORRADE_COMPARE(unpackSmallestThree({49151, 49151, 16383}), Quaternion{});
+    CORRADE_COMPARE(unpackSmallestThree({16383, 16383, 16383}), (Quaternion{{1.0f, 0.0f, 0.0f}, 0.0f}));
+    CORRADE_COMPARE(unpackSmallestThree({16383, 49151, 16383}), (Quaternion{{0.0f, 0.0f, 1.0f}, 0.0f}));
+}
+
+void CompressionTest::packSmallestThreeNotNormalized() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Animation::packSmallestThree(Quaternion{{1.0f, 2.0f, 3.0f}, 4.0f});
+    CORRADE_COMPARE(out.str(), "Animation::packSmallestThree(): Quaternion({1, 2, 3}, 4) is not normalized\n");
+}
+
+void CompressionTest::interpolateSmallestThree() {
+    const Vector3us a = Animation::packSmallestThree(Quaternion::rotation(35.0_degf, Vector3::xAxis()));
+    const Vector3us b = Animation::packSmallestThree(-Quaternion::rotation(130.0_degf, Vector3{1.0f, 2.0f, 3.0f}.normalized()));
+
+    CORRADE_COMPARE(selectSmallestThree(a, b, 0.7f), unpackSmallestThree(a));
+    CORRADE_COMPARE(selectSmallestThree(a, b, 1.0f), unpackSmallestThree(b));
+    CORRADE_COMPARE(lerpSmallestThree(a, b, 0.3f),
+        Math::lerpShortestPath(unpackSmallestThree(a), unpackSmallestThree(b), 0.3f));
+    CORRADE_COMPARE(slerpSmallestThree(a, b, 0.3f),
+        Math::slerpShortestPath(unpackSmallestThree(a), unpackSmallestThree(b), 0.3f));
+}
+
+void CompressionTest::interpolateNormalized() {
+    const Vector3us a{0, 65535, 32768};
+    const Vector3us b{65535, 0, 32768};
+
+    CORRADE_COMPARE(selectNormalized(a, b, 0.5f), (Vector3{0.0f, 1.0f, 0.500008f}));
+    CORRADE_COMPARE(selectNormalized(a, b, 1.0f), (Vector3{1.0f, 0.0f, 0.500008f}));
+    CORRADE_COMPARE(lerpNormalized(a, b, 0.25f), (Vector3{0.25f, 0.75f, 0.500008f}));
+}
+
+void CompressionTest::reduceKeyframes() {
+    const Track<Float, Vector3> track{{
+        {0.0f, {0.0f, 0.0f, 0.0f}},
+        {1.0f, {1.0f, 0.0f, 0.0f}},
+        {2.0f, {2.0f, 0.0f, 0.0f}},
+        {3.0f, {3.0f, 0.0f, 0.0f}},
+        {4.0f, {3.0f, 1.0f, 0.0f}},
+        {5.0f, {3.0f, 2.0005f, 0.0f}},
+        {6.0f, {3.0f, 3.0f, 0.0f}}
+    }, Interpolation::Linear, Extrapolation::Extrapolated, Extrapolation::Constant};
+
+    /* The slight deviation at 5.0 is within the tolerance */
+    Track<Float, Vector3> reduced = Animation::reduceKeyframes(track, 0.001f);
+    CORRADE_COMPARE(reduced.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(reduced.interpolator(), track.interpolator());
+    CORRADE_COMPARE(reduced.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(reduced.after(), Extrapolation::Constant);
+    CORRADE_COMPARE(reduced.duration(), track.duration());
+    CORRADE_COMPARE_AS(reduced.keys(), Containers::arrayView<Float>({
+        0.0f, 3.0f, 6.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(reduced.values(), Containers::arrayView<Vector3>({
+        {0.0f, 0.0f, 0.0f},
+        {3.0f, 0.0f, 0.0f},
+        {3.0f, 3.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(reduced.at(1.5f), (Vector3{1.5f, 0.0f, 0.0f}));
+
+    /* With a smaller tolerance it's kept */
+    Track<Float, Vector3> reducedLess = Animation::reduceKeyframes(track, 0.0001f);
+    CORRADE_COMPARE_AS(reducedLess.keys(), Containers::arrayView<Float>({
+        0.0f, 3.0f, 4.0f, 5.0f, 6.0f
+    }), TestSuite::Compare::Container);
+
+    /* The view overload should give the same result */
+    Track<Float, Vector3> reducedView = Animation::reduceKeyframes(TrackView<const Float, const Vector3>{track}, 0.001f);
+    CORRADE_COMPARE_AS(reducedView.keys(), reduced.keys(), TestSuite::Compare::Container);
+}
+
+void CompressionTest::reduceKeyframesQuaternion() {
+    const Track<Float, Quaternion> track{{
+        {0.0f, Quaternion::rotation(0.0_degf, Vector3::xAxis())},
+        {1.0f, Quaternion::rotation(10.0_degf, Vector3::xAxis())},
+        {2.0f, Quaternion::rotation(20.0_degf, Vector3::xAxis())},
+        {3.0f, Quaternion::rotation(40.0_degf, Vector3::xAxis())}
+    }, Interpolation::Linear};
+
+    /* The tolerance is an angle in radians */
+    Track<Float, Quaternion> reduced = Animation::reduceKeyframes(track, Float(Rad(0.01_degf)));
+    CORRADE_COMPARE_AS(reduced.keys(), Containers::arrayView<Float>({
+        0.0f, 2.0f, 3.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(reduced.at(0.5f), Quaternion::rotation(5.0_degf, Vector3::xAxis()));
+
+    /* A tolerance larger than the 3.33° difference drops the middle as
+       well */
+    Track<Float, Quaternion> reducedMore = Animation::reduceKeyframes(track, Float(Rad(4.0_degf)));
+    CORRADE_COMPARE_AS(reducedMore.keys(), Containers::arrayView<Float>({
+        0.0f, 3.0f
+    }), TestSuite::Compare::Container);
+}
+
+void CompressionTest::reduceKeyframesConstant() {
+    const Track<Float, Float> track{{
+        {0.0f, 1.0f},
+        {1.0f, 1.0f},
+        {2.0f, 2.0f},
+        {3.0f, 2.0f},
+        {4.0f, 2.0f}
+    }, Interpolation::Constant};
+
+    Track<Float, Float> reduced = Animation::reduceKeyframes(track, 0.0f);
+    CORRADE_COMPARE_AS(reduced.keys(), Containers::arrayView<Float>({
+        0.0f, 2.0f, 4.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(reduced.values(), Containers::arrayView<Float>({
+        1.0f, 2.0f, 2.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(reduced.at(1.5f), 1.0f);
+    CORRADE_COMPARE(reduced.at(3.5f), 2.0f);
+}
+
+void CompressionTest::reduceKeyframesLongRun() {
+    /* A long constant run that could be reduced to just the endpoints */
+    Containers::Array<std::pair<Float, Float>> data{200};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {Float(i), 3.0f};
+    const Track<Float, Float> track{std::move(data), Interpolation::Constant};
+
+    /* The distance between kept keyframes is limited to keep the reduction
+       from being quadratic */
+    Track<Float, Float> reduced = Animation::reduceKeyframes(track, 0.0f);
+    CORRADE_COMPARE_AS(reduced.keys(), Containers::arrayView<Float>({
+        0.0f, 64.0f, 128.0f, 192.0f, 199.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(reduced.at(100.0f), 3.0f);
+}
+
+void CompressionTest::reduceKeyframesEmpty() {
+    Track<Float, Float> empty = Animation::reduceKeyframes(Track<Float, Float>{nullptr, Math::lerp}, 0.1f);
+    CORRADE_VERIFY(empty.keys().empty());
+
+    Track<Float, Float> single = Animation::reduceKeyframes(Track<Float, Float>{{{1.5f, 3.0f}}, Math::lerp}, 0.1f);
+    CORRADE_COMPARE_AS(single.keys(), Containers::arrayView<Float>({
+        1.5f
+    }), TestSuite::Compare::Container);
+}
+
+void CompressionTest::quantizeRotations() {
+    const Quaternion a = Quaternion::rotation(35.0_degf, Vector3::xAxis());
+    const Quaternion b = Quaternion::rotation(130.0_degf, Vector3{1.0f, 2.0f, 3.0f}.normalized());
+    const Track<Float, Quaternion> track{{
+        {0.0f, a},
+        {2.0f, b}
+    }, Interpolation::Linear, Extrapolation::Extrapolated, Extrapolation::DefaultConstructed};
+
+    Track<Float, Vector3us, Quaternion> quantized = Animation::quantizeRotations(track);
+    CORRADE_COMPARE(quantized.interpolation(), Interpolation::Linear);
+    CORRADE_VERIFY(quantized.interpolator() == slerpSmallestThree);
+    CORRADE_COMPARE(quantized.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(quantized.after(), Extrapolation::DefaultConstructed);
+    CORRADE_COMPARE_AS(quantized.keys(), Containers::arrayView<Float>({
+        0.0f, 2.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(quantized.values(), Containers::arrayView<Vector3us>({
+        Animation::packSmallestThree(a),
+        Animation::packSmallestThree(b)
+    }), TestSuite::Compare::Container);
+
+    /* Decoded on the fly, close to the original */
+    CORRADE_COMPARE(Math::abs(Math::dot(quantized.at(0.5f), track.at(0.5f))), 1.0f);
+}
+
+void CompressionTest::quantizeRotationsConstant() {
+    const Track<Float, Quaternion> track{{
+        {0.0f, Quaternion::rotation(35.0_degf, Vector3::xAxis())},
+        {2.0f, Quaternion{}}
+    }, Interpolation::Constant};
+
+    Track<Float, Vector3us, Quaternion> quantized = Animation::quantizeRotations(TrackView<const Float, const Quaternion>{track});
+    CORRADE_COMPARE(quantized.interpolation(), Interpolation::Constant);
+    CORRADE_VERIFY(quantized.interpolator() == selectSmallestThree);
+    CORRADE_COMPARE(quantized.at(2.5f), Quaternion{});
+}
+
+void CompressionTest::quantizeRotationsInvalidInterpolation() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Track<Float, Quaternion> track{{
+        {0.0f, Quaternion{}},
+        {2.0f, Quaternion{}}
+    }, Math::slerp};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Animation::quantizeRotations(track);
+    CORRADE_COMPARE(out.str(), "Animation::quantizeRotations(): can't quantize a track with Animation::Interpolation::Custom\n");
+}
+
+void CompressionTest::quantizeVectors() {
+    const Track<Float, Vector3> track{{
+        {0.0f, {1.0f, -2.0f, 5.0f}},
+        {1.0f, {3.0f, -2.0f, 7.0f}},
+        {2.0f, {2.0f, -2.0f, 6.0f}}
+    }, Interpolation::Linear, Extrapolation::Constant, Extrapolation::Extrapolated};
+
+    Range3D range;
+    Track<Float, Vector3us, Vector3> quantized = Animation::quantizeVectors(track, range);
+    CORRADE_COMPARE(range, (Range3D{{1.0f, -2.0f, 5.0f}, {3.0f, -2.0f, 7.0f}}));
+    CORRADE_COMPARE(quantized.interpolation(), Interpolation::Linear);
+    CORRADE_VERIFY(quantized.interpolator() == lerpNormalized);
+    CORRADE_COMPARE(quantized.before(), Extrapolation::Constant);
+    CORRADE_COMPARE(quantized.after(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE_AS(quantized.keys(), Containers::arrayView<Float>({
+        0.0f, 1.0f, 2.0f
+    }), TestSuite::Compare::Container);
+    /* Components that don't change are packed to zero */
+    CORRADE_COMPARE_AS(quantized.values(), Containers::arrayView<Vector3us>({
+        {0, 0, 0},
+        {65535, 0, 65535},
+        {32768, 0, 32768}
+    }), TestSuite::Compare::Container);
+
+    /* Scaled back, it's the same as the original */
+    CORRADE_COMPARE(range.min() + quantized.at(0.5f)*range.size(), track.at(0.5f));
+}
+
+void CompressionTest::quantizeVectorsConstant() {
+    const Track<Float, Vector3> track{{
+        {0.0f, {1.0f, -2.0f, 5.0f}},
+        {1.0f, {3.0f, -2.0f, 7.0f}}
+    }, Interpolation::Constant};
+
+    Range3D range;
+    Track<Float, Vector3us, Vector3> quantized = Animation::quantizeVectors(TrackView<const Float, const Vector3>{track}, range);
+    CORRADE_COMPARE(quantized.interpolation(), Interpolation::Constant);
+    CORRADE_VERIFY(quantized.interpolator() == selectNormalized);
+    CORRADE_COMPARE(range.min() + quantized.at(0.5f)*range.size(), (Vector3{1.0f, -2.0f, 5.0f}));
+}
+
+void CompressionTest::quantizeVectorsEmpty() {
+    Range3D range{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}};
+    Track<Float, Vector3us, Vector3> quantized = Animation::quantizeVectors(Track<Float, Vector3>{nullptr, Interpolation::Linear}, range);
+    CORRADE_VERIFY(quantized.keys().empty());
+    CORRADE_COMPARE(range, Range3D{});
+}
+
+void CompressionTest::quantizeVectorsInvalidInterpolation() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Track<Float, Vector3> track{{
+        {0.0f, Vector3{}},
+        {2.0f, Vector3{}}
+    }, Math::lerp};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Range3D range;
+    Animation::quantizeVectors(track, range);
+    CORRADE_COMPARE(out.str(), "Animation::quantizeVectors(): can't quantize a track with Animation::Interpolation::Custom\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::CompressionTest)
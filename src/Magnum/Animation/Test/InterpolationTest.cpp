@@ -68,6 +68,7 @@ struct InterpolationTest: TestSuite::Tester {
 
     void interpolateHint();
     void interpolateStrictHint();
+    void interpolateSearch();
 
     void interpolateDifferentResultType();
     void interpolateStrictDifferentResultType();
@@ -146,6 +147,18 @@ const struct {
         Extrapolation::Extrapolated, 1.0f, 3.0f}
 };
 
+const Float UniformKeys[]{0.0f, 0.5f, 1.0f, 1.5f, 2.0f, 2.5f, 3.0f, 3.5f, 4.0f, 4.5f, 5.0f, 5.5f};
+const Float NonUniformKeys[]{0.0f, 0.125f, 1.0f, 1.25f, 1.5f, 3.0f, 3.0f, 3.5f, 4.75f, 5.0f, 5.25f, 5.5f};
+const Float SearchValues[]{3.0f, 1.0f, 2.5f, 0.5f, 7.0f, -1.0f, 2.0f, 4.0f, 3.5f, 0.0f, 1.5f, 6.0f};
+
+const struct {
+    const char* name;
+    Containers::ArrayView<const Float> keys;
+} SearchData[] {
+    {"uniform", UniformKeys},
+    {"non-uniform", NonUniformKeys}
+};
+
 const struct {
     const char* name;
     std::size_t hint;
@@ -191,6 +204,9 @@ InterpolationTest::InterpolationTest() {
                        &InterpolationTest::interpolateStrictHint},
                        Containers::arraySize(HintData));
 
+    addInstancedTests({&InterpolationTest::interpolateSearch},
+        Containers::arraySize(SearchData));
+
     addTests({&InterpolationTest::interpolateDifferentResultType,
               &InterpolationTest::interpolateStrictDifferentResultType,
 
@@ -518,6 +534,31 @@ void InterpolationTest::interpolateStrictHint() {
     CORRADE_COMPARE(hint, 2);
 }
 
+void InterpolationTest::interpolateSearch() {
+    auto&& data = SearchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Going back and forth and jumping over many keyframes at once, the
+       result should be always the same as with a linear search from the
+       beginning */
+    const Float frames[]{5.3f, 0.1f, 3.0f, -1.0f, 2.9f, 7.0f, 1.25f, 1.3f, 4.8f, 0.0f, 5.5f, 3.25f};
+    std::size_t hint{};
+    for(Float frame: frames) {
+        CORRADE_ITERATION(frame);
+
+        std::size_t expected = 0;
+        while(expected + 2 < data.keys.size() && frame >= data.keys[expected + 1])
+            ++expected;
+
+        CORRADE_COMPARE((Animation::interpolate<Float, Float>(
+            data.keys, SearchValues, Extrapolation::Extrapolated,
+            Extrapolation::Extrapolated, Math::lerp, frame, hint)),
+            Math::lerp(SearchValues[expected], SearchValues[expected + 1],
+                Math::lerpInverted(data.keys[expected], data.keys[expected + 1], frame)));
+        CORRADE_COMPARE(hint, expected);
+    }
+}
+
 using namespace Math::Literals;
 
 const Half HalfValues[]{3.0_h, 1.0_h, 2.5_h, 0.5_h};
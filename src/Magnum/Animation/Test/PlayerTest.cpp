@@ -32,6 +32,7 @@
 #include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/Animation/Player.h"
+#include "Magnum/Animation/TrackBatch.h"
 
 namespace Magnum { namespace Animation { namespace Test { namespace {
 
@@ -86,6 +87,7 @@ struct PlayerTest: TestSuite::Tester {
     template<class T> void addWithCallbackOnChange();
     template<class T> void addWithCallbackOnChangeTemplate();
     template<class T> void addRawCallback();
+    void addBatch();
 
     void runFor100YearsFloat();
     void runFor100YearsChrono();
@@ -181,7 +183,8 @@ PlayerTest::PlayerTest() {
               &PlayerTest::addWithCallbackOnChangeTemplate<Track<Float, Float>>,
               &PlayerTest::addWithCallbackOnChangeTemplate<TrackView<Float, Float>>,
               &PlayerTest::addRawCallback<Track<Float, Float>>,
-              &PlayerTest::addRawCallback<TrackView<Float, Float>>});
+              &PlayerTest::addRawCallback<TrackView<Float, Float>>,
+              &PlayerTest::addBatch});
 
     addInstancedTests({
         &PlayerTest::runFor100YearsFloat,
@@ -1330,6 +1333,47 @@ template<class T> void PlayerTest::addRawCallback() {
         TestSuite::Compare::Container);
 }
 
+void PlayerTest::addBatch() {
+    const Animation::Track<Float, Float> track2{{
+        {2.0f, 0.0f},
+        {6.0f, 8.0f}
+    }, Math::lerp};
+
+    TrackBatch<Float, Float> batch;
+    batch.add(Track)
+         .add(track2);
+
+    Float value = -1.0f;
+    Player<Float> player;
+    CORRADE_VERIFY(player.isEmpty());
+    player.addBatch(batch);
+    CORRADE_VERIFY(!player.isEmpty());
+    CORRADE_COMPARE(player.size(), 0);
+    CORRADE_COMPARE(player.batchCount(), 1);
+    CORRADE_COMPARE(player.duration(), (Range1D{1.0f, 6.0f}));
+
+    /* Duration of tracks added later gets joined with the batch one */
+    player.add(Track, value)
+        .play(2.0f);
+    CORRADE_COMPARE(player.size(), 1);
+    CORRADE_COMPARE(player.duration(), (Range1D{1.0f, 6.0f}));
+
+    /* 1.75 secs in, which is 2.75 in the track range */
+    player.advance(3.75f);
+    CORRADE_COMPARE(player.state(), State::Playing);
+    CORRADE_COMPARE(value, 4.0f);
+    CORRADE_COMPARE(batch.results()[0], 4.0f);
+    CORRADE_COMPARE(batch.results()[1], 1.5f);
+
+    /* After the animation runs out, the batch gets parked at the end as
+       well */
+    player.advance(10.0f);
+    CORRADE_COMPARE(player.state(), State::Stopped);
+    CORRADE_COMPARE(value, 2.0f);
+    CORRADE_COMPARE(batch.results()[0], 2.0f);
+    CORRADE_COMPARE(batch.results()[1], 8.0f);
+}
+
 void PlayerTest::runFor100YearsFloat() {
     auto&& data = RunFor100YearsData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -0,0 +1,384 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Animation/TrackBatch.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct TrackBatchTest: TestSuite::Tester {
+    explicit TrackBatchTest();
+
+    void constructEmpty();
+    void constructMove();
+
+    void add();
+    void addDifferentInterpolator();
+    void addDifferentExtrapolation();
+    void addEmpty();
+    void addSizeMismatch();
+
+    void advanceLerp();
+    void advanceLerpVector();
+    void advanceSlerp();
+    void advanceCustomInterpolator();
+    void advanceSingleKeyframe();
+    void advanceBackwards();
+};
+
+const struct {
+    const char* name;
+    Extrapolation extrapolationBefore;
+    Extrapolation extrapolationAfter;
+} AdvanceData[] {
+    {"default-constructed", Extrapolation::DefaultConstructed, Extrapolation::DefaultConstructed},
+    {"constant", Extrapolation::Constant, Extrapolation::Constant},
+    {"extrapolated", Extrapolation::Extrapolated, Extrapolation::Extrapolated},
+    {"constant before, default-constructed after", Extrapolation::Constant, Extrapolation::DefaultConstructed}
+};
+
+TrackBatchTest::TrackBatchTest() {
+    addTests({&TrackBatchTest::constructEmpty,
+              &TrackBatchTest::constructMove,
+
+              &TrackBatchTest::add,
+              &TrackBatchTest::addDifferentInterpolator,
+              &TrackBatchTest::addDifferentExtrapolation,
+              &TrackBatchTest::addEmpty,
+              &TrackBatchTest::addSizeMismatch});
+
+    addInstancedTests({&TrackBatchTest::advanceLerp,
+                       &TrackBatchTest::advanceLerpVector,
+                       &TrackBatchTest::advanceSlerp,
+                       &TrackBatchTest::advanceCustomInterpolator},
+        Containers::arraySize(AdvanceData));
+
+    addTests({&TrackBatchTest::advanceSingleKeyframe,
+              &TrackBatchTest::advanceBackwards});
+}
+
+using namespace Math::Literals;
+
+/* Tracks of varying lengths and ranges, seven of them so the vectorized code
+   has a remainder to process in the scalar loop as well */
+const Float Keys[]{0.0f, 1.0f, 2.5f, 3.0f, 4.0f, 5.5f};
+const Float Keys2[]{-1.0f, 2.0f, 4.5f};
+const Float Keys3[]{1.5f, 2.0f};
+const Float Values[]{1.5f, 3.0f, 5.0f, 2.0f, -1.0f, 0.5f};
+
+const Float Times[]{-2.0f, -1.0f, 0.25f, 1.0f, 1.75f, 2.75f, 4.5f, 5.5f, 7.0f};
+
+void TrackBatchTest::constructEmpty() {
+    TrackBatch<Float, Vector3> batch;
+    CORRADE_VERIFY(!batch.interpolator());
+    CORRADE_VERIFY(batch.isEmpty());
+    CORRADE_COMPARE(batch.size(), 0);
+    CORRADE_COMPARE(batch.duration(), Range1D{});
+    CORRADE_VERIFY(batch.results().empty());
+
+    /* Advancing an empty batch should do nothing */
+    batch.advance(1.0f);
+    CORRADE_VERIFY(batch.results().empty());
+}
+
+void TrackBatchTest::constructMove() {
+    TrackBatch<Float, Float> a;
+    a.add(TrackView<const Float, const Float>{Keys, Values, Math::lerp});
+
+    TrackBatch<Float, Float> b{std::move(a)};
+    CORRADE_COMPARE(b.size(), 1);
+    CORRADE_COMPARE(b.duration(), (Range1D{0.0f, 5.5f}));
+
+    TrackBatch<Float, Float> c;
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), 1);
+    CORRADE_COMPARE(c.duration(), (Range1D{0.0f, 5.5f}));
+
+    c.advance(1.75f);
+    CORRADE_COMPARE(c.results()[0], 4.0f);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<TrackBatch<Float, Float>>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<TrackBatch<Float, Float>>::value);
+}
+
+void TrackBatchTest::add() {
+    const Track<Float, Float> track{{
+        {1.0f, 1.5f},
+        {2.5f, 3.0f}
+    }, Interpolation::Linear, Extrapolation::Extrapolated, Extrapolation::Constant};
+    Float keys[]{-0.5f, 2.0f};
+    Float values[]{3.0f, 1.0f};
+
+    TrackBatch<Float, Float> batch;
+    batch.add(track)
+        .add(TrackView<Float, Float>{keys, values, Interpolation::Linear, Extrapolation::Extrapolated, Extrapolation::Constant})
+        .add(TrackView<const Float, const Float>{Keys, Values, Interpolation::Linear, Extrapolation::Extrapolated, Extrapolation::Constant});
+    CORRADE_VERIFY(!batch.isEmpty());
+    CORRADE_COMPARE(batch.size(), 3);
+    CORRADE_COMPARE(batch.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(batch.interpolator(), track.interpolator());
+    CORRADE_COMPARE(batch.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(batch.after(), Extrapolation::Constant);
+    CORRADE_COMPARE(batch.duration(), (Range1D{-0.5f, 5.5f}));
+
+    /* Results are default-constructed until advanced */
+    CORRADE_COMPARE(batch.results().size(), 3);
+    CORRADE_COMPARE(batch.results()[0], 0.0f);
+    CORRADE_COMPARE(batch.results()[1], 0.0f);
+    CORRADE_COMPARE(batch.results()[2], 0.0f);
+
+    batch.advance(1.75f);
+    CORRADE_COMPARE(batch.results()[0], 2.25f);
+    CORRADE_COMPARE(batch.results()[1], 1.2f);
+    CORRADE_COMPARE(batch.results()[2], 4.0f);
+}
+
+void TrackBatchTest::addDifferentInterpolator() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    TrackBatch<Float, Float> batch;
+    batch.add(TrackView<const Float, const Float>{Keys, Values, Math::lerp});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    batch.add(TrackView<const Float, const Float>{Keys, Values, Math::select});
+    CORRADE_COMPARE(batch.size(), 1);
+    CORRADE_COMPARE(out.str(), "Animation::TrackBatch::add(): expected the same interpolator and extrapolation for all tracks\n");
+}
+
+void TrackBatchTest::addDifferentExtrapolation() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    TrackBatch<Float, Float> batch;
+    batch.add(TrackView<const Float, const Float>{Keys, Values, Math::lerp, Extrapolation::Constant});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    batch.add(TrackView<const Float, const Float>{Keys, Values, Math::lerp, Extrapolation::Extrapolated, Extrapolation::Constant});
+    batch.add(TrackView<const Float, const Float>{Keys, Values, Math::lerp, Extrapolation::Constant, Extrapolation::DefaultConstructed});
+    CORRADE_COMPARE(batch.size(), 1);
+    CORRADE_COMPARE(out.str(),
+        "Animation::TrackBatch::add(): expected the same interpolator and extrapolation for all tracks\n"
+        "Animation::TrackBatch::add(): expected the same interpolator and extrapolation for all tracks\n");
+}
+
+void TrackBatchTest::addEmpty() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    TrackBatch<Float, Float> batch;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    batch.add(TrackView<const Float, const Float>{nullptr, nullptr, Math::lerp});
+    CORRADE_VERIFY(batch.isEmpty());
+    CORRADE_COMPARE(out.str(), "Animation::TrackBatch::add(): expected at least one keyframe\n");
+}
+
+void TrackBatchTest::addSizeMismatch() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    TrackBatch<Float, Float> batch;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    batch.add(TrackView<const Float, const Float>{Keys, Containers::arrayView(Values).prefix(5), Math::lerp});
+    CORRADE_VERIFY(batch.isEmpty());
+    CORRADE_COMPARE(out.str(), "Animation::TrackBatch::add(): keys and values don't have the same size\n");
+}
+
+void TrackBatchTest::advanceLerp() {
+    auto&& data = AdvanceData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const TrackView<const Float, const Float> tracks[]{
+        {Keys, Values, Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter},
+        {Keys2, Containers::arrayView(Values).prefix(3), Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter},
+        {Keys3, Containers::arrayView(Values).slice(2, 4), Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter},
+        {Containers::arrayView(Keys).suffix(1), Containers::arrayView(Values).prefix(5), Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter},
+        {Keys2, Containers::arrayView(Values).suffix(3), Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter},
+        {Containers::arrayView(Keys).prefix(4), Containers::arrayView(Values).suffix(2), Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter},
+        {Keys3, Containers::arrayView(Values).suffix(4), Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter}
+    };
+
+    TrackBatch<Float, Float> batch;
+    for(const TrackView<const Float, const Float>& track: tracks)
+        batch.add(track);
+    CORRADE_COMPARE(batch.size(), 7);
+
+    for(Float time: Times) {
+        CORRADE_ITERATION(time);
+        batch.advance(time);
+        for(std::size_t i = 0; i != batch.size(); ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(batch.results()[i], tracks[i].at(time));
+        }
+    }
+}
+
+void TrackBatchTest::advanceLerpVector() {
+    auto&& data = AdvanceData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Vector3 values[]{
+        {1.5f, 0.0f, -1.0f},
+        {3.0f, 0.5f, 2.0f},
+        {5.0f, 1.0f, 0.0f},
+        {2.0f, -2.0f, 1.5f},
+        {-1.0f, 0.25f, 3.0f},
+        {0.5f, 4.0f, 2.5f}
+    };
+
+    const TrackView<const Float, const Vector3> tracks[]{
+        {Keys, values, Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter},
+        {Keys2, Containers::arrayView(values).suffix(3), Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter},
+        {Keys3, Containers::arrayView(values).slice(1, 3), Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter}
+    };
+
+    TrackBatch<Float, Vector3> batch;
+    for(const TrackView<const Float, const Vector3>& track: tracks)
+        batch.add(track);
+
+    for(Float time: Times) {
+        CORRADE_ITERATION(time);
+        batch.advance(time);
+        for(std::size_t i = 0; i != batch.size(); ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(batch.results()[i], tracks[i].at(time));
+        }
+    }
+}
+
+void TrackBatchTest::advanceSlerp() {
+    auto&& data = AdvanceData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Quaternion values[]{
+        Quaternion::rotation(15.0_degf, Vector3::xAxis()),
+        Quaternion::rotation(-35.0_degf, Vector3::yAxis()),
+        Quaternion::rotation(75.0_degf, Vector3::zAxis()),
+        Quaternion::rotation(120.0_degf, Vector3::xAxis()),
+        Quaternion::rotation(-5.0_degf, Vector3::zAxis()),
+        Quaternion::rotation(60.0_degf, Vector3::yAxis())
+    };
+
+    const TrackView<const Float, const Quaternion> tracks[]{
+        {Keys, values, Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter},
+        {Keys2, Containers::arrayView(values).suffix(3), Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter},
+        {Keys3, Containers::arrayView(values).slice(1, 3), Interpolation::Linear, data.extrapolationBefore, data.extrapolationAfter}
+    };
+
+    TrackBatch<Float, Quaternion> batch;
+    for(const TrackView<const Float, const Quaternion>& track: tracks)
+        batch.add(track);
+
+    for(Float time: Times) {
+        CORRADE_ITERATION(time);
+        batch.advance(time);
+        for(std::size_t i = 0; i != batch.size(); ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(batch.results()[i], tracks[i].at(time));
+        }
+    }
+}
+
+void TrackBatchTest::advanceCustomInterpolator() {
+    auto&& data = AdvanceData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Int values[]{15, -3, 7, 22, 0, 1};
+
+    const TrackView<const Float, const Int> tracks[]{
+        {Keys, values, Math::select, data.extrapolationBefore, data.extrapolationAfter},
+        {Keys2, Containers::arrayView(values).suffix(3), Math::select, data.extrapolationBefore, data.extrapolationAfter},
+        {Keys3, Containers::arrayView(values).slice(1, 3), Math::select, data.extrapolationBefore, data.extrapolationAfter}
+    };
+
+    TrackBatch<Float, Int> batch;
+    for(const TrackView<const Float, const Int>& track: tracks)
+        batch.add(track);
+
+    for(Float time: Times) {
+        CORRADE_ITERATION(time);
+        batch.advance(time);
+        for(std::size_t i = 0; i != batch.size(); ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(batch.results()[i], tracks[i].at(time));
+        }
+    }
+}
+
+void TrackBatchTest::advanceSingleKeyframe() {
+    const Float keys[]{2.0f};
+    const Float values[]{3.5f};
+
+    TrackBatch<Float, Float> batch;
+    batch.add(TrackView<const Float, const Float>{keys, values, Math::lerp, Extrapolation::DefaultConstructed})
+         .add(TrackView<const Float, const Float>{keys, values, Math::lerp, Extrapolation::DefaultConstructed});
+    CORRADE_COMPARE(batch.duration(), (Range1D{2.0f, 2.0f}));
+
+    /* Same as in interpolate(), the value is default-constructed only if the
+       key differs */
+    batch.advance(1.0f);
+    CORRADE_COMPARE(batch.results()[0], 0.0f);
+    CORRADE_COMPARE(batch.results()[1], 0.0f);
+
+    batch.advance(2.0f);
+    CORRADE_COMPARE(batch.results()[0], 3.5f);
+    CORRADE_COMPARE(batch.results()[1], 3.5f);
+
+    batch.advance(3.0f);
+    CORRADE_COMPARE(batch.results()[0], 0.0f);
+    CORRADE_COMPARE(batch.results()[1], 0.0f);
+}
+
+void TrackBatchTest::advanceBackwards() {
+    TrackBatch<Float, Float> batch;
+    batch.add(TrackView<const Float, const Float>{Keys, Values, Math::lerp});
+
+    /* The hint gets rewound when going back in time */
+    batch.advance(4.5f);
+    CORRADE_COMPARE(batch.results()[0], -0.5f);
+    batch.advance(0.5f);
+    CORRADE_COMPARE(batch.results()[0], 2.25f);
+    batch.advance(5.0f);
+    CORRADE_COMPARE(batch.results()[0], 0.0f);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::TrackBatchTest)
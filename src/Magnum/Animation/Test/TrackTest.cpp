@@ -23,7 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/Animation/Track.h"
 #include "Magnum/Math/Half.h"
@@ -54,6 +56,11 @@ struct TrackTest: TestSuite::Tester {
     void atStrict();
     void atDifferentResultType();
     void atDifferentResultTypeStrict();
+
+    void resample();
+    void resampleView();
+    void resampleEmpty();
+    void resampleInvalidCount();
 };
 
 /* Reduced version from InterpolateTest, keep in sync with TrackViewTest */
@@ -112,7 +119,12 @@ TrackTest::TrackTest() {
                        &TrackTest::atStrict}, Containers::arraySize(AtData));
 
     addTests({&TrackTest::atDifferentResultType,
-              &TrackTest::atDifferentResultTypeStrict});
+              &TrackTest::atDifferentResultTypeStrict,
+
+              &TrackTest::resample,
+              &TrackTest::resampleView,
+              &TrackTest::resampleEmpty,
+              &TrackTest::resampleInvalidCount});
 }
 
 using namespace Math::Literals;
@@ -489,6 +501,82 @@ void TrackTest::atDifferentResultTypeStrict() {
     CORRADE_COMPARE(hint, 2);
 }
 
+void TrackTest::resample() {
+    const Track<Float, Float> a{
+        {{1.0f, 3.0f},
+         {2.0f, 1.0f},
+         {4.0f, 2.5f},
+         {5.0f, 0.5f}}, Interpolation::Linear,
+        Extrapolation::Extrapolated, Extrapolation::DefaultConstructed};
+
+    /* The last value should be 0.5 even though the original track gives back
+       a default-constructed value for it */
+    const Track<Float, Float> b = Animation::resample(a, 5);
+    CORRADE_COMPARE(b.interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(b.interpolator(), a.interpolator());
+    CORRADE_COMPARE(b.before(), Extrapolation::Extrapolated);
+    CORRADE_COMPARE(b.after(), Extrapolation::DefaultConstructed);
+    CORRADE_COMPARE(b.duration(), (Range1D{1.0f, 5.0f}));
+    CORRADE_COMPARE(b.size(), 5);
+    CORRADE_COMPARE(b[0], std::make_pair(1.0f, 3.0f));
+    CORRADE_COMPARE(b[1], std::make_pair(2.0f, 1.0f));
+    CORRADE_COMPARE(b[2], std::make_pair(3.0f, 1.75f));
+    CORRADE_COMPARE(b[3], std::make_pair(4.0f, 2.5f));
+    CORRADE_COMPARE(b[4], std::make_pair(5.0f, 0.5f));
+
+    /* Lookup without a hint */
+    CORRADE_COMPARE(b.at(4.5f), 1.5f);
+    CORRADE_COMPARE(b.at(0.5f), 4.0f);
+    CORRADE_COMPARE(b.at(5.0f), 0.0f);
+
+    /* Coarser resampling loses the keyframes in between */
+    const Track<Float, Float> c = Animation::resample(a, 3);
+    CORRADE_COMPARE(c.size(), 3);
+    CORRADE_COMPARE(c[0], std::make_pair(1.0f, 3.0f));
+    CORRADE_COMPARE(c[1], std::make_pair(3.0f, 1.75f));
+    CORRADE_COMPARE(c[2], std::make_pair(5.0f, 0.5f));
+}
+
+void TrackTest::resampleView() {
+    Float keys[]{0.0f, 1.0f, 3.0f};
+    Vector3 values[]{{0.0f, 1.0f, 2.0f}, {1.0f, 0.0f, 2.0f}, {3.0f, 0.0f, -2.0f}};
+    const TrackView<Float, Vector3> a{keys, values, Math::lerp};
+
+    const Track<Float, Vector3> b = Animation::resample(a, 4);
+    CORRADE_COMPARE(b.interpolation(), Interpolation::Custom);
+    CORRADE_COMPARE(b.duration(), (Range1D{0.0f, 3.0f}));
+    CORRADE_COMPARE(b.size(), 4);
+    CORRADE_COMPARE(b[0], std::make_pair(0.0f, (Vector3{0.0f, 1.0f, 2.0f})));
+    CORRADE_COMPARE(b[1], std::make_pair(1.0f, (Vector3{1.0f, 0.0f, 2.0f})));
+    CORRADE_COMPARE(b[2], std::make_pair(2.0f, (Vector3{2.0f, 0.0f, 0.0f})));
+    CORRADE_COMPARE(b[3], std::make_pair(3.0f, (Vector3{3.0f, 0.0f, -2.0f})));
+}
+
+void TrackTest::resampleEmpty() {
+    const Track<Float, Float> a{nullptr, Math::lerp};
+
+    const Track<Float, Float> b = Animation::resample(a, 3);
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b[0], std::make_pair(0.0f, 0.0f));
+    CORRADE_COMPARE(b[1], std::make_pair(0.0f, 0.0f));
+    CORRADE_COMPARE(b[2], std::make_pair(0.0f, 0.0f));
+}
+
+void TrackTest::resampleInvalidCount() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Track<Float, Float> a{
+        {{1.0f, 3.0f},
+         {2.0f, 1.0f}}, Math::lerp};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Animation::resample(a, 1);
+    CORRADE_COMPARE(out.str(), "Animation::resample(): expected at least two keyframes, got 1\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Animation::Test::TrackTest)
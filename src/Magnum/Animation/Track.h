@@ -76,12 +76,26 @@ performance. You have the following options:
 @subsection Animation-Track-performance-hint Keyframe hinting
 
 The @ref Track and @ref TrackView classes are fully stateless and the
-@ref at(K) const function performs a linear search for matching keyframe from
-the beginning every time. You can use @ref at(K, std::size_t&) const to
-remember last used keyframe index and pass it in the next iteration as a hint:
+@ref at(K) const function searches for matching keyframe from the beginning
+every time. You can use @ref at(K, std::size_t&) const to remember last used
+keyframe index and pass it in the next iteration as a hint:
 
 @snippet MagnumAnimation.cpp Track-performance-hint
 
+With a hint, continuous playback finds the keyframe in constant time, while
+seeking or scrubbing falls back to a binary search. See @ref interpolate() for
+details.
+
+@subsection Animation-Track-performance-resample Uniform keyframe spacing
+
+If random access to the track is common, such as when scrubbing a timeline or
+evaluating the animation at arbitrary points in time, you can use
+@ref resample() to convert the track to uniformly spaced keyframes. For such
+tracks the keyframe position is calculated directly from the frame value and
+the lookup is done in constant time even without a hint:
+
+@snippet MagnumAnimation.cpp Track-performance-resample
+
 @subsection Animation-Track-performance-strict Strict interpolation
 
 While it's possible to have different @ref Extrapolation modes for frames
@@ -798,6 +812,64 @@ template<class K, class V, class R
         }
 };
 
+/**
+@brief Resample a track to uniformly spaced keyframes
+@param track    Track to resample
+@param count    Keyframe count in the output
+@m_since_latest
+
+Creates a track with @p count keyframes uniformly spaced over
+@ref TrackView::duration(), with values calculated using
+@ref TrackView::interpolator(). The first and last keyframe value is the same
+as in the original track. The interpolation and extrapolation behavior is kept the
+same. Expects that @p count is at least @cpp 2 @ce. For an empty track the
+keyframes are all default-constructed.
+
+Keyframe lookup in a resampled track is done in constant time, see
+@ref Animation-Track-performance-resample for more information. The amount of
+detail preserved from the original depends on @p count --- keyframes that
+don't fall on the sampling points are not preserved exactly. Since the values
+are stored in the same type as the result, only tracks where the value type
+is the same as the result type are supported, i.e. not spline tracks.
+@experimental
+*/
+template<class K, class V> Track<K, V, V> resample(const TrackView<const K, const V, V>& track, std::size_t count) {
+    CORRADE_ASSERT(count >= 2,
+        "Animation::resample(): expected at least two keyframes, got" << count, (Track<K, V, V>{nullptr, track.interpolation(), track.interpolator(), track.before(), track.after()}));
+
+    const Math::Range1D<K> duration = track.duration();
+    Containers::Array<std::pair<K, V>> data{count};
+    std::size_t hint{};
+    for(std::size_t i = 0; i != count; ++i) {
+        /* Ensuring the last keyframe is exactly at the end, which a lerp()
+           doesn't guarantee */
+        const K key = i + 1 == count ? duration.max() :
+            Math::lerp(duration.min(), duration.max(), Float(i)/Float(count - 1));
+        /* All keys are inside the track duration, so constant extrapolation
+           gives back the boundary values even if the track would return a
+           default-constructed value for them */
+        data[i] = {key, interpolate(track.keys(), track.values(), Extrapolation::Constant, Extrapolation::Constant, track.interpolator(), key, hint)};
+    }
+
+    return Track<K, V, V>{std::move(data), track.interpolation(), track.interpolator(), track.before(), track.after()};
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class K, class V> Track<K, V, V> resample(const TrackView<K, V, V>& track, std::size_t count) {
+    return resample(TrackView<const K, const V, V>{track}, count);
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class K, class V> Track<K, V, V> resample(const Track<K, V, V>& track, std::size_t count) {
+    return resample(TrackView<const K, const V, V>{track}, count);
+}
+
 }}
 
 #endif
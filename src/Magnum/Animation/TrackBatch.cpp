@@ -0,0 +1,54 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TrackBatch.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Magnum { namespace Animation { namespace Implementation {
+
+void lerpBatch(const Float* const a, const Float* const b, const Float* const t, Float* const out, const std::size_t count) {
+    std::size_t i = 0;
+
+    /* SSE2 is the baseline on x86-64, so no runtime dispatch is needed. The
+       operations are done in the same order as in Math::lerp() so the results
+       are the same as with the scalar code. */
+    #ifdef CORRADE_TARGET_SSE2
+    const __m128 one = _mm_set1_ps(1.0f);
+    for(; i + 4 <= count; i += 4) {
+        const __m128 tv = _mm_loadu_ps(t + i);
+        _mm_storeu_ps(out + i, _mm_add_ps(
+            _mm_mul_ps(_mm_sub_ps(one, tv), _mm_loadu_ps(a + i)),
+            _mm_mul_ps(tv, _mm_loadu_ps(b + i))));
+    }
+    #endif
+
+    for(; i != count; ++i)
+        out[i] = (1.0f - t[i])*a[i] + t[i]*b[i];
+}
+
+}}}
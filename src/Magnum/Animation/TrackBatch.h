@@ -0,0 +1,339 @@
+#ifndef Magnum_Animation_TrackBatch_h
+#define Magnum_Animation_TrackBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::TrackBatch
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/visibility.h"
+#include "Magnum/Animation/Track.h"
+
+namespace Magnum { namespace Animation {
+
+namespace Implementation {
+    /* Detects whether given interpolator is a plain component-wise
+       Math::lerp() on Float scalars or vectors, which can be then done on
+       the whole batch at once */
+    template<class V, class R, class = void> struct TrackBatchLerp {
+        enum: std::size_t { Components = 0 };
+        static bool is(R(*)(const V&, const V&, Float)) { return false; }
+    };
+    template<> struct TrackBatchLerp<Float, Float> {
+        enum: std::size_t { Components = 1 };
+        static bool is(Float(*interpolator)(const Float&, const Float&, Float)) {
+            return interpolator == static_cast<Float(*)(const Float&, const Float&, Float)>(Math::lerp);
+        }
+    };
+    template<class V> struct TrackBatchLerp<V, V, typename std::enable_if<std::is_base_of<Math::Vector<V::Size, Float>, V>::value>::type> {
+        enum: std::size_t { Components = V::Size };
+        static bool is(V(*interpolator)(const V&, const V&, Float)) {
+            return interpolator == static_cast<V(*)(const V&, const V&, Float)>(Math::lerp);
+        }
+    };
+
+    /* Calculates out[i] = (1 - t[i])*a[i] + t[i]*b[i], vectorized if
+       possible. Defined in TrackBatch.cpp. */
+    MAGNUM_EXPORT void lerpBatch(const Float* a, const Float* b, const Float* t, Float* out, std::size_t count);
+}
+
+/**
+@brief Batch of animation tracks of the same type
+@tparam K       Key type
+@tparam V       Value type
+@tparam R       Result type
+@m_since_latest
+
+Groups tracks that share the same value type, interpolator and extrapolation
+behavior and evaluates all of them at once into a contiguous array of
+@ref results(). Compared to adding each track to a @ref Player separately,
+which makes an indirect call and writes to a scattered destination location
+for every track, the keyframe search and interpolation is done in a tight
+loop over structure-of-arrays data, with a single result array written
+sequentially.
+
+Tracks are added using @ref add(), the first added track decides the
+@ref interpolator(), @ref interpolation(), @ref before() and @ref after()
+behavior of the whole batch and all following tracks are expected to match
+it. Every call to @ref advance() then updates the @ref results() array, with
+result at index @cpp i @ce corresponding to @cpp i @ce-th added track. The
+output is the same as calling @ref TrackView::at(K, std::size_t&) const on
+each track separately:
+
+@snippet MagnumAnimation.cpp TrackBatch-usage
+
+The batch can be either advanced directly with a key value as shown above,
+or added to a @ref Player using @ref Player::addBatch(), which then takes care
+of the playback state and time-to-key conversion.
+
+@section Animation-TrackBatch-performance Performance
+
+If the interpolator is @ref Math::lerp() on @ref Magnum::Float "Float" scalars
+or vectors (which is what @ref interpolatorFor() picks for
+@ref Interpolation::Linear), the interpolation is done for all tracks at once
+using SIMD instructions where available. Other interpolators, such as
+@ref Math::slerp() used for quaternions, are called through the same function
+pointer for every track, which is well-predictable and avoids the per-track
+dispatch that @ref Player::add() has.
+
+The tracks reference the data passed to @ref add() and the data are expected
+to be kept in scope for the whole lifetime of the batch. Each track needs to
+have at least one keyframe.
+@experimental
+*/
+template<class K, class V, class R
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    = ResultOf<V>
+    #endif
+> class TrackBatch {
+    public:
+        /** @brief Key type */
+        typedef K KeyType;
+
+        /** @brief Value type */
+        typedef V ValueType;
+
+        /** @brief Animation result type */
+        typedef R ResultType;
+
+        /** @brief Interpolation function */
+        typedef R(*Interpolator)(const V&, const V&, Float);
+
+        /**
+         * @brief Constructor
+         *
+         * Creates an empty batch. The interpolation and extrapolation
+         * behavior is taken from the first track passed to @ref add().
+         */
+        explicit TrackBatch() noexcept: _interpolator{}, _interpolation{}, _before{}, _after{}, _lerp{} {}
+
+        /** @brief Copying is not allowed */
+        TrackBatch(const TrackBatch<K, V, R>&) = delete;
+
+        /** @brief Move constructor */
+        TrackBatch(TrackBatch<K, V, R>&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        TrackBatch<K, V, R>& operator=(const TrackBatch<K, V, R>&) = delete;
+
+        /** @brief Move assignment */
+        TrackBatch<K, V, R>& operator=(TrackBatch<K, V, R>&&) noexcept = default;
+
+        /**
+         * @brief Interpolation function
+         *
+         * Taken from the first added track, @cpp nullptr @ce if the batch is
+         * empty.
+         */
+        Interpolator interpolator() const { return _interpolator; }
+
+        /**
+         * @brief Interpolation behavior
+         *
+         * Taken from the first added track.
+         */
+        Interpolation interpolation() const { return _interpolation; }
+
+        /**
+         * @brief Extrapolation behavior before first keyframe
+         *
+         * Taken from the first added track.
+         */
+        Extrapolation before() const { return _before; }
+
+        /**
+         * @brief Extrapolation behavior after last keyframe
+         *
+         * Taken from the first added track.
+         */
+        Extrapolation after() const { return _after; }
+
+        /** @brief Whether the batch is empty */
+        bool isEmpty() const { return _keys.empty(); }
+
+        /** @brief Count of tracks in the batch */
+        std::size_t size() const { return _keys.size(); }
+
+        /**
+         * @brief Combined duration of all tracks
+         *
+         * If the batch is empty, returns default-constructed value.
+         * @see @ref TrackView::duration()
+         */
+        Math::Range1D<K> duration() const { return _duration; }
+
+        /**
+         * @brief Interpolation results
+         *
+         * Result at index @cpp i @ce corresponds to @cpp i @ce-th track added
+         * with @ref add(). Default-constructed until @ref advance() is called
+         * for the first time.
+         */
+        Containers::ArrayView<const R> results() const { return _results; }
+
+        /**
+         * @brief Add a track
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the track has at least one keyframe and, if this isn't
+         * the first track in the batch, that its @ref TrackView::interpolator(),
+         * @ref TrackView::before() and @ref TrackView::after() are the same
+         * as of the first one. The track data are not copied, only
+         * referenced.
+         */
+        TrackBatch<K, V, R>& add(const TrackView<const K, const V, R>& track);
+
+        /**
+         * @brief Advance all tracks
+         * @return Reference to self (for method chaining)
+         *
+         * Interpolates all tracks at given @p key and saves the results to
+         * @ref results(). The per-track keyframe hint is remembered between
+         * the calls, so advancing monotonically forward is the fastest.
+         */
+        TrackBatch<K, V, R>& advance(K key);
+
+    private:
+        Float keyframes(std::size_t i, K frame, std::size_t& first, std::size_t& second);
+
+        Containers::Array<Containers::StridedArrayView1D<const K>> _keys;
+        Containers::Array<Containers::StridedArrayView1D<const V>> _values;
+        Containers::Array<std::size_t> _hints;
+        Containers::Array<R> _results;
+        /* Used only by the batch lerp path */
+        Containers::Array<V> _from, _to;
+        Containers::Array<Float> _factors;
+        Math::Range1D<K> _duration;
+        Interpolator _interpolator;
+        Interpolation _interpolation;
+        Extrapolation _before, _after;
+        bool _lerp;
+};
+
+template<class K, class V, class R> TrackBatch<K, V, R>& TrackBatch<K, V, R>::add(const TrackView<const K, const V, R>& track) {
+    CORRADE_ASSERT(!track.keys().empty(),
+        "Animation::TrackBatch::add(): expected at least one keyframe", *this);
+    CORRADE_ASSERT(track.keys().size() == track.values().size(),
+        "Animation::TrackBatch::add(): keys and values don't have the same size", *this);
+
+    if(_keys.empty()) {
+        _interpolator = track.interpolator();
+        _interpolation = track.interpolation();
+        _before = track.before();
+        _after = track.after();
+        _lerp = Implementation::TrackBatchLerp<V, R>::is(_interpolator);
+        _duration = track.duration();
+    } else {
+        CORRADE_ASSERT(track.interpolator() == _interpolator && track.before() == _before && track.after() == _after,
+            "Animation::TrackBatch::add(): expected the same interpolator and extrapolation for all tracks", *this);
+        _duration = Math::join(_duration, track.duration());
+    }
+
+    arrayAppend(_keys, track.keys());
+    arrayAppend(_values, track.values());
+    arrayAppend(_hints, std::size_t{});
+    arrayAppend(_results, R{});
+    if(_lerp) {
+        arrayAppend(_from, V{});
+        arrayAppend(_to, V{});
+        arrayResize(_factors, Containers::NoInit, _factors.size() + Implementation::TrackBatchLerp<V, R>::Components);
+    }
+
+    return *this;
+}
+
+/* Mirrors interpolate(), except that the default-constructed extrapolation is
+   handled separately in advance() */
+template<class K, class V, class R> Float TrackBatch<K, V, R>::keyframes(const std::size_t i, K frame, std::size_t& first, std::size_t& second) {
+    const Containers::StridedArrayView1D<const K>& keys = _keys[i];
+
+    /* Only one frame, use it for both sides of the interpolator */
+    if(keys.size() == 1) {
+        first = second = 0;
+        return 0.0f;
+    }
+
+    /* Find a pair of keys that is around given time */
+    std::size_t& hint = _hints[i];
+    hint = Implementation::keyframeIndex(keys, frame, hint);
+
+    if(frame < keys[hint]) {
+        if(_before == Extrapolation::Constant) frame = keys[hint];
+    } else if(frame >= keys[hint + 1]) {
+        if(_after == Extrapolation::Constant) frame = keys[hint + 1];
+    }
+
+    first = hint;
+    second = hint + 1;
+    return Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame));
+}
+
+template<class K, class V, class R> TrackBatch<K, V, R>& TrackBatch<K, V, R>::advance(const K key) {
+    const std::size_t count = _keys.size();
+
+    /* For a plain lerp gather the keyframe pairs and factors first and then
+       interpolate everything in one go */
+    if(_lerp) {
+        const std::size_t components = Implementation::TrackBatchLerp<V, R>::Components;
+        for(std::size_t i = 0; i != count; ++i) {
+            std::size_t first, second;
+            const Float factor = keyframes(i, key, first, second);
+            _from[i] = _values[i][first];
+            _to[i] = _values[i][second];
+            for(std::size_t j = 0; j != components; ++j)
+                _factors[i*components + j] = factor;
+        }
+
+        Implementation::lerpBatch(reinterpret_cast<const Float*>(_from.data()), reinterpret_cast<const Float*>(_to.data()), _factors.data(), reinterpret_cast<Float*>(_results.data()), count*components);
+
+    /* Otherwise call the (same) interpolator for all tracks */
+    } else for(std::size_t i = 0; i != count; ++i) {
+        std::size_t first, second;
+        const Float factor = keyframes(i, key, first, second);
+        _results[i] = _interpolator(_values[i][first], _values[i][second], factor);
+    }
+
+    /* Patch up default-constructed values outside of the track range. Same
+       conditions as in interpolate(), where a single keyframe is treated as
+       being out of range only if the key is not equal to it. */
+    if(_before == Extrapolation::DefaultConstructed || _after == Extrapolation::DefaultConstructed) {
+        for(std::size_t i = 0; i != count; ++i) {
+            const Containers::StridedArrayView1D<const K>& keys = _keys[i];
+            if((_before == Extrapolation::DefaultConstructed && key < keys.front()) ||
+               (_after == Extrapolation::DefaultConstructed && (keys.size() == 1 ? key > keys.back() : key >= keys.back())))
+                _results[i] = R{};
+        }
+    }
+
+    return *this;
+}
+
+}}
+
+#endif
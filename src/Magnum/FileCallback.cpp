@@ -25,7 +25,10 @@
 
 #include "FileCallback.h"
 
+#include <unordered_map>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Directory.h>
 
 namespace Magnum {
 
@@ -45,4 +48,77 @@ Debug& operator<<(Debug& debug, const InputFileCallbackPolicy value) {
     return debug << "(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
 }
 
+struct MappedFileCallback::State {
+    struct File {
+        #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+        Containers::Array<const char, Utility::Directory::MapDeleter> mapped;
+        #endif
+        Containers::Array<char> read;
+        Containers::ArrayView<const char> data;
+        /* Set if the file was loaded with LoadPermanent at least once, in
+           which case Close is ignored as something may still reference it */
+        bool permanent;
+    };
+
+    std::unordered_map<std::string, File> files;
+};
+
+MappedFileCallback::MappedFileCallback(): _state{new State} {}
+
+MappedFileCallback::MappedFileCallback(MappedFileCallback&&) noexcept = default;
+
+MappedFileCallback::~MappedFileCallback() = default;
+
+MappedFileCallback& MappedFileCallback::operator=(MappedFileCallback&&) noexcept = default;
+
+std::size_t MappedFileCallback::fileCount() const {
+    return _state->files.size();
+}
+
+Containers::Optional<Containers::ArrayView<const char>> MappedFileCallback::callback(const std::string& filename, const InputFileCallbackPolicy policy, MappedFileCallback& state) {
+    std::unordered_map<std::string, State::File>& files = state._state->files;
+    auto found = files.find(filename);
+
+    /* Discard the mapping, if not needed anymore. Files loaded permanently
+       are kept until the instance is destroyed, even if the same file was
+       loaded temporarily by someone else since. */
+    if(policy == InputFileCallbackPolicy::Close) {
+        if(found != files.end() && !found->second.permanent) files.erase(found);
+        return {};
+    }
+
+    /* Return the existing mapping, if there's any, upgrading it to a
+       permanent one if requested */
+    if(found != files.end()) {
+        if(policy == InputFileCallbackPolicy::LoadPermanent)
+            found->second.permanent = true;
+        return found->second.data;
+    }
+
+    /* The caller prints its own message on failure, so don't print anything
+       here */
+    if(!Utility::Directory::exists(filename)) return {};
+
+    State::File file;
+    file.permanent = policy == InputFileCallbackPolicy::LoadPermanent;
+
+    /* Mapping can fail for example for empty files, in which case the file is
+       read into memory instead. Errors from mapRead() are not interesting in
+       that case. */
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    {
+        Error silenceError{nullptr};
+        file.mapped = Utility::Directory::mapRead(filename);
+    }
+    if(file.mapped.data()) file.data = Containers::arrayView(file.mapped);
+    else
+    #endif
+    {
+        file.read = Utility::Directory::read(filename);
+        file.data = file.read;
+    }
+
+    return files.emplace(filename, std::move(file)).first->second.data;
+}
+
 }
@@ -26,9 +26,12 @@
 */
 
 /** @file
- * @brief Enum @ref Magnum::InputFileCallbackPolicy
+ * @brief Enum @ref Magnum::InputFileCallbackPolicy, class @ref Magnum::MappedFileCallback
  */
 
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Utility/StlForwardString.h>
+
 #include "Magnum/Magnum.h"
 #include "Magnum/visibility.h"
 
@@ -100,6 +103,83 @@ enum class InputFileCallbackPolicy: UnsignedByte {
 /** @debugoperatorenum{InputFileCallbackPolicy} */
 MAGNUM_EXPORT Debug& operator<<(Debug& debug, InputFileCallbackPolicy value);
 
+/**
+@brief Memory-mapping input file callback
+@m_since_latest
+
+Keeps files requested through @ref callback() mapped into memory for as long
+as the instance exists or until the callback is called with
+@ref InputFileCallbackPolicy::Close for given file. Files that were requested
+with @ref InputFileCallbackPolicy::LoadPermanent at least once stay mapped
+until the instance is destroyed, even if the same file is requested and
+closed again later, as data returned by an importer with
+@ref Trade::ImporterFlag::PersistentInput may still reference them. Meant to be passed to
+@ref Trade::AbstractImporter::setFileCallback(),
+@ref ShaderTools::AbstractConverter::setInputFileCallback() or
+@ref Text::AbstractFont::setFileCallback() together with @ref callback():
+
+@snippet MagnumTrade.cpp MappedFileCallback
+
+Compared to reading whole files into memory, the operating system pages the
+file contents in on demand and can drop them again under memory pressure, as
+the mapping is backed by the file itself. Together with
+@ref Trade::ImporterFlag::PersistentInput, importers can then return data
+referencing the mapped memory directly instead of making a copy. In that case
+the instance has to outlive both the importer and all data returned from it.
+
+On platforms without memory mapping support, which is everything except
+@ref CORRADE_TARGET_UNIX "Unix" and non-RT
+@ref CORRADE_TARGET_WINDOWS "Windows", and for files that can't be mapped,
+such as empty files, the file is read into memory instead, with the same
+lifetime guarantees.
+*/
+class MAGNUM_EXPORT MappedFileCallback {
+    public:
+        /**
+         * @brief Callback function
+         *
+         * With @ref InputFileCallbackPolicy::LoadTemporary and
+         * @ref InputFileCallbackPolicy::LoadPermanent maps @p filename into
+         * memory and returns a view on its contents. If the file is mapped
+         * already, the existing mapping is returned. If the file doesn't
+         * exist, returns @ref Corrade::Containers::NullOpt. With
+         * @ref InputFileCallbackPolicy::Close the mapping is discarded,
+         * unless the file was loaded with
+         * @ref InputFileCallbackPolicy::LoadPermanent before, and
+         * @ref Corrade::Containers::NullOpt is returned.
+         */
+        static Containers::Optional<Containers::ArrayView<const char>> callback(const std::string& filename, InputFileCallbackPolicy policy, MappedFileCallback& state);
+
+        /** @brief Constructor */
+        explicit MappedFileCallback();
+
+        /** @brief Copying is not allowed */
+        MappedFileCallback(const MappedFileCallback&) = delete;
+
+        /** @brief Move constructor */
+        MappedFileCallback(MappedFileCallback&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Discards all remaining mappings.
+         */
+        ~MappedFileCallback();
+
+        /** @brief Copying is not allowed */
+        MappedFileCallback& operator=(const MappedFileCallback&) = delete;
+
+        /** @brief Move assignment */
+        MappedFileCallback& operator=(MappedFileCallback&&) noexcept;
+
+        /** @brief Count of currently mapped files */
+        std::size_t fileCount() const;
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
 }
 
 #endif
@@ -0,0 +1,450 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "InterpolationBatch.h"
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/CubicHermite.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Quaternion.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+#ifdef CORRADE_TARGET_SSE2
+/* SSE2 kernels, each processing a multiple of four items and returning the
+   count of items processed. The rest is handled by the scalar functions. The
+   operations are done in the same order as in the scalar functions so the
+   results are the same. SSE2 is the baseline on x86-64, so no runtime
+   dispatch is needed; other targets use just the scalar code. */
+
+/* Loads one float from four items */
+inline __m128 load(const char* const data, const std::ptrdiff_t stride) {
+    if(stride == std::ptrdiff_t(sizeof(Float)))
+        return _mm_loadu_ps(reinterpret_cast<const Float*>(data));
+    return _mm_setr_ps(
+        *reinterpret_cast<const Float*>(data),
+        *reinterpret_cast<const Float*>(data + stride),
+        *reinterpret_cast<const Float*>(data + 2*stride),
+        *reinterpret_cast<const Float*>(data + 3*stride));
+}
+
+/* Loads four three-component vectors and transposes them to one vector per
+   coordinate. Tightly packed vectors are loaded as three full vectors and
+   shuffled into place, otherwise each component is loaded separately. */
+inline void loadTransposed(const char* const data, const std::ptrdiff_t stride, __m128& x, __m128& y, __m128& z) {
+    if(stride == std::ptrdiff_t(3*sizeof(Float))) {
+        /* a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3 */
+        const Float* const f = reinterpret_cast<const Float*>(data);
+        const __m128 a = _mm_loadu_ps(f);
+        const __m128 b = _mm_loadu_ps(f + 4);
+        const __m128 c = _mm_loadu_ps(f + 8);
+        x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    } else {
+        const Float* const p0 = reinterpret_cast<const Float*>(data);
+        const Float* const p1 = reinterpret_cast<const Float*>(data + stride);
+        const Float* const p2 = reinterpret_cast<const Float*>(data + 2*stride);
+        const Float* const p3 = reinterpret_cast<const Float*>(data + 3*stride);
+        x = _mm_setr_ps(p0[0], p1[0], p2[0], p3[0]);
+        y = _mm_setr_ps(p0[1], p1[1], p2[1], p3[1]);
+        z = _mm_setr_ps(p0[2], p1[2], p2[2], p3[2]);
+    }
+}
+
+/* Inverse of the above */
+inline void storeTransposed(char* const data, const std::ptrdiff_t stride, const __m128 x, const __m128 y, const __m128 z) {
+    if(stride == std::ptrdiff_t(3*sizeof(Float))) {
+        /* xy01 = x0 y0 x1 y1, xy23 = x2 y2 x3 y3 */
+        Float* const f = reinterpret_cast<Float*>(data);
+        const __m128 xy01 = _mm_unpacklo_ps(x, y);
+        const __m128 xy23 = _mm_unpackhi_ps(x, y);
+        _mm_storeu_ps(f, _mm_shuffle_ps(xy01, _mm_shuffle_ps(z, xy01, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(f + 4, _mm_shuffle_ps(_mm_shuffle_ps(xy01, z, _MM_SHUFFLE(1, 1, 3, 3)), xy23, _MM_SHUFFLE(1, 0, 2, 0)));
+        _mm_storeu_ps(f + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, xy23, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(xy23, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+    } else {
+        alignas(16) Float xs[4], ys[4], zs[4];
+        _mm_store_ps(xs, x);
+        _mm_store_ps(ys, y);
+        _mm_store_ps(zs, z);
+        for(std::size_t i = 0; i != 4; ++i) {
+            Float* const p = reinterpret_cast<Float*>(data + std::ptrdiff_t(i)*stride);
+            p[0] = xs[i];
+            p[1] = ys[i];
+            p[2] = zs[i];
+        }
+    }
+}
+
+/* Loads four four-component values and transposes them to one vector per
+   component. The values are contiguous in memory in any case, so it's always
+   four full-width loads. */
+inline void loadTransposed(const char* const data, const std::ptrdiff_t stride, __m128& x, __m128& y, __m128& z, __m128& w) {
+    x = _mm_loadu_ps(reinterpret_cast<const Float*>(data));
+    y = _mm_loadu_ps(reinterpret_cast<const Float*>(data + stride));
+    z = _mm_loadu_ps(reinterpret_cast<const Float*>(data + 2*stride));
+    w = _mm_loadu_ps(reinterpret_cast<const Float*>(data + 3*stride));
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+}
+
+/* Inverse of the above */
+inline void storeTransposed(char* const data, const std::ptrdiff_t stride, __m128 x, __m128 y, __m128 z, __m128 w) {
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    _mm_storeu_ps(reinterpret_cast<Float*>(data), x);
+    _mm_storeu_ps(reinterpret_cast<Float*>(data + stride), y);
+    _mm_storeu_ps(reinterpret_cast<Float*>(data + 2*stride), z);
+    _mm_storeu_ps(reinterpret_cast<Float*>(data + 3*stride), w);
+}
+
+/* Four-component dot product, in the same order as Math::dot() for
+   quaternions */
+inline __m128 dot(const __m128 ax, const __m128 ay, const __m128 az, const __m128 aw, const __m128 bx, const __m128 by, const __m128 bz, const __m128 bw) {
+    return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz)), _mm_mul_ps(aw, bw));
+}
+
+/* Mask of lanes where the squared length is not in the range accepted by
+   isNormalized() */
+inline __m128 notNormalized(const __m128 lengthSquared) {
+    return _mm_cmpnlt_ps(
+        _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(lengthSquared, _mm_set1_ps(1.0f))),
+        _mm_set1_ps(2.0f*TypeTraits<Float>::epsilon()));
+}
+
+std::size_t lerpRun(const char* const a, const std::ptrdiff_t aStride, const char* const b, const std::ptrdiff_t bStride, const char* const t, const std::ptrdiff_t tStride, char* const out, const std::ptrdiff_t outStride, const std::size_t count) {
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const std::ptrdiff_t offset = std::ptrdiff_t(i);
+        __m128 ax, ay, az, bx, by, bz;
+        loadTransposed(a + offset*aStride, aStride, ax, ay, az);
+        loadTransposed(b + offset*bStride, bStride, bx, by, bz);
+        const __m128 tv = load(t + offset*tStride, tStride);
+        const __m128 oneMinusT = _mm_sub_ps(one, tv);
+        storeTransposed(out + offset*outStride, outStride,
+            _mm_add_ps(_mm_mul_ps(oneMinusT, ax), _mm_mul_ps(tv, bx)),
+            _mm_add_ps(_mm_mul_ps(oneMinusT, ay), _mm_mul_ps(tv, by)),
+            _mm_add_ps(_mm_mul_ps(oneMinusT, az), _mm_mul_ps(tv, bz)));
+    }
+
+    return i;
+}
+
+enum class QuaternionInterpolation {
+    Lerp,
+    LerpShortestPath,
+    Slerp,
+    SlerpShortestPath
+};
+
+/* All quaternion interpolation variants are calculated as
+   (ca*a + cb*b)/d, with just the per-lane coefficients being different. For
+   the lerp variants d is the length of the numerator, for the slerp variants
+   it's the sine of the angle, or 1 in the linear fallback case. A negated
+   coefficient gives the same result as a negated quaternion, so the shortest
+   path variants don't need to negate the quaternion itself. Processing stops
+   at the first block with a quaternion that isn't normalized, leaving it to
+   the scalar code to produce an assertion. */
+template<QuaternionInterpolation interpolation> std::size_t quaternionRun(const char* const a, const std::ptrdiff_t aStride, const char* const b, const std::ptrdiff_t bStride, const char* const t, const std::ptrdiff_t tStride, char* const out, const std::ptrdiff_t outStride, const std::size_t count) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const std::ptrdiff_t offset = std::ptrdiff_t(i);
+        __m128 ax, ay, az, aw, bx, by, bz, bw;
+        loadTransposed(a + offset*aStride, aStride, ax, ay, az, aw);
+        loadTransposed(b + offset*bStride, bStride, bx, by, bz, bw);
+
+        #ifndef CORRADE_NO_ASSERT
+        if(_mm_movemask_ps(_mm_or_ps(
+            notNormalized(dot(ax, ay, az, aw, ax, ay, az, aw)),
+            notNormalized(dot(bx, by, bz, bw, bx, by, bz, bw)))))
+            break;
+        #endif
+
+        const __m128 tv = load(t + offset*tStride, tStride);
+        const __m128 oneMinusT = _mm_sub_ps(one, tv);
+        const __m128 cosHalfAngle = dot(ax, ay, az, aw, bx, by, bz, bw);
+
+        /* Lerp variants, normalizing the result */
+        if(interpolation == QuaternionInterpolation::Lerp ||
+           interpolation == QuaternionInterpolation::LerpShortestPath) {
+            /* Flip the sign of the first coefficient in lanes where the
+               quaternions are more than 180° apart */
+            const __m128 ca = interpolation == QuaternionInterpolation::LerpShortestPath ?
+                _mm_xor_ps(oneMinusT, _mm_and_ps(_mm_cmplt_ps(cosHalfAngle, _mm_setzero_ps()), signMask)) : oneMinusT;
+            const __m128 x = _mm_add_ps(_mm_mul_ps(ca, ax), _mm_mul_ps(tv, bx));
+            const __m128 y = _mm_add_ps(_mm_mul_ps(ca, ay), _mm_mul_ps(tv, by));
+            const __m128 z = _mm_add_ps(_mm_mul_ps(ca, az), _mm_mul_ps(tv, bz));
+            const __m128 w = _mm_add_ps(_mm_mul_ps(ca, aw), _mm_mul_ps(tv, bw));
+            const __m128 length = _mm_sqrt_ps(dot(x, y, z, w, x, y, z, w));
+            storeTransposed(out + offset*outStride, outStride,
+                _mm_div_ps(x, length), _mm_div_ps(y, length),
+                _mm_div_ps(z, length), _mm_div_ps(w, length));
+            continue;
+        }
+
+        /* Slerp variants. There's no SIMD instruction for the trigonometric
+           functions, so the coefficients are calculated for each lane
+           separately using the same code as in the scalar variant, which
+           keeps the results the same. */
+        alignas(16) Float cosHalfAngles[4], ts[4], cas[4], cbs[4], ds[4];
+        _mm_store_ps(cosHalfAngles, cosHalfAngle);
+        _mm_store_ps(ts, tv);
+        for(std::size_t j = 0; j != 4; ++j) {
+            const Float cosj = cosHalfAngles[j];
+            const Float tj = ts[j];
+            const bool shortest = cosj < 0.0f;
+            if(interpolation == QuaternionInterpolation::Slerp ?
+                std::abs(cosj) > 1.0f - 0.5f*TypeTraits<Float>::epsilon() :
+                std::abs(cosj) >= 1.0f - TypeTraits<Float>::epsilon())
+            {
+                cas[j] = shortest ? -(1.0f - tj) : 1.0f - tj;
+                cbs[j] = tj;
+                ds[j] = 1.0f;
+            } else {
+                const Float angle = std::acos(interpolation == QuaternionInterpolation::Slerp ? cosj : std::abs(cosj));
+                const Float sa = std::sin((1.0f - tj)*angle);
+                cas[j] = interpolation == QuaternionInterpolation::SlerpShortestPath && shortest ? -sa : sa;
+                cbs[j] = std::sin(tj*angle);
+                ds[j] = std::sin(angle);
+            }
+        }
+
+        const __m128 ca = _mm_load_ps(cas);
+        const __m128 cb = _mm_load_ps(cbs);
+        const __m128 d = _mm_load_ps(ds);
+        storeTransposed(out + offset*outStride, outStride,
+            _mm_div_ps(_mm_add_ps(_mm_mul_ps(ca, ax), _mm_mul_ps(cb, bx)), d),
+            _mm_div_ps(_mm_add_ps(_mm_mul_ps(ca, ay), _mm_mul_ps(cb, by)), d),
+            _mm_div_ps(_mm_add_ps(_mm_mul_ps(ca, az), _mm_mul_ps(cb, bz)), d),
+            _mm_div_ps(_mm_add_ps(_mm_mul_ps(ca, aw), _mm_mul_ps(cb, bw)), d));
+    }
+
+    return i;
+}
+
+/* Cubic Hermite basis, in the same order as in splerp() */
+inline void hermiteBasis(const __m128 t, __m128& c0, __m128& c1, __m128& c2, __m128& c3) {
+    const __m128 tt = _mm_mul_ps(t, t);
+    const __m128 ttt = _mm_mul_ps(tt, t);
+    const __m128 twoT = _mm_mul_ps(_mm_set1_ps(2.0f), t);
+    const __m128 threeTT = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(3.0f), t), t);
+    c0 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(twoT, t), t), threeTT), _mm_set1_ps(1.0f));
+    c1 = _mm_add_ps(_mm_sub_ps(ttt, _mm_mul_ps(twoT, t)), t);
+    c2 = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(-2.0f), t), t), t), threeTT);
+    c3 = _mm_sub_ps(ttt, tt);
+}
+
+/* ((c0*p + c1*n) + c2*q) + c3*m, in the same order as in splerp() */
+inline __m128 hermite(const __m128 c0, const __m128 p, const __m128 c1, const __m128 n, const __m128 c2, const __m128 q, const __m128 c3, const __m128 m) {
+    return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, p), _mm_mul_ps(c1, n)), _mm_mul_ps(c2, q)), _mm_mul_ps(c3, m));
+}
+
+std::size_t splerpVectorRun(const char* const a, const std::ptrdiff_t aStride, const char* const b, const std::ptrdiff_t bStride, const char* const t, const std::ptrdiff_t tStride, char* const out, const std::ptrdiff_t outStride, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const std::ptrdiff_t offset = std::ptrdiff_t(i);
+        const char* const ai = a + offset*aStride;
+        const char* const bi = b + offset*bStride;
+        __m128 pax, pay, paz, nax, nay, naz, pbx, pby, pbz, mbx, mby, mbz;
+        loadTransposed(ai + 3*sizeof(Float), aStride, pax, pay, paz);
+        loadTransposed(ai + 6*sizeof(Float), aStride, nax, nay, naz);
+        loadTransposed(bi + 3*sizeof(Float), bStride, pbx, pby, pbz);
+        loadTransposed(bi, bStride, mbx, mby, mbz);
+
+        __m128 c0, c1, c2, c3;
+        hermiteBasis(load(t + offset*tStride, tStride), c0, c1, c2, c3);
+        storeTransposed(out + offset*outStride, outStride,
+            hermite(c0, pax, c1, nax, c2, pbx, c3, mbx),
+            hermite(c0, pay, c1, nay, c2, pby, c3, mby),
+            hermite(c0, paz, c1, naz, c2, pbz, c3, mbz));
+    }
+
+    return i;
+}
+
+std::size_t splerpQuaternionRun(const char* const a, const std::ptrdiff_t aStride, const char* const b, const std::ptrdiff_t bStride, const char* const t, const std::ptrdiff_t tStride, char* const out, const std::ptrdiff_t outStride, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const std::ptrdiff_t offset = std::ptrdiff_t(i);
+        const char* const ai = a + offset*aStride;
+        const char* const bi = b + offset*bStride;
+        __m128 pax, pay, paz, paw, pbx, pby, pbz, pbw;
+        loadTransposed(ai + 4*sizeof(Float), aStride, pax, pay, paz, paw);
+        loadTransposed(bi + 4*sizeof(Float), bStride, pbx, pby, pbz, pbw);
+
+        #ifndef CORRADE_NO_ASSERT
+        if(_mm_movemask_ps(_mm_or_ps(
+            notNormalized(dot(pax, pay, paz, paw, pax, pay, paz, paw)),
+            notNormalized(dot(pbx, pby, pbz, pbw, pbx, pby, pbz, pbw)))))
+            break;
+        #endif
+
+        __m128 nax, nay, naz, naw, mbx, mby, mbz, mbw;
+        loadTransposed(ai + 8*sizeof(Float), aStride, nax, nay, naz, naw);
+        loadTransposed(bi, bStride, mbx, mby, mbz, mbw);
+
+        __m128 c0, c1, c2, c3;
+        hermiteBasis(load(t + offset*tStride, tStride), c0, c1, c2, c3);
+        const __m128 x = hermite(c0, pax, c1, nax, c2, pbx, c3, mbx);
+        const __m128 y = hermite(c0, pay, c1, nay, c2, pby, c3, mby);
+        const __m128 z = hermite(c0, paz, c1, naz, c2, pbz, c3, mbz);
+        const __m128 w = hermite(c0, paw, c1, naw, c2, pbw, c3, mbw);
+        const __m128 length = _mm_sqrt_ps(dot(x, y, z, w, x, y, z, w));
+        storeTransposed(out + offset*outStride, outStride,
+            _mm_div_ps(x, length), _mm_div_ps(y, length),
+            _mm_div_ps(z, length), _mm_div_ps(w, length));
+    }
+
+    return i;
+}
+#endif
+
+}
+
+void lerpInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& a, const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& b, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Vector3<Float>>& out) {
+    CORRADE_ASSERT(b.size() == a.size() && t.size() == a.size() && out.size() == a.size(),
+        "Math::lerpInto(): expected views of the same size but got" << a.size() << Corrade::Utility::Debug::nospace << "," << b.size() << Corrade::Utility::Debug::nospace << "," << t.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    i = lerpRun(
+        reinterpret_cast<const char*>(a.data()), a.stride(),
+        reinterpret_cast<const char*>(b.data()), b.stride(),
+        reinterpret_cast<const char*>(t.data()), t.stride(),
+        reinterpret_cast<char*>(out.data()), out.stride(), a.size());
+    #endif
+    for(; i != a.size(); ++i)
+        out[i] = Math::lerp(a[i], b[i], t[i]);
+}
+
+void lerpInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& out) {
+    CORRADE_ASSERT(normalizedB.size() == normalizedA.size() && t.size() == normalizedA.size() && out.size() == normalizedA.size(),
+        "Math::lerpInto(): expected views of the same size but got" << normalizedA.size() << Corrade::Utility::Debug::nospace << "," << normalizedB.size() << Corrade::Utility::Debug::nospace << "," << t.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    i = quaternionRun<QuaternionInterpolation::Lerp>(
+        reinterpret_cast<const char*>(normalizedA.data()), normalizedA.stride(),
+        reinterpret_cast<const char*>(normalizedB.data()), normalizedB.stride(),
+        reinterpret_cast<const char*>(t.data()), t.stride(),
+        reinterpret_cast<char*>(out.data()), out.stride(), normalizedA.size());
+    #endif
+    for(; i != normalizedA.size(); ++i)
+        out[i] = Math::lerp(normalizedA[i], normalizedB[i], t[i]);
+}
+
+void lerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& out) {
+    CORRADE_ASSERT(normalizedB.size() == normalizedA.size() && t.size() == normalizedA.size() && out.size() == normalizedA.size(),
+        "Math::lerpShortestPathInto(): expected views of the same size but got" << normalizedA.size() << Corrade::Utility::Debug::nospace << "," << normalizedB.size() << Corrade::Utility::Debug::nospace << "," << t.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    i = quaternionRun<QuaternionInterpolation::LerpShortestPath>(
+        reinterpret_cast<const char*>(normalizedA.data()), normalizedA.stride(),
+        reinterpret_cast<const char*>(normalizedB.data()), normalizedB.stride(),
+        reinterpret_cast<const char*>(t.data()), t.stride(),
+        reinterpret_cast<char*>(out.data()), out.stride(), normalizedA.size());
+    #endif
+    for(; i != normalizedA.size(); ++i)
+        out[i] = Math::lerpShortestPath(normalizedA[i], normalizedB[i], t[i]);
+}
+
+void slerpInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& out) {
+    CORRADE_ASSERT(normalizedB.size() == normalizedA.size() && t.size() == normalizedA.size() && out.size() == normalizedA.size(),
+        "Math::slerpInto(): expected views of the same size but got" << normalizedA.size() << Corrade::Utility::Debug::nospace << "," << normalizedB.size() << Corrade::Utility::Debug::nospace << "," << t.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    i = quaternionRun<QuaternionInterpolation::Slerp>(
+        reinterpret_cast<const char*>(normalizedA.data()), normalizedA.stride(),
+        reinterpret_cast<const char*>(normalizedB.data()), normalizedB.stride(),
+        reinterpret_cast<const char*>(t.data()), t.stride(),
+        reinterpret_cast<char*>(out.data()), out.stride(), normalizedA.size());
+    #endif
+    for(; i != normalizedA.size(); ++i)
+        out[i] = Math::slerp(normalizedA[i], normalizedB[i], t[i]);
+}
+
+void slerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& out) {
+    CORRADE_ASSERT(normalizedB.size() == normalizedA.size() && t.size() == normalizedA.size() && out.size() == normalizedA.size(),
+        "Math::slerpShortestPathInto(): expected views of the same size but got" << normalizedA.size() << Corrade::Utility::Debug::nospace << "," << normalizedB.size() << Corrade::Utility::Debug::nospace << "," << t.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    i = quaternionRun<QuaternionInterpolation::SlerpShortestPath>(
+        reinterpret_cast<const char*>(normalizedA.data()), normalizedA.stride(),
+        reinterpret_cast<const char*>(normalizedB.data()), normalizedB.stride(),
+        reinterpret_cast<const char*>(t.data()), t.stride(),
+        reinterpret_cast<char*>(out.data()), out.stride(), normalizedA.size());
+    #endif
+    for(; i != normalizedA.size(); ++i)
+        out[i] = Math::slerpShortestPath(normalizedA[i], normalizedB[i], t[i]);
+}
+
+void splerpInto(const Corrade::Containers::StridedArrayView1D<const CubicHermite3D<Float>>& a, const Corrade::Containers::StridedArrayView1D<const CubicHermite3D<Float>>& b, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Vector3<Float>>& out) {
+    CORRADE_ASSERT(b.size() == a.size() && t.size() == a.size() && out.size() == a.size(),
+        "Math::splerpInto(): expected views of the same size but got" << a.size() << Corrade::Utility::Debug::nospace << "," << b.size() << Corrade::Utility::Debug::nospace << "," << t.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    i = splerpVectorRun(
+        reinterpret_cast<const char*>(a.data()), a.stride(),
+        reinterpret_cast<const char*>(b.data()), b.stride(),
+        reinterpret_cast<const char*>(t.data()), t.stride(),
+        reinterpret_cast<char*>(out.data()), out.stride(), a.size());
+    #endif
+    for(; i != a.size(); ++i)
+        out[i] = Math::splerp(a[i], b[i], t[i]);
+}
+
+void splerpInto(const Corrade::Containers::StridedArrayView1D<const CubicHermiteQuaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const CubicHermiteQuaternion<Float>>& b, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& out) {
+    CORRADE_ASSERT(b.size() == a.size() && t.size() == a.size() && out.size() == a.size(),
+        "Math::splerpInto(): expected views of the same size but got" << a.size() << Corrade::Utility::Debug::nospace << "," << b.size() << Corrade::Utility::Debug::nospace << "," << t.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    i = splerpQuaternionRun(
+        reinterpret_cast<const char*>(a.data()), a.stride(),
+        reinterpret_cast<const char*>(b.data()), b.stride(),
+        reinterpret_cast<const char*>(t.data()), t.stride(),
+        reinterpret_cast<char*>(out.data()), out.stride(), a.size());
+    #endif
+    for(; i != a.size(); ++i)
+        out[i] = Math::splerp(a[i], b[i], t[i]);
+}
+
+}}
@@ -0,0 +1,165 @@
+#ifndef Magnum_Math_InterpolationBatch_h
+#define Magnum_Math_InterpolationBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Functions @ref Magnum::Math::lerpInto(), @ref Magnum::Math::lerpShortestPathInto(), @ref Magnum::Math::slerpInto(), @ref Magnum::Math::slerpShortestPathInto(), @ref Magnum::Math::splerpInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/visibility.h"
+#include "Magnum/Math/Math.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@{ @name Batch interpolation functions
+
+These functions interpolate an unbounded range of value pairs, each with its
+own interpolation factor, as opposed to the single-value functions in
+@ref Magnum/Math/Functions.h, @ref Magnum/Math/Quaternion.h and
+@ref Magnum/Math/CubicHermite.h. Item @cpp i @ce of @p out is the result of
+interpolating between item @cpp i @ce of @p a and @p b with the factor at
+item @cpp i @ce of @p t. All views are expected to have the same size.
+
+On platforms with SSE2 the values are processed four at a time, with the input
+data transposed from the array-of-structures layout to one vector per
+component. The operations are done in the same order as in the scalar
+functions so the results are the same. Spherical interpolation calculates the
+trigonometric functions for each value separately, as there are no SIMD
+instructions for these, but the rest is vectorized. Other platforms use just
+the scalar functions.
+*/
+
+/**
+@brief Batch linear interpolation of vectors
+@param[in]  a       First values
+@param[in]  b       Second values
+@param[in]  t       Interpolation phases
+@param[out] out     Where to put the result
+@m_since_latest
+
+Batch variant of @ref lerp(const T&, const T&, U). Expects that all views
+have the same size.
+*/
+MAGNUM_EXPORT void lerpInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& a, const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& b, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Vector3<Float>>& out);
+
+/**
+@brief Batch linear interpolation of quaternions
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases
+@param[out] out         Where to put the result
+@m_since_latest
+
+Batch variant of @ref lerp(const Quaternion<T>&, const Quaternion<T>&, T).
+Expects that all views have the same size. Same as there, all quaternions are
+expected to be normalized.
+*/
+MAGNUM_EXPORT void lerpInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& out);
+
+/**
+@brief Batch linear shortest-path interpolation of quaternions
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases
+@param[out] out         Where to put the result
+@m_since_latest
+
+Batch variant of @ref lerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T).
+Expects that all views have the same size. Same as there, all quaternions are
+expected to be normalized.
+*/
+MAGNUM_EXPORT void lerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& out);
+
+/**
+@brief Batch spherical linear interpolation of quaternions
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases
+@param[out] out         Where to put the result
+@m_since_latest
+
+Batch variant of @ref slerp(const Quaternion<T>&, const Quaternion<T>&, T).
+Expects that all views have the same size. Same as there, all quaternions are
+expected to be normalized.
+*/
+MAGNUM_EXPORT void slerpInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& out);
+
+/**
+@brief Batch spherical linear shortest-path interpolation of quaternions
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases
+@param[out] out         Where to put the result
+@m_since_latest
+
+Batch variant of @ref slerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T).
+Expects that all views have the same size. Same as there, all quaternions are
+expected to be normalized.
+*/
+MAGNUM_EXPORT void slerpShortestPathInto(const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Corrade::Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& out);
+
+/**
+@brief Batch spline interpolation of cubic Hermite vectors
+@param[in]  a       First spline points
+@param[in]  b       Second spline points
+@param[in]  t       Interpolation phases
+@param[out] out     Where to put the result
+@m_since_latest
+
+Batch variant of @ref splerp(const CubicHermite<T>&, const CubicHermite<T>&, U).
+Expects that all views have the same size.
+*/
+MAGNUM_EXPORT void splerpInto(const Corrade::Containers::StridedArrayView1D<const CubicHermite3D<Float>>& a, const Corrade::Containers::StridedArrayView1D<const CubicHermite3D<Float>>& b, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Vector3<Float>>& out);
+
+/**
+@brief Batch spline interpolation of cubic Hermite quaternions
+@param[in]  a       First spline points
+@param[in]  b       Second spline points
+@param[in]  t       Interpolation phases
+@param[out] out     Where to put the result
+@m_since_latest
+
+Batch variant of @ref splerp(const CubicHermiteQuaternion<T>&, const CubicHermiteQuaternion<T>&, T).
+Expects that all views have the same size. Same as there, the
+@ref CubicHermite::point() is expected to be a normalized quaternion in all
+items of @p a and @p b.
+*/
+MAGNUM_EXPORT void splerpInto(const Corrade::Containers::StridedArrayView1D<const CubicHermiteQuaternion<Float>>& a, const Corrade::Containers::StridedArrayView1D<const CubicHermiteQuaternion<Float>>& b, const Corrade::Containers::StridedArrayView1D<const Float>& t, const Corrade::Containers::StridedArrayView1D<Quaternion<Float>>& out);
+
+/* Since 1.8.17, the original short-hand group closing doesn't work anymore.
+   FFS. */
+/**
+ * @}
+ */
+
+}}
+
+#endif
@@ -212,7 +212,10 @@ template<class T> bool aabbFrustum(const Vector3<T>& aabbCenter, const Vector3<T
 
 Checks for each plane of the frustum whether the sphere is behind the plane
 (the points distance larger than the sphere's radius) using
-@ref Distance::pointPlaneScaled().
+@ref Distance::pointPlaneScaled(). The distance is measured in units of the
+plane normal length, so the planes are expected to have normalized normals ---
+which isn't the case for a frustum created using
+@ref Frustum::fromMatrix(), normalize the planes first in that case.
 */
 template<class T> bool sphereFrustum(const Vector3<T>& sphereCenter, T sphereRadius, const Frustum<T>& frustum);
 
@@ -468,12 +471,10 @@ template<class T> bool aabbFrustum(const Vector3<T>& aabbCenter, const Vector3<T
 }
 
 template<class T> bool sphereFrustum(const Vector3<T>& sphereCenter, const T sphereRadius, const Frustum<T>& frustum) {
-    const T radiusSq = sphereRadius*sphereRadius;
-
     for(const Vector4<T>& plane: frustum) {
         /* The sphere is in front of one of the frustum planes (normals point
            outwards) */
-        if(Distance::pointPlaneScaled<T>(sphereCenter, plane) < -radiusSq)
+        if(Distance::pointPlaneScaled<T>(sphereCenter, plane) < -sphereRadius)
             return false;
     }
 
@@ -0,0 +1,348 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "IntersectionBatch.h"
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Intersection.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Magnum { namespace Math { namespace Intersection {
+
+namespace {
+
+/* Tests items from the first one until the end one by one, writing whole
+   bytes of the mask. The first item is expected to be a multiple of 8. */
+template<class F> inline void scalarRun(std::size_t i, const std::size_t count, UnsignedByte* const mask, F test) {
+    for(; i < count; i += 8) {
+        UnsignedByte bits = 0;
+        const std::size_t end = Math::min(count - i, std::size_t{8});
+        for(std::size_t j = 0; j != end; ++j)
+            if(test(i + j)) bits |= 1 << j;
+        mask[i/8] = bits;
+    }
+}
+
+#ifdef CORRADE_TARGET_SSE2
+/* SSE2 kernels, each processing a multiple of eight items and returning the
+   count of items processed. The rest is handled by scalarRun(). The
+   operations are done in the same order as in the scalar functions so the
+   results are the same. SSE2 is the baseline on x86-64, so no runtime
+   dispatch is needed; other targets use just the scalar code. */
+
+/* Loads four three-component vectors and transposes them to one vector per
+   coordinate. Tightly packed vectors are loaded as three full vectors and
+   shuffled into place, otherwise each component is loaded separately. */
+inline void loadTransposed(const char* const data, const std::ptrdiff_t stride, __m128& x, __m128& y, __m128& z) {
+    if(stride == std::ptrdiff_t(3*sizeof(Float))) {
+        /* a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3 */
+        const Float* const f = reinterpret_cast<const Float*>(data);
+        const __m128 a = _mm_loadu_ps(f);
+        const __m128 b = _mm_loadu_ps(f + 4);
+        const __m128 c = _mm_loadu_ps(f + 8);
+        x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    } else {
+        const Float* const p0 = reinterpret_cast<const Float*>(data);
+        const Float* const p1 = reinterpret_cast<const Float*>(data + stride);
+        const Float* const p2 = reinterpret_cast<const Float*>(data + 2*stride);
+        const Float* const p3 = reinterpret_cast<const Float*>(data + 3*stride);
+        x = _mm_setr_ps(p0[0], p1[0], p2[0], p3[0]);
+        y = _mm_setr_ps(p0[1], p1[1], p2[1], p3[1]);
+        z = _mm_setr_ps(p0[2], p1[2], p2[2], p3[2]);
+    }
+}
+
+inline __m128 load(const char* const data, const std::ptrdiff_t stride) {
+    if(stride == std::ptrdiff_t(sizeof(Float)))
+        return _mm_loadu_ps(reinterpret_cast<const Float*>(data));
+    return _mm_setr_ps(
+        *reinterpret_cast<const Float*>(data),
+        *reinterpret_cast<const Float*>(data + stride),
+        *reinterpret_cast<const Float*>(data + 2*stride),
+        *reinterpret_cast<const Float*>(data + 3*stride));
+}
+
+/* a*b + c*d + e*f, in this order */
+inline __m128 dot(const __m128 a, const __m128 b, const __m128 c, const __m128 d, const __m128 e, const __m128 f) {
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, b), _mm_mul_ps(c, d)), _mm_mul_ps(e, f));
+}
+
+/* Frustum planes broadcast to all lanes, together with absolute values of
+   the normals for the box tests */
+struct Planes {
+    explicit Planes(const Frustum<Float>& frustum) {
+        for(std::size_t i = 0; i != 6; ++i) {
+            nx[i] = _mm_set1_ps(frustum[i].x());
+            ny[i] = _mm_set1_ps(frustum[i].y());
+            nz[i] = _mm_set1_ps(frustum[i].z());
+            w[i] = _mm_set1_ps(frustum[i].w());
+            absNx[i] = _mm_set1_ps(Math::abs(frustum[i].x()));
+            absNy[i] = _mm_set1_ps(Math::abs(frustum[i].y()));
+            absNz[i] = _mm_set1_ps(Math::abs(frustum[i].z()));
+        }
+    }
+
+    __m128 nx[6], ny[6], nz[6], w[6];
+    __m128 absNx[6], absNy[6], absNz[6];
+};
+
+std::size_t sphereFrustumRun(const char* const centers, const std::ptrdiff_t centerStride, const char* const radii, const std::ptrdiff_t radiusStride, const Frustum<Float>& frustum, UnsignedByte* const mask, const std::size_t count) {
+    const Planes planes{frustum};
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        Int bits = 0;
+        for(std::size_t half = 0; half != 2; ++half) {
+            const std::ptrdiff_t offset = std::ptrdiff_t(i + half*4);
+            __m128 x, y, z;
+            loadTransposed(centers + offset*centerStride, centerStride, x, y, z);
+            const __m128 negativeRadius = _mm_xor_ps(load(radii + offset*radiusStride, radiusStride), signMask);
+
+            /* Outside if behind any plane */
+            __m128 outside = _mm_setzero_ps();
+            for(std::size_t p = 0; p != 6; ++p) {
+                const __m128 distance = _mm_add_ps(dot(planes.nx[p], x, planes.ny[p], y, planes.nz[p], z), planes.w[p]);
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negativeRadius));
+            }
+
+            bits |= (~_mm_movemask_ps(outside) & 0xf) << half*4;
+        }
+        mask[i/8] = UnsignedByte(bits);
+    }
+
+    return i;
+}
+
+std::size_t aabbFrustumRun(const char* const centers, const std::ptrdiff_t centerStride, const char* const extents, const std::ptrdiff_t extentStride, const Frustum<Float>& frustum, UnsignedByte* const mask, const std::size_t count) {
+    const Planes planes{frustum};
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        Int bits = 0;
+        for(std::size_t half = 0; half != 2; ++half) {
+            const std::ptrdiff_t offset = std::ptrdiff_t(i + half*4);
+            __m128 cx, cy, cz, ex, ey, ez;
+            loadTransposed(centers + offset*centerStride, centerStride, cx, cy, cz);
+            loadTransposed(extents + offset*extentStride, extentStride, ex, ey, ez);
+
+            __m128 outside = _mm_setzero_ps();
+            for(std::size_t p = 0; p != 6; ++p) {
+                const __m128 d = dot(cx, planes.nx[p], cy, planes.ny[p], cz, planes.nz[p]);
+                const __m128 r = dot(ex, planes.absNx[p], ey, planes.absNy[p], ez, planes.absNz[p]);
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(d, r), _mm_xor_ps(planes.w[p], signMask)));
+            }
+
+            bits |= (~_mm_movemask_ps(outside) & 0xf) << half*4;
+        }
+        mask[i/8] = UnsignedByte(bits);
+    }
+
+    return i;
+}
+
+std::size_t rangeFrustumRun(const char* const ranges, const std::ptrdiff_t stride, const Frustum<Float>& frustum, UnsignedByte* const mask, const std::size_t count) {
+    const Planes planes{frustum};
+
+    /* Same as in the scalar variant, the range is converted to a doubled
+       center and extent, which is then compared to doubled plane distance */
+    __m128 doubleNegativeW[6];
+    for(std::size_t p = 0; p != 6; ++p)
+        doubleNegativeW[p] = _mm_set1_ps(-2.0f*frustum[p].w());
+
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        Int bits = 0;
+        for(std::size_t half = 0; half != 2; ++half) {
+            const char* const data = ranges + std::ptrdiff_t(i + half*4)*stride;
+            __m128 minX, minY, minZ, maxX, maxY, maxZ;
+            loadTransposed(data, stride, minX, minY, minZ);
+            loadTransposed(data + 3*sizeof(Float), stride, maxX, maxY, maxZ);
+            const __m128 cx = _mm_add_ps(minX, maxX);
+            const __m128 cy = _mm_add_ps(minY, maxY);
+            const __m128 cz = _mm_add_ps(minZ, maxZ);
+            const __m128 ex = _mm_sub_ps(maxX, minX);
+            const __m128 ey = _mm_sub_ps(maxY, minY);
+            const __m128 ez = _mm_sub_ps(maxZ, minZ);
+
+            __m128 outside = _mm_setzero_ps();
+            for(std::size_t p = 0; p != 6; ++p) {
+                const __m128 d = dot(cx, planes.nx[p], cy, planes.ny[p], cz, planes.nz[p]);
+                const __m128 r = dot(ex, planes.absNx[p], ey, planes.absNy[p], ez, planes.absNz[p]);
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(d, r), doubleNegativeW[p]));
+            }
+
+            bits |= (~_mm_movemask_ps(outside) & 0xf) << half*4;
+        }
+        mask[i/8] = UnsignedByte(bits);
+    }
+
+    return i;
+}
+
+std::size_t sphereConeRun(const char* const centers, const std::ptrdiff_t centerStride, const char* const radii, const std::ptrdiff_t radiusStride, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, const Float sinAngle, const Float tanAngleSqPlusOne, UnsignedByte* const mask, const std::size_t count) {
+    const __m128 ox = _mm_set1_ps(coneOrigin.x());
+    const __m128 oy = _mm_set1_ps(coneOrigin.y());
+    const __m128 oz = _mm_set1_ps(coneOrigin.z());
+    const __m128 nx = _mm_set1_ps(coneNormal.x());
+    const __m128 ny = _mm_set1_ps(coneNormal.y());
+    const __m128 nz = _mm_set1_ps(coneNormal.z());
+    const __m128 sine = _mm_set1_ps(sinAngle);
+    const __m128 tanSqPlusOne = _mm_set1_ps(tanAngleSqPlusOne);
+    const __m128 zero = _mm_setzero_ps();
+
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        Int bits = 0;
+        for(std::size_t half = 0; half != 2; ++half) {
+            const std::ptrdiff_t offset = std::ptrdiff_t(i + half*4);
+            __m128 x, y, z;
+            loadTransposed(centers + offset*centerStride, centerStride, x, y, z);
+            const __m128 radius = load(radii + offset*radiusStride, radiusStride);
+
+            const __m128 dx = _mm_sub_ps(x, ox);
+            const __m128 dy = _mm_sub_ps(y, oy);
+            const __m128 dz = _mm_sub_ps(z, oz);
+
+            /* Point - cone test, whether the sphere is in front of the cone
+               origin */
+            const __m128 radiusSin = _mm_mul_ps(radius, sine);
+            const __m128 front = _mm_cmpgt_ps(dot(
+                _mm_sub_ps(dx, _mm_mul_ps(radiusSin, nx)), nx,
+                _mm_sub_ps(dy, _mm_mul_ps(radiusSin, ny)), ny,
+                _mm_sub_ps(dz, _mm_mul_ps(radiusSin, nz)), nz), zero);
+
+            /* In front of the origin, cone test */
+            const __m128 cx = _mm_add_ps(_mm_mul_ps(sine, dx), _mm_mul_ps(nx, radius));
+            const __m128 cy = _mm_add_ps(_mm_mul_ps(sine, dy), _mm_mul_ps(ny, radius));
+            const __m128 cz = _mm_add_ps(_mm_mul_ps(sine, dz), _mm_mul_ps(nz, radius));
+            const __m128 lenA = dot(cx, nx, cy, ny, cz, nz);
+            const __m128 inCone = _mm_cmple_ps(dot(cx, cx, cy, cy, cz, cz), _mm_mul_ps(_mm_mul_ps(lenA, lenA), tanSqPlusOne));
+
+            /* Behind the origin, simple sphere point check */
+            const __m128 inSphere = _mm_cmple_ps(dot(dx, dx, dy, dy, dz, dz), _mm_mul_ps(radius, radius));
+
+            const __m128 intersects = _mm_or_ps(_mm_and_ps(front, inCone), _mm_andnot_ps(front, inSphere));
+            bits |= _mm_movemask_ps(intersects) << half*4;
+        }
+        mask[i/8] = UnsignedByte(bits);
+    }
+
+    return i;
+}
+#endif
+
+}
+
+void sphereFrustum(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Corrade::Containers::StridedArrayView1D<const Float>& sphereRadii, const Frustum<Float>& frustum, const Corrade::Containers::ArrayView<UnsignedByte>& mask) {
+    CORRADE_ASSERT(sphereRadii.size() == sphereCenters.size(),
+        "Math::Intersection::sphereFrustum(): expected" << sphereCenters.size() << "radii but got" << sphereRadii.size(), );
+    CORRADE_ASSERT(mask.size() == (sphereCenters.size() + 7)/8,
+        "Math::Intersection::sphereFrustum(): expected a mask of" << (sphereCenters.size() + 7)/8 << "bytes but got" << mask.size(), );
+
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    i = sphereFrustumRun(
+        reinterpret_cast<const char*>(sphereCenters.data()), sphereCenters.stride(),
+        reinterpret_cast<const char*>(sphereRadii.data()), sphereRadii.stride(),
+        frustum, mask.data(), sphereCenters.size());
+    #endif
+    scalarRun(i, sphereCenters.size(), mask.data(), [&](std::size_t j) {
+        return sphereFrustum(sphereCenters[j], sphereRadii[j], frustum);
+    });
+}
+
+void aabbFrustum(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& aabbCenters, const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& aabbExtents, const Frustum<Float>& frustum, const Corrade::Containers::ArrayView<UnsignedByte>& mask) {
+    CORRADE_ASSERT(aabbExtents.size() == aabbCenters.size(),
+        "Math::Intersection::aabbFrustum(): expected" << aabbCenters.size() << "extents but got" << aabbExtents.size(), );
+    CORRADE_ASSERT(mask.size() == (aabbCenters.size() + 7)/8,
+        "Math::Intersection::aabbFrustum(): expected a mask of" << (aabbCenters.size() + 7)/8 << "bytes but got" << mask.size(), );
+
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    i = aabbFrustumRun(
+        reinterpret_cast<const char*>(aabbCenters.data()), aabbCenters.stride(),
+        reinterpret_cast<const char*>(aabbExtents.data()), aabbExtents.stride(),
+        frustum, mask.data(), aabbCenters.size());
+    #endif
+    scalarRun(i, aabbCenters.size(), mask.data(), [&](std::size_t j) {
+        return aabbFrustum(aabbCenters[j], aabbExtents[j], frustum);
+    });
+}
+
+void rangeFrustum(const Corrade::Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const Frustum<Float>& frustum, const Corrade::Containers::ArrayView<UnsignedByte>& mask) {
+    CORRADE_ASSERT(mask.size() == (ranges.size() + 7)/8,
+        "Math::Intersection::rangeFrustum(): expected a mask of" << (ranges.size() + 7)/8 << "bytes but got" << mask.size(), );
+
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    i = rangeFrustumRun(
+        reinterpret_cast<const char*>(ranges.data()), ranges.stride(),
+        frustum, mask.data(), ranges.size());
+    #endif
+    scalarRun(i, ranges.size(), mask.data(), [&](std::size_t j) {
+        return rangeFrustum(ranges[j], frustum);
+    });
+}
+
+void sphereCone(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Corrade::Containers::StridedArrayView1D<const Float>& sphereRadii, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, const Float sinAngle, const Float tanAngleSqPlusOne, const Corrade::Containers::ArrayView<UnsignedByte>& mask) {
+    CORRADE_ASSERT(sphereRadii.size() == sphereCenters.size(),
+        "Math::Intersection::sphereCone(): expected" << sphereCenters.size() << "radii but got" << sphereRadii.size(), );
+    CORRADE_ASSERT(mask.size() == (sphereCenters.size() + 7)/8,
+        "Math::Intersection::sphereCone(): expected a mask of" << (sphereCenters.size() + 7)/8 << "bytes but got" << mask.size(), );
+
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    i = sphereConeRun(
+        reinterpret_cast<const char*>(sphereCenters.data()), sphereCenters.stride(),
+        reinterpret_cast<const char*>(sphereRadii.data()), sphereRadii.stride(),
+        coneOrigin, coneNormal, sinAngle, tanAngleSqPlusOne,
+        mask.data(), sphereCenters.size());
+    #endif
+    scalarRun(i, sphereCenters.size(), mask.data(), [&](std::size_t j) {
+        return sphereCone(sphereCenters[j], sphereRadii[j], coneOrigin, coneNormal, sinAngle, tanAngleSqPlusOne);
+    });
+}
+
+void sphereCone(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Corrade::Containers::StridedArrayView1D<const Float>& sphereRadii, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, const Rad<Float> coneAngle, const Corrade::Containers::ArrayView<UnsignedByte>& mask) {
+    /* Same as in the scalar variant */
+    const Rad<Float> halfAngle = coneAngle*0.5f;
+    const Float sinAngle = Math::sin(halfAngle);
+    const Float tanAngleSqPlusOne = 1.0f + Math::pow<Float>(Math::tan<Float>(halfAngle), 2.0f);
+
+    sphereCone(sphereCenters, sphereRadii, coneOrigin, coneNormal, sinAngle, tanAngleSqPlusOne, mask);
+}
+
+}}}
@@ -0,0 +1,144 @@
+#ifndef Magnum_Math_IntersectionBatch_h
+#define Magnum_Math_IntersectionBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Batch variants of @ref Magnum::Math::Intersection::sphereFrustum(), @ref Magnum::Math::Intersection::aabbFrustum(), @ref Magnum::Math::Intersection::rangeFrustum() and @ref Magnum::Math::Intersection::sphereCone()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/visibility.h"
+#include "Magnum/Math/Math.h"
+
+namespace Magnum { namespace Math { namespace Intersection {
+
+/**
+@{ @name Batch intersection functions
+
+These functions test an unbounded range of objects against a single frustum or
+cone, as opposed to the single-object functions in
+@ref Magnum/Math/Intersection.h. The result is written into a bit mask, where
+bit @cpp i % 8 @ce of byte @cpp i / 8 @ce is set if the @cpp i @ce-th object
+intersects. The mask is expected to be exactly @cpp (count + 7)/8 @ce bytes
+large; bits past the object count in the last byte are set to zero.
+
+On platforms with SSE2 the objects are processed eight at a time, with the
+input data transposed from the array-of-structures layout to one vector per
+coordinate. Tightly packed inputs are transposed with full-width loads and
+shuffles, strided inputs with per-item loads. The results are the same as with
+the scalar functions. Other platforms use just the scalar functions.
+*/
+
+/**
+@brief Intersection of spheres and a frustum
+@param[in]  sphereCenters   Sphere centers
+@param[in]  sphereRadii     Sphere radii
+@param[in]  frustum         Frustum planes with normals pointing outwards
+@param[out] mask            Bit mask with intersecting spheres set
+@m_since_latest
+
+Batch variant of @ref sphereFrustum(const Vector3<T>&, T, const Frustum<T>&).
+Same as there, the planes are expected to have normalized normals. Expects
+that @p sphereCenters and @p sphereRadii have the same size and that @p mask
+is @cpp (sphereCenters.size() + 7)/8 @ce bytes large.
+*/
+MAGNUM_EXPORT void sphereFrustum(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Corrade::Containers::StridedArrayView1D<const Float>& sphereRadii, const Frustum<Float>& frustum, const Corrade::Containers::ArrayView<UnsignedByte>& mask);
+
+/**
+@brief Intersection of axis-aligned boxes and a frustum
+@param[in]  aabbCenters     Box centers
+@param[in]  aabbExtents     Box (half-)extents
+@param[in]  frustum         Frustum planes with normals pointing outwards
+@param[out] mask            Bit mask with intersecting boxes set
+@m_since_latest
+
+Batch variant of @ref aabbFrustum(const Vector3<T>&, const Vector3<T>&, const Frustum<T>&).
+Expects that @p aabbCenters and @p aabbExtents have the same size and that
+@p mask is @cpp (aabbCenters.size() + 7)/8 @ce bytes large.
+*/
+MAGNUM_EXPORT void aabbFrustum(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& aabbCenters, const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& aabbExtents, const Frustum<Float>& frustum, const Corrade::Containers::ArrayView<UnsignedByte>& mask);
+
+/**
+@brief Intersection of ranges and a frustum
+@param[in]  ranges          Ranges
+@param[in]  frustum         Frustum planes with normals pointing outwards
+@param[out] mask            Bit mask with intersecting ranges set
+@m_since_latest
+
+Batch variant of @ref rangeFrustum(const Range3D<T>&, const Frustum<T>&).
+Expects that @p mask is @cpp (ranges.size() + 7)/8 @ce bytes large.
+*/
+MAGNUM_EXPORT void rangeFrustum(const Corrade::Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const Frustum<Float>& frustum, const Corrade::Containers::ArrayView<UnsignedByte>& mask);
+
+/**
+@brief Intersection of spheres and a cone using precomputed values
+@param[in]  sphereCenters       Sphere centers
+@param[in]  sphereRadii         Sphere radii
+@param[in]  coneOrigin          Cone origin
+@param[in]  coneNormal          Cone normal
+@param[in]  sinAngle            Precomputed sine of half the cone's opening
+    angle
+@param[in]  tanAngleSqPlusOne   Precomputed
+    @f$ \tan^2 \theta + 1 @f$, where @f$ \theta @f$ is half the cone's
+    opening angle
+@param[out] mask                Bit mask with intersecting spheres set
+@m_since_latest
+
+Batch variant of @ref sphereCone(const Vector3<T>&, T, const Vector3<T>&, const Vector3<T>&, T, T).
+Expects that @p sphereCenters and @p sphereRadii have the same size and that
+@p mask is @cpp (sphereCenters.size() + 7)/8 @ce bytes large.
+*/
+MAGNUM_EXPORT void sphereCone(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Corrade::Containers::StridedArrayView1D<const Float>& sphereRadii, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, Float sinAngle, Float tanAngleSqPlusOne, const Corrade::Containers::ArrayView<UnsignedByte>& mask);
+
+/**
+@brief Intersection of spheres and a cone
+@param[in]  sphereCenters   Sphere centers
+@param[in]  sphereRadii     Sphere radii
+@param[in]  coneOrigin      Cone origin
+@param[in]  coneNormal      Cone normal
+@param[in]  coneAngle       Cone opening angle (@f$ 0 < \Theta < \pi @f$)
+@param[out] mask            Bit mask with intersecting spheres set
+@m_since_latest
+
+Batch variant of @ref sphereCone(const Vector3<T>&, T, const Vector3<T>&, const Vector3<T>&, Rad<T>).
+Calculates the sine and tangent values once and then delegates to
+@ref sphereCone(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>&, const Corrade::Containers::StridedArrayView1D<const Float>&, const Vector3<Float>&, const Vector3<Float>&, Float, Float, const Corrade::Containers::ArrayView<UnsignedByte>&).
+*/
+MAGNUM_EXPORT void sphereCone(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Corrade::Containers::StridedArrayView1D<const Float>& sphereRadii, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, Rad<Float> coneAngle, const Corrade::Containers::ArrayView<UnsignedByte>& mask);
+
+/* Since 1.8.17, the original short-hand group closing doesn't work anymore.
+   FFS. */
+/**
+ * @}
+ */
+
+}}}
+
+#endif
@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Functions @ref Magnum::Math::pack(), @ref Magnum::Math::unpack(), @ref Magnum::Math::packHalf(), @ref Magnum::Math::unpackHalf()
+ * @brief Functions @ref Magnum::Math::pack(), @ref Magnum::Math::unpack(), @ref Magnum::Math::packHalf(), @ref Magnum::Math::unpackHalf(), @ref Magnum::Math::packOctahedral(), @ref Magnum::Math::unpackOctahedral()
  */
 
 #include "Magnum/Math/Functions.h"
@@ -217,6 +217,134 @@ template<std::size_t size> Vector<size, Float> unpackHalf(const Vector<size, Uns
     return out;
 }
 
+namespace Implementation {
+
+template<class T> inline T octahedralSignNotZero(T value) {
+    return value < T(0) ? T(-1) : T(1);
+}
+
+/* Folds the lower hemisphere over the diagonals. Used by both encoding and
+   decoding as the operation is its own inverse. */
+template<class T> inline void octahedralWrap(T& x, T& y) {
+    const T wrappedX = (T(1) - abs(y))*octahedralSignNotZero(x);
+    y = (T(1) - abs(x))*octahedralSignNotZero(y);
+    x = wrappedX;
+}
+
+template<class T> inline Vector<2, T> octahedralEncode(const Vector<3, T>& direction) {
+    const T invL1 = T(1)/(abs(direction[0]) + abs(direction[1]) + abs(direction[2]));
+    T x = direction[0]*invL1;
+    T y = direction[1]*invL1;
+    if(direction[2] < T(0)) octahedralWrap(x, y);
+    return {x, y};
+}
+
+template<class T> inline Vector<3, T> octahedralDecode(T x, T y) {
+    const T z = T(1) - abs(x) - abs(y);
+    if(z < T(0)) octahedralWrap(x, y);
+    const Vector<3, T> out{x, y, z};
+    return out/out.length();
+}
+
+template<class FloatingPoint, class T> inline typename std::enable_if<IsIntegral<T>::value, FloatingPoint>::type octahedralComponent(T value) {
+    return unpack<FloatingPoint>(value);
+}
+template<class FloatingPoint, class T> inline typename std::enable_if<IsFloatingPoint<T>::value, FloatingPoint>::type octahedralComponent(T value) {
+    return FloatingPoint(value);
+}
+
+}
+
+/**
+@brief Unpack an octahedral-encoded unit vector
+@m_since_latest
+
+Inverse to @ref packOctahedral(). The @p value is expected to be a
+two-component vector of @ref Magnum::Byte "Byte", @ref Magnum::Short "Short"
+or a floating-point type, the returned value is always normalized. Example
+usage:
+
+@snippet MagnumMath.cpp unpackOctahedral
+
+@see @ref unpackOctahedralInto()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class FloatingPoint, class T> inline FloatingPoint unpackOctahedral(const Vector<2, T>& value);
+#else
+template<class FloatingPoint, class T> inline FloatingPoint unpackOctahedral(const Vector<2, T>& value) {
+    static_assert(FloatingPoint::Size == 3 && IsFloatingPoint<typename FloatingPoint::Type>::value,
+        "unpacking must be done to a three-component floating-point vector");
+    typedef typename FloatingPoint::Type F;
+    return FloatingPoint{Implementation::octahedralDecode(
+        Implementation::octahedralComponent<F>(value[0]),
+        Implementation::octahedralComponent<F>(value[1]))};
+}
+#endif
+
+/**
+@brief Pack a unit vector using octahedral encoding
+@m_since_latest
+
+Projects @p value onto an octahedron and unfolds it onto a square, resulting
+in two components in the @f$ [-1, 1] @f$ range. The `T` type is expected to be
+a two-component vector of either a floating-point type, in which case the
+coordinates are returned as-is, or @ref Magnum::Byte "Byte" / @ref Magnum::Short "Short",
+in which case they're packed to a signed normalized representation. Compared
+to packing all three components with @ref pack(), the octahedral
+representation needs only two thirds of the space while having a more uniform
+distribution of the representable directions, so the precision is comparable
+or better. For integral types, all four nearest representable values are
+tried and the one decoding closest to @p value is picked, instead of simply
+rounding each component.
+
+The @p value is expected to be non-zero, but doesn't need to be normalized.
+Example usage:
+
+@snippet MagnumMath.cpp packOctahedral
+
+Algorithm used: *Zina H. Cigolle, Sam Donow, Daniel Evangelakos, Michael Mara,
+Morgan McGuire, Quirin Meyer --- A Survey of Efficient Representations for
+Independent Unit Vectors, JCGT 3(2), 2014, http://jcgt.org/published/0003/02/01/*.
+@see @ref unpackOctahedral(), @ref packOctahedralInto()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T, class FloatingPoint> inline T packOctahedral(const Vector<3, FloatingPoint>& value);
+#else
+template<class T, class FloatingPoint> inline typename std::enable_if<IsFloatingPoint<typename T::Type>::value, T>::type packOctahedral(const Vector<3, FloatingPoint>& value) {
+    static_assert(T::Size == 2,
+        "packing must be done to a two-component vector");
+    return T{Implementation::octahedralEncode(value)};
+}
+template<class T, class FloatingPoint> typename std::enable_if<IsIntegral<typename T::Type>::value, T>::type packOctahedral(const Vector<3, FloatingPoint>& value) {
+    static_assert(T::Size == 2 && std::is_signed<typename T::Type>::value,
+        "packing must be done to a two-component signed integral vector");
+    typedef typename T::Type Integral;
+    const Vector<2, FloatingPoint> encoded = Implementation::octahedralEncode(value);
+    const Vector<3, FloatingPoint> normalized = value.normalized();
+    constexpr FloatingPoint bitMax = Implementation::bitMax<Integral>();
+    const FloatingPoint x = encoded[0]*bitMax;
+    const FloatingPoint y = encoded[1]*bitMax;
+
+    /* Try all four combinations of rounding down and up, pick the one that
+       decodes closest to the input */
+    T out{Magnum::NoInit};
+    FloatingPoint bestDot = FloatingPoint(-2);
+    for(UnsignedInt i = 0; i != 4; ++i) {
+        const Vector<2, Integral> candidate{
+            Integral(i & 1 ? ceil(x) : floor(x)),
+            Integral(i & 2 ? ceil(y) : floor(y))};
+        const FloatingPoint d = dot(normalized, Implementation::octahedralDecode(
+            unpack<FloatingPoint>(candidate[0]),
+            unpack<FloatingPoint>(candidate[1])));
+        if(d > bestDot) {
+            bestDot = d;
+            out = T{candidate};
+        }
+    }
+    return out;
+}
+#endif
+
 /* Since 1.8.17, the original short-hand group closing doesn't work anymore.
    FFS. */
 /**
@@ -29,33 +29,316 @@
 #include <Corrade/Utility/Assert.h>
 
 #include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/Math/Implementation/halfTables.hpp"
 
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace Magnum { namespace Math {
 
 namespace {
 
+/* If both views are contiguous in the first dimension as well, they're
+   processed as a single run, which lets the vectorized paths operate on more
+   than a few items at a time. Otherwise each row is a separate run. */
+template<class T, class U> inline void runs(const Corrade::Containers::StridedArrayView2D<T>& src, const Corrade::Containers::StridedArrayView2D<U>& dst, std::size_t& runCount, std::size_t& runSize, std::ptrdiff_t& srcStride, std::ptrdiff_t& dstStride) {
+    if(src.isContiguous() && dst.isContiguous()) {
+        runCount = 1;
+        runSize = src.size()[0]*src.size()[1];
+        srcStride = 0;
+        dstStride = 0;
+    } else {
+        runCount = src.size()[0];
+        runSize = src.size()[1];
+        srcStride = src.stride()[0];
+        dstStride = dst.stride()[0];
+    }
+}
+
+#ifdef CORRADE_TARGET_SSE2
+/* SSE2 kernels operating on contiguous runs of data. Each returns the count
+   of items it processed, the remaining tail is handled by the scalar loop in
+   the caller. SSE2 is the baseline on x86-64, so no runtime dispatch is
+   needed; other targets use just the scalar code. */
+
+/* Widens eight consecutive items to two vectors of 32-bit integers */
+inline void widen(const UnsignedByte* const src, __m128i& a, __m128i& b) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i in = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)), zero);
+    a = _mm_unpacklo_epi16(in, zero);
+    b = _mm_unpackhi_epi16(in, zero);
+}
+
+inline void widen(const Byte* const src, __m128i& a, __m128i& b) {
+    const __m128i in8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+    const __m128i in = _mm_srai_epi16(_mm_unpacklo_epi8(in8, in8), 8);
+    a = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+    b = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+}
+
+inline void widen(const UnsignedShort* const src, __m128i& a, __m128i& b) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    a = _mm_unpacklo_epi16(in, zero);
+    b = _mm_unpackhi_epi16(in, zero);
+}
+
+inline void widen(const Short* const src, __m128i& a, __m128i& b) {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    a = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+    b = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+}
+
+inline void widen(const Int* const src, __m128i& a, __m128i& b) {
+    a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4));
+}
+
+/* Narrows two vectors of 32-bit integers to eight consecutive items, with
+   saturation */
+inline void narrow(const __m128i a, const __m128i b, UnsignedByte* const dst) {
+    const __m128i out = _mm_packs_epi32(a, b);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(out, out));
+}
+
+inline void narrow(const __m128i a, const __m128i b, Byte* const dst) {
+    const __m128i out = _mm_packs_epi32(a, b);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi16(out, out));
+}
+
+inline void narrow(const __m128i a, const __m128i b, UnsignedShort* const dst) {
+    /* There's no unsigned 32-to-16-bit pack in SSE2, bias the values to the
+       signed range and back */
+    const __m128i bias = _mm_set1_epi32(0x8000);
+    const __m128i out = _mm_packs_epi32(_mm_sub_epi32(a, bias), _mm_sub_epi32(b, bias));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_xor_si128(out, _mm_set1_epi16(-0x8000)));
+}
+
+inline void narrow(const __m128i a, const __m128i b, Short* const dst) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(a, b));
+}
+
+inline void narrow(const __m128i a, const __m128i b, Int* const dst) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), a);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4), b);
+}
+
+/* Rounds half away from zero, to match std::round() in the scalar code. The
+   fraction is calculated exactly, so there's no double rounding as with the
+   usual x + 0.5 trick. */
+inline __m128i roundToInt(const __m128 value) {
+    const __m128i truncated = _mm_cvttps_epi32(value);
+    const __m128 fraction = _mm_and_ps(_mm_sub_ps(value, _mm_cvtepi32_ps(truncated)), _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)));
+    const __m128i roundAway = _mm_castps_si128(_mm_cmpge_ps(fraction, _mm_set1_ps(0.5f)));
+    /* -1 for negative values, +1 for positive */
+    const __m128i sign = _mm_or_si128(_mm_srai_epi32(_mm_castps_si128(value), 31), _mm_set1_epi32(1));
+    return _mm_add_epi32(truncated, _mm_and_si128(roundAway, sign));
+}
+
+template<class T> std::size_t unpackUnsignedRun(const T* const src, Float* const dst, const std::size_t count) {
+    const __m128 bitMax = _mm_set1_ps(Implementation::bitMax<T>());
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        __m128i a, b;
+        widen(src + i, a, b);
+        _mm_storeu_ps(dst + i, _mm_div_ps(_mm_cvtepi32_ps(a), bitMax));
+        _mm_storeu_ps(dst + i + 4, _mm_div_ps(_mm_cvtepi32_ps(b), bitMax));
+    }
+    return i;
+}
+
+template<class T> std::size_t unpackSignedRun(const T* const src, Float* const dst, const std::size_t count) {
+    const __m128 bitMax = _mm_set1_ps(Implementation::bitMax<T>());
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        __m128i a, b;
+        widen(src + i, a, b);
+        _mm_storeu_ps(dst + i, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(a), bitMax), minusOne));
+        _mm_storeu_ps(dst + i + 4, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(b), bitMax), minusOne));
+    }
+    return i;
+}
+
+template<class T> std::size_t packRun(const Float* const src, T* const dst, const std::size_t count) {
+    const __m128 bitMax = _mm_set1_ps(Implementation::bitMax<T>());
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m128i a = roundToInt(_mm_mul_ps(_mm_loadu_ps(src + i), bitMax));
+        const __m128i b = roundToInt(_mm_mul_ps(_mm_loadu_ps(src + i + 4), bitMax));
+        narrow(a, b, dst + i);
+    }
+    return i;
+}
+
+/* Conversions without a dedicated kernel go through the scalar code only */
+template<class T, class U> inline std::size_t castRun(const T*, U*, std::size_t) {
+    return 0;
+}
+
+template<class T> std::size_t castToFloatRun(const T* const src, Float* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        __m128i a, b;
+        widen(src + i, a, b);
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(a));
+        _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(b));
+    }
+    return i;
+}
+
+template<class T> std::size_t castFromFloatRun(const Float* const src, T* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m128i a = _mm_cvttps_epi32(_mm_loadu_ps(src + i));
+        const __m128i b = _mm_cvttps_epi32(_mm_loadu_ps(src + i + 4));
+        narrow(a, b, dst + i);
+    }
+    return i;
+}
+
+inline std::size_t castRun(const UnsignedByte* const src, Float* const dst, const std::size_t count) {
+    return castToFloatRun(src, dst, count);
+}
+
+inline std::size_t castRun(const Byte* const src, Float* const dst, const std::size_t count) {
+    return castToFloatRun(src, dst, count);
+}
+
+inline std::size_t castRun(const UnsignedShort* const src, Float* const dst, const std::size_t count) {
+    return castToFloatRun(src, dst, count);
+}
+
+inline std::size_t castRun(const Short* const src, Float* const dst, const std::size_t count) {
+    return castToFloatRun(src, dst, count);
+}
+
+inline std::size_t castRun(const Int* const src, Float* const dst, const std::size_t count) {
+    return castToFloatRun(src, dst, count);
+}
+
+inline std::size_t castRun(const Float* const src, UnsignedByte* const dst, const std::size_t count) {
+    return castFromFloatRun(src, dst, count);
+}
+
+inline std::size_t castRun(const Float* const src, Byte* const dst, const std::size_t count) {
+    return castFromFloatRun(src, dst, count);
+}
+
+inline std::size_t castRun(const Float* const src, UnsignedShort* const dst, const std::size_t count) {
+    return castFromFloatRun(src, dst, count);
+}
+
+inline std::size_t castRun(const Float* const src, Short* const dst, const std::size_t count) {
+    return castFromFloatRun(src, dst, count);
+}
+
+inline std::size_t castRun(const Float* const src, Int* const dst, const std::size_t count) {
+    return castFromFloatRun(src, dst, count);
+}
+
+inline std::size_t castRun(const Float* const src, Double* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128 in = _mm_loadu_ps(src + i);
+        _mm_storeu_pd(dst + i, _mm_cvtps_pd(in));
+        _mm_storeu_pd(dst + i + 2, _mm_cvtps_pd(_mm_movehl_ps(in, in)));
+    }
+    return i;
+}
+
+inline std::size_t castRun(const Double* const src, Float* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128 a = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+        const __m128 b = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 2));
+        _mm_storeu_ps(dst + i, _mm_movelh_ps(a, b));
+    }
+    return i;
+}
+
+/* Branchless half-to-float conversion, giving the same bits as the table
+   lookup including denormals, infinities and NaN payloads */
+inline __m128i unpackHalfSse2(const __m128i h) {
+    const __m128i expMantissa = _mm_and_si128(h, _mm_set1_epi32(0x7fff));
+    /* Shift exponent and mantissa into place and multiply by 2^112 to adjust
+       the exponent bias, which also normalizes denormals */
+    const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMantissa, 13)), _mm_castsi128_ps(_mm_set1_epi32((127 + 112) << 23)));
+    /* Infinity and NaN get the exponent bits all set */
+    const __m128i infNan = _mm_and_si128(_mm_cmpgt_epi32(expMantissa, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(255 << 23));
+    const __m128i sign = _mm_slli_epi32(_mm_xor_si128(h, expMantissa), 16);
+    return _mm_or_si128(_mm_castps_si128(scaled), _mm_or_si128(sign, infNan));
+}
+
+/* Branchless float-to-half conversion, truncating the mantissa the same way
+   as the table lookup */
+inline __m128i packHalfSse2(const __m128i f) {
+    const __m128i abs = _mm_and_si128(f, _mm_set1_epi32(0x7fffffff));
+    const __m128i sign = _mm_and_si128(_mm_srli_epi32(f, 16), _mm_set1_epi32(0x8000));
+    const __m128i shifted = _mm_srli_epi32(abs, 13);
+
+    /* Normal range, rebias the exponent */
+    const __m128i normal = _mm_sub_epi32(shifted, _mm_set1_epi32(112 << 10));
+    /* Denormal range, the value multiplied by 2^24 and truncated is directly
+       the half mantissa */
+    const __m128i denormal = _mm_cvttps_epi32(_mm_mul_ps(_mm_castsi128_ps(abs), _mm_set1_ps(16777216.0f)));
+    /* Overflow goes to infinity, NaNs keep the upper part of the payload */
+    const __m128i isNan = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7f800000));
+    const __m128i infNan = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(isNan, _mm_and_si128(shifted, _mm_set1_epi32(0x3ff))));
+
+    const __m128i isDenormal = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000));
+    const __m128i isOverflow = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x477fffff));
+    const __m128i finite = _mm_or_si128(_mm_and_si128(isDenormal, denormal), _mm_andnot_si128(isDenormal, normal));
+    const __m128i out = _mm_or_si128(_mm_and_si128(isOverflow, infNan), _mm_andnot_si128(isOverflow, finite));
+    return _mm_or_si128(out, sign);
+}
+
+inline std::size_t unpackHalfRun(const UnsignedShort* const src, Float* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        __m128i a, b;
+        widen(src + i, a, b);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), unpackHalfSse2(a));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 4), unpackHalfSse2(b));
+    }
+    return i;
+}
+
+inline std::size_t packHalfRun(const Float* const src, UnsignedShort* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m128i a = packHalfSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        const __m128i b = packHalfSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 4)));
+        narrow(a, b, dst + i);
+    }
+    return i;
+}
+#endif
+
 template<class T> inline void unpackUnsignedIntoImplementation(const Corrade::Containers::StridedArrayView2D<const T>& src, const Corrade::Containers::StridedArrayView2D<Float>& dst) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
     CORRADE_ASSERT(src.template isContiguous<1>() && dst.isContiguous<1>(),
         "Math::unpackInto(): second view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
     /* Caching values to avoid inline function calls in ebug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+    std::size_t runCount, runSize;
+    std::ptrdiff_t srcStride, dstStride;
+    runs(src, dst, runCount, runSize, srcStride, dstStride);
+    for(std::size_t i = 0; i != runCount; ++i) {
         const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
         Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
-            *dstPtrI++ = *srcPtrI++/bitMax;
+        std::size_t j = 0;
+        #ifdef CORRADE_TARGET_SSE2
+        j = unpackUnsignedRun(srcPtrI, dstPtrI, runSize);
+        #endif
+        for(; j != runSize; ++j)
+            dstPtrI[j] = srcPtrI[j]/bitMax;
 
         srcPtr += srcStride;
         dstPtr += dstStride;
@@ -80,23 +363,24 @@ template<class T> inline void unpackSignedIntoImplementation(const Corrade::Cont
     CORRADE_ASSERT(src.template isContiguous<1>() && dst.isContiguous<1>(),
         "Math::unpackInto(): second view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
     /* Caching values to avoid inline function calls in debug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+    std::size_t runCount, runSize;
+    std::ptrdiff_t srcStride, dstStride;
+    runs(src, dst, runCount, runSize, srcStride, dstStride);
+    for(std::size_t i = 0; i != runCount; ++i) {
         const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
         Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const Float value = *srcPtrI++/bitMax;
+        std::size_t j = 0;
+        #ifdef CORRADE_TARGET_SSE2
+        j = unpackSignedRun(srcPtrI, dstPtrI, runSize);
+        #endif
+        for(; j != runSize; ++j) {
+            const Float value = srcPtrI[j]/bitMax;
             /* Avoiding a max() call in Debug */
-            *dstPtrI++ = value < -1.0f ? -1.0f : value;
+            dstPtrI[j] = value < -1.0f ? -1.0f : value;
         }
 
         srcPtr += srcStride;
@@ -122,22 +406,23 @@ template<class T> inline void packIntoImplementation(const Corrade::Containers::
     CORRADE_ASSERT(src.isContiguous<1>() && dst.template isContiguous<1>(),
         "Math::packInto(): second view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
     /* Caching values to avoid inline function calls in debug builds */
     constexpr Float bitMax = Implementation::bitMax<T>();
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+    std::size_t runCount, runSize;
+    std::ptrdiff_t srcStride, dstStride;
+    runs(src, dst, runCount, runSize, srcStride, dstStride);
+    for(std::size_t i = 0; i != runCount; ++i) {
         const Float* srcPtrI = reinterpret_cast<const Float*>(srcPtr);
         T* dstPtrI = reinterpret_cast<T*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
+        std::size_t j = 0;
+        #ifdef CORRADE_TARGET_SSE2
+        j = packRun(srcPtrI, dstPtrI, runSize);
+        #endif
+        for(; j != runSize; ++j)
             /** @todo provide a version that doesn't do rounding */
-            *dstPtrI++ = std::round(*srcPtrI++*bitMax);
+            dstPtrI[j] = std::round(srcPtrI[j]*bitMax);
 
         srcPtr += srcStride;
         dstPtr += dstStride;
@@ -170,20 +455,21 @@ template<class T, class U> inline void castIntoImplementation(const Corrade::Con
     CORRADE_ASSERT(src.template isContiguous<1>() && dst.template isContiguous<1>(),
         "Math::castInto(): second view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
     /* Caching values to avoid inline function calls in debug buílds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+    std::size_t runCount, runSize;
+    std::ptrdiff_t srcStride, dstStride;
+    runs(src, dst, runCount, runSize, srcStride, dstStride);
+    for(std::size_t i = 0; i != runCount; ++i) {
         const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
         U* dstPtrI = reinterpret_cast<U*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
-            *dstPtrI++ = U(*srcPtrI++);
+        std::size_t j = 0;
+        #ifdef CORRADE_TARGET_SSE2
+        j = castRun(srcPtrI, dstPtrI, runSize);
+        #endif
+        for(; j != runSize; ++j)
+            dstPtrI[j] = U(srcPtrI[j]);
 
         srcPtr += srcStride;
         dstPtr += dstStride;
@@ -311,15 +597,19 @@ void unpackHalfInto(const Corrade::Containers::StridedArrayView2D<const Unsigned
     /* Caching values to avoid inline function calls in debug builds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+    std::size_t runCount, runSize;
+    std::ptrdiff_t srcStride, dstStride;
+    runs(src, dst, runCount, runSize, srcStride, dstStride);
+    for(std::size_t i = 0; i != runCount; ++i) {
         const UnsignedShort* srcPtrI = reinterpret_cast<const UnsignedShort*>(srcPtr);
         UnsignedInt* dstPtrI = reinterpret_cast<UnsignedInt*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const UnsignedShort h = *srcPtrI++;
-            *dstPtrI++ = HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
+        std::size_t j = 0;
+        #ifdef CORRADE_TARGET_SSE2
+        j = unpackHalfRun(srcPtrI, reinterpret_cast<Float*>(dstPtrI), runSize);
+        #endif
+        for(; j != runSize; ++j) {
+            const UnsignedShort h = srcPtrI[j];
+            dstPtrI[j] = HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
         }
 
         srcPtr += srcStride;
@@ -336,15 +626,19 @@ void packHalfInto(const Corrade::Containers::StridedArrayView2D<const Float>& sr
     /* Caching values to avoid inline function calls in debug builds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
+    std::size_t runCount, runSize;
+    std::ptrdiff_t srcStride, dstStride;
+    runs(src, dst, runCount, runSize, srcStride, dstStride);
+    for(std::size_t i = 0; i != runCount; ++i) {
         const UnsignedInt* srcPtrI = reinterpret_cast<const UnsignedInt*>(srcPtr);
         UnsignedShort* dstPtrI = reinterpret_cast<UnsignedShort*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const UnsignedInt f = *srcPtrI++;
-            *dstPtrI++ = HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
+        std::size_t j = 0;
+        #ifdef CORRADE_TARGET_SSE2
+        j = packHalfRun(reinterpret_cast<const Float*>(srcPtrI), dstPtrI, runSize);
+        #endif
+        for(; j != runSize; ++j) {
+            const UnsignedInt f = srcPtrI[j];
+            dstPtrI[j] = HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
         }
 
         srcPtr += srcStride;
@@ -352,4 +646,48 @@ void packHalfInto(const Corrade::Containers::StridedArrayView2D<const Float>& sr
     }
 }
 
+namespace {
+
+template<class T> inline void packOctahedralIntoImplementation(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& src, const Corrade::Containers::StridedArrayView1D<Vector2<T>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::packOctahedralInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+
+    for(std::size_t i = 0, max = src.size(); i != max; ++i)
+        dst[i] = packOctahedral<Vector2<T>>(src[i]);
+}
+
+template<class T> inline void unpackOctahedralIntoImplementation(const Corrade::Containers::StridedArrayView1D<const Vector2<T>>& src, const Corrade::Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpackOctahedralInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+
+    for(std::size_t i = 0, max = src.size(); i != max; ++i)
+        dst[i] = unpackOctahedral<Vector3<Float>>(src[i]);
+}
+
+}
+
+void packOctahedralInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& src, const Corrade::Containers::StridedArrayView1D<Vector2<Byte>>& dst) {
+    packOctahedralIntoImplementation(src, dst);
+}
+
+void packOctahedralInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& src, const Corrade::Containers::StridedArrayView1D<Vector2<Short>>& dst) {
+    packOctahedralIntoImplementation(src, dst);
+}
+
+void packOctahedralInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& src, const Corrade::Containers::StridedArrayView1D<Vector2<Float>>& dst) {
+    packOctahedralIntoImplementation(src, dst);
+}
+
+void unpackOctahedralInto(const Corrade::Containers::StridedArrayView1D<const Vector2<Byte>>& src, const Corrade::Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    unpackOctahedralIntoImplementation(src, dst);
+}
+
+void unpackOctahedralInto(const Corrade::Containers::StridedArrayView1D<const Vector2<Short>>& src, const Corrade::Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    unpackOctahedralIntoImplementation(src, dst);
+}
+
+void unpackOctahedralInto(const Corrade::Containers::StridedArrayView1D<const Vector2<Float>>& src, const Corrade::Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    unpackOctahedralIntoImplementation(src, dst);
+}
+
 }}
@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Functions @ref Magnum::Math::packInto(), @ref Magnum::Math::unpackInto(), @ref Magnum::Math::packHalfInto(), @ref Magnum::Math::unpackHalfInto(), @ref Magnum::Math::castInto()
+ * @brief Functions @ref Magnum::Math::packInto(), @ref Magnum::Math::unpackInto(), @ref Magnum::Math::packHalfInto(), @ref Magnum::Math::unpackHalfInto(), @ref Magnum::Math::packOctahedralInto(), @ref Magnum::Math::unpackOctahedralInto(), @ref Magnum::Math::castInto()
  * @m_since{2020,06}
  */
 
@@ -34,6 +34,7 @@
 
 #include "Magnum/Types.h"
 #include "Magnum/visibility.h"
+#include "Magnum/Math/Math.h"
 
 namespace Magnum { namespace Math {
 
@@ -42,6 +43,14 @@ namespace Magnum { namespace Math {
 
 These functions process an ubounded range of values, as opposed to single
 vectors or scalars.
+
+On platforms with SSE2, @ref unpackInto(), @ref packInto(), @ref castInto()
+between @ref Float and 8-, 16- or 32-bit signed integers or @ref Double,
+@ref unpackHalfInto() and @ref packHalfInto() process the data several values
+at a time. The results are the same as with the scalar code. Each row is
+processed separately; if both views are contiguous as a whole, all data are
+processed as a single run, so tightly packed data benefit from the
+vectorization the most.
 */
 
 /**
@@ -165,6 +174,54 @@ ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*
 */
 MAGNUM_EXPORT void unpackHalfInto(const Corrade::Containers::StridedArrayView2D<const UnsignedShort>& src, const Corrade::Containers::StridedArrayView2D<Float>& dst);
 
+/**
+@brief Pack unit vectors using octahedral encoding
+@param[in]  src     Source unit vectors
+@param[out] dst     Destination octahedral-encoded values
+@m_since_latest
+
+Batch variant of @ref packOctahedral(), see its documentation for details.
+Expects that @p src and @p dst have the same size.
+@see @ref unpackOctahedralInto()
+*/
+MAGNUM_EXPORT void packOctahedralInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& src, const Corrade::Containers::StridedArrayView1D<Vector2<Byte>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void packOctahedralInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& src, const Corrade::Containers::StridedArrayView1D<Vector2<Short>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void packOctahedralInto(const Corrade::Containers::StridedArrayView1D<const Vector3<Float>>& src, const Corrade::Containers::StridedArrayView1D<Vector2<Float>>& dst);
+
+/**
+@brief Unpack octahedral-encoded unit vectors
+@param[in]  src     Source octahedral-encoded values
+@param[out] dst     Destination unit vectors
+@m_since_latest
+
+Batch variant of @ref unpackOctahedral(), see its documentation for details.
+Expects that @p src and @p dst have the same size.
+@see @ref packOctahedralInto()
+*/
+MAGNUM_EXPORT void unpackOctahedralInto(const Corrade::Containers::StridedArrayView1D<const Vector2<Byte>>& src, const Corrade::Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void unpackOctahedralInto(const Corrade::Containers::StridedArrayView1D<const Vector2<Short>>& src, const Corrade::Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_EXPORT void unpackOctahedralInto(const Corrade::Containers::StridedArrayView1D<const Vector2<Float>>& src, const Corrade::Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
 /**
 @brief Cast integer values into a floating-point representation
 @param[in]  src     Source integral values
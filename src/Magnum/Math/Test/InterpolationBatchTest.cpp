@@ -0,0 +1,333 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/CubicHermite.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/InterpolationBatch.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct InterpolationBatchTest: Corrade::TestSuite::Tester {
+    explicit InterpolationBatchTest();
+
+    void lerpVector();
+    void lerpQuaternion();
+    void lerpShortestPathQuaternion();
+    void slerpQuaternion();
+    void slerpShortestPathQuaternion();
+    void splerpVector();
+    void splerpQuaternion();
+
+    void notNormalized();
+    void assertions();
+};
+
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::CubicHermite3D<Float> CubicHermite3D;
+typedef Math::CubicHermiteQuaternion<Float> CubicHermiteQuaternion;
+typedef Math::Deg<Float> Deg;
+
+const struct {
+    const char* name;
+    std::size_t count;
+    bool interleaved;
+} BatchData[] {
+    {"less than a SIMD block", 3, false},
+    {"exactly a SIMD block", 4, false},
+    {"SIMD blocks and a remainder", 23, false},
+    {"interleaved", 23, true}
+};
+
+constexpr std::size_t MaxCount = 23;
+
+struct Item {
+    Vector3 vectorA, vectorB;
+    Float t;
+    Quaternion quaternionA, quaternionB;
+    CubicHermite3D splineA, splineB;
+    CubicHermiteQuaternion quaternionSplineA, quaternionSplineB;
+    Vector3 vectorOut;
+    Quaternion quaternionOut;
+};
+
+/* Same data either in separate tightly packed arrays or interleaved, to test
+   both the full-width loads and the strided loads */
+struct Input {
+    explicit Input(std::size_t count, bool interleaved) {
+        for(std::size_t i = 0; i != MaxCount; ++i) {
+            Item& item = items[i];
+            item.vectorA = {Float(i % 7)*4.0f - 12.0f,
+                            Float(i % 5)*0.5f,
+                            -Float(i % 11)*3.5f + 2.0f};
+            item.vectorB = {Float(i % 3)*0.5f + 0.25f,
+                            -Float(i % 4)*2.5f,
+                            Float(i % 2)*2.0f + 0.5f};
+            item.t = Float(i % 9)/8.0f;
+
+            /* Besides generic rotations, test also the linear fallback for
+               same and negated quaternions, and the shortest path */
+            item.quaternionA = Quaternion::rotation(Deg(Float(i)*37.0f), Vector3{1.0f, Float(i % 3), -0.5f}.normalized());
+            if(i % 5 == 0)
+                item.quaternionB = item.quaternionA;
+            else if(i % 5 == 1)
+                item.quaternionB = -item.quaternionA;
+            else
+                item.quaternionB = Quaternion::rotation(Deg(200.0f - Float(i)*53.0f), Vector3{Float(i % 4), -1.0f, 0.25f}.normalized());
+
+            item.splineA = {item.vectorB, item.vectorA, item.vectorB*0.5f};
+            item.splineB = {-item.vectorA, item.vectorB, item.vectorA*2.0f};
+            item.quaternionSplineA = {Quaternion{item.vectorB*0.1f, 0.25f}, item.quaternionA, Quaternion{item.vectorA*0.05f, -0.5f}};
+            item.quaternionSplineB = {Quaternion{-item.vectorA*0.05f, 1.0f}, item.quaternionB, Quaternion{item.vectorB*0.1f, 0.0f}};
+
+            vectorAData[i] = item.vectorA;
+            vectorBData[i] = item.vectorB;
+            tData[i] = item.t;
+            quaternionAData[i] = item.quaternionA;
+            quaternionBData[i] = item.quaternionB;
+            splineAData[i] = item.splineA;
+            splineBData[i] = item.splineB;
+            quaternionSplineAData[i] = item.quaternionSplineA;
+            quaternionSplineBData[i] = item.quaternionSplineB;
+        }
+
+        if(interleaved) {
+            vectorA = Corrade::Containers::StridedArrayView1D<const Vector3>{items, &items[0].vectorA, count, sizeof(Item)};
+            vectorB = Corrade::Containers::StridedArrayView1D<const Vector3>{items, &items[0].vectorB, count, sizeof(Item)};
+            t = Corrade::Containers::StridedArrayView1D<const Float>{items, &items[0].t, count, sizeof(Item)};
+            quaternionA = Corrade::Containers::StridedArrayView1D<const Quaternion>{items, &items[0].quaternionA, count, sizeof(Item)};
+            quaternionB = Corrade::Containers::StridedArrayView1D<const Quaternion>{items, &items[0].quaternionB, count, sizeof(Item)};
+            splineA = Corrade::Containers::StridedArrayView1D<const CubicHermite3D>{items, &items[0].splineA, count, sizeof(Item)};
+            splineB = Corrade::Containers::StridedArrayView1D<const CubicHermite3D>{items, &items[0].splineB, count, sizeof(Item)};
+            quaternionSplineA = Corrade::Containers::StridedArrayView1D<const CubicHermiteQuaternion>{items, &items[0].quaternionSplineA, count, sizeof(Item)};
+            quaternionSplineB = Corrade::Containers::StridedArrayView1D<const CubicHermiteQuaternion>{items, &items[0].quaternionSplineB, count, sizeof(Item)};
+            vectorOut = Corrade::Containers::StridedArrayView1D<Vector3>{items, &items[0].vectorOut, count, sizeof(Item)};
+            quaternionOut = Corrade::Containers::StridedArrayView1D<Quaternion>{items, &items[0].quaternionOut, count, sizeof(Item)};
+        } else {
+            vectorA = Corrade::Containers::stridedArrayView(vectorAData).prefix(count);
+            vectorB = Corrade::Containers::stridedArrayView(vectorBData).prefix(count);
+            t = Corrade::Containers::stridedArrayView(tData).prefix(count);
+            quaternionA = Corrade::Containers::stridedArrayView(quaternionAData).prefix(count);
+            quaternionB = Corrade::Containers::stridedArrayView(quaternionBData).prefix(count);
+            splineA = Corrade::Containers::stridedArrayView(splineAData).prefix(count);
+            splineB = Corrade::Containers::stridedArrayView(splineBData).prefix(count);
+            quaternionSplineA = Corrade::Containers::stridedArrayView(quaternionSplineAData).prefix(count);
+            quaternionSplineB = Corrade::Containers::stridedArrayView(quaternionSplineBData).prefix(count);
+            vectorOut = Corrade::Containers::stridedArrayView(vectorOutData).prefix(count);
+            quaternionOut = Corrade::Containers::stridedArrayView(quaternionOutData).prefix(count);
+        }
+    }
+
+    Item items[MaxCount];
+    Vector3 vectorAData[MaxCount];
+    Vector3 vectorBData[MaxCount];
+    Float tData[MaxCount];
+    Quaternion quaternionAData[MaxCount];
+    Quaternion quaternionBData[MaxCount];
+    CubicHermite3D splineAData[MaxCount];
+    CubicHermite3D splineBData[MaxCount];
+    CubicHermiteQuaternion quaternionSplineAData[MaxCount];
+    CubicHermiteQuaternion quaternionSplineBData[MaxCount];
+    Vector3 vectorOutData[MaxCount];
+    Quaternion quaternionOutData[MaxCount];
+
+    Corrade::Containers::StridedArrayView1D<const Vector3> vectorA, vectorB;
+    Corrade::Containers::StridedArrayView1D<const Float> t;
+    Corrade::Containers::StridedArrayView1D<const Quaternion> quaternionA, quaternionB;
+    Corrade::Containers::StridedArrayView1D<const CubicHermite3D> splineA, splineB;
+    Corrade::Containers::StridedArrayView1D<const CubicHermiteQuaternion> quaternionSplineA, quaternionSplineB;
+    Corrade::Containers::StridedArrayView1D<Vector3> vectorOut;
+    Corrade::Containers::StridedArrayView1D<Quaternion> quaternionOut;
+};
+
+InterpolationBatchTest::InterpolationBatchTest() {
+    addInstancedTests({&InterpolationBatchTest::lerpVector,
+                       &InterpolationBatchTest::lerpQuaternion,
+                       &InterpolationBatchTest::lerpShortestPathQuaternion,
+                       &InterpolationBatchTest::slerpQuaternion,
+                       &InterpolationBatchTest::slerpShortestPathQuaternion,
+                       &InterpolationBatchTest::splerpVector,
+                       &InterpolationBatchTest::splerpQuaternion},
+        Corrade::Containers::arraySize(BatchData));
+
+    addTests({&InterpolationBatchTest::notNormalized,
+              &InterpolationBatchTest::assertions});
+}
+
+void InterpolationBatchTest::lerpVector() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Input input{data.count, data.interleaved};
+    Math::lerpInto(input.vectorA, input.vectorB, input.t, input.vectorOut);
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(input.vectorOut[i], Math::lerp(input.vectorA[i], input.vectorB[i], input.t[i]));
+    }
+}
+
+void InterpolationBatchTest::lerpQuaternion() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Input input{data.count, data.interleaved};
+    Math::lerpInto(input.quaternionA, input.quaternionB, input.t, input.quaternionOut);
+
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(input.quaternionOut[i], Math::lerp(input.quaternionA[i], input.quaternionB[i], input.t[i]));
+    }
+}
+
+void InterpolationBatchTest::lerpShortestPathQuaternion() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Input input{data.count, data.interleaved};
+    Math::lerpShortestPathInto(input.quaternionA, input.quaternionB, input.t, input.quaternionOut);
+
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(input.quaternionOut[i], Math::lerpShortestPath(input.quaternionA[i], input.quaternionB[i], input.t[i]));
+    }
+}
+
+void InterpolationBatchTest::slerpQuaternion() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Input input{data.count, data.interleaved};
+    Math::slerpInto(input.quaternionA, input.quaternionB, input.t, input.quaternionOut);
+
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(input.quaternionOut[i], Math::slerp(input.quaternionA[i], input.quaternionB[i], input.t[i]));
+    }
+}
+
+void InterpolationBatchTest::slerpShortestPathQuaternion() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Input input{data.count, data.interleaved};
+    Math::slerpShortestPathInto(input.quaternionA, input.quaternionB, input.t, input.quaternionOut);
+
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(input.quaternionOut[i], Math::slerpShortestPath(input.quaternionA[i], input.quaternionB[i], input.t[i]));
+    }
+}
+
+void InterpolationBatchTest::splerpVector() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Input input{data.count, data.interleaved};
+    Math::splerpInto(input.splineA, input.splineB, input.t, input.vectorOut);
+
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(input.vectorOut[i], Math::splerp(input.splineA[i], input.splineB[i], input.t[i]));
+    }
+}
+
+void InterpolationBatchTest::splerpQuaternion() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Input input{data.count, data.interleaved};
+    Math::splerpInto(input.quaternionSplineA, input.quaternionSplineB, input.t, input.quaternionOut);
+
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(input.quaternionOut[i], Math::splerp(input.quaternionSplineA[i], input.quaternionSplineB[i], input.t[i]));
+    }
+}
+
+void InterpolationBatchTest::notNormalized() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    /* The not-normalized quaternion is in the second SIMD block, the batch
+       code should leave it to the scalar code which then asserts */
+    Quaternion a[9];
+    Quaternion b[9];
+    a[5] = Quaternion{{}, 3.0f};
+    const Float t[9]{};
+    Quaternion result[9];
+
+    std::ostringstream out;
+    Corrade::Utility::Error redirectError{&out};
+    Math::lerpInto(a, b, t, result);
+    Math::slerpShortestPathInto(a, b, t, result);
+    CORRADE_COMPARE(out.str(),
+        "Math::lerp(): quaternions Quaternion({0, 0, 0}, 3) and Quaternion({0, 0, 0}, 1) are not normalized\n"
+        "Math::slerpShortestPath(): quaternions Quaternion({0, 0, 0}, 3) and Quaternion({0, 0, 0}, 1) are not normalized\n");
+}
+
+void InterpolationBatchTest::assertions() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Vector3 vectors[9]{};
+    const Quaternion quaternions[9]{};
+    const CubicHermite3D splines[9]{};
+    const CubicHermiteQuaternion quaternionSplines[9]{};
+    const Float t[9]{};
+    Vector3 vectorOut[9];
+    Quaternion quaternionOut[9];
+
+    std::ostringstream out;
+    Corrade::Utility::Error redirectError{&out};
+    Math::lerpInto(vectors, vectors, Corrade::Containers::arrayView(t).prefix(8), vectorOut);
+    Math::lerpInto(quaternions, Corrade::Containers::arrayView(quaternions).prefix(8), t, quaternionOut);
+    Math::lerpShortestPathInto(quaternions, quaternions, t, Corrade::Containers::arrayView(quaternionOut).prefix(8));
+    Math::slerpInto(Corrade::Containers::arrayView(quaternions).prefix(8), quaternions, t, quaternionOut);
+    Math::slerpShortestPathInto(quaternions, quaternions, Corrade::Containers::arrayView(t).prefix(8), quaternionOut);
+    Math::splerpInto(splines, splines, t, Corrade::Containers::arrayView(vectorOut).prefix(8));
+    Math::splerpInto(quaternionSplines, Corrade::Containers::arrayView(quaternionSplines).prefix(8), t, quaternionOut);
+    CORRADE_COMPARE(out.str(),
+        "Math::lerpInto(): expected views of the same size but got 9, 9, 8 and 9\n"
+        "Math::lerpInto(): expected views of the same size but got 9, 8, 9 and 9\n"
+        "Math::lerpShortestPathInto(): expected views of the same size but got 9, 9, 9 and 8\n"
+        "Math::slerpInto(): expected views of the same size but got 8, 9, 9 and 9\n"
+        "Math::slerpShortestPathInto(): expected views of the same size but got 9, 9, 8 and 9\n"
+        "Math::splerpInto(): expected views of the same size but got 9, 9, 9 and 8\n"
+        "Math::splerpInto(): expected views of the same size but got 9, 8, 9 and 9\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::InterpolationBatchTest)
@@ -23,13 +23,17 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #ifndef CORRADE_NO_ASSERT
 #define CORRADE_NO_ASSERT
 #endif
 
+#include "Magnum/Math/CubicHermite.h"
 #include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/InterpolationBatch.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -43,6 +47,14 @@ struct InterpolationBenchmark: Corrade::TestSuite::Tester {
     void quaternionSlerpShortestPath();
     void dualQuaternionSclerp();
     void dualQuaternionSclerpShortestPath();
+
+    void vectorLerpBatch();
+    void quaternionLerpBatch();
+    void quaternionLerpShortestPathBatch();
+    void quaternionSlerpBatch();
+    void quaternionSlerpShortestPathBatch();
+    void cubicHermiteSplerpBatch();
+    void cubicHermiteQuaternionSplerpBatch();
 };
 
 using namespace Math::Literals;
@@ -50,6 +62,47 @@ using namespace Math::Literals;
 typedef Math::Quaternion<Float> Quaternion;
 typedef Math::DualQuaternion<Float> DualQuaternion;
 typedef Math::Vector3<Float> Vector3;
+typedef Math::Rad<Float> Rad;
+typedef Math::CubicHermite3D<Float> CubicHermite3D;
+typedef Math::CubicHermiteQuaternion<Float> CubicHermiteQuaternion;
+
+const struct {
+    const char* name;
+    bool batch;
+} BatchData[] {
+    /* Calling the single-value APIs in a loop */
+    {"per-item API", false},
+    /* Calling the batch APIs on the whole array */
+    {"batch API", true}
+};
+
+enum: std::size_t { Size = 4096 };
+
+/* Rotations all around the place, with the interpolation phases going
+   through the whole range */
+struct BatchInput {
+    explicit BatchInput() {
+        for(std::size_t i = 0; i != Size; ++i) {
+            const Vector3 axisA = Vector3{1.0f, Float(i % 3), -0.5f}.normalized();
+            const Vector3 axisB = Vector3{Float(i % 5), -1.0f, 0.25f}.normalized();
+            vectorA[i] = axisA*Float(i % 7);
+            vectorB[i] = axisB*Float(i % 11);
+            quaternionA[i] = Quaternion::rotation(Rad(Float(i)*0.37f), axisA);
+            quaternionB[i] = Quaternion::rotation(Rad(Float(i)*-0.53f), axisB);
+            splineA[i] = {vectorB[i], vectorA[i], vectorB[i]*0.5f};
+            splineB[i] = {-vectorA[i], vectorB[i], vectorA[i]*2.0f};
+            quaternionSplineA[i] = {Quaternion{axisB*0.1f, 0.25f}, quaternionA[i], Quaternion{axisA*0.05f, -0.5f}};
+            quaternionSplineB[i] = {Quaternion{-axisA*0.05f, 1.0f}, quaternionB[i], Quaternion{axisB*0.1f, 0.0f}};
+            t[i] = Float(i % 1001)/1000.0f;
+        }
+    }
+
+    Corrade::Containers::Array<Vector3> vectorA{Size}, vectorB{Size};
+    Corrade::Containers::Array<Quaternion> quaternionA{Size}, quaternionB{Size};
+    Corrade::Containers::Array<CubicHermite3D> splineA{Size}, splineB{Size};
+    Corrade::Containers::Array<CubicHermiteQuaternion> quaternionSplineA{Size}, quaternionSplineB{Size};
+    Corrade::Containers::Array<Float> t{Size};
+};
 
 InterpolationBenchmark::InterpolationBenchmark() {
     addBenchmarks({&InterpolationBenchmark::baseline,
@@ -59,6 +112,15 @@ InterpolationBenchmark::InterpolationBenchmark() {
                    &InterpolationBenchmark::quaternionSlerpShortestPath,
                    &InterpolationBenchmark::dualQuaternionSclerp,
                    &InterpolationBenchmark::dualQuaternionSclerpShortestPath}, 100);
+
+    addInstancedBenchmarks({&InterpolationBenchmark::vectorLerpBatch,
+                            &InterpolationBenchmark::quaternionLerpBatch,
+                            &InterpolationBenchmark::quaternionLerpShortestPathBatch,
+                            &InterpolationBenchmark::quaternionSlerpBatch,
+                            &InterpolationBenchmark::quaternionSlerpShortestPathBatch,
+                            &InterpolationBenchmark::cubicHermiteSplerpBatch,
+                            &InterpolationBenchmark::cubicHermiteQuaternionSplerpBatch}, 10,
+        Corrade::Containers::arraySize(BatchData));
 }
 
 void InterpolationBenchmark::baseline() {
@@ -150,6 +212,118 @@ void InterpolationBenchmark::dualQuaternionSclerpShortestPath() {
     CORRADE_VERIFY(!c.isNormalized());
 }
 
+void InterpolationBenchmark::vectorLerpBatch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const BatchInput input;
+    Corrade::Containers::Array<Vector3> out{Corrade::Containers::NoInit, Size};
+    if(!data.batch) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size; ++i)
+            out[i] = lerp(input.vectorA[i], input.vectorB[i], input.t[i]);
+    } else CORRADE_BENCHMARK(10) {
+        lerpInto(input.vectorA, input.vectorB, input.t, out);
+    }
+
+    CORRADE_COMPARE(out[Size - 1], lerp(input.vectorA[Size - 1], input.vectorB[Size - 1], input.t[Size - 1]));
+}
+
+void InterpolationBenchmark::quaternionLerpBatch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const BatchInput input;
+    Corrade::Containers::Array<Quaternion> out{Corrade::Containers::NoInit, Size};
+    if(!data.batch) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size; ++i)
+            out[i] = lerp(input.quaternionA[i], input.quaternionB[i], input.t[i]);
+    } else CORRADE_BENCHMARK(10) {
+        lerpInto(input.quaternionA, input.quaternionB, input.t, out);
+    }
+
+    CORRADE_COMPARE(out[Size - 1], lerp(input.quaternionA[Size - 1], input.quaternionB[Size - 1], input.t[Size - 1]));
+}
+
+void InterpolationBenchmark::quaternionLerpShortestPathBatch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const BatchInput input;
+    Corrade::Containers::Array<Quaternion> out{Corrade::Containers::NoInit, Size};
+    if(!data.batch) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size; ++i)
+            out[i] = lerpShortestPath(input.quaternionA[i], input.quaternionB[i], input.t[i]);
+    } else CORRADE_BENCHMARK(10) {
+        lerpShortestPathInto(input.quaternionA, input.quaternionB, input.t, out);
+    }
+
+    CORRADE_COMPARE(out[Size - 1], lerpShortestPath(input.quaternionA[Size - 1], input.quaternionB[Size - 1], input.t[Size - 1]));
+}
+
+void InterpolationBenchmark::quaternionSlerpBatch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const BatchInput input;
+    Corrade::Containers::Array<Quaternion> out{Corrade::Containers::NoInit, Size};
+    if(!data.batch) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size; ++i)
+            out[i] = slerp(input.quaternionA[i], input.quaternionB[i], input.t[i]);
+    } else CORRADE_BENCHMARK(10) {
+        slerpInto(input.quaternionA, input.quaternionB, input.t, out);
+    }
+
+    CORRADE_COMPARE(out[Size - 1], slerp(input.quaternionA[Size - 1], input.quaternionB[Size - 1], input.t[Size - 1]));
+}
+
+void InterpolationBenchmark::quaternionSlerpShortestPathBatch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const BatchInput input;
+    Corrade::Containers::Array<Quaternion> out{Corrade::Containers::NoInit, Size};
+    if(!data.batch) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size; ++i)
+            out[i] = slerpShortestPath(input.quaternionA[i], input.quaternionB[i], input.t[i]);
+    } else CORRADE_BENCHMARK(10) {
+        slerpShortestPathInto(input.quaternionA, input.quaternionB, input.t, out);
+    }
+
+    CORRADE_COMPARE(out[Size - 1], slerpShortestPath(input.quaternionA[Size - 1], input.quaternionB[Size - 1], input.t[Size - 1]));
+}
+
+void InterpolationBenchmark::cubicHermiteSplerpBatch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const BatchInput input;
+    Corrade::Containers::Array<Vector3> out{Corrade::Containers::NoInit, Size};
+    if(!data.batch) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size; ++i)
+            out[i] = splerp(input.splineA[i], input.splineB[i], input.t[i]);
+    } else CORRADE_BENCHMARK(10) {
+        splerpInto(input.splineA, input.splineB, input.t, out);
+    }
+
+    CORRADE_COMPARE(out[Size - 1], splerp(input.splineA[Size - 1], input.splineB[Size - 1], input.t[Size - 1]));
+}
+
+void InterpolationBenchmark::cubicHermiteQuaternionSplerpBatch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const BatchInput input;
+    Corrade::Containers::Array<Quaternion> out{Corrade::Containers::NoInit, Size};
+    if(!data.batch) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size; ++i)
+            out[i] = splerp(input.quaternionSplineA[i], input.quaternionSplineB[i], input.t[i]);
+    } else CORRADE_BENCHMARK(10) {
+        splerpInto(input.quaternionSplineA, input.quaternionSplineB, input.t, out);
+    }
+
+    CORRADE_COMPARE(out[Size - 1], splerp(input.quaternionSplineA[Size - 1], input.quaternionSplineB[Size - 1], input.t[Size - 1]));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::InterpolationBenchmark)
@@ -0,0 +1,304 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/IntersectionBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct IntersectionBatchTest: Corrade::TestSuite::Tester {
+    explicit IntersectionBatchTest();
+
+    void sphereFrustum();
+    void aabbFrustum();
+    void rangeFrustum();
+    void sphereCone();
+    void sphereConeAngle();
+
+    void assertions();
+};
+
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Frustum<Float> Frustum;
+typedef Math::Range3D<Float> Range3D;
+typedef Math::Deg<Float> Deg;
+
+const struct {
+    const char* name;
+    std::size_t count;
+    bool interleaved;
+} BatchData[] {
+    {"less than a SIMD block", 5, false},
+    {"exactly a SIMD block", 8, false},
+    {"SIMD blocks and a remainder", 37, false},
+    {"interleaved", 37, true}
+};
+
+constexpr std::size_t MaxCount = 37;
+
+struct Item {
+    Vector3 center;
+    Float radius;
+    Vector3 extents;
+    Range3D range;
+};
+
+/* Same data either in separate tightly packed arrays or interleaved, to test
+   both the full-width loads and the strided loads */
+struct Input {
+    explicit Input(std::size_t count, bool interleaved) {
+        for(std::size_t i = 0; i != MaxCount; ++i) {
+            Item& item = items[i];
+            item.center = {Float(i % 7)*4.0f - 12.0f,
+                           Float(i % 5)*5.0f - 10.0f,
+                           -Float(i % 11)*3.5f + 2.0f};
+            item.radius = Float(i % 4)*0.75f;
+            item.extents = {Float(i % 3)*0.5f + 0.25f,
+                            Float(i % 4)*0.5f,
+                            Float(i % 2)*2.0f + 0.5f};
+            item.range = {item.center - item.extents, item.center + item.extents};
+
+            centerData[i] = item.center;
+            radiusData[i] = item.radius;
+            extentData[i] = item.extents;
+            rangeData[i] = item.range;
+        }
+
+        if(interleaved) {
+            centers = Corrade::Containers::StridedArrayView1D<const Vector3>{items, &items[0].center, count, sizeof(Item)};
+            radii = Corrade::Containers::StridedArrayView1D<const Float>{items, &items[0].radius, count, sizeof(Item)};
+            extents = Corrade::Containers::StridedArrayView1D<const Vector3>{items, &items[0].extents, count, sizeof(Item)};
+            ranges = Corrade::Containers::StridedArrayView1D<const Range3D>{items, &items[0].range, count, sizeof(Item)};
+        } else {
+            centers = Corrade::Containers::stridedArrayView(centerData).prefix(count);
+            radii = Corrade::Containers::stridedArrayView(radiusData).prefix(count);
+            extents = Corrade::Containers::stridedArrayView(extentData).prefix(count);
+            ranges = Corrade::Containers::stridedArrayView(rangeData).prefix(count);
+        }
+    }
+
+    Item items[MaxCount];
+    Vector3 centerData[MaxCount];
+    Float radiusData[MaxCount];
+    Vector3 extentData[MaxCount];
+    Range3D rangeData[MaxCount];
+
+    Corrade::Containers::StridedArrayView1D<const Vector3> centers, extents;
+    Corrade::Containers::StridedArrayView1D<const Float> radii;
+    Corrade::Containers::StridedArrayView1D<const Range3D> ranges;
+};
+
+/* The sphere test needs normalized planes */
+Frustum frustum() {
+    Frustum out = Frustum::fromMatrix(Matrix4::perspectiveProjection(Deg(70.0f), 1.3f, 0.5f, 30.0f));
+    for(std::size_t i = 0; i != 6; ++i)
+        out[i] /= out[i].xyz().length();
+    return out;
+}
+
+IntersectionBatchTest::IntersectionBatchTest() {
+    addInstancedTests({&IntersectionBatchTest::sphereFrustum,
+                       &IntersectionBatchTest::aabbFrustum,
+                       &IntersectionBatchTest::rangeFrustum,
+                       &IntersectionBatchTest::sphereCone,
+                       &IntersectionBatchTest::sphereConeAngle},
+        Corrade::Containers::arraySize(BatchData));
+
+    addTests({&IntersectionBatchTest::assertions});
+}
+
+void IntersectionBatchTest::sphereFrustum() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Input input{data.count, data.interleaved};
+    const Frustum frustum = Test::frustum();
+
+    /* Filled to verify the bits past the end get cleared */
+    UnsignedByte mask[(MaxCount + 7)/8];
+    for(UnsignedByte& i: mask) i = 0xff;
+    Intersection::sphereFrustum(input.centers, input.radii, frustum, Corrade::Containers::arrayView(mask).prefix((data.count + 7)/8));
+
+    /* Ensure the results are consistent with non-batch APIs */
+    std::size_t intersecting = 0;
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        const bool expected = Intersection::sphereFrustum(input.centers[i], input.radii[i], frustum);
+        CORRADE_COMPARE(bool(mask[i/8] & (1 << i % 8)), expected);
+        if(expected) ++intersecting;
+    }
+    if(data.count % 8)
+        CORRADE_COMPARE(mask[data.count/8] >> data.count % 8, 0);
+
+    /* Both outcomes should be tested */
+    if(data.count >= 8) {
+        CORRADE_VERIFY(intersecting > 0);
+        CORRADE_VERIFY(intersecting < data.count);
+    }
+}
+
+void IntersectionBatchTest::aabbFrustum() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Input input{data.count, data.interleaved};
+    const Frustum frustum = Test::frustum();
+
+    UnsignedByte mask[(MaxCount + 7)/8];
+    for(UnsignedByte& i: mask) i = 0xff;
+    Intersection::aabbFrustum(input.centers, input.extents, frustum, Corrade::Containers::arrayView(mask).prefix((data.count + 7)/8));
+
+    std::size_t intersecting = 0;
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        const bool expected = Intersection::aabbFrustum(input.centers[i], input.extents[i], frustum);
+        CORRADE_COMPARE(bool(mask[i/8] & (1 << i % 8)), expected);
+        if(expected) ++intersecting;
+    }
+    if(data.count % 8)
+        CORRADE_COMPARE(mask[data.count/8] >> data.count % 8, 0);
+
+    if(data.count >= 8) {
+        CORRADE_VERIFY(intersecting > 0);
+        CORRADE_VERIFY(intersecting < data.count);
+    }
+}
+
+void IntersectionBatchTest::rangeFrustum() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Input input{data.count, data.interleaved};
+    const Frustum frustum = Test::frustum();
+
+    UnsignedByte mask[(MaxCount + 7)/8];
+    for(UnsignedByte& i: mask) i = 0xff;
+    Intersection::rangeFrustum(input.ranges, frustum, Corrade::Containers::arrayView(mask).prefix((data.count + 7)/8));
+
+    std::size_t intersecting = 0;
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        const bool expected = Intersection::rangeFrustum(input.ranges[i], frustum);
+        CORRADE_COMPARE(bool(mask[i/8] & (1 << i % 8)), expected);
+        if(expected) ++intersecting;
+    }
+    if(data.count % 8)
+        CORRADE_COMPARE(mask[data.count/8] >> data.count % 8, 0);
+
+    if(data.count >= 8) {
+        CORRADE_VERIFY(intersecting > 0);
+        CORRADE_VERIFY(intersecting < data.count);
+    }
+}
+
+void IntersectionBatchTest::sphereCone() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Input input{data.count, data.interleaved};
+    const Vector3 origin{1.0f, 0.5f, 2.0f};
+    const Vector3 normal = Vector3{0.2f, -0.1f, -1.0f}.normalized();
+    const Float sinAngle = Math::sin(Deg(20.0f));
+    const Float tanAngleSqPlusOne = Math::pow<2>(Math::tan(Deg(20.0f))) + 1.0f;
+
+    UnsignedByte mask[(MaxCount + 7)/8];
+    for(UnsignedByte& i: mask) i = 0xff;
+    Intersection::sphereCone(input.centers, input.radii, origin, normal, sinAngle, tanAngleSqPlusOne, Corrade::Containers::arrayView(mask).prefix((data.count + 7)/8));
+
+    std::size_t intersecting = 0;
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        const bool expected = Intersection::sphereCone(input.centers[i], input.radii[i], origin, normal, sinAngle, tanAngleSqPlusOne);
+        CORRADE_COMPARE(bool(mask[i/8] & (1 << i % 8)), expected);
+        if(expected) ++intersecting;
+    }
+    if(data.count % 8)
+        CORRADE_COMPARE(mask[data.count/8] >> data.count % 8, 0);
+
+    if(data.count >= 8) {
+        CORRADE_VERIFY(intersecting > 0);
+        CORRADE_VERIFY(intersecting < data.count);
+    }
+}
+
+void IntersectionBatchTest::sphereConeAngle() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Input input{data.count, data.interleaved};
+    const Vector3 origin{1.0f, 0.5f, 2.0f};
+    const Vector3 normal = Vector3{0.2f, -0.1f, -1.0f}.normalized();
+
+    const Math::Rad<Float> angle = Deg(40.0f);
+
+    UnsignedByte mask[(MaxCount + 7)/8];
+    Intersection::sphereCone(input.centers, input.radii, origin, normal, angle, Corrade::Containers::arrayView(mask).prefix((data.count + 7)/8));
+
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(bool(mask[i/8] & (1 << i % 8)), Intersection::sphereCone(input.centers[i], input.radii[i], origin, normal, angle));
+    }
+}
+
+void IntersectionBatchTest::assertions() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Vector3 centers[9]{};
+    const Float radii[9]{};
+    const Vector3 extents[9]{};
+    const Range3D ranges[9]{};
+    UnsignedByte mask[2];
+
+    std::ostringstream out;
+    Corrade::Utility::Error redirectError{&out};
+    Intersection::sphereFrustum(centers, Corrade::Containers::arrayView(radii).prefix(8), {}, mask);
+    Intersection::sphereFrustum(centers, radii, {}, Corrade::Containers::arrayView(mask).prefix(1));
+    Intersection::aabbFrustum(centers, Corrade::Containers::arrayView(extents).prefix(8), {}, mask);
+    Intersection::aabbFrustum(centers, extents, {}, Corrade::Containers::arrayView(mask).prefix(1));
+    Intersection::rangeFrustum(ranges, {}, Corrade::Containers::arrayView(mask).prefix(1));
+    Intersection::sphereCone(centers, Corrade::Containers::arrayView(radii).prefix(8), {}, {}, 0.5f, 1.0f, mask);
+    Intersection::sphereCone(centers, radii, {}, {}, 0.5f, 1.0f, Corrade::Containers::arrayView(mask).prefix(1));
+    CORRADE_COMPARE(out.str(),
+        "Math::Intersection::sphereFrustum(): expected 9 radii but got 8\n"
+        "Math::Intersection::sphereFrustum(): expected a mask of 2 bytes but got 1\n"
+        "Math::Intersection::aabbFrustum(): expected 9 extents but got 8\n"
+        "Math::Intersection::aabbFrustum(): expected a mask of 2 bytes but got 1\n"
+        "Math::Intersection::rangeFrustum(): expected a mask of 2 bytes but got 1\n"
+        "Math::Intersection::sphereCone(): expected 9 radii but got 8\n"
+        "Math::Intersection::sphereCone(): expected a mask of 2 bytes but got 1\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::IntersectionBatchTest)
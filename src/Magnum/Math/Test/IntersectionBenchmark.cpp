@@ -26,10 +26,13 @@
 
 #include <random>
 #include <utility>
+#include <Corrade/Containers/ArrayViewStl.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Angle.h"
 #include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/IntersectionBatch.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -102,13 +105,19 @@ struct IntersectionBenchmark: Corrade::TestSuite::Tester {
 
     void rangeFrustumNaive();
     void rangeFrustum();
+    void rangeFrustumBatch();
+
+    void aabbFrustum();
+    void aabbFrustumBatch();
 
     void rangeCone();
 
     void sphereFrustum();
+    void sphereFrustumBatch();
 
     void sphereConeNaive();
     void sphereCone();
+    void sphereConeBatch();
     void sphereConeView();
 
     Frustum _frustum;
@@ -121,18 +130,30 @@ struct IntersectionBenchmark: Corrade::TestSuite::Tester {
 
     std::vector<Range3D> _boxes;
     std::vector<Vector4> _spheres;
+
+    /* The same data in separate arrays for the batch APIs */
+    std::vector<Vector3> _centers;
+    std::vector<Vector3> _extents;
+    std::vector<Float> _radii;
+    std::vector<UnsignedByte> _mask;
 };
 
 IntersectionBenchmark::IntersectionBenchmark() {
     addBenchmarks({&IntersectionBenchmark::rangeFrustumNaive,
                    &IntersectionBenchmark::rangeFrustum,
+                   &IntersectionBenchmark::rangeFrustumBatch,
+
+                   &IntersectionBenchmark::aabbFrustum,
+                   &IntersectionBenchmark::aabbFrustumBatch,
 
                    &IntersectionBenchmark::rangeCone,
 
                    &IntersectionBenchmark::sphereFrustum,
+                   &IntersectionBenchmark::sphereFrustumBatch,
 
                    &IntersectionBenchmark::sphereConeNaive,
                    &IntersectionBenchmark::sphereCone,
+                   &IntersectionBenchmark::sphereConeBatch,
                    &IntersectionBenchmark::sphereConeView}, 10);
 
     /* Generate random data for the benchmarks */
@@ -156,7 +177,11 @@ IntersectionBenchmark::IntersectionBenchmark() {
         Vector3 extents{pd(g), pd(g), pd(g)};
         _boxes.emplace_back(center - extents, center + extents);
         _spheres.emplace_back(center, extents.length());
+        _centers.push_back(center);
+        _extents.push_back(extents);
+        _radii.push_back(extents.length());
     }
+    _mask.resize((_centers.size() + 7)/8);
 }
 
 void IntersectionBenchmark::rangeFrustumNaive() {
@@ -173,6 +198,29 @@ void IntersectionBenchmark::rangeFrustum() {
     }
 }
 
+void IntersectionBenchmark::rangeFrustumBatch() {
+    volatile UnsignedByte b = 0;
+    CORRADE_BENCHMARK(50) {
+        Intersection::rangeFrustum(_boxes, _frustum, _mask);
+        b = b ^ _mask[0];
+    }
+}
+
+void IntersectionBenchmark::aabbFrustum() {
+    volatile bool b = false;
+    CORRADE_BENCHMARK(50) for(std::size_t i = 0; i != _centers.size(); ++i) {
+        b = b ^ Intersection::aabbFrustum(_centers[i], _extents[i], _frustum);
+    }
+}
+
+void IntersectionBenchmark::aabbFrustumBatch() {
+    volatile UnsignedByte b = 0;
+    CORRADE_BENCHMARK(50) {
+        Intersection::aabbFrustum(_centers, _extents, _frustum, _mask);
+        b = b ^ _mask[0];
+    }
+}
+
 void IntersectionBenchmark::rangeCone() {
     volatile bool b = false;
     CORRADE_BENCHMARK(50) {
@@ -191,6 +239,14 @@ void IntersectionBenchmark::sphereFrustum() {
     }
 }
 
+void IntersectionBenchmark::sphereFrustumBatch() {
+    volatile UnsignedByte b = 0;
+    CORRADE_BENCHMARK(50) {
+        Intersection::sphereFrustum(_centers, _radii, _frustum, _mask);
+        b = b ^ _mask[0];
+    }
+}
+
 void IntersectionBenchmark::sphereConeNaive() {
     volatile bool b = false;
     CORRADE_BENCHMARK(50) for(auto& sphere: _spheres) {
@@ -210,6 +266,17 @@ void IntersectionBenchmark::sphereCone() {
     }
 }
 
+void IntersectionBenchmark::sphereConeBatch() {
+    volatile UnsignedByte b = 0;
+    CORRADE_BENCHMARK(50) {
+        const Float sinAngle = Math::sin(_cone.angle);
+        const Float tanAngle = Math::tan(_cone.angle);
+        const Float tanAngleSqPlusOne = tanAngle*tanAngle + 1.0f;
+        Intersection::sphereCone(_centers, _radii, _cone.origin, _cone.normal, sinAngle, tanAngleSqPlusOne, _mask);
+        b = b ^ _mask[0];
+    }
+}
+
 void IntersectionBenchmark::sphereConeView() {
     volatile bool b = false;
     CORRADE_BENCHMARK(50) {
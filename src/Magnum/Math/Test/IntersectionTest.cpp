@@ -267,6 +267,9 @@ void IntersectionTest::sphereFrustum() {
     CORRADE_VERIFY(Intersection::sphereFrustum({5.5f, 5.5f, 5.5f}, 1.5f,  frustum));
     /* Sphere outside */
     CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, 0.0f, 100.0f}, 0.5f, frustum));
+    /* Sphere outside, closer than the radius squared. Was incorrectly
+       reported as intersecting before. */
+    CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, 0.0f, -2.0f}, 1.5f, frustum));
 }
 
 void IntersectionTest::pointCone() {
@@ -0,0 +1,251 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/PackingBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct PackingBatchBenchmark: Corrade::TestSuite::Tester {
+    explicit PackingBatchBenchmark();
+
+    template<class T> void unpack();
+    template<class T> void pack();
+    void unpackHalf();
+    void packHalf();
+    template<class T> void castToFloat();
+    template<class T> void castFromFloat();
+    void castFloatDouble();
+};
+
+enum class Layout {
+    /* Calling the single-value APIs in a loop */
+    PerItem,
+    /* Four-component attributes interleaved with other data, each row
+       processed separately */
+    Interleaved,
+    /* Tightly packed four-component attributes, processed as a single run */
+    Contiguous
+};
+
+const struct {
+    const char* name;
+    Layout layout;
+} BenchmarkData[] {
+    {"per-item API", Layout::PerItem},
+    {"interleaved", Layout::Interleaved},
+    {"contiguous", Layout::Contiguous}
+};
+
+enum: std::size_t { Size = 16384 };
+
+PackingBatchBenchmark::PackingBatchBenchmark() {
+    addInstancedBenchmarks({
+        &PackingBatchBenchmark::unpack<UnsignedByte>,
+        &PackingBatchBenchmark::unpack<Byte>,
+        &PackingBatchBenchmark::unpack<UnsignedShort>,
+        &PackingBatchBenchmark::unpack<Short>,
+        &PackingBatchBenchmark::pack<UnsignedByte>,
+        &PackingBatchBenchmark::pack<Byte>,
+        &PackingBatchBenchmark::pack<UnsignedShort>,
+        &PackingBatchBenchmark::pack<Short>,
+        &PackingBatchBenchmark::unpackHalf,
+        &PackingBatchBenchmark::packHalf,
+        &PackingBatchBenchmark::castToFloat<UnsignedByte>,
+        &PackingBatchBenchmark::castToFloat<Short>,
+        &PackingBatchBenchmark::castToFloat<Int>,
+        &PackingBatchBenchmark::castFromFloat<UnsignedByte>,
+        &PackingBatchBenchmark::castFromFloat<Short>,
+        &PackingBatchBenchmark::castFromFloat<Int>,
+        &PackingBatchBenchmark::castFloatDouble}, 10,
+        Corrade::Containers::arraySize(BenchmarkData));
+}
+
+/* Views on Size four-component items. The interleaved layout has the items
+   padded to twice their size, so the first dimension isn't contiguous. */
+template<class T> Corrade::Containers::StridedArrayView2D<T> view(Corrade::Containers::Array<T>& data, Layout layout) {
+    return {data, {Size, 4}, {std::ptrdiff_t((layout == Layout::Interleaved ? 8 : 4)*sizeof(T)), sizeof(T)}};
+}
+
+template<class T> void PackingBatchBenchmark::unpack() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseTemplateName(TypeTraits<T>::name());
+    setTestCaseDescription(data.name);
+
+    Corrade::Containers::Array<T> src{Corrade::Containers::NoInit, Size*8};
+    Corrade::Containers::Array<Float> dst{Corrade::Containers::NoInit, Size*8};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = T(i*37);
+
+    const Corrade::Containers::StridedArrayView2D<T> srcView = view(src, data.layout);
+    const Corrade::Containers::StridedArrayView2D<Float> dstView = view(dst, data.layout);
+    if(data.layout == Layout::PerItem) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size*4; ++i)
+            dst[i] = Math::unpack<Float>(src[i]);
+    } else CORRADE_BENCHMARK(10) {
+        unpackInto(srcView, dstView);
+    }
+
+    CORRADE_COMPARE(dstView[Size - 1][3], Math::unpack<Float>(srcView[Size - 1][3]));
+}
+
+template<class T> void PackingBatchBenchmark::pack() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseTemplateName(TypeTraits<T>::name());
+    setTestCaseDescription(data.name);
+
+    Corrade::Containers::Array<Float> src{Corrade::Containers::NoInit, Size*8};
+    Corrade::Containers::Array<T> dst{Corrade::Containers::NoInit, Size*8};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = Float(i % 201)/100.0f - 1.0f;
+
+    const Corrade::Containers::StridedArrayView2D<Float> srcView = view(src, data.layout);
+    const Corrade::Containers::StridedArrayView2D<T> dstView = view(dst, data.layout);
+    if(data.layout == Layout::PerItem) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size*4; ++i)
+            dst[i] = Math::pack<T>(src[i]);
+    } else CORRADE_BENCHMARK(10) {
+        packInto(srcView, dstView);
+    }
+
+    CORRADE_COMPARE(dstView[Size - 1][3], Math::pack<T>(srcView[Size - 1][3]));
+}
+
+void PackingBatchBenchmark::unpackHalf() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Corrade::Containers::Array<UnsignedShort> src{Corrade::Containers::NoInit, Size*8};
+    Corrade::Containers::Array<Float> dst{Corrade::Containers::NoInit, Size*8};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = Math::packHalf(Float(i % 2001)/10.0f - 100.0f);
+
+    const Corrade::Containers::StridedArrayView2D<UnsignedShort> srcView = view(src, data.layout);
+    const Corrade::Containers::StridedArrayView2D<Float> dstView = view(dst, data.layout);
+    if(data.layout == Layout::PerItem) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size*4; ++i)
+            dst[i] = Math::unpackHalf(src[i]);
+    } else CORRADE_BENCHMARK(10) {
+        unpackHalfInto(srcView, dstView);
+    }
+
+    CORRADE_COMPARE(dstView[Size - 1][3], Math::unpackHalf(srcView[Size - 1][3]));
+}
+
+void PackingBatchBenchmark::packHalf() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Corrade::Containers::Array<Float> src{Corrade::Containers::NoInit, Size*8};
+    Corrade::Containers::Array<UnsignedShort> dst{Corrade::Containers::NoInit, Size*8};
+    /* Values exactly representable as halves, so the rounding behavior of
+       the single-value API doesn't matter when comparing */
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = Float(i % 2001)/8.0f - 125.0f;
+
+    const Corrade::Containers::StridedArrayView2D<Float> srcView = view(src, data.layout);
+    const Corrade::Containers::StridedArrayView2D<UnsignedShort> dstView = view(dst, data.layout);
+    if(data.layout == Layout::PerItem) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size*4; ++i)
+            dst[i] = Math::packHalf(src[i]);
+    } else CORRADE_BENCHMARK(10) {
+        packHalfInto(srcView, dstView);
+    }
+
+    CORRADE_COMPARE(dstView[Size - 1][3], Math::packHalf(srcView[Size - 1][3]));
+}
+
+template<class T> void PackingBatchBenchmark::castToFloat() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseTemplateName(TypeTraits<T>::name());
+    setTestCaseDescription(data.name);
+
+    Corrade::Containers::Array<T> src{Corrade::Containers::NoInit, Size*8};
+    Corrade::Containers::Array<Float> dst{Corrade::Containers::NoInit, Size*8};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = T(i*37);
+
+    const Corrade::Containers::StridedArrayView2D<T> srcView = view(src, data.layout);
+    const Corrade::Containers::StridedArrayView2D<Float> dstView = view(dst, data.layout);
+    if(data.layout == Layout::PerItem) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size*4; ++i)
+            dst[i] = Float(src[i]);
+    } else CORRADE_BENCHMARK(10) {
+        castInto(srcView, dstView);
+    }
+
+    CORRADE_COMPARE(dstView[Size - 1][3], Float(srcView[Size - 1][3]));
+}
+
+template<class T> void PackingBatchBenchmark::castFromFloat() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseTemplateName(TypeTraits<T>::name());
+    setTestCaseDescription(data.name);
+
+    Corrade::Containers::Array<Float> src{Corrade::Containers::NoInit, Size*8};
+    Corrade::Containers::Array<T> dst{Corrade::Containers::NoInit, Size*8};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = Float(i % 100) + 0.25f;
+
+    const Corrade::Containers::StridedArrayView2D<Float> srcView = view(src, data.layout);
+    const Corrade::Containers::StridedArrayView2D<T> dstView = view(dst, data.layout);
+    if(data.layout == Layout::PerItem) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size*4; ++i)
+            dst[i] = T(src[i]);
+    } else CORRADE_BENCHMARK(10) {
+        castInto(srcView, dstView);
+    }
+
+    CORRADE_COMPARE(dstView[Size - 1][3], T(srcView[Size - 1][3]));
+}
+
+void PackingBatchBenchmark::castFloatDouble() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Corrade::Containers::Array<Float> src{Corrade::Containers::NoInit, Size*8};
+    Corrade::Containers::Array<Double> dst{Corrade::Containers::NoInit, Size*8};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = Float(i)*0.25f;
+
+    const Corrade::Containers::StridedArrayView2D<Float> srcView = view(src, data.layout);
+    const Corrade::Containers::StridedArrayView2D<Double> dstView = view(dst, data.layout);
+    if(data.layout == Layout::PerItem) CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size*4; ++i)
+            dst[i] = Double(src[i]);
+    } else CORRADE_BENCHMARK(10) {
+        castInto(srcView, dstView);
+    }
+
+    CORRADE_COMPARE(dstView[Size - 1][3], Double(srcView[Size - 1][3]));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingBatchBenchmark)
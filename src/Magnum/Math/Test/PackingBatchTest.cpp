@@ -24,6 +24,7 @@
 */
 
 #include <sstream>
+#include <type_traits>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
@@ -36,6 +37,14 @@
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
+const struct {
+    const char* name;
+    bool contiguous;
+} RunData[] {
+    {"contiguous", true},
+    {"padded rows", false}
+};
+
 struct PackingBatchTest: Corrade::TestSuite::Tester {
     explicit PackingBatchTest();
 
@@ -51,6 +60,9 @@ struct PackingBatchTest: Corrade::TestSuite::Tester {
     void unpackHalf();
     void packHalf();
 
+    template<class T> void packOctahedral();
+    template<class T> void unpackOctahedral();
+
     template<class T> void castUnsignedFloat();
     template<class T> void castSignedFloat();
 
@@ -59,8 +71,15 @@ struct PackingBatchTest: Corrade::TestSuite::Tester {
 
     void castFloatDouble();
 
+    template<class T> void unpackRuns();
+    template<class T> void packRuns();
+    void unpackHalfRuns();
+    void packHalfRuns();
+    template<class T> void castFloatRuns();
+
     template<class T> void assertionsPackUnpack();
     void assertionsPackUnpackHalf();
+    void assertionsPackUnpackOctahedral();
     template<class U, class T> void assertionsCast();
 };
 
@@ -77,6 +96,13 @@ PackingBatchTest::PackingBatchTest() {
               &PackingBatchTest::unpackHalf,
               &PackingBatchTest::packHalf,
 
+              &PackingBatchTest::packOctahedral<Byte>,
+              &PackingBatchTest::packOctahedral<Short>,
+              &PackingBatchTest::packOctahedral<Float>,
+              &PackingBatchTest::unpackOctahedral<Byte>,
+              &PackingBatchTest::unpackOctahedral<Short>,
+              &PackingBatchTest::unpackOctahedral<Float>,
+
               &PackingBatchTest::castUnsignedFloat<UnsignedByte>,
               &PackingBatchTest::castUnsignedFloat<UnsignedShort>,
               &PackingBatchTest::castUnsignedFloat<UnsignedInt>,
@@ -91,13 +117,34 @@ PackingBatchTest::PackingBatchTest() {
               &PackingBatchTest::castSignedInteger<Short, Int>,
               &PackingBatchTest::castSignedInteger<Byte, Short>,
 
-              &PackingBatchTest::castFloatDouble,
-
-              &PackingBatchTest::assertionsPackUnpack<UnsignedByte>,
+              &PackingBatchTest::castFloatDouble});
+
+    addInstancedTests<PackingBatchTest>({
+        &PackingBatchTest::unpackRuns<UnsignedByte>,
+        &PackingBatchTest::unpackRuns<Byte>,
+        &PackingBatchTest::unpackRuns<UnsignedShort>,
+        &PackingBatchTest::unpackRuns<Short>,
+        &PackingBatchTest::packRuns<UnsignedByte>,
+        &PackingBatchTest::packRuns<Byte>,
+        &PackingBatchTest::packRuns<UnsignedShort>,
+        &PackingBatchTest::packRuns<Short>,
+        &PackingBatchTest::unpackHalfRuns,
+        &PackingBatchTest::packHalfRuns,
+        &PackingBatchTest::castFloatRuns<UnsignedByte>,
+        &PackingBatchTest::castFloatRuns<Byte>,
+        &PackingBatchTest::castFloatRuns<UnsignedShort>,
+        &PackingBatchTest::castFloatRuns<Short>,
+        &PackingBatchTest::castFloatRuns<UnsignedInt>,
+        &PackingBatchTest::castFloatRuns<Int>,
+        &PackingBatchTest::castFloatRuns<Double>},
+        Corrade::Containers::arraySize(RunData));
+
+    addTests({&PackingBatchTest::assertionsPackUnpack<UnsignedByte>,
               &PackingBatchTest::assertionsPackUnpack<Byte>,
               &PackingBatchTest::assertionsPackUnpack<UnsignedShort>,
               &PackingBatchTest::assertionsPackUnpack<Short>,
               &PackingBatchTest::assertionsPackUnpackHalf,
+              &PackingBatchTest::assertionsPackUnpackOctahedral,
               &PackingBatchTest::assertionsCast<Float, UnsignedByte>,
               &PackingBatchTest::assertionsCast<Float, Byte>,
               &PackingBatchTest::assertionsCast<Float, UnsignedShort>,
@@ -422,6 +469,60 @@ void PackingBatchTest::packHalf() {
         CORRADE_COMPARE(Math::packHalf(data[i].src), data[i].dst);
 }
 
+template<class T> void PackingBatchTest::packOctahedral() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    struct Data {
+        Vector3 src;
+        Math::Vector2<T> dst;
+    } data[]{
+        {{0.0f, 0.0f, 1.0f}, {}},
+        {{0.0f, 0.6f, -0.8f}, {}},
+        {{0.267261f, 0.534522f, 0.801784f}, {}},
+        {{-0.57735f, 0.57735f, -0.57735f}, {}}
+    };
+
+    Corrade::Containers::StridedArrayView1D<Vector3> src{data, &data[0].src,
+        Corrade::Containers::arraySize(data), sizeof(Data)};
+    Corrade::Containers::StridedArrayView1D<Math::Vector2<T>> dst{data, &data[0].dst,
+        Corrade::Containers::arraySize(data), sizeof(Data)};
+    packOctahedralInto(src, dst);
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != Corrade::Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(Math::packOctahedral<Math::Vector2<T>>(data[i].src), data[i].dst);
+    }
+}
+
+template<class T> void PackingBatchTest::unpackOctahedral() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    struct Data {
+        Math::Vector2<T> src;
+        Vector3 dst;
+    } data[]{
+        {Math::packOctahedral<Math::Vector2<T>>(Vector3{0.0f, 0.0f, 1.0f}), {}},
+        {Math::packOctahedral<Math::Vector2<T>>(Vector3{0.0f, 0.6f, -0.8f}), {}},
+        {Math::packOctahedral<Math::Vector2<T>>(Vector3{0.267261f, 0.534522f, 0.801784f}), {}}
+    };
+
+    Corrade::Containers::StridedArrayView1D<Math::Vector2<T>> src{data, &data[0].src,
+        Corrade::Containers::arraySize(data), sizeof(Data)};
+    Corrade::Containers::StridedArrayView1D<Vector3> dst{data, &data[0].dst,
+        Corrade::Containers::arraySize(data), sizeof(Data)};
+    unpackOctahedralInto(src, dst);
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != Corrade::Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(Math::unpackOctahedral<Vector3>(data[i].src), data[i].dst);
+    }
+
+    /* The first item is representable exactly in all precisions */
+    CORRADE_COMPARE(data[0].dst, (Vector3{0.0f, 0.0f, 1.0f}));
+}
+
 template<class T> void PackingBatchTest::castUnsignedFloat() {
     setTestCaseTemplateName(TypeTraits<T>::name());
 
@@ -614,6 +715,150 @@ void PackingBatchTest::castFloatDouble() {
         Corrade::TestSuite::Compare::Container);
 }
 
+/* Either a single contiguous run or rows with padding in between, processed
+   separately. The sizes are chosen to exercise both the vectorized code paths
+   and the scalar remainders. */
+template<class T> Corrade::Containers::StridedArrayView2D<T> runView(T(&data)[160], bool contiguous) {
+    if(contiguous) return Corrade::Containers::StridedArrayView2D<T>{data, {8, 20}};
+    return Corrade::Containers::StridedArrayView2D<T>{data, {8, 17}, {20*sizeof(T), sizeof(T)}};
+}
+
+template<class T> void PackingBatchTest::unpackRuns() {
+    auto&& data = RunData[testCaseInstanceId()];
+    setTestCaseTemplateName(TypeTraits<T>::name());
+    setTestCaseDescription(data.name);
+
+    T src[160];
+    for(std::size_t i = 0; i != Corrade::Containers::arraySize(src); ++i)
+        src[i] = T(i*1637);
+    /* For signed types this is the minimum, which gets clamped to -1 */
+    src[1] = T(1 << (sizeof(T)*8 - 1));
+    Float dst[160]{};
+
+    const Corrade::Containers::StridedArrayView2D<T> srcView = runView(src, data.contiguous);
+    const Corrade::Containers::StridedArrayView2D<Float> dstView = runView(dst, data.contiguous);
+    unpackInto(srcView, dstView);
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != srcView.size()[0]; ++i) {
+        for(std::size_t j = 0; j != srcView.size()[1]; ++j) {
+            CORRADE_ITERATION(i, j);
+            CORRADE_COMPARE(dstView[i][j], Math::unpack<Float>(srcView[i][j]));
+        }
+    }
+}
+
+template<class T> void PackingBatchTest::packRuns() {
+    auto&& data = RunData[testCaseInstanceId()];
+    setTestCaseTemplateName(TypeTraits<T>::name());
+    setTestCaseDescription(data.name);
+
+    /* The values include 0.5 which is exactly halfway between two integers
+       for all types, verifying the rounding matches */
+    Float src[160];
+    for(std::size_t i = 0; i != Corrade::Containers::arraySize(src); ++i)
+        src[i] = std::is_signed<T>::value ? Float(i % 41)/20.0f - 1.0f : Float(i % 21)/20.0f;
+    T dst[160]{};
+
+    const Corrade::Containers::StridedArrayView2D<Float> srcView = runView(src, data.contiguous);
+    const Corrade::Containers::StridedArrayView2D<T> dstView = runView(dst, data.contiguous);
+    packInto(srcView, dstView);
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != srcView.size()[0]; ++i) {
+        for(std::size_t j = 0; j != srcView.size()[1]; ++j) {
+            CORRADE_ITERATION(i, j);
+            CORRADE_COMPARE(dstView[i][j], Math::pack<T>(srcView[i][j]));
+        }
+    }
+}
+
+void PackingBatchTest::unpackHalfRuns() {
+    auto&& data = RunData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Clearing the lowest exponent bit to avoid NaNs, which wouldn't compare
+       equal */
+    UnsignedShort src[160];
+    for(std::size_t i = 0; i != Corrade::Containers::arraySize(src); ++i)
+        src[i] = UnsignedShort(i*397) & 0xfbff;
+    Float dst[160]{};
+
+    const Corrade::Containers::StridedArrayView2D<UnsignedShort> srcView = runView(src, data.contiguous);
+    const Corrade::Containers::StridedArrayView2D<Float> dstView = runView(dst, data.contiguous);
+    unpackHalfInto(srcView, dstView);
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != srcView.size()[0]; ++i) {
+        for(std::size_t j = 0; j != srcView.size()[1]; ++j) {
+            CORRADE_ITERATION(i, j);
+            CORRADE_COMPARE(dstView[i][j], Math::unpackHalf(srcView[i][j]));
+        }
+    }
+}
+
+void PackingBatchTest::packHalfRuns() {
+    auto&& data = RunData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* All values are exactly representable as halves, including denormals,
+       so they should survive a round trip */
+    UnsignedShort expected[160];
+    Float src[160];
+    for(std::size_t i = 0; i != Corrade::Containers::arraySize(src); ++i) {
+        expected[i] = UnsignedShort(i*397) & 0xfbff;
+        src[i] = Math::unpackHalf(expected[i]);
+    }
+    /* Overflow goes to infinity */
+    src[3] = 1.0e10f;
+    expected[3] = 0x7c00;
+    src[4] = -Constants::inf();
+    expected[4] = 0xfc00;
+    UnsignedShort dst[160]{};
+
+    const Corrade::Containers::StridedArrayView2D<Float> srcView = runView(src, data.contiguous);
+    const Corrade::Containers::StridedArrayView2D<UnsignedShort> dstView = runView(dst, data.contiguous);
+    const Corrade::Containers::StridedArrayView2D<UnsignedShort> expectedView = runView(expected, data.contiguous);
+    packHalfInto(srcView, dstView);
+
+    for(std::size_t i = 0; i != srcView.size()[0]; ++i) {
+        for(std::size_t j = 0; j != srcView.size()[1]; ++j) {
+            CORRADE_ITERATION(i, j);
+            CORRADE_COMPARE(dstView[i][j], expectedView[i][j]);
+        }
+    }
+}
+
+template<class T> void PackingBatchTest::castFloatRuns() {
+    auto&& data = RunData[testCaseInstanceId()];
+    setTestCaseTemplateName(TypeTraits<T>::name());
+    setTestCaseDescription(data.name);
+
+    T values[160];
+    Float floats[160];
+    for(std::size_t i = 0; i != Corrade::Containers::arraySize(values); ++i) {
+        values[i] = T(i % 100);
+        floats[i] = std::is_signed<T>::value ? Float(i % 200) - 99.75f : Float(i % 200) + 0.75f;
+    }
+    T valuesOut[160]{};
+    Float floatsOut[160]{};
+
+    const Corrade::Containers::StridedArrayView2D<T> valuesView = runView(values, data.contiguous);
+    const Corrade::Containers::StridedArrayView2D<Float> floatsView = runView(floats, data.contiguous);
+    const Corrade::Containers::StridedArrayView2D<T> valuesOutView = runView(valuesOut, data.contiguous);
+    const Corrade::Containers::StridedArrayView2D<Float> floatsOutView = runView(floatsOut, data.contiguous);
+    castInto(valuesView, floatsOutView);
+    castInto(floatsView, valuesOutView);
+
+    for(std::size_t i = 0; i != valuesView.size()[0]; ++i) {
+        for(std::size_t j = 0; j != valuesView.size()[1]; ++j) {
+            CORRADE_ITERATION(i, j);
+            CORRADE_COMPARE(floatsOutView[i][j], Float(valuesView[i][j]));
+            CORRADE_COMPARE(valuesOutView[i][j], T(floatsView[i][j]));
+        }
+    }
+}
+
 template<class T> void PackingBatchTest::assertionsPackUnpack() {
     #ifdef CORRADE_NO_ASSERT
     CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
@@ -724,6 +969,23 @@ template<class U, class T> void PackingBatchTest::assertionsCast() {
         "Math::castInto(): second view dimension is not contiguous\n");
 }
 
+void PackingBatchTest::assertionsPackUnpackOctahedral() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Vector3 directions[2]{};
+    Vector2s packed[1]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    packOctahedralInto(directions, packed);
+    unpackOctahedralInto(packed, directions);
+    CORRADE_COMPARE(out.str(),
+        "Math::packOctahedralInto(): wrong destination size, got 1 but expected 2\n"
+        "Math::unpackOctahedralInto(): wrong destination size, got 2 but expected 1\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::PackingBatchTest)
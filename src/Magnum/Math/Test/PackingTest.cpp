@@ -23,10 +23,15 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cmath>
 #include <limits>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
 
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Constants.h"
 #include "Magnum/Math/Packing.h"
+#include "Magnum/Math/TypeTraits.h"
 #include "Magnum/Math/Vector3.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
@@ -47,6 +52,12 @@ struct PackingTest: Corrade::TestSuite::Tester {
     void pack8bitRoundtrip();
     void pack16bitRoundtrip();
 
+    void packOctahedral();
+    template<class T> void packOctahedralIntegral();
+    void unpackOctahedral();
+    void octahedralRoundtripAxes();
+    template<class T> void octahedralRoundtrip();
+
     /* Half (un)pack functions are tested and benchmarked in HalfTest.cpp,
        because there's involved comparison and benchmarks to ground truth */
 };
@@ -57,6 +68,9 @@ typedef Math::Rad<Float> Rad;
 typedef Math::Vector3<Float> Vector3;
 typedef Math::Vector3<UnsignedByte> Vector3ub;
 typedef Math::Vector3<Byte> Vector3b;
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector2<Byte> Vector2b;
+typedef Math::Vector2<Short> Vector2s;
 
 PackingTest::PackingTest() {
     addTests({&PackingTest::bitMax,
@@ -71,6 +85,15 @@ PackingTest::PackingTest() {
 
     addRepeatedTests({&PackingTest::pack8bitRoundtrip}, 256);
     addRepeatedTests({&PackingTest::pack16bitRoundtrip}, 65536);
+
+    addTests({&PackingTest::packOctahedral,
+              &PackingTest::packOctahedralIntegral<Byte>,
+              &PackingTest::packOctahedralIntegral<Short>,
+              &PackingTest::unpackOctahedral,
+              &PackingTest::octahedralRoundtripAxes,
+              &PackingTest::octahedralRoundtrip<Byte>,
+              &PackingTest::octahedralRoundtrip<Short>,
+              &PackingTest::octahedralRoundtrip<Float>});
 }
 
 void PackingTest::bitMax() {
@@ -319,6 +342,87 @@ void PackingTest::pack16bitRoundtrip() {
     CORRADE_COMPARE(Math::pack<UnsignedShort>(Math::unpack<Float, UnsignedShort>(testCaseRepeatId())), testCaseRepeatId());
 }
 
+void PackingTest::packOctahedral() {
+    /* Upper hemisphere is projected directly */
+    CORRADE_COMPARE(Math::packOctahedral<Vector2>(Vector3{0.0f, 0.0f, 1.0f}), (Vector2{0.0f, 0.0f}));
+    CORRADE_COMPARE(Math::packOctahedral<Vector2>(Vector3{1.0f, 0.0f, 0.0f}), (Vector2{1.0f, 0.0f}));
+    CORRADE_COMPARE(Math::packOctahedral<Vector2>(Vector3{0.267261f, 0.534522f, 0.801784f}), (Vector2{0.166667f, 0.333333f}));
+
+    /* Lower hemisphere is folded over the diagonals */
+    CORRADE_COMPARE(Math::packOctahedral<Vector2>(Vector3{0.0f, 0.6f, -0.8f}), (Vector2{0.571429f, 1.0f}));
+    CORRADE_COMPARE(Math::packOctahedral<Vector2>(Vector3{0.0f, 0.0f, -1.0f}), (Vector2{1.0f, 1.0f}));
+
+    /* Input doesn't need to be normalized */
+    CORRADE_COMPARE(Math::packOctahedral<Vector2>(Vector3{0.0f, 1.2f, -1.6f}), (Vector2{0.571429f, 1.0f}));
+}
+
+template<class T> void PackingTest::packOctahedralIntegral() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    constexpr T bitMax = Implementation::bitMax<T>();
+    typedef Math::Vector2<T> Vector2T;
+    CORRADE_COMPARE(Math::packOctahedral<Vector2T>(Vector3{0.0f, 0.0f, 1.0f}), (Vector2T{0, 0}));
+    CORRADE_COMPARE(Math::packOctahedral<Vector2T>(Vector3{0.0f, -1.0f, 0.0f}), (Vector2T{0, -bitMax}));
+    CORRADE_COMPARE(Math::packOctahedral<Vector2T>(Vector3{0.0f, 0.0f, -1.0f}), (Vector2T{bitMax, bitMax}));
+}
+
+void PackingTest::unpackOctahedral() {
+    CORRADE_COMPARE(Math::unpackOctahedral<Vector3>(Vector2{0.0f, 0.0f}), (Vector3{0.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(Math::unpackOctahedral<Vector3>(Vector2{1.0f, 1.0f}), (Vector3{0.0f, 0.0f, -1.0f}));
+    CORRADE_COMPARE(Math::unpackOctahedral<Vector3>(Vector2{0.571429f, 1.0f}), (Vector3{0.0f, 0.6f, -0.8f}));
+
+    /* Integral inputs are unpacked first */
+    CORRADE_COMPARE(Math::unpackOctahedral<Vector3>(Vector2b{0, -127}), (Vector3{0.0f, -1.0f, 0.0f}));
+    CORRADE_COMPARE(Math::unpackOctahedral<Vector3>(Vector2s{32767, 0}), (Vector3{1.0f, 0.0f, 0.0f}));
+
+    /* The output is always normalized */
+    CORRADE_VERIFY(Math::unpackOctahedral<Vector3>(Vector2b{40, -70}).isNormalized());
+    CORRADE_VERIFY(Math::unpackOctahedral<Vector3>(Vector2b{127, 127}).isNormalized());
+}
+
+void PackingTest::octahedralRoundtripAxes() {
+    /* Axis-aligned directions are all representable exactly */
+    for(const Vector3 axis: {Vector3::xAxis(), Vector3::yAxis(), Vector3::zAxis(),
+                             -Vector3::xAxis(), -Vector3::yAxis(), -Vector3::zAxis()}) {
+        CORRADE_ITERATION(axis);
+        CORRADE_COMPARE(Math::unpackOctahedral<Vector3>(Math::packOctahedral<Vector2b>(axis)), axis);
+        CORRADE_COMPARE(Math::unpackOctahedral<Vector3>(Math::packOctahedral<Vector2s>(axis)), axis);
+        CORRADE_COMPARE(Math::unpackOctahedral<Vector3>(Math::packOctahedral<Vector2>(axis)), axis);
+    }
+}
+
+/* Distance between two unit vectors is about the same as the angle between
+   them for small angles, and isn't affected by the imprecision of acos()
+   close to 1 */
+template<class> struct OctahedralTraits;
+template<> struct OctahedralTraits<Byte> {
+    static Float maxError() { return Float(Rad{0.7_degf}); }
+};
+template<> struct OctahedralTraits<Short> {
+    static Float maxError() { return Float(Rad{0.003_degf}); }
+};
+template<> struct OctahedralTraits<Float> {
+    static Float maxError() { return 1.0e-5f; }
+};
+
+template<class T> void PackingTest::octahedralRoundtrip() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* A Fibonacci sphere, i.e. evenly distributed directions */
+    constexpr UnsignedInt count = 1000;
+    const Float goldenAngle = Constants<Float>::pi()*(3.0f - std::sqrt(5.0f));
+    Float maxError = 0.0f;
+    for(UnsignedInt i = 0; i != count; ++i) {
+        const Float z = 1.0f - 2.0f*(i + 0.5f)/count;
+        const Float r = std::sqrt(1.0f - z*z);
+        const Vector3 direction{r*std::cos(goldenAngle*i), r*std::sin(goldenAngle*i), z};
+        const Vector3 decoded = Math::unpackOctahedral<Vector3>(Math::packOctahedral<Math::Vector2<T>>(direction));
+        maxError = Math::max(maxError, (decoded - direction).length());
+    }
+
+    CORRADE_COMPARE_AS(maxError, OctahedralTraits<T>::maxError(), Corrade::TestSuite::Compare::Less);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::PackingTest)
@@ -0,0 +1,191 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AnalyzeOverdraw.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Vertex positions are snapped to 1/16th of a pixel, edge functions are then
+   evaluated exactly in integers */
+constexpr Int SubpixelBits = 4;
+constexpr Long PixelCenter = 1 << (SubpixelBits - 1);
+
+/* Each view is a rotation, i.e. right×up = back, to not change the winding.
+   The viewer looks in the direction opposite to back. */
+struct View {
+    Vector3 right, up, back;
+};
+
+constexpr View Views[]{
+    {{ 1.0f, 0.0f,  0.0f}, {0.0f, 1.0f,  0.0f}, { 0.0f,  0.0f,  1.0f}},
+    {{-1.0f, 0.0f,  0.0f}, {0.0f, 1.0f,  0.0f}, { 0.0f,  0.0f, -1.0f}},
+    {{ 0.0f, 0.0f, -1.0f}, {0.0f, 1.0f,  0.0f}, { 1.0f,  0.0f,  0.0f}},
+    {{ 0.0f, 0.0f,  1.0f}, {0.0f, 1.0f,  0.0f}, {-1.0f,  0.0f,  0.0f}},
+    {{ 1.0f, 0.0f,  0.0f}, {0.0f, 0.0f, -1.0f}, { 0.0f,  1.0f,  0.0f}},
+    {{ 1.0f, 0.0f,  0.0f}, {0.0f, 0.0f,  1.0f}, { 0.0f, -1.0f,  0.0f}}
+};
+
+struct Point {
+    Long x, y;
+    Float depth;
+};
+
+/* Twice the signed area of the (a, b, p) triangle, positive if p is on the
+   left of the a→b edge */
+inline Long edge(const Point& a, const Point& b, const Long px, const Long py) {
+    return (b.x - a.x)*(py - a.y) - (b.y - a.y)*(px - a.x);
+}
+
+/* A pixel center exactly on an edge belongs to just one of the two triangles
+   sharing it. These traverse the edge in opposite directions, so it's enough
+   to pick one direction. Returns the minimal edge function value for the
+   pixel to be inside. */
+inline Long edgeMin(const Point& a, const Point& b) {
+    const Long dx = b.x - a.x;
+    const Long dy = b.y - a.y;
+    return dy > 0 || (dy == 0 && dx < 0) ? 0 : 1;
+}
+
+template<class T> OverdrawStatistics analyzeOverdrawImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt resolution) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::analyzeOverdraw(): index count not divisible by 3", {});
+    CORRADE_ASSERT(resolution >= 1 && resolution <= 4096,
+        "MeshTools::analyzeOverdraw(): expected resolution to be between 1 and 4096 but got" << resolution, {});
+    for(const T index: indices)
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::analyzeOverdraw(): index" << index << "out of bounds for" << positions.size() << "vertices", {});
+
+    OverdrawStatistics out{};
+    if(indices.empty()) return out;
+
+    Containers::Array<Vector3> viewPositions{Containers::NoInit, positions.size()};
+    Containers::Array<Float> depth{Containers::NoInit, std::size_t{resolution}*resolution};
+    for(const View& view: Views) {
+        for(std::size_t i = 0; i != positions.size(); ++i) {
+            const Vector3& position = positions[i];
+            viewPositions[i] = {Math::dot(position, view.right),
+                                Math::dot(position, view.up),
+                                -Math::dot(position, view.back)};
+        }
+
+        /* Fit the projection to bounds of all referenced vertices, keeping
+           the aspect ratio. If the mesh is flat in this view, nothing gets
+           rasterized. */
+        Vector2 min{Constants::inf()}, max{-Constants::inf()};
+        for(const T index: indices) {
+            min = Math::min(min, viewPositions[index].xy());
+            max = Math::max(max, viewPositions[index].xy());
+        }
+        const Float extent = (max - min).max();
+        if(!(extent > 0.0f)) continue;
+        const Float scale = Float(resolution << SubpixelBits)/extent;
+
+        for(Float& i: depth) i = Constants::inf();
+
+        for(std::size_t i = 0; i != indices.size(); i += 3) {
+            Point p[3];
+            for(std::size_t j = 0; j != 3; ++j) {
+                const Vector3& position = viewPositions[indices[i + j]];
+                const Vector2 scaled = (position.xy() - min)*scale;
+                p[j] = {Long(scaled.x() + 0.5f), Long(scaled.y() + 0.5f), position.z()};
+            }
+
+            /* Cull back-facing and degenerate triangles */
+            const Long area = edge(p[0], p[1], p[2].x, p[2].y);
+            if(area <= 0) continue;
+
+            /* Conservative pixel bounds of the triangle, clamped to the
+               viewport */
+            const Int minX = Int(Math::min(p[0].x, Math::min(p[1].x, p[2].x)) >> SubpixelBits);
+            const Int minY = Int(Math::min(p[0].y, Math::min(p[1].y, p[2].y)) >> SubpixelBits);
+            const Int maxX = Math::min(Int(Math::max(p[0].x, Math::max(p[1].x, p[2].x)) >> SubpixelBits), Int(resolution) - 1);
+            const Int maxY = Math::min(Int(Math::max(p[0].y, Math::max(p[1].y, p[2].y)) >> SubpixelBits), Int(resolution) - 1);
+
+            const Long min0 = edgeMin(p[1], p[2]);
+            const Long min1 = edgeMin(p[2], p[0]);
+            const Long min2 = edgeMin(p[0], p[1]);
+            for(Int y = minY; y <= maxY; ++y) {
+                const Long py = (Long(y) << SubpixelBits) + PixelCenter;
+                for(Int x = minX; x <= maxX; ++x) {
+                    const Long px = (Long(x) << SubpixelBits) + PixelCenter;
+                    const Long w0 = edge(p[1], p[2], px, py);
+                    const Long w1 = edge(p[2], p[0], px, py);
+                    const Long w2 = edge(p[0], p[1], px, py);
+                    if(w0 < min0 || w1 < min1 || w2 < min2) continue;
+
+                    const Float z = (Float(w0)*p[0].depth + Float(w1)*p[1].depth + Float(w2)*p[2].depth)/Float(area);
+                    Float& d = depth[std::size_t(y)*resolution + x];
+                    if(z < d) {
+                        d = z;
+                        ++out.shadedPixelCount;
+                    }
+                }
+            }
+        }
+
+        for(const Float i: depth) if(i != Constants::inf())
+            ++out.coveredPixelCount;
+    }
+
+    if(out.coveredPixelCount)
+        out.overdraw = Float(out.shadedPixelCount)/Float(out.coveredPixelCount);
+    return out;
+}
+
+}
+
+OverdrawStatistics analyzeOverdraw(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt resolution) {
+    return analyzeOverdrawImplementation(indices, positions, resolution);
+}
+
+OverdrawStatistics analyzeOverdraw(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt resolution) {
+    return analyzeOverdrawImplementation(indices, positions, resolution);
+}
+
+OverdrawStatistics analyzeOverdraw(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt resolution) {
+    return analyzeOverdrawImplementation(indices, positions, resolution);
+}
+
+OverdrawStatistics analyzeOverdraw(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt resolution) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::analyzeOverdraw(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return analyzeOverdrawImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, resolution);
+    else if(indices.size()[1] == 2)
+        return analyzeOverdrawImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, resolution);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::analyzeOverdraw(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return analyzeOverdrawImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, resolution);
+    }
+}
+
+}}
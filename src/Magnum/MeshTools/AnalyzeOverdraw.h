@@ -0,0 +1,115 @@
+#ifndef Magnum_MeshTools_AnalyzeOverdraw_h
+#define Magnum_MeshTools_AnalyzeOverdraw_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::OverdrawStatistics, function @ref Magnum::MeshTools::analyzeOverdraw()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Overdraw statistics
+@m_since_latest
+
+@see @ref analyzeOverdraw()
+*/
+struct OverdrawStatistics {
+    /**
+     * @brief Count of pixels covered by the mesh
+     *
+     * Summed over all rendered views.
+     */
+    UnsignedInt coveredPixelCount;
+
+    /**
+     * @brief Count of shaded pixels
+     *
+     * Count of fragments that passed the depth test at the time they were
+     * rasterized, summed over all rendered views.
+     */
+    UnsignedInt shadedPixelCount;
+
+    /**
+     * @brief Overdraw ratio
+     *
+     * @ref shadedPixelCount divided by @ref coveredPixelCount. Is
+     * @cpp 1.0f @ce if each pixel got shaded exactly once, @cpp 0.0f @ce if
+     * no pixels were covered.
+     */
+    Float overdraw;
+};
+
+/**
+@brief Analyze overdraw
+@param indices      Triangle indices
+@param positions    Vertex positions
+@param resolution   Resolution of the rasterized views
+@m_since_latest
+
+Rasterizes the mesh on the CPU from six axis-aligned directions using an
+orthographic projection fitted to the mesh bounds, with back-face culling and
+a depth test, and counts how many times each pixel was shaded. Pixel coverage
+follows a consistent fill rule, so pixels on edges shared by two triangles are
+counted just once. Useful to measure the effect of
+@ref optimizeOverdrawInPlace() without a GPU. Expects that @p indices size is
+divisible by @cpp 3 @ce, all indices are less than @p positions size and
+@p resolution is between @cpp 1 @ce and @cpp 4096 @ce.
+*/
+MAGNUM_MESHTOOLS_EXPORT OverdrawStatistics analyzeOverdraw(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt resolution = 256);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT OverdrawStatistics analyzeOverdraw(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt resolution = 256);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT OverdrawStatistics analyzeOverdraw(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt resolution = 256);
+
+/**
+@brief Analyze overdraw on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref analyzeOverdraw(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT OverdrawStatistics analyzeOverdraw(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt resolution = 256);
+
+}}
+
+#endif
@@ -0,0 +1,89 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AnalyzeVertexCache.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+template<class T> VertexCacheStatistics analyzeVertexCacheImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::analyzeVertexCache(): index count not divisible by 3", {});
+
+    /* A vertex is in the FIFO cache if less than cacheSize other vertices
+       were put into it after it. Timestamps start past the cache size so
+       zero-initialized vertices are treated as not cached, and a zero
+       timestamp also means the vertex wasn't referenced yet. */
+    Containers::Array<UnsignedInt> timestamps{Containers::ValueInit, vertexCount};
+    UnsignedInt time = cacheSize + 1;
+    UnsignedInt transformedVertexCount = 0;
+    UnsignedInt referencedVertexCount = 0;
+    for(const T index: indices) {
+        CORRADE_ASSERT(index < vertexCount, "MeshTools::analyzeVertexCache(): index" << index << "out of bounds for" << vertexCount << "vertices", {});
+        if(time - timestamps[index] <= cacheSize) continue;
+
+        if(!timestamps[index]) ++referencedVertexCount;
+        timestamps[index] = time++;
+        ++transformedVertexCount;
+    }
+
+    VertexCacheStatistics out;
+    out.transformedVertexCount = transformedVertexCount;
+    out.acmr = indices.empty() ? 0.0f : Float(transformedVertexCount)/Float(indices.size()/3);
+    out.atvr = indices.empty() ? 0.0f : Float(transformedVertexCount)/Float(referencedVertexCount);
+    return out;
+}
+
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::analyzeVertexCache(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return analyzeVertexCacheImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), vertexCount, cacheSize);
+    else if(indices.size()[1] == 2)
+        return analyzeVertexCacheImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), vertexCount, cacheSize);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::analyzeVertexCache(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return analyzeVertexCacheImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), vertexCount, cacheSize);
+    }
+}
+
+}}
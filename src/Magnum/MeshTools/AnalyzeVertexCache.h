@@ -0,0 +1,116 @@
+#ifndef Magnum_MeshTools_AnalyzeVertexCache_h
+#define Magnum_MeshTools_AnalyzeVertexCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::VertexCacheStatistics, function @ref Magnum::MeshTools::analyzeVertexCache()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Post-transform vertex cache statistics
+@m_since_latest
+
+@see @ref analyzeVertexCache()
+*/
+struct VertexCacheStatistics {
+    /**
+     * @brief Count of vertex shader invocations
+     *
+     * Count of indices that weren't found in the modelled cache.
+     */
+    UnsignedInt transformedVertexCount;
+
+    /**
+     * @brief Average cache miss ratio
+     *
+     * @ref transformedVertexCount divided by triangle count. Is between
+     * @cpp 3.0f @ce for a mesh with no vertex reuse at all and
+     * @cpp 0.5f @ce for an ideally ordered infinitely large regular grid.
+     * @cpp 0.0f @ce if there are no triangles.
+     */
+    Float acmr;
+
+    /**
+     * @brief Average transform to vertex ratio
+     *
+     * @ref transformedVertexCount divided by count of unique vertices
+     * referenced by the index buffer. Is @cpp 1.0f @ce for an ideally
+     * ordered mesh, independently on its topology. @cpp 0.0f @ce if there
+     * are no triangles.
+     */
+    Float atvr;
+};
+
+/**
+@brief Analyze post-transform vertex cache efficiency
+@param indices      Triangle indices
+@param vertexCount  Vertex count
+@param cacheSize    Modelled post-transform vertex cache size
+@m_since_latest
+
+Simulates a FIFO post-transform vertex cache of @p cacheSize entries, which
+is the model most commonly used by GPU hardware, and counts vertices that
+would need to be transformed when drawing the mesh. Useful to measure the
+effect of @ref optimizeVertexCacheInPlace() and @ref tipsifyInPlace(). Expects
+that @p indices size is divisible by @cpp 3 @ce and all indices are less than
+@p vertexCount.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+@brief Analyze post-transform vertex cache efficiency on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>&, UnsignedInt, std::size_t)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+}}
+
+#endif
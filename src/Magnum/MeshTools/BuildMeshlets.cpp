@@ -0,0 +1,271 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BuildMeshlets.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+constexpr UnsignedInt NoLocalIndex = ~UnsignedInt{};
+
+/* Approximate bounding sphere of the meshlet vertices. Starts with a sphere
+   spanning the most distant pair of axis-extreme points and grows it to
+   include all remaining points. Algorithm used: *Jack Ritter --- An Efficient
+   Bounding Sphere, Graphics Gems, 1990*. */
+void meshletBoundingSphere(Meshlet& meshlet, const Containers::ArrayView<const UnsignedInt> vertices, const Containers::StridedArrayView1D<const Vector3>& positions) {
+    UnsignedInt minIndex[3]{}, maxIndex[3]{};
+    for(UnsignedInt i = 0; i != vertices.size(); ++i) {
+        const Vector3& p = positions[vertices[i]];
+        for(std::size_t j = 0; j != 3; ++j) {
+            if(p[j] < positions[vertices[minIndex[j]]][j]) minIndex[j] = i;
+            if(p[j] > positions[vertices[maxIndex[j]]][j]) maxIndex[j] = i;
+        }
+    }
+
+    std::size_t axis = 0;
+    Float axisDistance = -1.0f;
+    for(std::size_t j = 0; j != 3; ++j) {
+        const Float distance = (positions[vertices[maxIndex[j]]] - positions[vertices[minIndex[j]]]).dot();
+        if(distance > axisDistance) {
+            axisDistance = distance;
+            axis = j;
+        }
+    }
+
+    Vector3 center = (positions[vertices[minIndex[axis]]] + positions[vertices[maxIndex[axis]]])*0.5f;
+    Float radius = Math::sqrt(axisDistance)*0.5f;
+    for(const UnsignedInt vertex: vertices) {
+        const Vector3 delta = positions[vertex] - center;
+        const Float distance = delta.length();
+        if(distance <= radius) continue;
+
+        const Float grownRadius = (radius + distance)*0.5f;
+        center += delta*((grownRadius - radius)/distance);
+        radius = grownRadius;
+    }
+
+    meshlet.center = center;
+    meshlet.radius = radius;
+}
+
+/* Normal cone of the meshlet triangles. The axis is the normalized sum of the
+   triangle normals, the cone angle is given by the triangle normal farthest
+   from it and the apex is moved back along the axis so all triangle planes
+   are in front of it. */
+void meshletNormalCone(Meshlet& meshlet, const Containers::ArrayView<const UnsignedInt> vertices, const Containers::ArrayView<const UnsignedByte> triangles, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::ArrayView<Vector3> normals) {
+    Vector3 axis;
+    for(std::size_t i = 0; i != triangles.size()/3; ++i) {
+        const Vector3& a = positions[vertices[triangles[i*3 + 0]]];
+        const Vector3& b = positions[vertices[triangles[i*3 + 1]]];
+        const Vector3& c = positions[vertices[triangles[i*3 + 2]]];
+        const Vector3 normal = Math::cross(b - a, c - a);
+        const Float length = normal.length();
+        normals[i] = length > 0.0f ? normal/length : Vector3{};
+        axis += normals[i];
+    }
+
+    meshlet.coneApex = meshlet.center;
+    meshlet.coneAngle = Rad{0.0f};
+    const Float axisLength = axis.length();
+    if(axisLength == 0.0f) {
+        meshlet.coneAxis = Vector3::zAxis();
+        return;
+    }
+    axis /= axisLength;
+    meshlet.coneAxis = axis;
+
+    /* Degenerate triangles have a zero normal and don't affect anything */
+    Float minDot = 1.0f;
+    for(std::size_t i = 0; i != triangles.size()/3; ++i)
+        if(!normals[i].isZero()) minDot = Math::min(minDot, Math::dot(normals[i], axis));
+    if(minDot <= 0.0f) return;
+
+    Float offset = 0.0f;
+    for(std::size_t i = 0; i != triangles.size()/3; ++i) {
+        if(normals[i].isZero()) continue;
+        const Vector3& a = positions[vertices[triangles[i*3 + 0]]];
+        offset = Math::max(offset, -Math::dot(a - meshlet.center, normals[i])/Math::dot(axis, normals[i]));
+    }
+
+    meshlet.coneApex = meshlet.center - axis*offset;
+    meshlet.coneAngle = Rad{Constants::pi()} - 2.0f*Math::acos(Math::min(minDot, 1.0f));
+}
+
+template<class T> Meshlets buildMeshletsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::buildMeshlets(): index count not divisible by 3", {});
+    CORRADE_ASSERT(maxVertexCount >= 3 && maxVertexCount <= 256,
+        "MeshTools::buildMeshlets(): expected max vertex count to be between 3 and 256 but got" << maxVertexCount, {});
+    CORRADE_ASSERT(maxTriangleCount,
+        "MeshTools::buildMeshlets(): expected non-zero max triangle count", {});
+    for(const T index: indices)
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::buildMeshlets(): index" << index << "out of bounds for" << positions.size() << "vertices", {});
+
+    const std::size_t triangleCount = indices.size()/3;
+    Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::buildAdjacency(indices, positions.size(), liveTriangleCount, neighborOffset, neighbors);
+
+    Containers::Array<bool> emitted{Containers::ValueInit, triangleCount};
+    Containers::Array<UnsignedInt> localIndices{Containers::NoInit, positions.size()};
+    for(UnsignedInt& i: localIndices) i = NoLocalIndex;
+    Containers::Array<Vector3> normals{Containers::NoInit, Math::min(std::size_t(maxTriangleCount), triangleCount)};
+
+    Meshlets out;
+    Meshlet meshlet{};
+
+    /* Calculates bounds of the current meshlet, adds it to the output and
+       starts a new one */
+    auto flush = [&]() {
+        const Containers::ArrayView<const UnsignedInt> vertices = out.vertices.slice(meshlet.vertexOffset, meshlet.vertexOffset + meshlet.vertexCount);
+        const Containers::ArrayView<const UnsignedByte> triangles = out.triangles.slice(meshlet.triangleOffset*3, (meshlet.triangleOffset + meshlet.triangleCount)*3);
+        for(const UnsignedInt vertex: vertices) localIndices[vertex] = NoLocalIndex;
+        meshletBoundingSphere(meshlet, vertices, positions);
+        meshletNormalCone(meshlet, vertices, triangles, positions, normals);
+        arrayAppend(out.meshlets, meshlet);
+
+        meshlet = Meshlet{};
+        meshlet.vertexOffset = out.vertices.size();
+        meshlet.triangleOffset = out.triangles.size()/3;
+    };
+
+    /* How many vertices of given triangle aren't in the meshlet yet */
+    auto newVertexCount = [&](const std::size_t triangle) {
+        return UnsignedInt(localIndices[indices[triangle*3 + 0]] == NoLocalIndex) +
+               UnsignedInt(localIndices[indices[triangle*3 + 1]] == NoLocalIndex) +
+               UnsignedInt(localIndices[indices[triangle*3 + 2]] == NoLocalIndex);
+    };
+
+    std::size_t nextTriangle = 0;
+    for(;;) {
+        /* Find the neighbor triangle that adds the fewest new vertices, and
+           out of those the one that has the fewest remaining neighbors, as
+           that doesn't leave holes behind */
+        std::size_t best = triangleCount;
+        UnsignedInt bestNewVertexCount = ~UnsignedInt{};
+        UnsignedInt bestLiveCount = ~UnsignedInt{};
+        for(std::size_t i = 0; i != meshlet.vertexCount; ++i) {
+            const UnsignedInt vertex = out.vertices[meshlet.vertexOffset + i];
+            if(!liveTriangleCount[vertex]) continue;
+
+            for(UnsignedInt j = neighborOffset[vertex]; j != neighborOffset[vertex + 1]; ++j) {
+                const UnsignedInt triangle = neighbors[j];
+                if(emitted[triangle]) continue;
+
+                const UnsignedInt triangleNewVertexCount = newVertexCount(triangle);
+                if(meshlet.vertexCount + triangleNewVertexCount > maxVertexCount)
+                    continue;
+
+                const UnsignedInt liveCount =
+                    liveTriangleCount[indices[triangle*3 + 0]] +
+                    liveTriangleCount[indices[triangle*3 + 1]] +
+                    liveTriangleCount[indices[triangle*3 + 2]];
+                if(triangleNewVertexCount < bestNewVertexCount || (triangleNewVertexCount == bestNewVertexCount && liveCount < bestLiveCount)) {
+                    best = triangle;
+                    bestNewVertexCount = triangleNewVertexCount;
+                    bestLiveCount = liveCount;
+                }
+            }
+        }
+
+        /* No suitable neighbor, take the next triangle in index order. If it
+           doesn't fit, start a new meshlet. */
+        if(best == triangleCount) {
+            while(nextTriangle != triangleCount && emitted[nextTriangle])
+                ++nextTriangle;
+            if(nextTriangle == triangleCount) break;
+
+            best = nextTriangle;
+            if(meshlet.vertexCount + newVertexCount(best) > maxVertexCount)
+                flush();
+        }
+
+        /* Add the triangle to the meshlet */
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt vertex = indices[best*3 + i];
+            if(localIndices[vertex] == NoLocalIndex) {
+                localIndices[vertex] = meshlet.vertexCount++;
+                arrayAppend(out.vertices, vertex);
+            }
+            arrayAppend(out.triangles, UnsignedByte(localIndices[vertex]));
+            --liveTriangleCount[vertex];
+        }
+        emitted[best] = true;
+        if(++meshlet.triangleCount == maxTriangleCount) flush();
+    }
+
+    if(meshlet.triangleCount) flush();
+    return out;
+}
+
+}
+
+Meshlets buildMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return buildMeshletsImplementation(indices, positions, maxVertexCount, maxTriangleCount);
+}
+
+Meshlets buildMeshlets(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return buildMeshletsImplementation(indices, positions, maxVertexCount, maxTriangleCount);
+}
+
+Meshlets buildMeshlets(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return buildMeshletsImplementation(indices, positions, maxVertexCount, maxTriangleCount);
+}
+
+Meshlets buildMeshlets(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::buildMeshlets(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return buildMeshletsImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, maxVertexCount, maxTriangleCount);
+    else if(indices.size()[1] == 2)
+        return buildMeshletsImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, maxVertexCount, maxTriangleCount);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::buildMeshlets(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return buildMeshletsImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, maxVertexCount, maxTriangleCount);
+    }
+}
+
+Meshlets buildMeshlets(const Trade::MeshData& mesh, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::buildMeshlets(): expected a triangle mesh, got" << mesh.primitive(), {});
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::buildMeshlets(): the mesh is not indexed", {});
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::buildMeshlets(): the mesh has no positions", {});
+
+    const Containers::Array<UnsignedInt> indices = mesh.indicesAsArray();
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    return buildMeshletsImplementation(Containers::StridedArrayView1D<const UnsignedInt>{indices}, positions, maxVertexCount, maxTriangleCount);
+}
+
+}}
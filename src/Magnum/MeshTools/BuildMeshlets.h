@@ -0,0 +1,198 @@
+#ifndef Magnum_MeshTools_BuildMeshlets_h
+#define Magnum_MeshTools_BuildMeshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::Meshlet, @ref Magnum::MeshTools::Meshlets, function @ref Magnum::MeshTools::buildMeshlets()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet
+@m_since_latest
+
+A single cluster produced by @ref buildMeshlets(). The vertex and triangle
+ranges point into @ref Meshlets::vertices and @ref Meshlets::triangles. The
+bounding sphere can be used for frustum culling with
+@ref Math::Intersection::sphereFrustum(), the normal cone for culling
+clusters that face away from the camera with
+@ref Math::Intersection::pointCone() --- see @ref buildMeshlets() for an
+example.
+*/
+struct Meshlet {
+    /** @brief Offset of the first vertex in @ref Meshlets::vertices */
+    UnsignedInt vertexOffset;
+
+    /** @brief Vertex count */
+    UnsignedInt vertexCount;
+
+    /**
+     * @brief Offset of the first triangle in @ref Meshlets::triangles
+     *
+     * In triangles, i.e. the first local index is at three times this value.
+     */
+    UnsignedInt triangleOffset;
+
+    /** @brief Triangle count */
+    UnsignedInt triangleCount;
+
+    /** @brief Bounding sphere center */
+    Vector3 center;
+
+    /** @brief Bounding sphere radius */
+    Float radius;
+
+    /**
+     * @brief Normal cone apex
+     *
+     * All triangles of the meshlet are in front of their planes when viewed
+     * from inside the cone defined by this apex, the negated
+     * @ref coneAxis and @ref coneAngle.
+     */
+    Vector3 coneApex;
+
+    /** @brief Normal cone axis, normalized */
+    Vector3 coneAxis;
+
+    /**
+     * @brief Normal cone culling angle
+     *
+     * Apex angle of a cone with an origin at @ref coneApex and a normal
+     * being negative @ref coneAxis. If a point lies inside, all triangles of
+     * the meshlet are facing away from it. If the triangle normals of the
+     * meshlet spread @f$ 90 \degree @f$ or more from the axis, the meshlet
+     * can't be culled this way and the angle is zero.
+     */
+    Rad coneAngle;
+};
+
+/**
+@brief Meshlets
+@m_since_latest
+
+Output of @ref buildMeshlets().
+*/
+struct Meshlets {
+    /** @brief Meshlets */
+    Containers::Array<Meshlet> meshlets;
+
+    /**
+     * @brief Meshlet vertices
+     *
+     * Indices into the original vertex data, each meshlet uses a range of
+     * @ref Meshlet::vertexCount items starting at @ref Meshlet::vertexOffset.
+     */
+    Containers::Array<UnsignedInt> vertices;
+
+    /**
+     * @brief Meshlet triangles
+     *
+     * Local indices into each meshlet vertex range, three per triangle. Each
+     * meshlet uses a range of @ref Meshlet::triangleCount triangles starting
+     * at @ref Meshlet::triangleOffset.
+     */
+    Containers::Array<UnsignedByte> triangles;
+};
+
+/**
+@brief Split a triangle mesh into meshlets
+@param indices          Index array
+@param positions        Vertex positions
+@param maxVertexCount   Max vertex count in a meshlet
+@param maxTriangleCount Max triangle count in a meshlet
+@m_since_latest
+
+Each meshlet is started from the first triangle that isn't part of any
+meshlet yet and then grown by adding neighboring triangles that introduce the
+fewest new vertices, preferring triangles whose vertices have the fewest
+remaining neighbors. If there are no neighbors that would fit, the next
+triangle in index order is used, until either of the limits is reached.
+Unconnected parts thus get put into the same meshlet if they're next to each
+other in the index buffer. Running @ref optimizeVertexCacheInPlace() on the
+indices first is thus recommended, as it makes such triangles spatially close.
+
+The default limits of @cpp 64 @ce vertices and @cpp 124 @ce triangles fit the
+common recommendations for mesh shaders. Triangles use 8-bit local indices,
+so @p maxVertexCount is expected to be between @cpp 3 @ce and @cpp 256 @ce,
+@p maxTriangleCount is expected to be non-zero. Each meshlet gets a bounding
+sphere and a normal cone, usable for culling like this:
+
+@snippet MagnumMeshTools.cpp buildMeshlets
+
+Expects that @p indices size is divisible by @cpp 3 @ce and all indices are
+less than @p positions size.
+*/
+MAGNUM_MESHTOOLS_EXPORT Meshlets buildMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Meshlets buildMeshlets(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Meshlets buildMeshlets(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+@brief Split a triangle mesh into meshlets on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref buildMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Meshlets buildMeshlets(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+@brief Split a triangle mesh into meshlets
+@m_since_latest
+
+Expects that the mesh is indexed, is a @ref MeshPrimitive::Triangles and has
+a @ref Trade::MeshAttribute::Position. Calls
+@ref buildMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, UnsignedInt)
+with the mesh indices and the first position attribute. The
+@ref Meshlets::vertices then index the original mesh vertex data.
+*/
+MAGNUM_MESHTOOLS_EXPORT Meshlets buildMeshlets(const Trade::MeshData& mesh, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+}}
+
+#endif
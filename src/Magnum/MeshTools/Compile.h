@@ -106,7 +106,11 @@ possibly also an index buffer, if the mesh is indexed.
     @ref Shaders::Generic3D::Position if they are 3D.
 -   If the mesh contains normals or if @ref CompileFlag::GenerateFlatNormals /
     @ref CompileFlag::GenerateSmoothNormals is set, these are bound to
-    @ref Shaders::Generic3D::Normal.
+    @ref Shaders::Generic3D::Normal. Octahedral-encoded normals, tangents
+    and bitangents in @ref VertexFormat::Vector2bNormalized or
+    @ref VertexFormat::Vector2sNormalized are uploaded and bound as-is as a
+    two-component attribute, the shader is then expected to decode them ---
+    see @ref Trade::MeshAttribute::Normal for more information.
 -   If the mesh contains texture coordinates, these are bound to
     @ref Shaders::Generic::TextureCoordinates.
 -   If the mesh contains colors, these are bound to
@@ -30,6 +30,7 @@
 
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Implementation/parallel.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <vector>
@@ -98,57 +99,11 @@ namespace {
 using namespace Math::Literals;
 #endif
 
-template<class T> inline void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    CORRADE_ASSERT(indices.size() % 3 == 0,
-        "MeshTools::generateSmoothNormalsInto(): index count not divisible by 3", );
-    CORRADE_ASSERT(normals.size() == positions.size(),
-        "MeshTools::generateSmoothNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
-
-    if(indices.empty()) return;
-
-    /* Gather count of triangles for every vertex. This abuses the output
-       storage to avoid extra allocations, zero-initialize it first to avoid
-       random memory getting used. */
-    Containers::StridedArrayView1D<UnsignedInt> triangleCount =
-        Containers::arrayCast<UnsignedInt>(normals);
-    for(UnsignedInt& i: triangleCount) i = 0;
-    for(const T index: indices) {
-        CORRADE_ASSERT(index < positions.size(), "MeshTools::generateSmoothNormalsInto(): index" << index << "out of bounds for" << positions.size() << "elements", );
-        ++triangleCount[index];
-    }
-
-    /* Turn that into a running offset array:
-       triangleOffset[i + 1] - triangleOffset[i] is triangle count for vertex i
-       triangleOffset[i] is offset into an triangle ID array for vertex i */
-    Containers::Array<UnsignedInt> triangleOffset{Containers::NoInit, positions.size() + 1};
-    triangleOffset[0] = 0;
-    for(std::size_t i = 0; i != triangleCount.size(); ++i)
-        triangleOffset[i + 1] = triangleOffset[i] + triangleCount[i];
-
-    CORRADE_INTERNAL_ASSERT(triangleOffset.back() == indices.size());
-
-    /* Gather triangle IDs for every vertex. For vertex i,
-       triangleIds[triangleOffset[i]] until triangleIds[triangleOffset[i + 1]]
-       contains IDs of triangles that contain it. */
-    Containers::Array<T> triangleIds{Containers::NoInit, indices.size()};
-    for(std::size_t i = 0; i != indices.size(); ++i) {
-        const T triangleId = i/3;
-        const T vertexId = indices[i];
-
-        /* How many triangle IDs is still left to be written, which also means
-           the offset where we put the ID. Decrement that for the next run. */
-        const std::size_t triangleIdsLeftForVertex = triangleCount[vertexId]--;
-        triangleIds[triangleOffset[vertexId + 1] - triangleIdsLeftForVertex] = triangleId;
-    }
-
-    /* Now, triangleCount should be all zeros, we don't need it anymore and the
-       underlying `normals` array is ready to get filled with real output. */
-
-    /* Precalculate cross product and interior angles of each face --- the loop
-       below would otherwise calculate it for every vertex, which is at least
-       3x as much work */
-    Containers::Array<std::pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, indices.size()/3};
-    for(std::size_t i = 0; i != crossAngles.size(); ++i) {
+/* Precalculate cross product and interior angles of each face --- the
+   per-vertex loop would otherwise calculate it for every vertex, which is at
+   least 3x as much work */
+template<class T> void calculateCrossAngles(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::ArrayView<std::pair<Vector3, Math::Vector3<Rad>>> crossAngles, const std::size_t begin, const std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i) {
         const Vector3 v0 = positions[indices[i*3 + 0]];
         const Vector3 v1 = positions[indices[i*3 + 1]];
         const Vector3 v2 = positions[indices[i*3 + 2]];
@@ -179,80 +134,292 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
         crossAngles[i].second[2] = Rad(180.0_degf)
             - crossAngles[i].second[0] - crossAngles[i].second[1];
     }
+}
 
-    /* For every vertex v, calculate normals from all faces it belongs to and
-       average them */
-    for(std::size_t v = 0; v != positions.size(); ++v) {
+/* For every vertex v, calculate normals from all faces it belongs to and
+   average them */
+void accumulateNormals(const Containers::ArrayView<const UnsignedInt> cornerOffset, const Containers::ArrayView<const UnsignedInt> cornerIds, const Containers::ArrayView<const std::pair<Vector3, Math::Vector3<Rad>>> crossAngles, const Containers::StridedArrayView1D<Vector3>& normals, const std::size_t begin, const std::size_t end) {
+    for(std::size_t v = begin; v != end; ++v) {
         /* normals are an external memory, ensure we accumulate from zero */
-        normals[v] = Vector3{Math::ZeroInit};
+        Vector3 normal{Math::ZeroInit};
 
-        /* Go through all triangles sharing this vertex */
-        for(std::size_t t = triangleOffset[v]; t != triangleOffset[v + 1]; ++t) {
-            const std::size_t baseIndex = triangleIds[t]*3;
-            const T v0i = indices[baseIndex + 0];
-            const T v1i = indices[baseIndex + 1];
-            const T v2i = indices[baseIndex + 2];
+        /* Go through all triangle corners that reference this vertex. The
+           corner ID is an index into the index buffer, so it directly
+           gives both the triangle and which of its three angles to use,
+           without having to look into the index buffer again. */
+        for(std::size_t c = cornerOffset[v]; c != cornerOffset[v + 1]; ++c) {
+            const UnsignedInt cornerId = cornerIds[c];
 
             /* Cross product is a vector in direction of the normal with length
                equal to size of the parallelogram */
-            const std::pair<Vector3, Math::Vector3<Rad>>& crossAngle = crossAngles[triangleIds[t]];
-
-            /* Angle between two sides of the triangle that share vertex `v`.
-               The shared vertex can be one of the three. */
-            Rad angle;
-            if(v == v0i) angle = crossAngle.second[0];
-            else if(v == v1i) angle = crossAngle.second[1];
-            else if(v == v2i) angle = crossAngle.second[2];
-            else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+            const std::pair<Vector3, Math::Vector3<Rad>>& crossAngle = crossAngles[cornerId/3];
 
             /* The normal is cross.normalized(), we need to multiply it it by
                surface area which is cross.length()/2. Since normalization is
                division by length, multiplying it by length again will be a
                no-op. Then, since all normals are divided by 2, it doesn't
                change their ratio for the final normalization so we can omit
-               that as well. Finally we need to weight by the angle, and in
-               that case only the ratio is important as well, so it doesn't
-               matter if degrees or radians. */
-            normals[v] += crossAngle.first*Float(angle);
+               that as well. Finally we need to weight by the angle at the
+               corner, and in that case only the ratio is important as well, so
+               it doesn't matter if degrees or radians. */
+            normal += crossAngle.first*Float(crossAngle.second[cornerId % 3]);
         }
 
         /* Normalize the accumulated direction */
-        normals[v] = normals[v].normalized();
+        normals[v] = normal.normalized();
     }
 }
 
+/* Vertices are split into as many contiguous buckets as there are tasks for
+   the parallel adjacency calculation. This is consistent with
+   vertexBucketBegin(), i.e. vertexBucket(v) == b for all vertices in the
+   [vertexBucketBegin(b), vertexBucketBegin(b + 1)) range. */
+inline UnsignedInt vertexBucket(const std::size_t vertexCount, const UnsignedInt bucketCount, const std::size_t vertex) {
+    return UnsignedInt(UnsignedLong(vertex)*bucketCount/vertexCount);
+}
+
+inline std::size_t vertexBucketBegin(const std::size_t vertexCount, const UnsignedInt bucketCount, const UnsignedInt bucket) {
+    return std::size_t((UnsignedLong(vertexCount)*bucket + bucketCount - 1)/bucketCount);
+}
+
+template<class T> struct GenerateSmoothNormalsParallelState {
+    Containers::StridedArrayView1D<const T> indices;
+    Containers::StridedArrayView1D<const Vector3> positions;
+    Containers::StridedArrayView1D<Vector3> normals;
+    UnsignedInt taskCount;
+    /* taskCount*taskCount counts of corners for every (task, bucket) pair,
+       turned into output offsets later */
+    Containers::ArrayView<UnsignedInt> bucketCounts;
+    /* taskCount + 1 offsets of each vertex bucket in bucketedCorners */
+    Containers::ArrayView<UnsignedInt> bucketOffsets;
+    /* For each task position of the first out-of-bounds index, if any */
+    Containers::ArrayView<std::size_t> outOfBounds;
+    Containers::ArrayView<UnsignedInt> bucketedCorners;
+    Containers::StridedArrayView1D<UnsignedInt> triangleCount;
+    Containers::ArrayView<UnsignedInt> cornerOffset;
+    Containers::ArrayView<UnsignedInt> cornerIds;
+    Containers::ArrayView<std::pair<Vector3, Math::Vector3<Rad>>> crossAngles;
+    UnsignedInt triangleTaskCount;
+    UnsignedInt vertexTaskCount;
+};
+
+/* A parallel variant of the count / prefix sum / scatter adjacency
+   calculation done in generateSmoothNormalsIntoImplementation(). The indices
+   are first bucketed by vertex range, preserving their relative order, and
+   then each vertex range is processed separately. Each vertex thus gets its
+   corners in the same order as with the serial variant, making the output
+   bit-exact. Returns false if an out-of-bounds index was encountered. */
+template<class T> bool buildCornerAdjacencyParallel(GenerateSmoothNormalsParallelState<T>& state, const TaskExecutor executor, void* const executorUserData) {
+    typedef GenerateSmoothNormalsParallelState<T> State;
+
+    /* Count corners going to each vertex bucket from each index range,
+       checking for index bounds at the same time */
+    executor(state.taskCount, [](const UnsignedInt id, void* const statePointer) {
+        State& state = *static_cast<State*>(statePointer);
+        const std::size_t vertexCount = state.positions.size();
+        const Containers::ArrayView<UnsignedInt> counts = state.bucketCounts.slice(id*state.taskCount, (id + 1)*state.taskCount);
+        for(UnsignedInt& i: counts) i = 0;
+        state.outOfBounds[id] = ~std::size_t{};
+        for(std::size_t i = Implementation::taskRangeBegin(state.indices.size(), state.taskCount, id), end = Implementation::taskRangeBegin(state.indices.size(), state.taskCount, id + 1); i != end; ++i) {
+            const T index = state.indices[i];
+            if(index >= vertexCount) {
+                state.outOfBounds[id] = i;
+                return;
+            }
+            ++counts[vertexBucket(vertexCount, state.taskCount, index)];
+        }
+    }, &state, executorUserData);
+
+    /* The index ranges are ordered, so the first task that found an
+       out-of-bounds index has the earliest one */
+    for(const std::size_t i: state.outOfBounds)
+        CORRADE_ASSERT(i == ~std::size_t{}, "MeshTools::generateSmoothNormalsInto(): index" << state.indices[i] << "out of bounds for" << state.positions.size() << "elements", false);
+
+    /* Turn the counts into offsets, ordered by bucket first and index range
+       second */
+    UnsignedInt offset = 0;
+    for(UnsignedInt bucket = 0; bucket != state.taskCount; ++bucket) {
+        state.bucketOffsets[bucket] = offset;
+        for(UnsignedInt task = 0; task != state.taskCount; ++task) {
+            const UnsignedInt count = state.bucketCounts[task*state.taskCount + bucket];
+            state.bucketCounts[task*state.taskCount + bucket] = offset;
+            offset += count;
+        }
+    }
+    state.bucketOffsets[state.taskCount] = offset;
+    CORRADE_INTERNAL_ASSERT(offset == state.indices.size());
+
+    /* Scatter the corners into the buckets */
+    executor(state.taskCount, [](const UnsignedInt id, void* const statePointer) {
+        State& state = *static_cast<State*>(statePointer);
+        const std::size_t vertexCount = state.positions.size();
+        const Containers::ArrayView<UnsignedInt> offsets = state.bucketCounts.slice(id*state.taskCount, (id + 1)*state.taskCount);
+        for(std::size_t i = Implementation::taskRangeBegin(state.indices.size(), state.taskCount, id), end = Implementation::taskRangeBegin(state.indices.size(), state.taskCount, id + 1); i != end; ++i)
+            state.bucketedCorners[offsets[vertexBucket(vertexCount, state.taskCount, state.indices[i])]++] = i;
+    }, &state, executorUserData);
+
+    /* Each bucket then does the same as the serial variant, but only on its
+       own range of vertices. The first offset is written by the caller, each
+       bucket writes only the offset after each of its vertices, so nothing
+       is written by two tasks. */
+    executor(state.taskCount, [](const UnsignedInt id, void* const statePointer) {
+        State& state = *static_cast<State*>(statePointer);
+        const std::size_t vertexCount = state.positions.size();
+        const std::size_t vertexBegin = vertexBucketBegin(vertexCount, state.taskCount, id);
+        const std::size_t vertexEnd = vertexBucketBegin(vertexCount, state.taskCount, id + 1);
+        const Containers::ArrayView<const UnsignedInt> corners = state.bucketedCorners.slice(state.bucketOffsets[id], state.bucketOffsets[id + 1]);
+
+        for(std::size_t v = vertexBegin; v != vertexEnd; ++v)
+            state.triangleCount[v] = 0;
+        for(const UnsignedInt corner: corners)
+            ++state.triangleCount[state.indices[corner]];
+
+        UnsignedInt offset = state.bucketOffsets[id];
+        for(std::size_t v = vertexBegin; v != vertexEnd; ++v) {
+            offset += state.triangleCount[v];
+            state.cornerOffset[v + 1] = offset;
+        }
+
+        for(const UnsignedInt corner: corners) {
+            const T vertexId = state.indices[corner];
+            const std::size_t cornerIdsLeftForVertex = state.triangleCount[vertexId]--;
+            state.cornerIds[state.cornerOffset[vertexId + 1] - cornerIdsLeftForVertex] = corner;
+        }
+    }, &state, executorUserData);
+
+    return true;
+}
+
+template<class T> void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const TaskExecutor executor, void* const executorUserData) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::generateSmoothNormalsInto(): index count not divisible by 3", );
+    CORRADE_ASSERT(normals.size() == positions.size(),
+        "MeshTools::generateSmoothNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
+
+    if(indices.empty()) return;
+
+    /* The count of triangles for every vertex abuses the output storage to
+       avoid extra allocations */
+    const Containers::StridedArrayView1D<UnsignedInt> triangleCount =
+        Containers::arrayCast<UnsignedInt>(normals);
+
+    /* For vertex i, cornerIds[cornerOffset[i]] until
+       cornerIds[cornerOffset[i + 1]] contains positions in the index array
+       that reference it. Storing the corners instead of triangle IDs means
+       the per-vertex loop doesn't need to look into the index array to figure
+       out which angle to use. */
+    Containers::Array<UnsignedInt> cornerOffset{Containers::NoInit, positions.size() + 1};
+    Containers::Array<UnsignedInt> cornerIds{Containers::NoInit, indices.size()};
+    Containers::Array<std::pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, indices.size()/3};
+    cornerOffset[0] = 0;
+
+    const UnsignedInt taskCount = executor ? Implementation::parallelTaskCount(indices.size()) : 1;
+    if(taskCount == 1) {
+        /* Gather count of triangles for every vertex, zero-initialize the
+           storage first to avoid random memory getting used */
+        for(UnsignedInt& i: triangleCount) i = 0;
+        for(const T index: indices) {
+            CORRADE_ASSERT(index < positions.size(), "MeshTools::generateSmoothNormalsInto(): index" << index << "out of bounds for" << positions.size() << "elements", );
+            ++triangleCount[index];
+        }
+
+        /* Turn that into a running offset array:
+           cornerOffset[i + 1] - cornerOffset[i] is corner count for vertex i
+           cornerOffset[i] is offset into the corner ID array for vertex i */
+        for(std::size_t i = 0; i != triangleCount.size(); ++i)
+            cornerOffset[i + 1] = cornerOffset[i] + triangleCount[i];
+
+        CORRADE_INTERNAL_ASSERT(cornerOffset.back() == indices.size());
+
+        /* Gather corner IDs for every vertex */
+        for(std::size_t i = 0; i != indices.size(); ++i) {
+            const T vertexId = indices[i];
+
+            /* How many corner IDs is still left to be written, which also
+               means the offset where we put the ID. Decrement that for the
+               next run. */
+            const std::size_t cornerIdsLeftForVertex = triangleCount[vertexId]--;
+            cornerIds[cornerOffset[vertexId + 1] - cornerIdsLeftForVertex] = i;
+        }
+
+        /* Now, triangleCount should be all zeros, we don't need it anymore
+           and the underlying `normals` array is ready to get filled with real
+           output. */
+
+        calculateCrossAngles(indices, positions, crossAngles, 0, crossAngles.size());
+        accumulateNormals(cornerOffset, cornerIds, crossAngles, normals, 0, positions.size());
+        return;
+    }
+
+    Containers::Array<UnsignedInt> bucketCounts{NoInit, std::size_t{taskCount}*taskCount};
+    Containers::Array<UnsignedInt> bucketOffsets{NoInit, std::size_t{taskCount} + 1};
+    Containers::Array<std::size_t> outOfBounds{NoInit, taskCount};
+    Containers::Array<UnsignedInt> bucketedCorners{NoInit, indices.size()};
+    GenerateSmoothNormalsParallelState<T> state{indices, positions, normals, taskCount, bucketCounts, bucketOffsets, outOfBounds, bucketedCorners, triangleCount, cornerOffset, cornerIds, crossAngles, Implementation::parallelTaskCount(crossAngles.size()), Implementation::parallelTaskCount(positions.size())};
+    if(!buildCornerAdjacencyParallel(state, executor, executorUserData))
+        return;
+
+    typedef GenerateSmoothNormalsParallelState<T> State;
+    executor(state.triangleTaskCount, [](const UnsignedInt id, void* const statePointer) {
+        State& state = *static_cast<State*>(statePointer);
+        calculateCrossAngles(state.indices, state.positions, state.crossAngles,
+            Implementation::taskRangeBegin(state.crossAngles.size(), state.triangleTaskCount, id),
+            Implementation::taskRangeBegin(state.crossAngles.size(), state.triangleTaskCount, id + 1));
+    }, &state, executorUserData);
+    executor(state.vertexTaskCount, [](const UnsignedInt id, void* const statePointer) {
+        State& state = *static_cast<State*>(statePointer);
+        accumulateNormals(state.cornerOffset, state.cornerIds, state.crossAngles, state.normals,
+            Implementation::taskRangeBegin(state.positions.size(), state.vertexTaskCount, id),
+            Implementation::taskRangeBegin(state.positions.size(), state.vertexTaskCount, id + 1));
+    }, &state, executorUserData);
+}
+
 }
 
 /* If not done this way but with templates instead, C++ wouldn't be able to
    figure out on its own which overload to use when indices are not already a
    strided arrray view */
 void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, nullptr, nullptr);
 }
 void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, nullptr, nullptr);
 }
 void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, nullptr, nullptr);
+}
+
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const TaskExecutor executor, void* const executorUserData) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, executor, executorUserData);
+}
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const TaskExecutor executor, void* const executorUserData) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, executor, executorUserData);
+}
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const TaskExecutor executor, void* const executorUserData) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, executor, executorUserData);
 }
 
 void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
+    generateSmoothNormalsInto(indices, positions, normals, nullptr, nullptr);
+}
+
+void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const TaskExecutor executor, void* const executorUserData) {
     CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateSmoothNormalsInto(): second index view dimension is not contiguous", );
     if(indices.size()[1] == 4)
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals, executor, executorUserData);
     else if(indices.size()[1] == 2)
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals, executor, executorUserData);
     else {
         CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::generateSmoothNormalsInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals, executor, executorUserData);
     }
 }
 
 namespace {
 
-template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
+template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const TaskExecutor executor, void* const executorUserData) {
     Containers::Array<Vector3> out{Containers::NoInit, positions.size()};
-    generateSmoothNormalsInto(indices, positions, out);
+    generateSmoothNormalsInto(indices, positions, out, executor, executorUserData);
     return out;
 }
 
@@ -262,18 +429,32 @@ template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImpleme
    figure out on its own which overload to use when indices are not already a
    strided arrray view */
 Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
-    return generateSmoothNormalsImplementation(indices, positions);
+    return generateSmoothNormalsImplementation(indices, positions, nullptr, nullptr);
 }
 Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
-    return generateSmoothNormalsImplementation(indices, positions);
+    return generateSmoothNormalsImplementation(indices, positions, nullptr, nullptr);
 }
 Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
-    return generateSmoothNormalsImplementation(indices, positions);
+    return generateSmoothNormalsImplementation(indices, positions, nullptr, nullptr);
+}
+
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const TaskExecutor executor, void* const executorUserData) {
+    return generateSmoothNormalsImplementation(indices, positions, executor, executorUserData);
+}
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const TaskExecutor executor, void* const executorUserData) {
+    return generateSmoothNormalsImplementation(indices, positions, executor, executorUserData);
+}
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const TaskExecutor executor, void* const executorUserData) {
+    return generateSmoothNormalsImplementation(indices, positions, executor, executorUserData);
 }
 
 Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
+    return generateSmoothNormals(indices, positions, nullptr, nullptr);
+}
+
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const TaskExecutor executor, void* const executorUserData) {
     Containers::Array<Vector3> out{Containers::NoInit, positions.size()};
-    generateSmoothNormalsInto(indices, positions, out);
+    generateSmoothNormalsInto(indices, positions, out, executor, executorUserData);
     return out;
 }
 
@@ -30,6 +30,7 @@
  */
 
 #include "Magnum/Magnum.h"
+#include "Magnum/TaskExecutor.h"
 #include "Magnum/MeshTools/visibility.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -133,6 +134,30 @@ MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const C
  */
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions);
 
+/**
+@brief Generate smooth normals using a parallel task executor
+@m_since_latest
+
+Same as @ref generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&),
+but with the work distributed across tasks dispatched via @p executor, which
+gets passed @p executorUserData. See
+@ref generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&, TaskExecutor, void*)
+for details.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, TaskExecutor executor, void* executorUserData = nullptr);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, TaskExecutor executor, void* executorUserData = nullptr);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, TaskExecutor executor, void* executorUserData = nullptr);
+
 /**
 @brief Generate smooth normals using a type-erased index array
 @m_since{2020,06}
@@ -144,6 +169,15 @@ etc. overloads.
 */
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions);
 
+/**
+@brief Generate smooth normals using a type-erased index array and a parallel task executor
+@m_since_latest
+
+Same as @ref generateSmoothNormals(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<const Vector3>&),
+but with the work distributed across tasks dispatched via @p executor.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, TaskExecutor executor, void* executorUserData = nullptr);
+
 /**
 @brief Generate smooth normals into an existing array
 @param[in] indices      Triangle face indices
@@ -179,6 +213,34 @@ MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::Strided
  */
 MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals);
 
+/**
+@brief Generate smooth normals into an existing array using a parallel task executor
+@m_since_latest
+
+Same as @ref generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&),
+but with the work distributed across tasks dispatched via @p executor, which
+gets passed @p executorUserData. The indices are first split into buckets by
+vertex range, each bucket then calculates adjacency for its own vertices and
+finally the per-face and per-vertex passes are split into contiguous ranges.
+The output is bit-exact with the serial variant. Small meshes are processed
+serially without calling the executor at all, the same happens if
+@p executor is @cpp nullptr @ce. Compared to the serial variant, this
+function allocates one more internal array of the same size as @p indices.
+*/
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, TaskExecutor executor, void* executorUserData = nullptr);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, TaskExecutor executor, void* executorUserData = nullptr);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, TaskExecutor executor, void* executorUserData = nullptr);
+
 /**
 @brief Generate smooth normals into an existing array using a type-erased index array
 @m_since{2020,06}
@@ -191,6 +253,15 @@ etc. overloads.
 */
 MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals);
 
+/**
+@brief Generate smooth normals into an existing array using a type-erased index array and a parallel task executor
+@m_since_latest
+
+Same as @ref generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<const Vector3>&, const Containers::StridedArrayView1D<Vector3>&),
+but with the work distributed across tasks dispatched via @p executor.
+*/
+MAGNUM_MESHTOOLS_EXPORT void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, TaskExecutor executor, void* executorUserData = nullptr);
+
 }}
 
 #endif
@@ -0,0 +1,49 @@
+#ifndef Magnum_MeshTools_Implementation_parallel_h
+#define Magnum_MeshTools_Implementation_parallel_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace MeshTools { namespace Implementation { namespace {
+
+/* Splitting the work into at most 256 tasks, each having at least 4096 items
+   so the overhead of task dispatch and per-task allocations doesn't dominate.
+   Being a power of two isn't strictly needed for anything. */
+UnsignedInt parallelTaskCount(const std::size_t size) {
+    UnsignedInt count = 1;
+    while(count < 256 && count*std::size_t{4096} < size) count *= 2;
+    return count;
+}
+
+/* Beginning of a contiguous range of items processed by given task, end of
+   the range is the beginning of the next one */
+inline std::size_t taskRangeBegin(const std::size_t size, const UnsignedInt count, const UnsignedInt id) {
+    return std::size_t(UnsignedLong(size)*id/count);
+}
+
+}}}}
+
+#endif
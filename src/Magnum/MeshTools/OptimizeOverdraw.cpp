@@ -0,0 +1,196 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeOverdraw.h"
+
+#include <algorithm>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Modelled FIFO cache, same as in analyzeVertexCache() */
+struct FifoCache {
+    explicit FifoCache(const std::size_t vertexCount, const std::size_t cacheSize): timestamps{Containers::ValueInit, vertexCount}, time{UnsignedInt(cacheSize) + 1}, cacheSize{UnsignedInt(cacheSize)} {}
+
+    /* Makes all vertices stale */
+    void flush() { time += cacheSize + 1; }
+
+    /* Returns count of vertices that weren't in the cache */
+    UnsignedInt add(const UnsignedInt a, const UnsignedInt b, const UnsignedInt c) {
+        return add(a) + add(b) + add(c);
+    }
+
+    UnsignedInt add(const UnsignedInt vertex) {
+        if(time - timestamps[vertex] <= cacheSize) return 0;
+        timestamps[vertex] = time++;
+        return 1;
+    }
+
+    Containers::Array<UnsignedInt> timestamps;
+    UnsignedInt time;
+    UnsignedInt cacheSize;
+};
+
+template<class T> void optimizeOverdrawInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeOverdrawInPlace(): index count not divisible by 3", );
+    CORRADE_ASSERT(cacheSize,
+        "MeshTools::optimizeOverdrawInPlace(): expected non-zero cache size", );
+    CORRADE_ASSERT(threshold >= 1.0f,
+        "MeshTools::optimizeOverdrawInPlace(): expected threshold to be at least 1 but got" << threshold, );
+    for(const T index: indices)
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::optimizeOverdrawInPlace(): index" << index << "out of bounds for" << positions.size() << "vertices", );
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* Hard cluster boundaries are where all three vertices of a triangle
+       are a cache miss, i.e. where the previous triangles have no effect on
+       the cache. The first triangle always starts a cluster. */
+    FifoCache cache{positions.size(), cacheSize};
+    Containers::Array<UnsignedInt> hardBoundaries;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        if(cache.add(indices[i*3 + 0], indices[i*3 + 1], indices[i*3 + 2]) == 3 || i == 0)
+            arrayAppend(hardBoundaries, UnsignedInt(i));
+    }
+    arrayAppend(hardBoundaries, UnsignedInt(triangleCount));
+
+    /* Split each hard cluster further at places where the cache miss ratio
+       so far is not larger than threshold times the ratio of the whole
+       cluster */
+    Containers::Array<UnsignedInt> clusters;
+    for(std::size_t i = 0; i + 1 != hardBoundaries.size(); ++i) {
+        const UnsignedInt begin = hardBoundaries[i];
+        const UnsignedInt end = hardBoundaries[i + 1];
+
+        cache.flush();
+        UnsignedInt clusterMisses = 0;
+        for(UnsignedInt t = begin; t != end; ++t)
+            clusterMisses += cache.add(indices[t*3 + 0], indices[t*3 + 1], indices[t*3 + 2]);
+        const Float clusterThreshold = threshold*Float(clusterMisses)/Float(end - begin);
+
+        arrayAppend(clusters, begin);
+        cache.flush();
+        UnsignedInt misses = 0;
+        UnsignedInt count = 0;
+        for(UnsignedInt t = begin; t + 1 < end; ++t) {
+            misses += cache.add(indices[t*3 + 0], indices[t*3 + 1], indices[t*3 + 2]);
+            ++count;
+            if(Float(misses)/Float(count) <= clusterThreshold) {
+                arrayAppend(clusters, t + 1);
+                cache.flush();
+                misses = 0;
+                count = 0;
+            }
+        }
+    }
+    arrayAppend(clusters, UnsignedInt(triangleCount));
+    const std::size_t clusterCount = clusters.size() - 1;
+
+    /* Area-weighted centroid and normal of each cluster, together with the
+       centroid of the whole mesh. Cross product length is twice the triangle
+       area, which doesn't matter for the weighting. */
+    Containers::Array<Vector3> clusterCentroids{Containers::ValueInit, clusterCount};
+    Containers::Array<Vector3> clusterNormals{Containers::ValueInit, clusterCount};
+    Containers::Array<Float> clusterAreas{Containers::ValueInit, clusterCount};
+    Vector3 meshCentroid;
+    Float meshArea = 0.0f;
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        for(UnsignedInt t = clusters[i]; t != clusters[i + 1]; ++t) {
+            const Vector3& a = positions[indices[t*3 + 0]];
+            const Vector3& b = positions[indices[t*3 + 1]];
+            const Vector3& c = positions[indices[t*3 + 2]];
+            const Vector3 normal = Math::cross(b - a, c - a);
+            const Float area = normal.length();
+            clusterCentroids[i] += (a + b + c)*(area/3.0f);
+            clusterNormals[i] += normal;
+            clusterAreas[i] += area;
+        }
+
+        meshCentroid += clusterCentroids[i];
+        meshArea += clusterAreas[i];
+    }
+    if(meshArea > 0.0f) meshCentroid /= meshArea;
+
+    /* Clusters facing away from the mesh centroid the most are the most likely
+       to occlude other parts of the mesh */
+    Containers::Array<Float> clusterScores{Containers::NoInit, clusterCount};
+    Containers::Array<UnsignedInt> clusterOrder{Containers::NoInit, clusterCount};
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        clusterOrder[i] = i;
+        const Float normalLength = clusterNormals[i].length();
+        clusterScores[i] = clusterAreas[i] > 0.0f && normalLength > 0.0f ?
+            Math::dot(clusterCentroids[i]/clusterAreas[i] - meshCentroid, clusterNormals[i]/normalLength) : 0.0f;
+    }
+    std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&clusterScores](const UnsignedInt a, const UnsignedInt b) {
+        return clusterScores[a] > clusterScores[b];
+    });
+
+    /* Emit the clusters in the sorted order */
+    Containers::Array<T> outputIndices{Containers::NoInit, indices.size()};
+    std::size_t out = 0;
+    for(const UnsignedInt cluster: clusterOrder)
+        for(std::size_t i = clusters[cluster]*3; i != clusters[cluster + 1]*3; ++i)
+            outputIndices[out++] = indices[i];
+    CORRADE_INTERNAL_ASSERT(out == indices.size());
+
+    /* Copy the optimized index buffer back */
+    Utility::copy(outputIndices, indices);
+}
+
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeOverdrawInPlace(): second index view dimension is not contiguous", );
+    if(indices.size()[1] == 4)
+        return optimizeOverdrawInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), positions, cacheSize, threshold);
+    else if(indices.size()[1] == 2)
+        return optimizeOverdrawInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), positions, cacheSize, threshold);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::optimizeOverdrawInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+        return optimizeOverdrawInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), positions, cacheSize, threshold);
+    }
+}
+
+}}
@@ -0,0 +1,100 @@
+#ifndef Magnum_MeshTools_OptimizeOverdraw_h
+#define Magnum_MeshTools_OptimizeOverdraw_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeOverdrawInPlace()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize the mesh for reduced overdraw in-place
+@param[in,out] indices  Indices array to operate on
+@param[in] positions    Vertex positions
+@param[in] cacheSize    Modelled post-transform vertex cache size
+@param[in] threshold    How much worse vertex cache efficiency is allowed
+@m_since_latest
+
+Reorders triangles in the index array so triangles that are likely to occlude
+others get drawn first, independently of the view direction. Expects the
+index array to be already optimized for the post-transform vertex cache, for
+example using @ref optimizeVertexCacheInPlace() or @ref tipsifyInPlace(), and
+@p cacheSize being the same as was used for that.
+
+The triangles are first split into clusters at places where the modelled
+FIFO cache gets flushed completely, as reordering those doesn't affect cache
+efficiency at all. Each cluster is then further split at places where the
+cache miss ratio of the part so far is not larger than @p threshold times the
+miss ratio of the whole cluster. A value of @cpp 1.0f @ce thus keeps the cache
+efficiency almost intact, while larger values result in more and smaller
+clusters, giving more freedom to the sorting. The clusters are then sorted by
+how much they face away from the mesh centroid, as those are most likely to
+occlude other parts of the mesh. Algorithm used: *Pedro V. Sander, Diego Nehab,
+and Joshua Barczak --- Fast Triangle Reordering for Vertex Locality and
+Reduced Overdraw, SIGGRAPH 2007,
+http://gfx.cs.princeton.edu/pubs/Sander_2007_%3ETR/index.php*.
+
+Triangles inside each cluster keep their order, as does the vertex order in
+each triangle. Expects that @p indices size is divisible by @cpp 3 @ce, all
+indices are less than @p positions size, @p cacheSize is not zero and
+@p threshold is at least @cpp 1.0f @ce. Use @ref analyzeOverdraw() and
+@ref analyzeVertexCache() to measure the effect.
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize, Float threshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize, Float threshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize, Float threshold = 1.05f);
+
+/**
+@brief Optimize the mesh for reduced overdraw in-place on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize, Float threshold = 1.05f);
+
+}}
+
+#endif
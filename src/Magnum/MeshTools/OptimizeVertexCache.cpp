@@ -0,0 +1,223 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeVertexCache.h"
+
+#include <cmath>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Scoring parameters as suggested in the original article */
+constexpr Float CacheDecayPower = 1.5f;
+constexpr Float LastTriangleScore = 0.75f;
+constexpr Float ValenceBoostScale = 2.0f;
+constexpr Float ValenceBoostPower = 0.5f;
+
+/* Valence boost is tabulated up to this count of live triangles, above that
+   it's calculated directly */
+constexpr UnsignedInt MaxTabulatedValence = 32;
+
+struct VertexScore {
+    explicit VertexScore(const std::size_t cacheSize): cachePositionScore{Containers::NoInit, cacheSize} {
+        /* The three vertices of the last emitted triangle get a fixed score,
+           otherwise it'd be preferred to emit the same triangle again */
+        for(std::size_t i = 0; i != 3; ++i)
+            cachePositionScore[i] = LastTriangleScore;
+        for(std::size_t i = 3; i != cacheSize; ++i)
+            cachePositionScore[i] = std::pow(1.0f - Float(i - 3)/Float(cacheSize - 3), CacheDecayPower);
+
+        valenceScore[0] = 0.0f;
+        for(UnsignedInt i = 1; i <= MaxTabulatedValence; ++i)
+            valenceScore[i] = ValenceBoostScale*std::pow(Float(i), -ValenceBoostPower);
+    }
+
+    /* A negative cache position means the vertex is not in the cache */
+    Float operator()(const Int cachePosition, const UnsignedInt liveTriangleCount) const {
+        /* Vertices with no triangles left to emit don't matter anymore */
+        if(!liveTriangleCount) return -1.0f;
+
+        /* Boost vertices with only a few triangles left, so lone triangles
+           don't get left behind, causing expensive dead ends later */
+        const Float score = liveTriangleCount <= MaxTabulatedValence ?
+            valenceScore[liveTriangleCount] :
+            ValenceBoostScale*std::pow(Float(liveTriangleCount), -ValenceBoostPower);
+        return cachePosition < 0 ? score : score + cachePositionScore[cachePosition];
+    }
+
+    Containers::Array<Float> cachePositionScore;
+    Float valenceScore[MaxTabulatedValence + 1];
+};
+
+template<class T> void optimizeVertexCacheInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeVertexCacheInPlace(): index count not divisible by 3", );
+    CORRADE_ASSERT(cacheSize >= 4,
+        "MeshTools::optimizeVertexCacheInPlace(): expected cache size to be at least 4 but got" << cacheSize, );
+    for(const T index: indices)
+        CORRADE_ASSERT(index < vertexCount, "MeshTools::optimizeVertexCacheInPlace(): index" << index << "out of bounds for" << vertexCount << "vertices", );
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* Neighboring triangles for each vertex, per-vertex live triangle count */
+    Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::buildAdjacency<T>(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+    /* Initial vertex scores, with nothing in the cache */
+    const VertexScore score{cacheSize};
+    Containers::Array<Float> vertexScores{Containers::NoInit, vertexCount};
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        vertexScores[i] = score(-1, liveTriangleCount[i]);
+
+    /* Initial triangle scores and the best one to start with */
+    Containers::Array<Float> triangleScores{Containers::NoInit, triangleCount};
+    std::size_t bestTriangle = 0;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        triangleScores[i] =
+            vertexScores[indices[i*3 + 0]] +
+            vertexScores[indices[i*3 + 1]] +
+            vertexScores[indices[i*3 + 2]];
+        if(triangleScores[i] > triangleScores[bestTriangle])
+            bestTriangle = i;
+    }
+
+    Containers::Array<bool> emitted{Containers::ValueInit, triangleCount};
+
+    /* Modelled LRU cache. Has three extra slots for vertices of the newly
+       emitted triangle, vertices that end up in those are evicted. */
+    Containers::Array<UnsignedInt> cache{Containers::NoInit, cacheSize + 3};
+    Containers::Array<UnsignedInt> nextCache{Containers::NoInit, cacheSize + 3};
+    std::size_t cacheUsed = 0;
+
+    /* Output index buffer, cursor for finding the next triangle on dead end */
+    Containers::Array<T> outputIndices{Containers::NoInit, indices.size()};
+    std::size_t deadEndCursor = 0;
+
+    for(std::size_t out = 0; out != triangleCount; ++out) {
+        /* None of the vertices in the cache has any live triangles, pick the
+           next not yet emitted triangle in the original order */
+        if(bestTriangle == ~std::size_t{}) {
+            while(emitted[deadEndCursor]) ++deadEndCursor;
+            bestTriangle = deadEndCursor;
+        }
+
+        /* Emit the triangle and put its vertices to the front of the cache.
+           In case of degenerate triangles each vertex is put there just
+           once. */
+        const std::size_t t = bestTriangle;
+        emitted[t] = true;
+        const T a = indices[t*3 + 0];
+        const T b = indices[t*3 + 1];
+        const T c = indices[t*3 + 2];
+        outputIndices[out*3 + 0] = a;
+        outputIndices[out*3 + 1] = b;
+        outputIndices[out*3 + 2] = c;
+        --liveTriangleCount[a];
+        --liveTriangleCount[b];
+        --liveTriangleCount[c];
+        std::size_t nextCacheUsed = 0;
+        nextCache[nextCacheUsed++] = a;
+        if(b != a) nextCache[nextCacheUsed++] = b;
+        if(c != a && c != b) nextCache[nextCacheUsed++] = c;
+
+        /* The rest of the cache follows in the original order */
+        for(std::size_t i = 0; i != cacheUsed; ++i) {
+            const UnsignedInt v = cache[i];
+            if(v == a || v == b || v == c) continue;
+            nextCache[nextCacheUsed++] = v;
+        }
+
+        /* Update scores of all vertices that were in the cache, including
+           the evicted ones, and propagate the difference to all their
+           triangles that weren't emitted yet */
+        for(std::size_t i = 0; i != nextCacheUsed; ++i) {
+            const UnsignedInt v = nextCache[i];
+            const Float vertexScore = score(i < cacheSize ? Int(i) : -1, liveTriangleCount[v]);
+            const Float difference = vertexScore - vertexScores[v];
+            vertexScores[v] = vertexScore;
+            for(std::size_t j = neighborOffset[v]; j != neighborOffset[v + 1]; ++j)
+                triangleScores[neighbors[j]] += difference;
+        }
+
+        /* Pick the next triangle from live triangles of vertices that are
+           still in the cache. Done in a separate pass after all updates, as
+           a triangle score may get updated from more than one vertex. */
+        cacheUsed = Math::min(nextCacheUsed, cacheSize);
+        bestTriangle = ~std::size_t{};
+        Float bestScore = -1.0f;
+        for(std::size_t i = 0; i != cacheUsed; ++i) {
+            const UnsignedInt v = nextCache[i];
+            if(!liveTriangleCount[v]) continue;
+            for(std::size_t j = neighborOffset[v]; j != neighborOffset[v + 1]; ++j) {
+                const UnsignedInt neighbor = neighbors[j];
+                if(!emitted[neighbor] && triangleScores[neighbor] > bestScore) {
+                    bestTriangle = neighbor;
+                    bestScore = triangleScores[neighbor];
+                }
+            }
+        }
+
+        std::swap(cache, nextCache);
+    }
+
+    /* Copy the optimized index buffer back */
+    Utility::copy(outputIndices, indices);
+}
+
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount, cacheSize);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount, cacheSize);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount, cacheSize);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView2D<char>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeVertexCacheInPlace(): second index view dimension is not contiguous", );
+    if(indices.size()[1] == 4)
+        return optimizeVertexCacheInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), vertexCount, cacheSize);
+    else if(indices.size()[1] == 2)
+        return optimizeVertexCacheInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), vertexCount, cacheSize);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::optimizeVertexCacheInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+        return optimizeVertexCacheInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), vertexCount, cacheSize);
+    }
+}
+
+}}
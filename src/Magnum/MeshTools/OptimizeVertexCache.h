@@ -0,0 +1,91 @@
+#ifndef Magnum_MeshTools_OptimizeVertexCache_h
+#define Magnum_MeshTools_OptimizeVertexCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexCacheInPlace()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize the mesh for post-transform vertex cache in-place
+@param[in,out] indices  Indices array to operate on
+@param[in] vertexCount  Vertex count
+@param[in] cacheSize    Modelled post-transform vertex cache size
+@m_since_latest
+
+Reorders triangles in the index array for better usage of post-transform
+vertex cache. Compared to @ref tipsifyInPlace(), which only fans around
+vertices, this greedily picks the next triangle based on a score of its
+vertices, which models their position in a LRU cache of @p cacheSize entries
+and the count of triangles still using them. That generally results in a lower
+@ref VertexCacheStatistics::acmr "ACMR" at the cost of a slower
+optimization. Algorithm used: *Tom Forsyth --- Linear-Speed Vertex Cache
+Optimisation, https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html*.
+
+Vertex order inside each triangle is preserved. When there's no triangle
+adjacent to vertices in the cache, the algorithm continues with the first
+not-yet-emitted triangle in the original order. Expects that @p indices size is
+divisible by @cpp 3 @ce, all indices are less than @p vertexCount and
+@p cacheSize is at least @cpp 4 @ce. A value between @cpp 16 @ce and
+@cpp 32 @ce is a good fit for most GPUs.
+@see @ref analyzeVertexCache(), @ref optimizeVertexFetchInPlace()
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+@brief Optimize the mesh for post-transform vertex cache in-place on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, UnsignedInt, std::size_t)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView2D<char>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+}}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeVertexFetch.h"
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+template<class T> std::size_t optimizeVertexFetchInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView2D<char>& vertexData) {
+    CORRADE_ASSERT(vertexData.isContiguous<1>(),
+        "MeshTools::optimizeVertexFetchInPlace(): second vertex data view dimension is not contiguous", {});
+
+    /* Assign new vertex IDs in order of first use */
+    const std::size_t vertexCount = vertexData.size()[0];
+    Containers::Array<UnsignedInt> remap{Containers::DirectInit, vertexCount, ~UnsignedInt{}};
+    UnsignedInt referencedCount = 0;
+    for(const T index: indices) {
+        CORRADE_ASSERT(index < vertexCount, "MeshTools::optimizeVertexFetchInPlace(): index" << index << "out of bounds for" << vertexCount << "vertices", {});
+        if(remap[index] == ~UnsignedInt{}) remap[index] = referencedCount++;
+    }
+
+    /* Unreferenced vertices go after, in the original order */
+    UnsignedInt nextId = referencedCount;
+    for(UnsignedInt& i: remap)
+        if(i == ~UnsignedInt{}) i = nextId++;
+
+    /* Update the indices */
+    for(T& index: indices) index = T(remap[index]);
+
+    /* Permute the vertex data through a temporary copy */
+    const std::size_t vertexSize = vertexData.size()[1];
+    Containers::Array<char> permuted{Containers::NoInit, vertexCount*vertexSize};
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        std::memcpy(permuted + remap[i]*vertexSize, vertexData[i].data(), vertexSize);
+    Utility::copy(Containers::StridedArrayView2D<const char>{permuted, {vertexCount, vertexSize}}, vertexData);
+
+    return referencedCount;
+}
+
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& vertexData) {
+    return optimizeVertexFetchInPlaceImplementation(indices, vertexData);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& vertexData) {
+    return optimizeVertexFetchInPlaceImplementation(indices, vertexData);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& vertexData) {
+    return optimizeVertexFetchInPlaceImplementation(indices, vertexData);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& vertexData) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeVertexFetchInPlace(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return optimizeVertexFetchInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), vertexData);
+    else if(indices.size()[1] == 2)
+        return optimizeVertexFetchInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), vertexData);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::optimizeVertexFetchInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return optimizeVertexFetchInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), vertexData);
+    }
+}
+
+}}
@@ -0,0 +1,88 @@
+#ifndef Magnum_MeshTools_OptimizeVertexFetch_h
+#define Magnum_MeshTools_OptimizeVertexFetch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexFetchInPlace()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize the mesh for vertex fetch in-place
+@param[in,out] indices      Indices array to operate on
+@param[in,out] vertexData   Vertex data to reorder
+@return Count of vertices referenced by @p indices
+@m_since_latest
+
+Reorders vertices in @p vertexData so they're in the order in which they're
+first referenced by @p indices and updates @p indices to match, making vertex
+fetch access the memory as linearly as possible. Vertices that aren't
+referenced by any index are moved after all referenced vertices, preserving
+their relative order, so the vertex data can be shortened to the returned
+count. Triangle order isn't modified in any way, so this function is meant to
+be called after @ref optimizeVertexCacheInPlace() or @ref tipsifyInPlace().
+
+Expects that the second dimension of @p vertexData is contiguous and all
+indices are less than size of the first dimension of @p vertexData. The
+function allocates a temporary copy of the vertex data. If you have
+multiple non-interleaved vertex attributes, @ref interleave() them first.
+@see @ref analyzeVertexCache()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& vertexData);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& vertexData);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& vertexData);
+
+/**
+@brief Optimize the mesh for vertex fetch in-place on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<char>&)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& vertexData);
+
+}}
+
+#endif
@@ -0,0 +1,306 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Quantize.h"
+
+#include <cmath>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/PackingBatch.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+bool isInUnitRange(const Containers::StridedArrayView2D<const Float>& values) {
+    for(Containers::StridedArrayView1D<const Float> i: values)
+        for(const Float j: i)
+            if(!(j >= 0.0f && j <= 1.0f)) return false;
+    return true;
+}
+
+template<class T> Containers::StridedArrayView1D<T> attributeView(Containers::Array<char>& data, const std::size_t offset, const UnsignedInt vertexCount, const std::size_t stride) {
+    return {data, reinterpret_cast<T*>(data.data() + offset), vertexCount, std::ptrdiff_t(stride)};
+}
+
+/* Packs to unsigned normalized integers, returns max absolute error */
+template<class T> Float packUnsignedNormalized(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst) {
+    Math::packInto(src, dst);
+    Float maxError = 0.0f;
+    for(std::size_t i = 0; i != src.size()[0]; ++i)
+        for(std::size_t j = 0; j != src.size()[1]; ++j)
+            maxError = Math::max(maxError, Math::abs(Math::unpack<Float>(dst[i][j]) - src[i][j]));
+    return maxError;
+}
+
+/* Packs to half-floats, returns max absolute error */
+Float packHalf(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
+    Math::packHalfInto(src, dst);
+    Float maxError = 0.0f;
+    for(std::size_t i = 0; i != src.size()[0]; ++i)
+        for(std::size_t j = 0; j != src.size()[1]; ++j)
+            maxError = Math::max(maxError, Math::abs(Math::unpackHalf(dst[i][j]) - src[i][j]));
+    return maxError;
+}
+
+/* Normalizes the first three components and packs them to signed
+   normalized integers, a fourth component (if present) is clamped to the
+   [-1, 1] range. Returns max angle between the original and decoded
+   direction, zero-length input directions are ignored. */
+template<class T> Float packDirections(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst) {
+    Float maxAngle = 0.0f;
+    for(std::size_t i = 0; i != src.size()[0]; ++i) {
+        const Vector3 direction{src[i][0], src[i][1], src[i][2]};
+        const Float length = direction.length();
+        const Vector3 normalized = length ? direction/length : Vector3{};
+        for(std::size_t j = 0; j != 3; ++j)
+            dst[i][j] = Math::pack<T>(normalized[j]);
+        if(src.size()[1] == 4)
+            dst[i][3] = Math::pack<T>(Math::clamp(src[i][3], -1.0f, 1.0f));
+
+        if(!length) continue;
+        const Vector3 decoded{Math::unpack<Float>(dst[i][0]),
+                              Math::unpack<Float>(dst[i][1]),
+                              Math::unpack<Float>(dst[i][2])};
+        const Float cosine = Math::clamp(Math::dot(normalized, decoded.normalized()), -1.0f, 1.0f);
+        maxAngle = Math::max(maxAngle, std::acos(cosine));
+    }
+    return maxAngle;
+}
+
+/* Packs octahedral-encoded directions, returns max angle between the
+   original and decoded direction. Zero-length input directions are encoded
+   as zero and ignored. */
+template<class T> Float packOctahedralDirections(const Containers::StridedArrayView1D<const Vector3>& src, const Containers::StridedArrayView1D<Math::Vector2<T>>& dst) {
+    Float maxAngle = 0.0f;
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        if(src[i].isZero()) {
+            dst[i] = {};
+            continue;
+        }
+
+        dst[i] = Math::packOctahedral<Math::Vector2<T>>(src[i]);
+        const Float cosine = Math::clamp(Math::dot(src[i].normalized(), Math::unpackOctahedral<Vector3>(dst[i])), -1.0f, 1.0f);
+        maxAngle = Math::max(maxAngle, std::acos(cosine));
+    }
+    return maxAngle;
+}
+
+}
+
+Trade::MeshData quantize(const Trade::MeshData& mesh, const QuantizeFlags flags, QuantizationInfo* const info) {
+    const UnsignedInt vertexCount = mesh.vertexCount();
+
+    /* Decide on the output formats and calculate the interleaved layout,
+       with each attribute aligned to four bytes */
+    Containers::Array<VertexFormat> formats{Containers::NoInit, mesh.attributeCount()};
+    Containers::Array<std::size_t> offsets{Containers::NoInit, mesh.attributeCount()};
+    std::size_t stride = 0;
+    Vector3 positionMin{Constants::inf()};
+    Vector3 positionMax{-Constants::inf()};
+    bool hasPositions = false;
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const Trade::MeshAttribute name = mesh.attributeName(i);
+        const VertexFormat format = mesh.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::quantize(): attribute" << i << "has an implementation-specific format" << reinterpret_cast<void*>(vertexFormatUnwrap(format)),
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+
+        formats[i] = format;
+        if(mesh.attributeArraySize(i)) {
+            /* Array attributes are copied as-is */
+        } else if(name == Trade::MeshAttribute::Position && format == VertexFormat::Vector3) {
+            formats[i] = VertexFormat::Vector3s;
+            const std::pair<Vector3, Vector3> minmax = Math::minmax(mesh.attribute<Vector3>(i));
+            positionMin = Math::min(positionMin, minmax.first);
+            positionMax = Math::max(positionMax, minmax.second);
+            hasPositions = true;
+        } else if(name == Trade::MeshAttribute::Position && format == VertexFormat::Vector2) {
+            formats[i] = VertexFormat::Vector2s;
+            const std::pair<Vector2, Vector2> minmax = Math::minmax(mesh.attribute<Vector2>(i));
+            positionMin = Math::min(positionMin, Vector3{minmax.first, 0.0f});
+            positionMax = Math::max(positionMax, Vector3{minmax.second, 0.0f});
+            hasPositions = true;
+        } else if((name == Trade::MeshAttribute::Normal ||
+                   name == Trade::MeshAttribute::Tangent ||
+                   name == Trade::MeshAttribute::Bitangent) && format == VertexFormat::Vector3) {
+            if(flags & QuantizeFlag::OctahedralNormals)
+                formats[i] = flags & QuantizeFlag::HighPrecisionNormals ?
+                    VertexFormat::Vector2sNormalized : VertexFormat::Vector2bNormalized;
+            else
+                formats[i] = flags & QuantizeFlag::HighPrecisionNormals ?
+                    VertexFormat::Vector3sNormalized : VertexFormat::Vector3bNormalized;
+        } else if(name == Trade::MeshAttribute::Tangent && format == VertexFormat::Vector4) {
+            formats[i] = flags & QuantizeFlag::HighPrecisionNormals ?
+                VertexFormat::Vector4sNormalized : VertexFormat::Vector4bNormalized;
+        } else if(name == Trade::MeshAttribute::TextureCoordinates && format == VertexFormat::Vector2) {
+            formats[i] = !(flags & QuantizeFlag::HalfTextureCoordinates) && isInUnitRange(Containers::arrayCast<2, const Float>(mesh.attribute<Vector2>(i))) ?
+                VertexFormat::Vector2usNormalized : VertexFormat::Vector2h;
+        } else if(name == Trade::MeshAttribute::Color && format == VertexFormat::Vector3) {
+            formats[i] = isInUnitRange(Containers::arrayCast<2, const Float>(mesh.attribute<Vector3>(i))) ?
+                VertexFormat::Vector3ubNormalized : VertexFormat::Vector3h;
+        } else if(name == Trade::MeshAttribute::Color && format == VertexFormat::Vector4) {
+            formats[i] = isInUnitRange(Containers::arrayCast<2, const Float>(mesh.attribute<Vector4>(i))) ?
+                VertexFormat::Vector4ubNormalized : VertexFormat::Vector4h;
+        }
+
+        offsets[i] = stride;
+        const std::size_t size = vertexFormatSize(formats[i])*Math::max(mesh.attributeArraySize(i), UnsignedShort{1});
+        stride += (size + 3) & ~std::size_t{3};
+    }
+
+    /* Uniform scale mapping the largest bounding box half-extent to the
+       full 16-bit range, centered around the bounding box center. For a
+       single point or an empty mesh the scale is arbitrary, use 1. */
+    Vector3 positionCenter;
+    Float positionScale = 1.0f;
+    if(hasPositions && vertexCount) {
+        positionCenter = (positionMin + positionMax)/2.0f;
+        const Float halfExtent = ((positionMax - positionMin)/2.0f).max();
+        if(halfExtent > 0.0f) positionScale = halfExtent/32767.0f;
+    }
+
+    QuantizationInfo out{};
+    out.positionDequantization = Matrix4::translation(positionCenter)*Matrix4::scaling(Vector3{positionScale});
+    Float directionError = 0.0f;
+
+    Containers::Array<char> vertexData{Containers::ValueInit, stride*vertexCount};
+    Containers::Array<Trade::MeshAttributeData> attributeData{mesh.attributeCount()};
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        const std::size_t offset = offsets[i];
+
+        /* Positions, converted manually as Math::packInto() can't do the
+           scaling */
+        if(formats[i] == VertexFormat::Vector3s && format == VertexFormat::Vector3) {
+            const Containers::StridedArrayView1D<const Vector3> src = mesh.attribute<Vector3>(i);
+            const Containers::StridedArrayView1D<Vector3s> dst = attributeView<Vector3s>(vertexData, offset, vertexCount, stride);
+            for(std::size_t j = 0; j != src.size(); ++j) {
+                dst[j] = Vector3s{Math::round((src[j] - positionCenter)/positionScale)};
+                out.positionError = Math::max(out.positionError, (positionCenter + Vector3{dst[j]}*positionScale - src[j]).length());
+            }
+        } else if(formats[i] == VertexFormat::Vector2s && format == VertexFormat::Vector2) {
+            const Containers::StridedArrayView1D<const Vector2> src = mesh.attribute<Vector2>(i);
+            const Containers::StridedArrayView1D<Vector2s> dst = attributeView<Vector2s>(vertexData, offset, vertexCount, stride);
+            for(std::size_t j = 0; j != src.size(); ++j) {
+                dst[j] = Vector2s{Math::round((src[j] - positionCenter.xy())/positionScale)};
+                out.positionError = Math::max(out.positionError, (positionCenter.xy() + Vector2{dst[j]}*positionScale - src[j]).length());
+            }
+
+        /* Directions */
+        } else if(formats[i] == VertexFormat::Vector2bNormalized && format == VertexFormat::Vector3) {
+            directionError = Math::max(directionError, packOctahedralDirections(
+                mesh.attribute<Vector3>(i),
+                attributeView<Vector2b>(vertexData, offset, vertexCount, stride)));
+        } else if(formats[i] == VertexFormat::Vector2sNormalized && format == VertexFormat::Vector3) {
+            directionError = Math::max(directionError, packOctahedralDirections(
+                mesh.attribute<Vector3>(i),
+                attributeView<Vector2s>(vertexData, offset, vertexCount, stride)));
+        } else if(formats[i] == VertexFormat::Vector3bNormalized && format == VertexFormat::Vector3) {
+            directionError = Math::max(directionError, packDirections(
+                Containers::arrayCast<2, const Float>(mesh.attribute<Vector3>(i)),
+                Containers::arrayCast<2, Byte>(attributeView<Vector3b>(vertexData, offset, vertexCount, stride))));
+        } else if(formats[i] == VertexFormat::Vector3sNormalized && format == VertexFormat::Vector3) {
+            directionError = Math::max(directionError, packDirections(
+                Containers::arrayCast<2, const Float>(mesh.attribute<Vector3>(i)),
+                Containers::arrayCast<2, Short>(attributeView<Vector3s>(vertexData, offset, vertexCount, stride))));
+        } else if(formats[i] == VertexFormat::Vector4bNormalized && format == VertexFormat::Vector4) {
+            directionError = Math::max(directionError, packDirections(
+                Containers::arrayCast<2, const Float>(mesh.attribute<Vector4>(i)),
+                Containers::arrayCast<2, Byte>(attributeView<Vector4b>(vertexData, offset, vertexCount, stride))));
+        } else if(formats[i] == VertexFormat::Vector4sNormalized && format == VertexFormat::Vector4) {
+            directionError = Math::max(directionError, packDirections(
+                Containers::arrayCast<2, const Float>(mesh.attribute<Vector4>(i)),
+                Containers::arrayCast<2, Short>(attributeView<Vector4s>(vertexData, offset, vertexCount, stride))));
+
+        /* Texture coordinates */
+        } else if(formats[i] == VertexFormat::Vector2usNormalized && format == VertexFormat::Vector2) {
+            out.textureCoordinateError = Math::max(out.textureCoordinateError, packUnsignedNormalized(
+                Containers::arrayCast<2, const Float>(mesh.attribute<Vector2>(i)),
+                Containers::arrayCast<2, UnsignedShort>(attributeView<Vector2us>(vertexData, offset, vertexCount, stride))));
+        } else if(formats[i] == VertexFormat::Vector2h && format == VertexFormat::Vector2) {
+            out.textureCoordinateError = Math::max(out.textureCoordinateError, packHalf(
+                Containers::arrayCast<2, const Float>(mesh.attribute<Vector2>(i)),
+                Containers::arrayCast<2, UnsignedShort>(attributeView<Vector2us>(vertexData, offset, vertexCount, stride))));
+
+        /* Colors */
+        } else if(formats[i] == VertexFormat::Vector3ubNormalized && format == VertexFormat::Vector3) {
+            out.colorError = Math::max(out.colorError, packUnsignedNormalized(
+                Containers::arrayCast<2, const Float>(mesh.attribute<Vector3>(i)),
+                Containers::arrayCast<2, UnsignedByte>(attributeView<Vector3ub>(vertexData, offset, vertexCount, stride))));
+        } else if(formats[i] == VertexFormat::Vector4ubNormalized && format == VertexFormat::Vector4) {
+            out.colorError = Math::max(out.colorError, packUnsignedNormalized(
+                Containers::arrayCast<2, const Float>(mesh.attribute<Vector4>(i)),
+                Containers::arrayCast<2, UnsignedByte>(attributeView<Vector4ub>(vertexData, offset, vertexCount, stride))));
+        } else if(formats[i] == VertexFormat::Vector3h && format == VertexFormat::Vector3) {
+            out.colorError = Math::max(out.colorError, packHalf(
+                Containers::arrayCast<2, const Float>(mesh.attribute<Vector3>(i)),
+                Containers::arrayCast<2, UnsignedShort>(attributeView<Vector3us>(vertexData, offset, vertexCount, stride))));
+        } else if(formats[i] == VertexFormat::Vector4h && format == VertexFormat::Vector4) {
+            out.colorError = Math::max(out.colorError, packHalf(
+                Containers::arrayCast<2, const Float>(mesh.attribute<Vector4>(i)),
+                Containers::arrayCast<2, UnsignedShort>(attributeView<Vector4us>(vertexData, offset, vertexCount, stride))));
+
+        /* Everything else is copied as-is */
+        } else {
+            const Containers::StridedArrayView2D<const char> src = mesh.attribute(i);
+            Utility::copy(src, Containers::StridedArrayView2D<char>{vertexData,
+                vertexData.data() + offset, src.size(),
+                {std::ptrdiff_t(stride), 1}});
+        }
+
+        attributeData[i] = Trade::MeshAttributeData{mesh.attributeName(i),
+            formats[i],
+            Containers::StridedArrayView1D<const void>{vertexData,
+                vertexData.data() + offset, vertexCount, std::ptrdiff_t(stride)},
+            mesh.attributeArraySize(i)};
+    }
+
+    out.directionError = Rad{directionError};
+    if(info) *info = out;
+
+    /* Copy the index data, if any */
+    Containers::Array<char> indexData;
+    Trade::MeshIndexData indices;
+    if(mesh.isIndexed()) {
+        indexData = Containers::Array<char>{Containers::NoInit, mesh.indexData().size()};
+        indices = Trade::MeshIndexData{mesh.indexType(), indexData.slice(mesh.indexOffset(), mesh.indexOffset() + mesh.indexCount()*meshIndexTypeSize(mesh.indexType()))};
+        Utility::copy(mesh.indexData(), indexData);
+    }
+
+    return Trade::MeshData{mesh.primitive(),
+        std::move(indexData), indices,
+        std::move(vertexData), std::move(attributeData), vertexCount};
+}
+
+}}
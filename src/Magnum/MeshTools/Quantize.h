@@ -0,0 +1,195 @@
+#ifndef Magnum_MeshTools_Quantize_h
+#define Magnum_MeshTools_Quantize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::quantize(), struct @ref Magnum::MeshTools::QuantizationInfo, enum @ref Magnum::MeshTools::QuantizeFlag, enum set @ref Magnum::MeshTools::QuantizeFlags
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Quantization flag
+@m_since_latest
+
+@see @ref QuantizeFlags, @ref quantize()
+*/
+enum class QuantizeFlag: UnsignedByte {
+    /**
+     * Quantize normals, tangents and bitangents to 16-bit components instead
+     * of 8-bit.
+     */
+    HighPrecisionNormals = 1 << 0,
+
+    /**
+     * Quantize texture coordinates to half-floats even if they're all in the
+     * @f$ [0, 1] @f$ range.
+     */
+    HalfTextureCoordinates = 1 << 1,
+
+    /**
+     * Encode normals, bitangents and three-component tangents using
+     * @ref Math::packOctahedral() into @ref VertexFormat::Vector2bNormalized,
+     * or @ref VertexFormat::Vector2sNormalized if
+     * @ref QuantizeFlag::HighPrecisionNormals is set. The octahedral
+     * representation needs only two components, but has to be decoded in the
+     * shader, see @ref Trade::MeshAttribute::Normal for more information.
+     * Four-component tangents are unaffected by this flag.
+     */
+    OctahedralNormals = 1 << 2
+};
+
+/**
+@brief Quantization flags
+@m_since_latest
+
+@see @ref quantize()
+*/
+typedef Containers::EnumSet<QuantizeFlag> QuantizeFlags;
+
+CORRADE_ENUMSET_OPERATORS(QuantizeFlags)
+
+/**
+@brief Quantization info
+@m_since_latest
+
+Filled by @ref quantize().
+*/
+struct QuantizationInfo {
+    /**
+     * @brief Position dequantization matrix
+     *
+     * Transforms the quantized positions back to the original space. Is
+     * always a uniform scaling combined with a translation, so it can be
+     * directly multiplied with a model transformation without affecting the
+     * normal matrix. If the mesh doesn't have any positions, it's an
+     * identity.
+     */
+    Matrix4 positionDequantization;
+
+    /**
+     * @brief Max position error
+     *
+     * Largest distance between an original and a dequantized position, in
+     * the original units.
+     */
+    Float positionError;
+
+    /**
+     * @brief Max direction error
+     *
+     * Largest angle between an original and a decoded normal, tangent or
+     * bitangent direction.
+     */
+    Rad directionError;
+
+    /**
+     * @brief Max texture coordinate error
+     *
+     * Largest absolute difference between an original and a decoded texture
+     * coordinate component.
+     */
+    Float textureCoordinateError;
+
+    /**
+     * @brief Max color error
+     *
+     * Largest absolute difference between an original and a decoded color
+     * channel.
+     */
+    Float colorError;
+};
+
+/**
+@brief Quantize mesh vertex attributes
+@param mesh         Input mesh
+@param flags        Flags
+@param[out] info    If not @cpp nullptr @ce, the position dequantization
+    matrix and the largest introduced error for each attribute kind is written
+    here
+@m_since_latest
+
+Returns a copy of @p mesh with floating-point attributes converted to compact
+formats, chosen per attribute:
+
+-   @ref Trade::MeshAttribute::Position in @ref VertexFormat::Vector3 or
+    @ref VertexFormat::Vector2 is converted to @ref VertexFormat::Vector3s or
+    @ref VertexFormat::Vector2s, respectively. All position attributes are
+    scaled uniformly and centered to fit the whole 16-bit range and the
+    inverse transformation is returned in
+    @ref QuantizationInfo::positionDequantization.
+-   @ref Trade::MeshAttribute::Normal, @ref Trade::MeshAttribute::Tangent and
+    @ref Trade::MeshAttribute::Bitangent in @ref VertexFormat::Vector3 or
+    @ref VertexFormat::Vector4 are normalized and converted to
+    @ref VertexFormat::Vector3bNormalized or
+    @ref VertexFormat::Vector4bNormalized, or to
+    @ref VertexFormat::Vector3sNormalized or
+    @ref VertexFormat::Vector4sNormalized if
+    @ref QuantizeFlag::HighPrecisionNormals is set. The fourth tangent
+    component is expected to be the bitangent direction sign. If
+    @ref QuantizeFlag::OctahedralNormals is set, three-component directions
+    are octahedral-encoded to @ref VertexFormat::Vector2bNormalized or
+    @ref VertexFormat::Vector2sNormalized instead.
+-   @ref Trade::MeshAttribute::TextureCoordinates in @ref VertexFormat::Vector2
+    are converted to @ref VertexFormat::Vector2usNormalized if all
+    coordinates are in the @f$ [0, 1] @f$ range and
+    @ref QuantizeFlag::HalfTextureCoordinates isn't set, and to
+    @ref VertexFormat::Vector2h otherwise.
+-   @ref Trade::MeshAttribute::Color in @ref VertexFormat::Vector3 or
+    @ref VertexFormat::Vector4 is converted to
+    @ref VertexFormat::Vector3ubNormalized or
+    @ref VertexFormat::Vector4ubNormalized if all channels are in the
+    @f$ [0, 1] @f$ range and to @ref VertexFormat::Vector3h or
+    @ref VertexFormat::Vector4h otherwise.
+
+All other attributes, including array attributes and attributes that are
+already in a packed format, are copied unchanged. The output is interleaved,
+with each attribute aligned to four bytes. Index data, if any, are copied
+unchanged as well. Expects that the mesh doesn't contain any attributes with
+an implementation-specific format.
+
+When rendering, the quantized positions need to be transformed with
+@ref QuantizationInfo::positionDequantization, for example by multiplying it
+into the model transformation, normalized formats are converted back to
+floats by the GPU directly.
+@see @ref isVertexFormatNormalized(), @ref Math::packInto(),
+    @ref Math::packHalfInto(), @ref Math::packOctahedral()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData quantize(const Trade::MeshData& mesh, QuantizeFlags flags = {}, QuantizationInfo* info = nullptr);
+
+}}
+
+#endif
@@ -28,42 +28,424 @@
 #include <cstring>
 #include <limits>
 #include <numeric>
-#include <unordered_map>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Algorithms.h>
-#include <Corrade/Utility/MurmurHash2.h>
+#include <Corrade/Utility/Debug.h>
 
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/MeshTools/Reference.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/Implementation/parallel.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace MeshTools {
 
-struct ArrayEqual {
-    explicit ArrayEqual(std::size_t size): _size{size} {}
+namespace {
+
+/* Final avalanche step of SplitMix64. The table is indexed with the low bits
+   of the hash, so all input bits need to affect those. */
+inline UnsignedLong hashFinalize(UnsignedLong h) {
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ull;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebull;
+    h ^= h >> 31;
+    return h;
+}
+
+inline UnsignedLong hashCombine(const UnsignedLong h, const UnsignedLong word) {
+    const UnsignedLong x = (h ^ word)*0x9e3779b97f4a7c15ull;
+    return (x << 31)|(x >> 33);
+}
+
+/* Hashes the data in 8-byte words with a 4-byte and a byte-wise tail. When
+   called with a compile-time constant size, the loops get fully unrolled and
+   the tails for sizes that are a multiple of 8 disappear completely. Going
+   through memcpy() to not rely on the data being aligned, which compilers
+   turn into a single load. */
+inline UnsignedLong hashBytes(const char* const data, const std::size_t size) {
+    UnsignedLong h = size;
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8) {
+        UnsignedLong word;
+        std::memcpy(&word, data + i, 8);
+        h = hashCombine(h, word);
+    }
+    if(i + 4 <= size) {
+        UnsignedInt word;
+        std::memcpy(&word, data + i, 4);
+        h = hashCombine(h, word);
+        i += 4;
+    }
+    if(i != size) {
+        UnsignedLong word = 0;
+        std::memcpy(&word, data + i, size - i);
+        h = hashCombine(h, word);
+    }
+    return hashFinalize(h);
+}
+
+/* Key with size known only at runtime */
+struct RuntimeSizeKey {
+    explicit RuntimeSizeKey(std::size_t size): _size{size} {}
+
+    std::size_t size() const { return _size; }
 
-    bool operator()(const void* a, const void* b) const {
+    UnsignedLong hash(const char* data) const {
+        return hashBytes(data, _size);
+    }
+
+    bool equal(const char* a, const char* b) const {
         return std::memcmp(a, b, _size) == 0;
     }
 
     private: std::size_t _size;
 };
 
-struct ArrayHash {
-    explicit ArrayHash(std::size_t size): _size{size} {}
+/* Key with size known at compile time, which allows the compiler to inline
+   and unroll both the hashing and the comparison. Used for the most common
+   vertex sizes such as Vector3, Vector4 or Vector3d. */
+template<std::size_t size_> struct FixedSizeKey {
+    std::size_t size() const { return size_; }
 
-    std::size_t operator()(const void* a) const {
-        return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), _size).byteArray());
+    UnsignedLong hash(const char* data) const {
+        return hashBytes(data, size_);
     }
 
-    private: std::size_t _size;
+    bool equal(const char* a, const char* b) const {
+        return std::memcmp(a, b, size_) == 0;
+    }
 };
 
+/* A flat open-addressing hash table with linear probing, storing just indices
+   of the keys in an external strided array and the upper 32 bits of their
+   hash to avoid comparing the actual keys on most collisions --- the lower
+   bits are already used for the slot position, so they wouldn't tell keys
+   that ended up in the same probe sequence apart. Compared to a
+   std::unordered_map there's a single allocation done upfront for the worst
+   case of all keys being unique and no pointer chasing during lookup. The
+   keys can't be removed, which isn't needed for anything here.
+
+   The data the keys point to have to stay unchanged while present in the
+   table. */
+template<class Key> class OpenAddressingTable {
+    public:
+        explicit OpenAddressingTable(const Key& key, const char* const data, const std::ptrdiff_t stride, const std::size_t maxSize): _key(key), _data{data}, _stride{stride} {
+            /* Keep the load factor at most at 2/3 */
+            std::size_t capacity = 16;
+            while(capacity < maxSize + maxSize/2) capacity *= 2;
+            _mask = capacity - 1;
+            _slots = Containers::Array<Slot>{Containers::NoInit, capacity};
+            clear();
+        }
+
+        std::size_t size() const { return _size; }
+
+        /* If there's already a key equal to the one at given index, returns
+           index of the existing key, otherwise inserts the index and returns
+           it */
+        UnsignedInt insert(const UnsignedInt index) {
+            return insert(index, _key.hash(_data + index*_stride));
+        }
+
+        /* Same as above, but with the hash calculated already */
+        UnsignedInt insert(const UnsignedInt index, const UnsignedLong hash) {
+            const char* const key = _data + index*_stride;
+            const UnsignedInt hashTag = UnsignedInt(hash >> 32);
+            for(std::size_t i = std::size_t(hash) & _mask; ; i = (i + 1) & _mask) {
+                Slot& slot = _slots[i];
+                if(slot.index == Empty) {
+                    slot.hash = hashTag;
+                    slot.index = index;
+                    ++_size;
+                    return index;
+                }
+
+                if(slot.hash == hashTag && _key.equal(_data + slot.index*_stride, key))
+                    return slot.index;
+            }
+        }
+
+        /* Returns index of a key equal to given key data or Empty if there's
+           no such key. The key data don't need to be a part of the
+           external array. */
+        UnsignedInt find(const char* const key) const {
+            const UnsignedLong hash = _key.hash(key);
+            const UnsignedInt hashTag = UnsignedInt(hash >> 32);
+            for(std::size_t i = std::size_t(hash) & _mask; ; i = (i + 1) & _mask) {
+                const Slot& slot = _slots[i];
+                if(slot.index == Empty) return Empty;
+                if(slot.hash == hashTag && _key.equal(_data + slot.index*_stride, key))
+                    return slot.index;
+            }
+        }
+
+        void clear() {
+            for(Slot& slot: _slots) slot.index = Empty;
+            _size = 0;
+        }
+
+        enum: UnsignedInt { Empty = ~UnsignedInt{} };
+
+    private:
+
+        struct Slot {
+            UnsignedInt hash;
+            UnsignedInt index;
+        };
+
+        Key _key;
+        const char* _data;
+        std::ptrdiff_t _stride;
+        std::size_t _mask, _size;
+        Containers::Array<Slot> _slots;
+};
+
+template<class Key> std::size_t removeDuplicatesIntoSerial(const Key& key, const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    const std::size_t dataSize = data.size()[0];
+
+    /* Table containing index of first occurence for each unique entry. The
+       keys are the original unchanged data. */
+    OpenAddressingTable<Key> table{key, static_cast<const char*>(data.data()), data.stride()[0], dataSize};
+
+    /* Go through all entries, put the (either new or already existing) index
+       into the output index array */
+    for(std::size_t i = 0; i != dataSize; ++i)
+        indices[i] = table.insert(UnsignedInt(i));
+
+    CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
+    return table.size();
+}
+
+template<class Key> std::size_t removeDuplicatesInPlaceIntoSerial(const Key& key, const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    const std::size_t dataSize = data.size()[0];
+
+    /* Table containing index of first occurence for each unique entry. The
+       table doesn't store a copy of the keys, only their index into the
+       original data that we mutate in-place, so extra care needs to be taken
+       to prevent already-inserted keys from getting modified. */
+    OpenAddressingTable<Key> table{key, static_cast<const char*>(data.data()), data.stride()[0], dataSize};
+
+    for(std::size_t i = 0; i != dataSize; ++i) {
+        /* First copy the key data to a potentially final no-longer-mutable
+           place (except if the source and target location is the same). Data
+           in [table.size()-1, i) is already present in the [0, table.size()-1)
+           range from previous iterations so we aren't overwriting anything. If
+           insertion succeeds, this location will not be touched ever again; if
+           it fails the location isn't used as a key anywhere and so it can be
+           reused next time for a different key.
+
+           Alternatively we could first do a lookup and only then
+           conditionally do a copy() and an insertion, but that means the hash
+           & search would be performed twice, which is never faster than a
+           plain memory copy. */
+        const std::size_t size = table.size();
+        if(i != size)
+            Utility::copy(data[i].asContiguous(), data[size].asContiguous());
+
+        /* Insert the new entry into the table, put the (either new or already
+           existing) index into the output index array. If the insertion
+           succeeds, the data at `size` are guaranteed to not change
+           anymore. */
+        indices[i] = table.insert(UnsignedInt(size));
+    }
+
+    CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
+    return table.size();
+}
+
+/* Picks a partition based on the upper 32 bits of the hash, because the lower
+   bits are used for addressing inside the table */
+inline UnsignedInt hashPartition(const UnsignedLong hash, const UnsignedInt count) {
+    return UnsignedInt(((hash >> 32)*count) >> 32);
+}
+
+template<class Key> struct RemoveDuplicatesParallelState {
+    Key key;
+    const char* data;
+    std::ptrdiff_t stride;
+    std::size_t size;
+    UnsignedInt taskCount;
+    Containers::StridedArrayView1D<UnsignedInt> indices;
+
+    /* Hash for every item */
+    Containers::Array<UnsignedLong> hashes;
+    /* Item count for each task and partition, turned into output offsets
+       for each task and partition */
+    Containers::Array<std::size_t> offsets;
+    /* Item indices ordered by partition and then by the original order */
+    Containers::Array<UnsignedInt> partitioned;
+    /* Where each partition begins in the above array, with the end of the
+       last partition being the last element */
+    Containers::Array<std::size_t> partitionOffsets;
+    /* Unique item count in each partition */
+    Containers::Array<std::size_t> uniqueCounts;
+};
+
+/* Equal items always end up in the same partition, and as items in each
+   partition are kept in the original order, the first occurence found in
+   each partition is the same as the globally first occurence. Thus the
+   output is the same as with removeDuplicatesIntoSerial(). */
+template<class Key> std::size_t removeDuplicatesIntoParallel(const Key& key, const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const TaskExecutor executor, void* const executorUserData) {
+    typedef RemoveDuplicatesParallelState<Key> State;
+
+    const std::size_t dataSize = data.size()[0];
+    const UnsignedInt taskCount = Implementation::parallelTaskCount(dataSize);
+    State state{key,
+        static_cast<const char*>(data.data()), data.stride()[0],
+        dataSize, taskCount, indices,
+        Containers::Array<UnsignedLong>{Containers::NoInit, dataSize},
+        Containers::Array<std::size_t>{Containers::ValueInit, std::size_t(taskCount)*taskCount},
+        Containers::Array<UnsignedInt>{Containers::NoInit, dataSize},
+        Containers::Array<std::size_t>{Containers::NoInit, std::size_t(taskCount) + 1},
+        Containers::Array<std::size_t>{Containers::NoInit, taskCount}};
+
+    /* Calculate hashes of all items in contiguous ranges and count how many
+       items fall into each partition */
+    executor(taskCount, [](const UnsignedInt id, void* const statePointer) {
+        State& state = *static_cast<State*>(statePointer);
+        std::size_t* const counts = state.offsets.data() + std::size_t(id)*state.taskCount;
+        for(std::size_t i = Implementation::taskRangeBegin(state.size, state.taskCount, id), end = Implementation::taskRangeBegin(state.size, state.taskCount, id + 1); i != end; ++i) {
+            const UnsignedLong hash = state.key.hash(state.data + std::ptrdiff_t(i)*state.stride);
+            state.hashes[i] = hash;
+            ++counts[hashPartition(hash, state.taskCount)];
+        }
+    }, &state, executorUserData);
+
+    /* Turn the counts into offsets where each task writes its items for each
+       partition. Ranges from earlier tasks go first so the original order is
+       preserved. */
+    {
+        std::size_t offset = 0;
+        for(UnsignedInt partition = 0; partition != taskCount; ++partition) {
+            state.partitionOffsets[partition] = offset;
+            for(UnsignedInt task = 0; task != taskCount; ++task) {
+                std::size_t& count = state.offsets[std::size_t(task)*taskCount + partition];
+                const std::size_t next = offset + count;
+                count = offset;
+                offset = next;
+            }
+        }
+        state.partitionOffsets[taskCount] = offset;
+        CORRADE_INTERNAL_ASSERT(offset == dataSize);
+    }
+
+    /* Scatter the item indices to their partitions */
+    executor(taskCount, [](const UnsignedInt id, void* const statePointer) {
+        State& state = *static_cast<State*>(statePointer);
+        std::size_t* const offsets = state.offsets.data() + std::size_t(id)*state.taskCount;
+        for(std::size_t i = Implementation::taskRangeBegin(state.size, state.taskCount, id), end = Implementation::taskRangeBegin(state.size, state.taskCount, id + 1); i != end; ++i)
+            state.partitioned[offsets[hashPartition(state.hashes[i], state.taskCount)]++] = UnsignedInt(i);
+    }, &state, executorUserData);
+
+    /* Deduplicate each partition with its own table. The tables reuse the
+       already calculated hashes. */
+    executor(taskCount, [](const UnsignedInt id, void* const statePointer) {
+        State& state = *static_cast<State*>(statePointer);
+        const std::size_t begin = state.partitionOffsets[id];
+        const std::size_t end = state.partitionOffsets[id + 1];
+        OpenAddressingTable<Key> table{state.key, state.data, state.stride, end - begin};
+        for(std::size_t j = begin; j != end; ++j) {
+            const UnsignedInt i = state.partitioned[j];
+            state.indices[i] = table.insert(i, state.hashes[i]);
+        }
+        state.uniqueCounts[id] = table.size();
+    }, &state, executorUserData);
+
+    std::size_t uniqueCount = 0;
+    for(const std::size_t count: state.uniqueCounts) uniqueCount += count;
+    return uniqueCount;
+}
+
+struct RemoveDuplicatesCompactionState {
+    std::size_t size;
+    UnsignedInt taskCount;
+    Containers::StridedArrayView1D<UnsignedInt> indices;
+
+    /* Unique item count in each task range, turned into output offsets */
+    Containers::Array<std::size_t> offsets;
+    /* Position of each unique item in the compacted array */
+    Containers::Array<UnsignedInt> remapping;
+};
+
+/* Takes an index array pointing to first occurences of each item, as produced
+   by removeDuplicatesIntoParallel(), compacts the unique items to the front
+   and updates the index array to point to them, thus producing the same
+   output as removeDuplicatesInPlaceIntoSerial(). */
+void removeDuplicatesCompactParallel(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const TaskExecutor executor, void* const executorUserData) {
+    typedef RemoveDuplicatesCompactionState State;
+
+    const std::size_t dataSize = data.size()[0];
+    const UnsignedInt taskCount = Implementation::parallelTaskCount(dataSize);
+    State state{dataSize, taskCount, indices,
+        Containers::Array<std::size_t>{Containers::NoInit, taskCount},
+        Containers::Array<UnsignedInt>{Containers::NoInit, dataSize}};
+
+    /* Count unique items in each range */
+    executor(taskCount, [](const UnsignedInt id, void* const statePointer) {
+        State& state = *static_cast<State*>(statePointer);
+        std::size_t count = 0;
+        for(std::size_t i = Implementation::taskRangeBegin(state.size, state.taskCount, id), end = Implementation::taskRangeBegin(state.size, state.taskCount, id + 1); i != end; ++i)
+            if(state.indices[i] == i) ++count;
+        state.offsets[id] = count;
+    }, &state, executorUserData);
+
+    /* Turn the counts into offsets */
+    {
+        std::size_t offset = 0;
+        for(std::size_t& count: state.offsets) {
+            const std::size_t next = offset + count;
+            count = offset;
+            offset = next;
+        }
+    }
+
+    /* Calculate the new position of each unique item */
+    executor(taskCount, [](const UnsignedInt id, void* const statePointer) {
+        State& state = *static_cast<State*>(statePointer);
+        std::size_t offset = state.offsets[id];
+        for(std::size_t i = Implementation::taskRangeBegin(state.size, state.taskCount, id), end = Implementation::taskRangeBegin(state.size, state.taskCount, id + 1); i != end; ++i)
+            if(state.indices[i] == i) state.remapping[i] = UnsignedInt(offset++);
+    }, &state, executorUserData);
+
+    /* Move the unique items to their new positions. The target position is
+       never after the source, so doing this in order doesn't overwrite
+       anything that wasn't moved yet. That however isn't true across task
+       ranges, so this part is done serially. */
+    for(std::size_t i = 0; i != dataSize; ++i)
+        if(indices[i] == i && state.remapping[i] != i)
+            Utility::copy(data[i].asContiguous(), data[state.remapping[i]].asContiguous());
+
+    /* Point the indices to the new positions */
+    executor(taskCount, [](const UnsignedInt id, void* const statePointer) {
+        State& state = *static_cast<State*>(statePointer);
+        for(std::size_t i = Implementation::taskRangeBegin(state.size, state.taskCount, id), end = Implementation::taskRangeBegin(state.size, state.taskCount, id + 1); i != end; ++i)
+            state.indices[i] = state.remapping[state.indices[i]];
+    }, &state, executorUserData);
+}
+
+template<class Key> std::size_t removeDuplicatesIntoImplementation(const Key& key, const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const TaskExecutor executor, void* const executorUserData) {
+    if(!executor) return removeDuplicatesIntoSerial(key, data, indices);
+    return removeDuplicatesIntoParallel(key, data, indices, executor, executorUserData);
+}
+
+template<class Key> std::size_t removeDuplicatesInPlaceIntoImplementation(const Key& key, const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const TaskExecutor executor, void* const executorUserData) {
+    if(!executor) return removeDuplicatesInPlaceIntoSerial(key, data, indices);
+    const std::size_t uniqueCount = removeDuplicatesIntoParallel(key, data, indices, executor, executorUserData);
+    removeDuplicatesCompactParallel(data, indices, executor, executorUserData);
+    return uniqueCount;
+}
+
+}
+
 std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    return removeDuplicatesInto(data, indices, nullptr, nullptr);
+}
+
+std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const TaskExecutor executor, void* const executorUserData) {
     /* Assuming the second dimension is contiguous so we can calculate the
        hashes easily */
     CORRADE_ASSERT(data.empty()[0] || data.isContiguous<1>(),
@@ -73,37 +455,31 @@ std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char
     CORRADE_ASSERT(indices.size() == dataSize,
         "MeshTools::removeDuplicatesInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
-    /* Table containing index of first occurence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
-       unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
-
-    /* Go through all entries */
-    for(std::size_t i = 0; i != dataSize; ++i) {
-        /* Try to insert new entry into the table. The inserted index points
-           into the original unchanged data array. */
-        const Containers::ArrayView<const char> entry = data[i].asContiguous();
-        const auto result = table.emplace(entry, i);
-
-        /* Put the (either new or already existing) index into the output
-           index array */
-        indices[i] = result.first->second;
+    /* Pick a specialized key implementation for the most common sizes */
+    switch(data.size()[1]) {
+        case 12: return removeDuplicatesIntoImplementation(FixedSizeKey<12>{}, data, indices, executor, executorUserData);
+        case 16: return removeDuplicatesIntoImplementation(FixedSizeKey<16>{}, data, indices, executor, executorUserData);
+        case 24: return removeDuplicatesIntoImplementation(FixedSizeKey<24>{}, data, indices, executor, executorUserData);
+        case 32: return removeDuplicatesIntoImplementation(FixedSizeKey<32>{}, data, indices, executor, executorUserData);
     }
-
-    CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
-    return table.size();
+    return removeDuplicatesIntoImplementation(RuntimeSizeKey{data.size()[1]}, data, indices, executor, executorUserData);
 }
 
 std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data) {
+    return removeDuplicates(data, nullptr, nullptr);
+}
+
+std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data, const TaskExecutor executor, void* const executorUserData) {
     Containers::Array<UnsignedInt> indices{Containers::NoInit, data.size()[0]};
-    const std::size_t size = removeDuplicatesInto(data, indices);
+    const std::size_t size = removeDuplicatesInto(data, indices, executor, executorUserData);
     return {std::move(indices), size};
 }
 
 std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    return removeDuplicatesInPlaceInto(data, indices, nullptr, nullptr);
+}
+
+std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const TaskExecutor executor, void* const executorUserData) {
     /* Assuming the second dimension is contiguous so we can calculate the
        hashes easily */
     CORRADE_ASSERT(data.empty()[0] || data.isContiguous<1>(),
@@ -113,57 +489,35 @@ std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<cha
     CORRADE_ASSERT(indices.size() == dataSize,
         "MeshTools::removeDuplicatesInPlaceInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
-    /* Table containing index of first occurence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
-       unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
-
-    /* Go through all entries and insert them into the table. Because the keys
-       have runtime size, the table doesn't store a copy of the keys, only a
-       reference. The reference is to the original data that we mutate
-       in-place, so extra care needs to be taken to prevent already-inserted
-       keys from getting modified. */
-    for(std::size_t i = 0; i != dataSize; ++i) {
-        /* First copy the key data to a potentially final no-longer-mutable
-           place (except if the source and target location is the same). Data
-           in [table.size()-1, i) is already present in the [0, table.size()-1)
-           range from previous iterations so we aren't overwriting anything. If
-           insertion succeeds, this location will not be touched ever again; if
-           it fails the location isn't used as a key anywhere and so it can be
-           reused next time for a different key.
-
-           Alternatively we could first call find() and only then conditionally
-           do a copy() and emplace(), but that means the hash & search would be
-           performed twice, which is never faster than a plain memory copy. */
-        const Containers::ArrayView<char> dst = data[table.size()].asContiguous();
-        if(i != table.size())
-            Utility::copy(data[i].asContiguous(), dst);
-
-        /* Insert the new entry into the table. If it succeeds, dst is
-           guaranteed to not change anymore. */
-        const auto result = table.emplace(dst, table.size());
-
-        /* Put the (either new or already existing) index into the output index
-           array */
-        indices[i] = result.first->second;
+    /* Pick a specialized key implementation for the most common sizes */
+    switch(data.size()[1]) {
+        case 12: return removeDuplicatesInPlaceIntoImplementation(FixedSizeKey<12>{}, data, indices, executor, executorUserData);
+        case 16: return removeDuplicatesInPlaceIntoImplementation(FixedSizeKey<16>{}, data, indices, executor, executorUserData);
+        case 24: return removeDuplicatesInPlaceIntoImplementation(FixedSizeKey<24>{}, data, indices, executor, executorUserData);
+        case 32: return removeDuplicatesInPlaceIntoImplementation(FixedSizeKey<32>{}, data, indices, executor, executorUserData);
     }
-
-    CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
-    return table.size();
+    return removeDuplicatesInPlaceIntoImplementation(RuntimeSizeKey{data.size()[1]}, data, indices, executor, executorUserData);
 }
 
 std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>& data) {
+    return removeDuplicatesInPlace(data, nullptr, nullptr);
+}
+
+std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>& data, const TaskExecutor executor, void* const executorUserData) {
     Containers::Array<UnsignedInt> indices{Containers::NoInit, data.size()[0]};
-    const std::size_t size = removeDuplicatesInPlaceInto(data, indices);
+    const std::size_t size = removeDuplicatesInPlaceInto(data, indices, executor, executorUserData);
     return {std::move(indices), size};
 }
 
 namespace {
 
-template<class IndexType> std::size_t removeDuplicatesIndexedInPlaceImplementation(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<char>& data) {
+template<class IndexType> struct RemapIndicesParallelState {
+    UnsignedInt taskCount;
+    Containers::StridedArrayView1D<IndexType> indices;
+    Containers::ArrayView<const UnsignedInt> remapping;
+};
+
+template<class IndexType> std::size_t removeDuplicatesIndexedInPlaceImplementation(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<char>& data, const TaskExecutor executor, void* const executorUserData) {
     /* Somehow ~IndexType{} doesn't work for < 4byte types, as the result is
        int(-1) instead of the type I want */
     CORRADE_ASSERT(data.size()[0] <= IndexType(-1),
@@ -174,84 +528,85 @@ template<class IndexType> std::size_t removeDuplicatesIndexedInPlaceImplementati
        original order, which is an useful property. The float version has this
        inverted (having the *Indexed() variant as the main implementation)
        because the remapping there has to be done once for every dimension. */
-    std::pair<Containers::Array<UnsignedInt>, std::size_t> result = removeDuplicatesInPlace(data);
-    for(auto& i: indices) i = result.first[i];
+    std::pair<Containers::Array<UnsignedInt>, std::size_t> result = removeDuplicatesInPlace(data, executor, executorUserData);
+    if(!executor) {
+        for(auto& i: indices) i = result.first[i];
+    } else {
+        typedef RemapIndicesParallelState<IndexType> State;
+        State state{Implementation::parallelTaskCount(indices.size()), indices, result.first};
+        executor(state.taskCount, [](const UnsignedInt id, void* const statePointer) {
+            State& state = *static_cast<State*>(statePointer);
+            for(std::size_t i = Implementation::taskRangeBegin(state.indices.size(), state.taskCount, id), end = Implementation::taskRangeBegin(state.indices.size(), state.taskCount, id + 1); i != end; ++i)
+                state.indices[i] = state.remapping[state.indices[i]];
+        }, &state, executorUserData);
+    }
     return result.second;
 }
 
+std::size_t removeDuplicatesIndexedInPlaceErasedImplementation(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data, const TaskExecutor executor, void* const executorUserData) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::removeDuplicatesIndexedInPlace(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return removeDuplicatesIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), data, executor, executorUserData);
+    else if(indices.size()[1] == 2)
+        return removeDuplicatesIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), data, executor, executorUserData);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::removeDuplicatesIndexedInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return removeDuplicatesIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), data, executor, executorUserData);
+    }
+}
+
 }
 
 std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data) {
-    return removeDuplicatesIndexedInPlaceImplementation(indices, data);
+    return removeDuplicatesIndexedInPlaceImplementation(indices, data, nullptr, nullptr);
 }
 
 std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data) {
-    return removeDuplicatesIndexedInPlaceImplementation(indices, data);
+    return removeDuplicatesIndexedInPlaceImplementation(indices, data, nullptr, nullptr);
 }
 
 std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data) {
-    return removeDuplicatesIndexedInPlaceImplementation(indices, data);
+    return removeDuplicatesIndexedInPlaceImplementation(indices, data, nullptr, nullptr);
 }
 
 std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data) {
-    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::removeDuplicatesIndexedInPlace(): second index view dimension is not contiguous", {});
-    if(indices.size()[1] == 4)
-        return removeDuplicatesIndexedInPlace(Containers::arrayCast<1, UnsignedInt>(indices), data);
-    else if(indices.size()[1] == 2)
-        return removeDuplicatesIndexedInPlace(Containers::arrayCast<1, UnsignedShort>(indices), data);
-    else {
-        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::removeDuplicatesIndexedInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
-        return removeDuplicatesIndexedInPlace(Containers::arrayCast<1, UnsignedByte>(indices), data);
-    }
+    return removeDuplicatesIndexedInPlaceErasedImplementation(indices, data, nullptr, nullptr);
 }
 
-namespace {
+std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data, const TaskExecutor executor, void* const executorUserData) {
+    return removeDuplicatesIndexedInPlaceImplementation(indices, data, executor, executorUserData);
+}
 
-template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<T>& data, T epsilon) {
-    /* Compared to the discrete version, we don't require the second dimension
-       to be contiguous, as we calculate the hash from a discretized contiguous
-       copy */
+std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data, const TaskExecutor executor, void* const executorUserData) {
+    return removeDuplicatesIndexedInPlaceImplementation(indices, data, executor, executorUserData);
+}
 
-    /* Somehow ~IndexType{} doesn't work for < 4byte types, as the result is
-       int(-1) instead of the type I want */
-    CORRADE_ASSERT(data.size()[0] <= IndexType(-1),
-        "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): a" << sizeof(IndexType) << Debug::nospace << "-byte index type is too small for" << data.size()[0] << "vertices", {});
+std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data, const TaskExecutor executor, void* const executorUserData) {
+    return removeDuplicatesIndexedInPlaceImplementation(indices, data, executor, executorUserData);
+}
 
-    /* Get bounds across all dimensions. When NaNs appear, those will get
-       collapsed together when you're lucky, or cause the whole data to
-       disappear when you're not -- it needs a much more specialized handling
-       to be robust. */
-    const std::size_t vectorSize = data.size()[1];
-    T range = T(0.0);
-    Containers::Array<T> offsets{Containers::NoInit, vectorSize};
-    {
-        /** @todo this isn't really cache-efficient, do differently */
-        std::size_t i = 0;
-        for(Containers::StridedArrayView1D<T> dimension: data.template transposed<0, 1>()) {
-            const Math::Range1D<T> minmax = Math::minmax(dimension);
-            range = Math::max(minmax.size(), range);
-            offsets[i++] = minmax.min();
-        }
-    }
+std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data, const TaskExecutor executor, void* const executorUserData) {
+    return removeDuplicatesIndexedInPlaceErasedImplementation(indices, data, executor, executorUserData);
+}
 
-    /* Make epsilon so large that std::size_t can index all vectors inside the
-       bounds. */
-    epsilon = Math::max(epsilon, range/T(~std::size_t{}));
+namespace {
 
-    /* Table containing original vector index for each discretized vector.
-       Reserving more buckets than necessary (i.e. as if each vector was
-       unique). */
+template<class Key, class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPlacePasses(const Key& key, const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<T>& data, const Containers::ArrayView<T> offsets, const T epsilon) {
+    const std::size_t vectorSize = data.size()[1];
     std::size_t dataSize = data.size()[0];
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]*sizeof(std::size_t)},
-        ArrayEqual{data.size()[1]*sizeof(std::size_t)}};
 
     /* Index array that'll be filled in each pass and then used for remapping
-       the `indices`; discretized storage for all map keys. */
+       the `indices`; discretized storage for all table keys. */
     Containers::Array<UnsignedInt> remapping{Containers::NoInit, dataSize};
     Containers::Array<std::size_t> discretized{Containers::NoInit, dataSize*vectorSize};
 
+    /* Table containing index of each unique discretized vector. The
+       discretized keys are stored in a compacted way, i.e. key of the n-th
+       unique vector is at the n-th position in the `discretized` array, which
+       means the index of the key in the table is also the index of the
+       vector in the new data array that has all duplicates removed. */
+    OpenAddressingTable<Key> table{key, reinterpret_cast<const char*>(discretized.data()), std::ptrdiff_t(vectorSize*sizeof(std::size_t)), dataSize};
+
     /* First go with original coordinates, then move them by epsilon/2 in each
        dimension. */
     T moveAmount = T(0.0);
@@ -259,9 +614,12 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
         for(std::size_t i = 0; i != dataSize; ++i) {
             /* Take the original vector and discretize it -- append the move
                amount to given dimension, subtract the minmal offset and divide
-               by epsilon. */
+               by epsilon. The discretized vector is put right after the
+               already inserted keys, if it turns out to be a duplicate, the
+               location gets reused in the next iteration. */
+            const std::size_t size = table.size();
             const Containers::StridedArrayView1D<T> entry = data[i];
-            const Containers::ArrayView<std::size_t> discretizedEntry = discretized.slice(i*vectorSize, (i + 1)*vectorSize);
+            const Containers::ArrayView<std::size_t> discretizedEntry = discretized.slice(size*vectorSize, (size + 1)*vectorSize);
             for(std::size_t vi = 0; vi != vectorSize; ++vi) {
                 T c = entry[vi];
                 /* In iteration `0` we're not moving in any dimension, in
@@ -271,22 +629,20 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
                 discretizedEntry[vi] = (c - offsets[vi])/epsilon;
             }
 
-            /* Try to insert new entry into the table. The inserted index
-               points into the new data array that has all duplicates removed.
-               This is a similar workflow to removeDuplicatesInPlaceInto() with
-               the only difference that we're remapping an existing index array
-               several times over instead of creating a new one */
-            const auto result = table.emplace(discretizedEntry, table.size());
-
-            /* Add the (either new or already existing) index into the array */
-            remapping[i] = result.first->second;
+            /* Try to insert new entry into the table and add the (either new
+               or already existing) index into the array. This is a similar
+               workflow to removeDuplicatesInPlaceInto() with the only
+               difference that we're remapping an existing index array several
+               times over instead of creating a new one. */
+            const UnsignedInt index = table.insert(UnsignedInt(size));
+            remapping[i] = index;
 
             /* If this is a new combination, copy the data to new (earlier)
-               position in the array. Data in [table.size()-1, i) are already
-               present in the [0, table.size()-1) range from previous
-               iterations so we aren't overwriting anything. */
-            if(result.second && i != table.size() - 1)
-                Utility::copy(entry, data[table.size() - 1]);
+               position in the array. Data in [size, i) are already present in
+               the [0, size) range from previous iterations so we aren't
+               overwriting anything. */
+            if(index == size && i != size)
+                Utility::copy(entry, data[size]);
         }
 
         /* Remap the resulting index array */
@@ -306,35 +662,167 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
     return dataSize;
 }
 
+template<class Key, class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceGrid(const Key& key, const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<T>& data, const Containers::ArrayView<T> offsets, const T epsilon) {
+    const std::size_t vectorSize = data.size()[1];
+    const std::size_t dataSize = data.size()[0];
+
+    /* Index array that'll be filled and then used for remapping the
+       `indices`; grid cell coordinates of each unique vector, with one extra
+       item at the end for neighbor cell lookup. */
+    Containers::Array<UnsignedInt> remapping{Containers::NoInit, dataSize};
+    Containers::Array<std::size_t> cells{Containers::NoInit, (dataSize + 1)*vectorSize};
+    const Containers::ArrayView<std::size_t> neighbor = cells.suffix(dataSize*vectorSize);
+
+    /* Table containing index of a unique vector for each grid cell. Similarly
+       to removeDuplicatesFuzzyIndexedInPlacePasses(), the cell coordinates are
+       stored in a compacted way, the index of a key in the table being also
+       the index of the vector in the new data array. As the cells have the
+       size of epsilon, any two vectors in the same cell are always closer
+       than epsilon, so each cell contains at most one unique vector. */
+    OpenAddressingTable<Key> table{key, reinterpret_cast<const char*>(cells.data()), std::ptrdiff_t(vectorSize*sizeof(std::size_t)), dataSize};
+
+    std::size_t neighborCount = 1;
+    for(std::size_t vi = 0; vi != vectorSize; ++vi) neighborCount *= 3;
+
+    for(std::size_t i = 0; i != dataSize; ++i) {
+        /* Calculate the cell the vector is in, put it right after the cells
+           of already inserted vectors. If it turns out to be a duplicate, the
+           location gets reused in the next iteration. */
+        const std::size_t size = table.size();
+        const Containers::StridedArrayView1D<T> entry = data[i];
+        const Containers::ArrayView<std::size_t> cell = cells.slice(size*vectorSize, (size + 1)*vectorSize);
+        for(std::size_t vi = 0; vi != vectorSize; ++vi)
+            cell[vi] = (entry[vi] - offsets[vi])/epsilon;
+
+        /* Look into the cell and all its neighbors, pick the earliest unique
+           vector that's not further than epsilon in any dimension. Cell
+           coordinates underflowing for the -1 neighbor will wrap around and
+           not be found in the table, which is fine. */
+        UnsignedInt found = OpenAddressingTable<Key>::Empty;
+        for(std::size_t n = 0; n != neighborCount; ++n) {
+            std::size_t id = n;
+            for(std::size_t vi = 0; vi != vectorSize; ++vi) {
+                neighbor[vi] = cell[vi] + id % 3 - 1;
+                id /= 3;
+            }
+
+            const UnsignedInt candidate = table.find(reinterpret_cast<const char*>(neighbor.data()));
+            if(candidate >= found) continue;
+
+            const Containers::StridedArrayView1D<T> unique = data[candidate];
+            bool close = true;
+            for(std::size_t vi = 0; vi != vectorSize; ++vi) {
+                if(Math::abs(entry[vi] - unique[vi]) > epsilon) {
+                    close = false;
+                    break;
+                }
+            }
+            if(close) found = candidate;
+        }
+
+        /* If nothing was found, insert the vector into the table. It's
+           possible that, due to rounding errors, the table already contains a
+           vector for the same cell that wasn't considered close enough, in
+           which case the vectors are treated as duplicates anyway. */
+        if(found == OpenAddressingTable<Key>::Empty) {
+            found = table.insert(UnsignedInt(size));
+
+            /* If this is a new vector, copy the data to new (earlier) position
+               in the array. Data in [size, i) are already present in the
+               [0, size) range from previous iterations so we aren't
+               overwriting anything. */
+            if(found == size && i != size)
+                Utility::copy(entry, data[size]);
+        }
+
+        remapping[i] = found;
+    }
+
+    /* Remap the resulting index array */
+    for(auto& i: indices) i = remapping[i];
+
+    CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
+    return table.size();
+}
+
+template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<T>& data, T epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    /* Compared to the discrete version, we don't require the second dimension
+       to be contiguous, as we calculate the hash from a discretized contiguous
+       copy */
+
+    /* Somehow ~IndexType{} doesn't work for < 4byte types, as the result is
+       int(-1) instead of the type I want */
+    CORRADE_ASSERT(data.size()[0] <= IndexType(-1),
+        "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): a" << sizeof(IndexType) << Debug::nospace << "-byte index type is too small for" << data.size()[0] << "vertices", {});
+    CORRADE_ASSERT(mode != RemoveDuplicatesFuzzyMode::Grid || data.size()[1] <= 4,
+        "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): grid mode supports at most four dimensions but got" << data.size()[1], {});
+
+    /* Get bounds across all dimensions. When NaNs appear, those will get
+       collapsed together when you're lucky, or cause the whole data to
+       disappear when you're not -- it needs a much more specialized handling
+       to be robust. */
+    const std::size_t vectorSize = data.size()[1];
+    T range = T(0.0);
+    Containers::Array<T> offsets{Containers::NoInit, vectorSize};
+    {
+        /** @todo this isn't really cache-efficient, do differently */
+        std::size_t i = 0;
+        for(Containers::StridedArrayView1D<T> dimension: data.template transposed<0, 1>()) {
+            const Math::Range1D<T> minmax = Math::minmax(dimension);
+            range = Math::max(minmax.size(), range);
+            offsets[i++] = minmax.min();
+        }
+    }
+
+    /* Make epsilon so large that std::size_t can index all vectors inside the
+       bounds. */
+    epsilon = Math::max(epsilon, range/T(~std::size_t{}));
+
+    /* Pick a specialized key implementation for the most common sizes */
+    if(mode == RemoveDuplicatesFuzzyMode::Grid) switch(vectorSize*sizeof(std::size_t)) {
+        case 12: return removeDuplicatesFuzzyIndexedInPlaceGrid(FixedSizeKey<12>{}, indices, data, Containers::arrayView(offsets), epsilon);
+        case 16: return removeDuplicatesFuzzyIndexedInPlaceGrid(FixedSizeKey<16>{}, indices, data, Containers::arrayView(offsets), epsilon);
+        case 24: return removeDuplicatesFuzzyIndexedInPlaceGrid(FixedSizeKey<24>{}, indices, data, Containers::arrayView(offsets), epsilon);
+        case 32: return removeDuplicatesFuzzyIndexedInPlaceGrid(FixedSizeKey<32>{}, indices, data, Containers::arrayView(offsets), epsilon);
+        default: return removeDuplicatesFuzzyIndexedInPlaceGrid(RuntimeSizeKey{vectorSize*sizeof(std::size_t)}, indices, data, Containers::arrayView(offsets), epsilon);
+    } else switch(vectorSize*sizeof(std::size_t)) {
+        case 12: return removeDuplicatesFuzzyIndexedInPlacePasses(FixedSizeKey<12>{}, indices, data, Containers::arrayView(offsets), epsilon);
+        case 16: return removeDuplicatesFuzzyIndexedInPlacePasses(FixedSizeKey<16>{}, indices, data, Containers::arrayView(offsets), epsilon);
+        case 24: return removeDuplicatesFuzzyIndexedInPlacePasses(FixedSizeKey<24>{}, indices, data, Containers::arrayView(offsets), epsilon);
+        case 32: return removeDuplicatesFuzzyIndexedInPlacePasses(FixedSizeKey<32>{}, indices, data, Containers::arrayView(offsets), epsilon);
+        default: return removeDuplicatesFuzzyIndexedInPlacePasses(RuntimeSizeKey{vectorSize*sizeof(std::size_t)}, indices, data, Containers::arrayView(offsets), epsilon);
+    }
 }
 
-std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
 }
 
-std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, mode);
 }
 
-std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, mode);
 }
 
-std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, mode);
 }
 
-std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, mode);
 }
 
-std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, mode);
+}
+
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, mode);
 }
 
 namespace {
 
-template<class T> std::size_t removeDuplicatesFuzzyInPlaceIntoImplementation(const Containers::StridedArrayView2D<T>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const T epsilon) {
+template<class T> std::size_t removeDuplicatesFuzzyInPlaceIntoImplementation(const Containers::StridedArrayView2D<T>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const T epsilon, const RemoveDuplicatesFuzzyMode mode) {
     CORRADE_ASSERT(indices.size() == data.size()[0],
         "MeshTools::removeDuplicatesFuzzyInPlaceInto(): output index array has" << indices.size() << "elements but expected" << data.size()[0], {});
 
@@ -344,66 +832,89 @@ template<class T> std::size_t removeDuplicatesFuzzyInPlaceIntoImplementation(con
     UnsignedInt i = 0;
     for(UnsignedInt& index: indices) index = i++;
 
-    const std::size_t size = removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::stridedArrayView(indices), data, epsilon);
+    const std::size_t size = removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::stridedArrayView(indices), data, epsilon, mode);
     return size;
 }
 
-template<class T> std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlaceImplementation(const Containers::StridedArrayView2D<T>& data, const T epsilon) {
+template<class T> std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlaceImplementation(const Containers::StridedArrayView2D<T>& data, const T epsilon, const RemoveDuplicatesFuzzyMode mode) {
     Containers::Array<UnsignedInt> indices{Containers::NoInit, data.size()[0]};
-    const std::size_t size = removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon);
+    const std::size_t size = removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon, mode);
     return {std::move(indices), size};
 }
 
 }
 
-std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyInPlaceImplementation(data, epsilon);
+std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>& data, const Float epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    return removeDuplicatesFuzzyInPlaceImplementation(data, epsilon, mode);
 }
 
-std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyInPlaceImplementation(data, epsilon);
+std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Double>& data, const Double epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    return removeDuplicatesFuzzyInPlaceImplementation(data, epsilon, mode);
 }
 
-std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Float epsilon) {
-    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon);
+std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Float epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon, mode);
 }
 
-std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Double epsilon) {
-    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon);
+std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Double epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    return removeDuplicatesFuzzyInPlaceIntoImplementation(data, indices, epsilon, mode);
 }
 
 namespace {
 
-template<class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<T>& data, const T epsilon) {
+template<class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<T>& data, const T epsilon, const RemoveDuplicatesFuzzyMode mode) {
     CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): second index view dimension is not contiguous", {});
     if(indices.size()[1] == 4)
-        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), data, epsilon);
+        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), data, epsilon, mode);
     else if(indices.size()[1] == 2)
-        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), data, epsilon);
+        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), data, epsilon, mode);
     else {
         CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
-        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), data, epsilon);
+        return removeDuplicatesFuzzyIndexedInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), data, epsilon, mode);
     }
 }
 
 }
 
-std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Float>& data, const Float epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, mode);
 }
 
-std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
-    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon);
+std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Double>& data, const Double epsilon, const RemoveDuplicatesFuzzyMode mode) {
+    return removeDuplicatesFuzzyIndexedInPlaceImplementation(indices, data, epsilon, mode);
+}
+
+Debug& operator<<(Debug& debug, const RemoveDuplicatesFuzzyMode value) {
+    debug << "MeshTools::RemoveDuplicatesFuzzyMode" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case RemoveDuplicatesFuzzyMode::v: return debug << "::" #v;
+        _c(Discretized)
+        _c(Grid)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
 }
 
 Trade::MeshData removeDuplicates(const Trade::MeshData& data) {
+    return removeDuplicates(data, nullptr, nullptr);
+}
+
+Trade::MeshData removeDuplicates(const Trade::MeshData& data, const TaskExecutor executor, void* const executorUserData) {
     return removeDuplicates(Trade::MeshData{data.primitive(),
         {}, data.indexData(), Trade::MeshIndexData{data.indices()},
         {}, data.vertexData(), Trade::meshAttributeDataNonOwningArray(data.attributeData()),
-        data.vertexCount()});
+        data.vertexCount()}, executor, executorUserData);
 }
 
 Trade::MeshData removeDuplicates(Trade::MeshData&& data) {
+    return removeDuplicates(std::move(data), nullptr, nullptr);
+}
+
+Trade::MeshData removeDuplicates(Trade::MeshData&& data, const TaskExecutor executor, void* const executorUserData) {
     CORRADE_ASSERT(data.attributeCount(),
         "MeshTools::removeDuplicates(): can't remove duplicates in an attributeless mesh",
         (Trade::MeshData{MeshPrimitive::Points, 0}));
@@ -421,12 +932,12 @@ Trade::MeshData removeDuplicates(Trade::MeshData&& data) {
     Containers::Array<char> indexData;
     MeshIndexType indexType;
     if(ownedInterleaved.isIndexed()) {
-        uniqueVertexCount = removeDuplicatesIndexedInPlace(ownedInterleaved.mutableIndices(), vertexData);
+        uniqueVertexCount = removeDuplicatesIndexedInPlace(ownedInterleaved.mutableIndices(), vertexData, executor, executorUserData);
         indexData = ownedInterleaved.releaseIndexData();
         indexType = ownedInterleaved.indexType();
     } else {
         indexData = Containers::Array<char>{Containers::NoInit, ownedInterleaved.vertexCount()*sizeof(UnsignedInt)};
-        uniqueVertexCount = removeDuplicatesInPlaceInto(vertexData, Containers::arrayCast<UnsignedInt>(indexData));
+        uniqueVertexCount = removeDuplicatesInPlaceInto(vertexData, Containers::arrayCast<UnsignedInt>(indexData), executor, executorUserData);
         indexType = MeshIndexType::UnsignedInt;
     }
 
@@ -457,7 +968,7 @@ Trade::MeshData removeDuplicates(Trade::MeshData&& data) {
         uniqueVertexCount};
 }
 
-Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& data, const Float floatEpsilon, const Double doubleEpsilon) {
+Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& data, const Float floatEpsilon, const Double doubleEpsilon, const RemoveDuplicatesFuzzyMode mode) {
     CORRADE_ASSERT(data.attributeCount(),
         "MeshTools::removeDuplicatesFuzzy(): can't remove duplicates in an attributeless mesh",
         (Trade::MeshData{MeshPrimitive::Points, 0}));
@@ -538,7 +1049,9 @@ Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& data, const Float f
                 attributeEpsilon = floatEpsilon*range;
             }
 
-            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, outputIndices, attributeEpsilon);
+            /* The grid mode has exponential cost with dimension count, so
+               use it only for attributes it supports */
+            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, outputIndices, attributeEpsilon, attribute.size()[1] <= 4 ? mode : RemoveDuplicatesFuzzyMode::Discretized);
 
         /* Doubles. No builtin attributes support those at the moment, so
            there's just the epsilon scaling based on attribute value range */
@@ -549,7 +1062,7 @@ Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& data, const Float f
             for(Containers::StridedArrayView1D<const Double> component: attribute.transposed<0, 1>())
                 range = Math::max(Range1Dd{Math::minmax(component)}.size(), range);
 
-            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, outputIndices, doubleEpsilon*range);
+            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, outputIndices, doubleEpsilon*range, attribute.size()[1] <= 4 ? mode : RemoveDuplicatesFuzzyMode::Discretized);
 
         /* Other attributes (integer, packed, half floats). No fuzzy
            comparison */
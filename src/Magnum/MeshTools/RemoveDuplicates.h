@@ -26,12 +26,13 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::removeDuplicatesInPlace(), @ref Magnum::MeshTools::removeDuplicatesIndexedInPlace()
+ * @brief Function @ref Magnum::MeshTools::removeDuplicatesInPlace(), @ref Magnum::MeshTools::removeDuplicatesIndexedInPlace(), enum @ref Magnum::MeshTools::RemoveDuplicatesFuzzyMode
  */
 
 #include <utility>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/TaskExecutor.h"
 #include "Magnum/Math/TypeTraits.h"
 #include "Magnum/MeshTools/visibility.h"
 #include "Magnum/Trade/Trade.h"
@@ -44,6 +45,44 @@
 
 namespace Magnum { namespace MeshTools {
 
+/**
+@brief Fuzzy duplicate removal mode
+@m_since_latest
+
+@see @ref removeDuplicatesFuzzyInPlace(),
+    @ref removeDuplicatesFuzzyIndexedInPlace(),
+    @ref removeDuplicatesFuzzy()
+*/
+enum class RemoveDuplicatesFuzzyMode: UnsignedByte {
+    /**
+     * Collapse the data into buckets of size @p epsilon. This is done once
+     * with the original data and then once for every dimension with the data
+     * shifted by half of @p epsilon in given dimension, to merge also data
+     * that fell into neighboring buckets. The first vector in given bucket is
+     * used, other ones are thrown away. The cost is linear in the data size,
+     * but the data is processed once more for each dimension.
+     */
+    Discretized,
+
+    /**
+     * Put the data into a uniform grid with cells of size @p epsilon and
+     * compare each vector with unique data in its cell and all neighbor
+     * cells. The vector is then merged with the earliest one that's not
+     * further than @p epsilon in any dimension. The data is processed just
+     * once and the cost is linear in the data size, but with @f$ 3^d @f$
+     * cell lookups for each vector. Supports at most four dimensions, which
+     * makes it suitable especially for positions in large spread-out point
+     * clouds.
+     */
+    Grid
+};
+
+/**
+@debugoperatorenum{RemoveDuplicatesFuzzyMode}
+@m_since_latest
+*/
+MAGNUM_MESHTOOLS_EXPORT Debug& operator<<(Debug& debug, RemoveDuplicatesFuzzyMode value);
+
 /**
 @brief Remove duplicate data from given array in-place
 @param[in,out] data Data array, duplicate items will be cut away with order
@@ -70,6 +109,21 @@ an index array pointing to original data locations.
 */
 MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>& data);
 
+/**
+@brief Remove duplicate data from given array in-place using a parallel task executor
+@m_since_latest
+
+Same as @ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&),
+but with the work distributed across tasks dispatched via @p executor, which
+gets passed @p executorUserData. The items are first split into partitions
+based on their hash, then duplicates are removed in each partition
+independently and the unique items are compacted, which is the only step done
+serially. The output is always the same as with the serial variant. If
+@p executor is @cpp nullptr @ce, the serial variant is used.
+@see @ref removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<UnsignedInt>&, TaskExecutor, void*)
+*/
+MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>& data, TaskExecutor executor, void* executorUserData = nullptr);
+
 /**
 @brief Remove duplicate data from given array in-place into given output index array
 @param[in,out] data     Data array, duplicate items will be cut away with order
@@ -84,6 +138,16 @@ Same as above, except that the index array is not allocated but put into
 */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices);
 
+/**
+@brief Remove duplicate data from given array in-place into given output index array using a parallel task executor
+@m_since_latest
+
+Same as @ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&, TaskExecutor, void*),
+except that the index array is not allocated but put into @p indices instead.
+Expects that @p indices has the same size as @p data.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, TaskExecutor executor, void* executorUserData = nullptr);
+
 /**
 @brief Remove duplicate data from given array
 @param[in] data     Data array
@@ -97,6 +161,19 @@ returns an index array pointing to original data locations.
 */
 MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data);
 
+/**
+@brief Remove duplicate data from given array using a parallel task executor
+@m_since_latest
+
+Same as @ref removeDuplicates(const Containers::StridedArrayView2D<const char>&),
+but with the work distributed across tasks dispatched via @p executor, which
+gets passed @p executorUserData. The items are first split into partitions
+based on their hash and then duplicates are removed in each partition
+independently. The output is always the same as with the serial variant. If
+@p executor is @cpp nullptr @ce, the serial variant is used.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data, TaskExecutor executor, void* executorUserData = nullptr);
+
 /**
 @brief Remove duplicate data from given array into given output index array
 @param[in]  data    Data array
@@ -110,6 +187,16 @@ makes an index array pointing to original data locations.
 */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices);
 
+/**
+@brief Remove duplicate data from given array into given output index array using a parallel task executor
+@m_since_latest
+
+Same as @ref removeDuplicates(const Containers::StridedArrayView2D<const char>&, TaskExecutor, void*),
+except that the index array is not allocated but put into @p indices instead.
+Expects that @p indices has the same size as @p data.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, TaskExecutor executor, void* executorUserData = nullptr);
+
 /**
 @brief Remove duplicates from indexed data in-place
 @param[in,out] indices  Index array, which will get remapped to list just
@@ -148,38 +235,74 @@ etc. overloads.
 */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data);
 
+/**
+@brief Remove duplicates from indexed data in-place using a parallel task executor
+@m_since_latest
+
+Same as @ref removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<char>&),
+but with the work distributed across tasks dispatched via @p executor, which
+gets passed @p executorUserData. See
+@ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&, TaskExecutor, void*)
+for more information.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data, TaskExecutor executor, void* executorUserData = nullptr);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data, TaskExecutor executor, void* executorUserData = nullptr);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data, TaskExecutor executor, void* executorUserData = nullptr);
+
+/**
+@brief Remove duplicates from indexed data in-place on a type-erased index array using a parallel task executor
+@m_since_latest
+
+Same as @ref removeDuplicatesIndexedInPlace(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView2D<char>&),
+but with the work distributed across tasks dispatched via @p executor.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data, TaskExecutor executor, void* executorUserData = nullptr);
+
 /**
 @brief Remove duplicate data from given array using fuzzy comparison in-place
 @param[in,out] data Data array, duplicate items will be cut away with order
     preserved
 @param[in] epsilon  Epsilon value, data closer than this distance will be
     melt together
+@param[in] mode     Duplicate removal mode
 @return Size of unique prefix in the cleaned up @p data array and the resulting
     index array
 @m_since{2020,06}
 
 Removes duplicate data from the array by collapsing them into buckets of size
 @p epsilon. First vector in given bucket is used, other ones are thrown away,
-no interpolation is done. Note that this function is meant to be used for
+no interpolation is done. See @ref RemoveDuplicatesFuzzyMode for a description
+of available algorithms, the @p mode parameter was added in
+@m_class{m-label m-info} **since latest**. Note that this function is meant to be used for
 floating-point data (or generally with non-zero @p epsilon), for data where
 bit-exact matching is sufficient use @ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&)
 instead.
 
 If you want to remove duplicate data from an already indexed array, use
-@ref removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<Float>&, Float)
+@ref removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<Float>&, Float, RemoveDuplicatesFuzzyMode)
 and friends instead.
 
 If you want to remove duplicates in multiple incidental arrays, first remove
 duplicates in each array separately and then combine the resulting index arrays
 back into a single one using @ref combineIndexedAttributes().
 */
-MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 /**
  * @overload
  * @m_since{2020,06}
  */
-MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 /**
 @brief Remove duplicate data from given array using fuzzy comparison in-place into given output index array
@@ -194,13 +317,13 @@ MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedInt>, std::size_t> r
 Same as above, except that the index array is not allocated but put into
 @p indices instead. Expects that @p indices has the same size as @p data.
 */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Float epsilon = Math::TypeTraits<Float>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Float epsilon = Math::TypeTraits<Float>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 /**
  * @overload
  * @m_since{2020,06}
  */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Double epsilon = Math::TypeTraits<Double>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Double epsilon = Math::TypeTraits<Double>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
@@ -235,41 +358,41 @@ template<class Vector> CORRADE_DEPRECATED("use removeDuplicatesInPlace() instead
 @return Size of unique prefix in the cleaned up @p data array
 @m_since{2020,06}
 
-Compared to @ref removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>&, Float)
+Compared to @ref removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>&, Float, RemoveDuplicatesFuzzyMode)
 this variant is more suited for data that is already indexed as it works on
 the existing index array instead of allocating a new one.
 */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 /**
  * @overload
  * @m_since{2020,06}
  */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 /**
  * @overload
  * @m_since{2020,06}
  */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 /**
  * @overload
  * @m_since{2020,06}
  */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 /**
  * @overload
  * @m_since{2020,06}
  */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 /**
  * @overload
  * @m_since{2020,06}
  */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 /**
 @brief Remove duplicates from indexed data using fuzzy comparison in-place on a type-erased index array
@@ -277,16 +400,16 @@ MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Co
 
 Expects that the second dimension of @p indices is contiguous and represents
 the actual 1/2/4-byte index type. Based on its size then calls
-@ref removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<Float>&, Float)
+@ref removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<Float>&, Float, RemoveDuplicatesFuzzyMode)
 or the other overloads.
 */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 /**
  * @overload
  * @m_since{2020,06}
  */
-MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 /**
 @brief Remove mesh data duplicates
@@ -318,6 +441,28 @@ data.
 */
 MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicates(Trade::MeshData&& data);
 
+/**
+@brief Remove mesh data duplicates using a parallel task executor
+@m_since_latest
+
+Same as @ref removeDuplicates(const Trade::MeshData&), but using
+@ref removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<UnsignedInt>&, TaskExecutor, void*)
+or @ref removeDuplicatesIndexedInPlace(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView2D<char>&, TaskExecutor, void*)
+with @p executor and @p executorUserData passed through. The output is always
+the same as with the serial variant.
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicates(const Trade::MeshData& data, TaskExecutor executor, void* executorUserData = nullptr);
+
+/**
+@brief Remove mesh data duplicates using a parallel task executor
+@m_since_latest
+
+Same as @ref removeDuplicates(const Trade::MeshData&, TaskExecutor, void*),
+except that it operates in-place on the passed instance, avoiding an extra copy
+of vertex and index data.
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicates(Trade::MeshData&& data, TaskExecutor executor, void* executorUserData = nullptr);
+
 /**
 @brief Remove mesh data duplicates with fuzzy comparison for floating-point attributes
 @m_since{2020,06}
@@ -327,9 +472,11 @@ Compared to @ref removeDuplicates(const Trade::MeshData&), calls
 on floating-point attributes. For attributes with a known range (such as
 @ref Trade::MeshAttribute::Normal being always @f$ [-1, 1] @f$ in each
 direction) the @p floatEpsilon / @p doubleEpsilon is scaled appropriately,
-otherwise it's scaled to calculated value range.
+otherwise it's scaled to calculated value range. The @p mode is used for all
+attributes with at most four components, attributes with more components
+always use @ref RemoveDuplicatesFuzzyMode::Discretized.
 */
-MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& data, Float floatEpsilon = Math::TypeTraits<Float>::epsilon(), Double doubleEpsilon = Math::TypeTraits<Double>::epsilon());
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& data, Float floatEpsilon = Math::TypeTraits<Float>::epsilon(), Double doubleEpsilon = Math::TypeTraits<Double>::epsilon(), RemoveDuplicatesFuzzyMode mode = RemoveDuplicatesFuzzyMode::Discretized);
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon) {
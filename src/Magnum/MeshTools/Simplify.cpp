@@ -0,0 +1,519 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simplify.h"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/OptimizeVertexFetch.h"
+#include "Magnum/MeshTools/Reference.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Symmetric 4x4 quadric matrix, stored as the upper triangle of the 3x3 part,
+   the linear part and the constant. The weight is accumulated separately so
+   the error can be normalized to a mean squared distance. */
+struct Quadric {
+    Float a00, a01, a02, a11, a12, a22;
+    Float b0, b1, b2;
+    Float c;
+    Float w;
+};
+
+/* Quadric for a plane with a unit normal n, going through a point p */
+Quadric planeQuadric(const Vector3& n, const Vector3& p, const Float weight) {
+    const Float d = -Math::dot(n, p);
+    Quadric q;
+    q.a00 = weight*n.x()*n.x();
+    q.a01 = weight*n.x()*n.y();
+    q.a02 = weight*n.x()*n.z();
+    q.a11 = weight*n.y()*n.y();
+    q.a12 = weight*n.y()*n.z();
+    q.a22 = weight*n.z()*n.z();
+    q.b0 = weight*n.x()*d;
+    q.b1 = weight*n.y()*d;
+    q.b2 = weight*n.z()*d;
+    q.c = weight*d*d;
+    q.w = weight;
+    return q;
+}
+
+void addQuadric(Quadric& a, const Quadric& b) {
+    a.a00 += b.a00;
+    a.a01 += b.a01;
+    a.a02 += b.a02;
+    a.a11 += b.a11;
+    a.a12 += b.a12;
+    a.a22 += b.a22;
+    a.b0 += b.b0;
+    a.b1 += b.b1;
+    a.b2 += b.b2;
+    a.c += b.c;
+    a.w += b.w;
+}
+
+/* Weighted mean squared distance of p to planes accumulated in a + b */
+Float quadricError(const Quadric& a, const Quadric& b, const Vector3& p) {
+    Quadric q = a;
+    addQuadric(q, b);
+    const Float rx = q.a00*p.x() + q.a01*p.y() + q.a02*p.z();
+    const Float ry = q.a01*p.x() + q.a11*p.y() + q.a12*p.z();
+    const Float rz = q.a02*p.x() + q.a12*p.y() + q.a22*p.z();
+    const Float error = p.x()*rx + p.y()*ry + p.z()*rz +
+        2.0f*(q.b0*p.x() + q.b1*p.y() + q.b2*p.z()) + q.c;
+    return q.w > 0.0f ? std::abs(error)/q.w : 0.0f;
+}
+
+/* Border edges are preserved by adding a plane perpendicular to the triangle
+   going through the edge, with a large weight */
+constexpr Float BorderWeight = 10.0f;
+
+/* Topological classification of a position. Vertices at the same position
+   with differing attributes (i.e., a seam) are never moved and nothing gets
+   collapsed onto them, so all vertices that participate in a collapse have
+   exactly one wedge and positions can be used interchangeably with vertex
+   indices for them. */
+enum class VertexKind: UnsignedByte {
+    Manifold,
+    Border,
+    Seam,
+    Locked
+};
+
+struct Collapse {
+    UnsignedInt from, to;
+    Float error;
+};
+
+/* Classifies positions referenced by the mesh and marks open half-edges.
+   Half-edges are identified by a pair of positions so seams don't appear as
+   borders. */
+void classify(const Containers::ArrayView<const UnsignedInt> indices, const Containers::ArrayView<const UnsignedInt> positionIds, const Containers::ArrayView<VertexKind> kinds, const Containers::ArrayView<bool> openEdges, const Containers::ArrayView<UnsignedInt> wedgeVertex) {
+    constexpr UnsignedInt NoVertex = ~UnsignedInt{};
+
+    /* Find positions that are referenced by more than one vertex */
+    for(UnsignedInt& i: wedgeVertex) i = NoVertex;
+    for(VertexKind& i: kinds) i = VertexKind::Manifold;
+    for(const UnsignedInt vertex: indices) {
+        const UnsignedInt position = positionIds[vertex];
+        if(wedgeVertex[position] == NoVertex)
+            wedgeVertex[position] = vertex;
+        else if(wedgeVertex[position] != vertex)
+            kinds[position] = VertexKind::Seam;
+    }
+
+    /* Sorted half-edges for looking up the opposite ones */
+    Containers::Array<UnsignedLong> halfEdges{Containers::NoInit, indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const std::size_t next = i - i%3 + (i + 1)%3;
+        halfEdges[i] = UnsignedLong(positionIds[indices[i]]) << 32 | positionIds[indices[next]];
+    }
+    std::sort(halfEdges.begin(), halfEdges.end());
+
+    /* Count open half-edges around each position, lock positions with a
+       non-manifold edge */
+    Containers::Array<UnsignedByte> openCount{Containers::ValueInit, kinds.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const std::size_t next = i - i%3 + (i + 1)%3;
+        const UnsignedInt a = positionIds[indices[i]];
+        const UnsignedInt b = positionIds[indices[next]];
+        const UnsignedLong edge = UnsignedLong(a) << 32 | b;
+        const UnsignedLong opposite = UnsignedLong(b) << 32 | a;
+
+        const std::pair<UnsignedLong*, UnsignedLong*> same = std::equal_range(halfEdges.begin(), halfEdges.end(), edge);
+        const std::pair<UnsignedLong*, UnsignedLong*> opposites = std::equal_range(halfEdges.begin(), halfEdges.end(), opposite);
+        if(same.second - same.first > 1 || opposites.second - opposites.first > 1) {
+            if(kinds[a] != VertexKind::Seam) kinds[a] = VertexKind::Locked;
+            if(kinds[b] != VertexKind::Seam) kinds[b] = VertexKind::Locked;
+        }
+
+        openEdges[i] = opposites.first == opposites.second;
+        if(openEdges[i]) {
+            if(openCount[a] != 0xff) ++openCount[a];
+            if(openCount[b] != 0xff) ++openCount[b];
+        }
+    }
+
+    /* A border vertex has exactly one incoming and one outgoing open edge,
+       anything else is too complex to be moved */
+    for(std::size_t i = 0; i != kinds.size(); ++i) {
+        if(!openCount[i] || kinds[i] != VertexKind::Manifold) continue;
+        kinds[i] = openCount[i] == 2 ? VertexKind::Border : VertexKind::Locked;
+    }
+}
+
+std::size_t simplifyImplementation(const Containers::ArrayView<UnsignedInt> indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError, Float* const resultError) {
+    if(indices.size() <= targetIndexCount) {
+        if(resultError) *resultError = 0.0f;
+        return indices.size();
+    }
+
+    const std::size_t vertexCount = positions.size();
+    Float maxError = 0.0f;
+
+    /* Group vertices with the same position */
+    Containers::Array<UnsignedInt> positionIds{Containers::NoInit, vertexCount};
+    const std::size_t positionCount = removeDuplicatesInto(Containers::arrayCast<2, const char>(positions), positionIds);
+
+    /* Normalize the positions to a unit cube so the error is relative to
+       mesh size */
+    const std::pair<Vector3, Vector3> minmax = Math::minmax(positions);
+    const Float extent = (minmax.second - minmax.first).max();
+    const Float scale = extent > 0.0f ? 1.0f/extent : 1.0f;
+    Containers::Array<Vector3> normalized{Containers::NoInit, positionCount};
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        normalized[positionIds[i]] = (positions[i] - minmax.first)*scale;
+
+    Containers::Array<VertexKind> kinds{Containers::NoInit, positionCount};
+    Containers::Array<bool> openEdges{Containers::NoInit, indices.size()};
+    Containers::Array<UnsignedInt> wedgeVertex{Containers::NoInit, positionCount};
+
+    /* Triangle plane quadrics and border edge quadrics. As nothing is ever
+       moved to a new position, these are calculated just once and then
+       merged on each collapse. */
+    classify(indices, positionIds, kinds, openEdges, wedgeVertex);
+    Containers::Array<Quadric> quadrics{Containers::ValueInit, positionCount};
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const UnsignedInt p[]{
+            positionIds[indices[i + 0]],
+            positionIds[indices[i + 1]],
+            positionIds[indices[i + 2]]
+        };
+        const Vector3 normal = Math::cross(normalized[p[1]] - normalized[p[0]], normalized[p[2]] - normalized[p[0]]);
+        const Float area = normal.length();
+        if(area == 0.0f) continue;
+        const Vector3 unitNormal = normal/area;
+
+        const Quadric plane = planeQuadric(unitNormal, normalized[p[0]], area);
+        for(const UnsignedInt j: p) addQuadric(quadrics[j], plane);
+
+        for(std::size_t j = 0; j != 3; ++j) {
+            if(!openEdges[i + j]) continue;
+            const UnsignedInt a = p[j];
+            const UnsignedInt b = p[(j + 1)%3];
+            const Vector3 edge = normalized[b] - normalized[a];
+            const Vector3 borderNormal = Math::cross(edge, unitNormal);
+            const Float borderNormalLength = borderNormal.length();
+            if(borderNormalLength == 0.0f) continue;
+            const Quadric border = planeQuadric(borderNormal/borderNormalLength, normalized[a], edge.dot()*BorderWeight);
+            addQuadric(quadrics[a], border);
+            addQuadric(quadrics[b], border);
+        }
+    }
+
+    Containers::Array<UnsignedInt> collapseTarget{Containers::NoInit, vertexCount};
+    Containers::Array<bool> locked{Containers::NoInit, vertexCount};
+    Containers::Array<UnsignedInt> marks{Containers::ValueInit, positionCount};
+    Containers::Array<UnsignedInt> visited{Containers::ValueInit, positionCount};
+    UnsignedInt mark = 0;
+    Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Containers::Array<Collapse> collapses;
+    const Float targetErrorSquared = targetError*targetError;
+    std::size_t indexCount = indices.size();
+    for(bool first = true; indexCount > targetIndexCount; first = false) {
+        const Containers::ArrayView<UnsignedInt> current = indices.prefix(indexCount);
+        if(!first) classify(current, positionIds, kinds, openEdges, wedgeVertex);
+
+        /* Gather collapse candidates in both directions of each edge. Interior
+           edges get added twice, which is harmless as the second one gets
+           rejected by the first one locking its vertices. */
+        arrayResize(collapses, 0);
+        for(std::size_t i = 0; i != indexCount; ++i) {
+            const std::size_t next = i - i%3 + (i + 1)%3;
+            const UnsignedInt edge[]{current[i], current[next]};
+            for(std::size_t j = 0; j != 2; ++j) {
+                const UnsignedInt from = edge[j];
+                const UnsignedInt to = edge[j ^ 1];
+                if(positionIds[from] == positionIds[to]) continue;
+
+                const VertexKind fromKind = kinds[positionIds[from]];
+                const VertexKind toKind = kinds[positionIds[to]];
+
+                /* Interior vertices can be collapsed onto anything that has
+                   a single wedge, border vertices only along the border */
+                if(toKind == VertexKind::Seam) continue;
+                if(fromKind != VertexKind::Manifold && !(fromKind == VertexKind::Border && toKind == VertexKind::Border && openEdges[i]))
+                    continue;
+
+                const Float error = quadricError(quadrics[positionIds[from]], quadrics[positionIds[to]], normalized[positionIds[to]]);
+                if(error > targetErrorSquared) continue;
+
+                arrayAppend(collapses, Collapse{from, to, error});
+            }
+        }
+        if(collapses.empty()) break;
+
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+            if(a.error != b.error) return a.error < b.error;
+            if(a.from != b.from) return a.from < b.from;
+            return a.to < b.to;
+        });
+
+        Implementation::buildAdjacency<UnsignedInt>(current, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+        for(std::size_t i = 0; i != vertexCount; ++i) {
+            collapseTarget[i] = i;
+            locked[i] = false;
+        }
+
+        /* Perform the cheapest collapses first. All vertices around a
+           collapsed edge get locked for the rest of the pass so the flip
+           checks stay valid. */
+        const std::size_t removeTriangleCount = (indexCount - targetIndexCount + 2)/3;
+        std::size_t removedTriangleCount = 0;
+        for(const Collapse& collapse: collapses) {
+            if(removedTriangleCount >= removeTriangleCount) break;
+            if(locked[collapse.from] || locked[collapse.to]) continue;
+
+            const UnsignedInt fromPosition = positionIds[collapse.from];
+            const UnsignedInt toPosition = positionIds[collapse.to];
+
+            /* Mark the one-ring of the target */
+            ++mark;
+            for(UnsignedInt j = neighborOffset[collapse.to]; j != neighborOffset[collapse.to + 1]; ++j)
+                for(std::size_t k = 0; k != 3; ++k)
+                    marks[positionIds[current[neighbors[j]*3 + k]]] = mark;
+
+            /* Check that no remaining triangle gets flipped, count the
+               removed triangles and the neighbors shared by both vertices */
+            bool valid = true;
+            std::size_t sharedTriangleCount = 0;
+            std::size_t sharedNeighborCount = 0;
+            for(UnsignedInt j = neighborOffset[collapse.from]; j != neighborOffset[collapse.from + 1]; ++j) {
+                const UnsignedInt triangle = neighbors[j];
+                const UnsignedInt p[]{
+                    positionIds[current[triangle*3 + 0]],
+                    positionIds[current[triangle*3 + 1]],
+                    positionIds[current[triangle*3 + 2]]
+                };
+
+                for(const UnsignedInt k: p) {
+                    if(k == fromPosition || k == toPosition || visited[k] == mark) continue;
+                    visited[k] = mark;
+                    if(marks[k] == mark) ++sharedNeighborCount;
+                }
+
+                if(p[0] == toPosition || p[1] == toPosition || p[2] == toPosition) {
+                    ++sharedTriangleCount;
+                    continue;
+                }
+
+                const Vector3 a = normalized[p[0]];
+                const Vector3 b = normalized[p[1]];
+                const Vector3 c = normalized[p[2]];
+                const Vector3 moved[]{
+                    p[0] == fromPosition ? normalized[toPosition] : a,
+                    p[1] == fromPosition ? normalized[toPosition] : b,
+                    p[2] == fromPosition ? normalized[toPosition] : c
+                };
+                const Vector3 before = Math::cross(b - a, c - a);
+                const Vector3 after = Math::cross(moved[1] - moved[0], moved[2] - moved[0]);
+                if(Math::dot(before, after) <= 0.0f) {
+                    valid = false;
+                    break;
+                }
+            }
+
+            /* Each removed triangle has exactly one neighbor shared by both
+               vertices, more than that would make the mesh non-manifold */
+            if(!valid || sharedNeighborCount != sharedTriangleCount) continue;
+
+            collapseTarget[collapse.from] = collapse.to;
+            for(const UnsignedInt vertex: {collapse.from, collapse.to})
+                for(UnsignedInt j = neighborOffset[vertex]; j != neighborOffset[vertex + 1]; ++j)
+                    for(std::size_t k = 0; k != 3; ++k)
+                        locked[current[neighbors[j]*3 + k]] = true;
+
+            addQuadric(quadrics[toPosition], quadrics[fromPosition]);
+            maxError = Math::max(maxError, collapse.error);
+            removedTriangleCount += sharedTriangleCount;
+        }
+
+        if(!removedTriangleCount) break;
+
+        /* Remap the indices and drop triangles that became degenerate */
+        std::size_t out = 0;
+        for(std::size_t i = 0; i != indexCount; i += 3) {
+            const UnsignedInt a = collapseTarget[current[i + 0]];
+            const UnsignedInt b = collapseTarget[current[i + 1]];
+            const UnsignedInt c = collapseTarget[current[i + 2]];
+            if(positionIds[a] == positionIds[b] || positionIds[b] == positionIds[c] || positionIds[c] == positionIds[a])
+                continue;
+            current[out++] = a;
+            current[out++] = b;
+            current[out++] = c;
+        }
+        indexCount = out;
+    }
+
+    if(resultError) *resultError = std::sqrt(maxError);
+    return indexCount;
+}
+
+template<class T> std::size_t simplifyInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError, Float* const resultError) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::simplifyInPlace(): index count not divisible by 3", {});
+    for(const T index: indices)
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::simplifyInPlace(): index" << index << "out of bounds for" << positions.size() << "vertices", {});
+
+    /* Operate on a 32-bit copy, which the adjacency helpers need anyway */
+    Containers::Array<UnsignedInt> indicesCopy{Containers::NoInit, indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indicesCopy[i] = indices[i];
+
+    const std::size_t indexCount = simplifyImplementation(indicesCopy, positions, targetIndexCount, targetError, resultError);
+    for(std::size_t i = 0; i != indexCount; ++i)
+        indices[i] = T(indicesCopy[i]);
+    return indexCount;
+}
+
+template<class T> void copyIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::ArrayView<char> out) {
+    const Containers::ArrayView<T> outT = Containers::arrayCast<T>(out);
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        outT[i] = T(indices[i]);
+}
+
+}
+
+std::size_t simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError, Float* const resultError) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, targetError, resultError);
+}
+
+std::size_t simplifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError, Float* const resultError) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, targetError, resultError);
+}
+
+std::size_t simplifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError, Float* const resultError) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, targetError, resultError);
+}
+
+std::size_t simplifyInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float targetError, Float* const resultError) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::simplifyInPlace(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return simplifyInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), positions, targetIndexCount, targetError, resultError);
+    else if(indices.size()[1] == 2)
+        return simplifyInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), positions, targetIndexCount, targetError, resultError);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::simplifyInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return simplifyInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), positions, targetIndexCount, targetError, resultError);
+    }
+}
+
+Trade::MeshData simplify(const Trade::MeshData& mesh, const std::size_t targetIndexCount, const Float targetError, Float* const resultError) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::simplify(): expected a triangle mesh, got" << mesh.primitive(),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::simplify(): the mesh is not indexed",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::simplify(): the mesh has no positions",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+
+    /* Make the data interleaved and owned so the unreferenced vertices can
+       be dropped in-place. The index buffer is replaced so no need to
+       preserve it. */
+    Trade::MeshData ownedInterleaved = owned(interleave(mesh));
+    const Containers::StridedArrayView2D<char> vertexData = MeshTools::interleavedMutableData(ownedInterleaved);
+
+    Containers::Array<UnsignedInt> indices = mesh.indicesAsArray();
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    const std::size_t indexCount = simplifyInPlace(Containers::stridedArrayView(indices), positions, targetIndexCount, targetError, resultError);
+    const Containers::StridedArrayView1D<UnsignedInt> simplifiedIndices = Containers::stridedArrayView(indices).prefix(indexCount);
+    const UnsignedInt vertexCount = UnsignedInt(optimizeVertexFetchInPlace(simplifiedIndices, vertexData));
+
+    /* Copy the referenced vertex prefix, same as in removeDuplicates() */
+    Containers::Array<char> simplifiedVertexData{Containers::NoInit, vertexCount*vertexData.size()[1]};
+    Utility::copy(vertexData.prefix(vertexCount),
+        Containers::StridedArrayView2D<char>{simplifiedVertexData, {vertexCount, vertexData.size()[1]}});
+
+    Containers::Array<Trade::MeshAttributeData> attributeData{ownedInterleaved.attributeCount()};
+    for(UnsignedInt i = 0; i != ownedInterleaved.attributeCount(); ++i)
+        attributeData[i] = Trade::MeshAttributeData{ownedInterleaved.attributeName(i),
+            ownedInterleaved.attributeFormat(i),
+            Containers::StridedArrayView1D<void>{simplifiedVertexData,
+                simplifiedVertexData.data() + ownedInterleaved.attributeOffset(i),
+                vertexCount,
+                ownedInterleaved.attributeStride(i)},
+            ownedInterleaved.attributeArraySize(i)};
+
+    /* Keep the original index type, the vertex count can only get smaller */
+    const MeshIndexType indexType = mesh.indexType();
+    Containers::Array<char> indexData{Containers::NoInit, indexCount*meshIndexTypeSize(indexType)};
+    if(indexType == MeshIndexType::UnsignedInt)
+        copyIndices<UnsignedInt>(simplifiedIndices, indexData);
+    else if(indexType == MeshIndexType::UnsignedShort)
+        copyIndices<UnsignedShort>(simplifiedIndices, indexData);
+    else {
+        CORRADE_INTERNAL_ASSERT(indexType == MeshIndexType::UnsignedByte);
+        copyIndices<UnsignedByte>(simplifiedIndices, indexData);
+    }
+
+    Trade::MeshIndexData indexDataView{indexType, indexData};
+    return Trade::MeshData{MeshPrimitive::Triangles,
+        std::move(indexData), indexDataView,
+        std::move(simplifiedVertexData), std::move(attributeData),
+        vertexCount};
+}
+
+Containers::Array<Trade::MeshData> simplifyLevels(const Trade::MeshData& mesh, const UnsignedInt levelCount, const Float ratio, const Float targetError) {
+    CORRADE_ASSERT(levelCount,
+        "MeshTools::simplifyLevels(): expected at least one level", {});
+    CORRADE_ASSERT(ratio > 0.0f && ratio < 1.0f,
+        "MeshTools::simplifyLevels(): expected ratio to be between 0 and 1 but got" << ratio, {});
+
+    Containers::Array<Trade::MeshData> levels;
+    arrayAppend(levels, Containers::InPlaceInit, owned(mesh));
+
+    std::size_t previousIndexCount = mesh.indexCount();
+    Float levelRatio = 1.0f;
+    for(UnsignedInt i = 1; i != levelCount; ++i) {
+        levelRatio *= ratio;
+        Trade::MeshData level = simplify(mesh, std::size_t(levelRatio*mesh.indexCount()), targetError);
+
+        /* The error threshold got hit, further levels would be the same */
+        if(level.indexCount() >= previousIndexCount) break;
+
+        previousIndexCount = level.indexCount();
+        arrayAppend(levels, Containers::InPlaceInit, std::move(level));
+    }
+    return levels;
+}
+
+}}
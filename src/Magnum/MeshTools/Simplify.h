@@ -0,0 +1,152 @@
+#ifndef Magnum_MeshTools_Simplify_h
+#define Magnum_MeshTools_Simplify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::simplifyInPlace(), @ref Magnum::MeshTools::simplify(), @ref Magnum::MeshTools::simplifyLevels()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Simplify a triangle mesh in-place
+@param[in,out] indices  Indices array to operate on
+@param[in] positions    Vertex positions
+@param[in] targetIndexCount Index count to aim for
+@param[in] targetError  Maximal allowed error, relative to mesh size
+@param[out] resultError If not @cpp nullptr @ce, the largest error of all
+    performed collapses, relative to mesh size, is written here
+@return New index count, always divisible by @cpp 3 @ce
+@m_since_latest
+
+Iteratively collapses edges of the mesh in an order given by the collapse
+error until the index count gets to @p targetIndexCount or lower, or until
+there are no more edges that could be collapsed with an error not larger than
+@p targetError. The error is measured as a square root of an area-weighted
+quadric error metric, relative to the largest dimension of the mesh bounding
+box --- thus for example a value of @cpp 0.01f @ce allows the surface to
+deviate by about 1% of the mesh size. Algorithm used: *Michael Garland and
+Paul S. Heckbert --- Surface Simplification Using Quadric Error Metrics,
+SIGGRAPH 1997, https://www.cs.cmu.edu/~./garland/Papers/quadrics.pdf*.
+
+An edge is always collapsed onto one of its existing vertices, which means no
+new vertices are created and attributes of the remaining vertices stay valid.
+Vertices sharing the same position are considered to lie on an attribute seam
+(for example a texture coordinate or a hard normal edge) --- these are never
+moved and nothing is collapsed onto them, so seams stay intact. Vertices on
+mesh borders are allowed to move only along the border, and vertices with a
+non-manifold neighborhood are never moved. Collapses that would flip a
+triangle or make the topology non-manifold are rejected.
+
+The first returned count items of @p indices contain the simplified mesh,
+contents of the rest is unspecified. Vertices that are no longer referenced
+aren't removed, use @ref optimizeVertexFetchInPlace() or
+@ref simplify(const Trade::MeshData&, std::size_t, Float, Float*) for that.
+Expects that @p indices size is divisible by @cpp 3 @ce and all indices are
+less than @p positions size.
+@see @ref analyzeVertexCache(), @ref optimizeVertexCacheInPlace()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError = 0.01f, Float* resultError = nullptr);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t simplifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError = 0.01f, Float* resultError = nullptr);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t simplifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError = 0.01f, Float* resultError = nullptr);
+
+/**
+@brief Simplify a triangle mesh in-place on a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float, Float*)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t simplifyInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float targetError = 0.01f, Float* resultError = nullptr);
+
+/**
+@brief Simplify a mesh
+@param mesh             Input mesh
+@param targetIndexCount Index count to aim for
+@param targetError      Maximal allowed error, relative to mesh size
+@param[out] resultError If not @cpp nullptr @ce, the largest error of all
+    performed collapses, relative to mesh size, is written here
+@m_since_latest
+
+Expects that the mesh is indexed, is a @ref MeshPrimitive::Triangles and has
+a @ref Trade::MeshAttribute::Position. Calls
+@ref simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float, Float*)
+on the first position attribute, and then removes vertices that are no longer
+referenced using @ref optimizeVertexFetchInPlace(). The returned mesh has all
+attributes of the original, interleaved, and keeps the original index type.
+@see @ref isInterleaved(), @ref simplifyLevels()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData simplify(const Trade::MeshData& mesh, std::size_t targetIndexCount, Float targetError = 0.01f, Float* resultError = nullptr);
+
+/**
+@brief Create a chain of simplified mesh levels
+@param mesh             Input mesh
+@param levelCount       Count of levels to create, including the original
+@param ratio            Target index count ratio between successive levels
+@param targetError      Maximal allowed error of each level, relative to mesh
+    size
+@m_since_latest
+
+The first returned level is an owned copy of @p mesh, each following level
+@cpp i @ce is created using
+@ref simplify(const Trade::MeshData&, std::size_t, Float, Float*) from the
+original mesh with target index count being @p ratio to the power of
+@cpp i @ce times the original index count. This matches the
+@ref Trade::AbstractImporter::meshLevelCount() convention, where level
+@cpp 0 @ce is the full-detail mesh. If a level can't be simplified any further
+without exceeding @p targetError, the chain ends there and thus the returned
+array may be shorter than @p levelCount.
+
+Expects that @p levelCount is at least @cpp 1 @ce, @p ratio is larger than
+@cpp 0.0f @ce and less than @cpp 1.0f @ce, and the same as
+@ref simplify(const Trade::MeshData&, std::size_t, Float, Float*) for
+@p mesh.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Trade::MeshData> simplifyLevels(const Trade::MeshData& mesh, UnsignedInt levelCount, Float ratio = 0.5f, Float targetError = 0.05f);
+
+}}
+
+#endif
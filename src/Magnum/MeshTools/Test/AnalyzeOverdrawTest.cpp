@@ -0,0 +1,218 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/AnalyzeOverdraw.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct AnalyzeOverdrawTest: TestSuite::Tester {
+    explicit AnalyzeOverdrawTest();
+
+    template<class T> void backToFront();
+    void frontToBack();
+    void resolution();
+    void empty();
+    void wrongIndexCount();
+    void wrongResolution();
+    void indexOutOfBounds();
+
+    template<class T> void erased();
+    void erasedNonContiguous();
+    void erasedWrongIndexSize();
+};
+
+AnalyzeOverdrawTest::AnalyzeOverdrawTest() {
+    addTests({&AnalyzeOverdrawTest::backToFront<UnsignedByte>,
+              &AnalyzeOverdrawTest::backToFront<UnsignedShort>,
+              &AnalyzeOverdrawTest::backToFront<UnsignedInt>,
+              &AnalyzeOverdrawTest::frontToBack,
+              &AnalyzeOverdrawTest::resolution,
+              &AnalyzeOverdrawTest::empty,
+              &AnalyzeOverdrawTest::wrongIndexCount,
+              &AnalyzeOverdrawTest::wrongResolution,
+              &AnalyzeOverdrawTest::indexOutOfBounds,
+
+              &AnalyzeOverdrawTest::erased<UnsignedByte>,
+              &AnalyzeOverdrawTest::erased<UnsignedShort>,
+              &AnalyzeOverdrawTest::erased<UnsignedInt>,
+              &AnalyzeOverdrawTest::erasedNonContiguous,
+              &AnalyzeOverdrawTest::erasedWrongIndexSize});
+}
+
+/* Two unit quads facing +Z, one behind the other. Visible only from the +Z
+   direction, from -Z they're culled and from the other directions they're
+   degenerate. */
+constexpr Vector3 TwoQuads[]{
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {1.0f, 1.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+
+    {0.0f, 0.0f, 1.0f},
+    {1.0f, 0.0f, 1.0f},
+    {1.0f, 1.0f, 1.0f},
+    {0.0f, 1.0f, 1.0f}
+};
+
+constexpr UnsignedByte BackToFrontIndices[]{
+    0, 1, 2, 0, 2, 3,
+    4, 5, 6, 4, 6, 7
+};
+
+template<class T> void AnalyzeOverdrawTest::backToFront() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(BackToFrontIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(BackToFrontIndices); ++i)
+        indices[i] = BackToFrontIndices[i];
+
+    /* Each pixel is covered by both quads, the front one being drawn later.
+       The diagonal pixels are shared by two triangles of each quad but
+       counted just once. */
+    OverdrawStatistics out = analyzeOverdraw(indices, TwoQuads);
+    CORRADE_COMPARE(out.coveredPixelCount, 256*256);
+    CORRADE_COMPARE(out.shadedPixelCount, 2*256*256);
+    CORRADE_COMPARE(out.overdraw, 2.0f);
+}
+
+void AnalyzeOverdrawTest::frontToBack() {
+    const UnsignedInt indices[]{
+        4, 5, 6, 4, 6, 7,
+        0, 1, 2, 0, 2, 3
+    };
+
+    /* The back quad gets fully rejected by the depth test */
+    OverdrawStatistics out = analyzeOverdraw(indices, TwoQuads);
+    CORRADE_COMPARE(out.coveredPixelCount, 256*256);
+    CORRADE_COMPARE(out.shadedPixelCount, 256*256);
+    CORRADE_COMPARE(out.overdraw, 1.0f);
+}
+
+void AnalyzeOverdrawTest::resolution() {
+    OverdrawStatistics out = analyzeOverdraw(BackToFrontIndices, TwoQuads, 16);
+    CORRADE_COMPARE(out.coveredPixelCount, 16*16);
+    CORRADE_COMPARE(out.shadedPixelCount, 2*16*16);
+    CORRADE_COMPARE(out.overdraw, 2.0f);
+}
+
+void AnalyzeOverdrawTest::empty() {
+    OverdrawStatistics out = analyzeOverdraw(Containers::StridedArrayView1D<const UnsignedInt>{}, TwoQuads);
+    CORRADE_COMPARE(out.coveredPixelCount, 0);
+    CORRADE_COMPARE(out.shadedPixelCount, 0);
+    CORRADE_COMPARE(out.overdraw, 0.0f);
+}
+
+void AnalyzeOverdrawTest::wrongIndexCount() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    const UnsignedByte indices[7]{};
+    analyzeOverdraw(indices, TwoQuads);
+    CORRADE_COMPARE(out.str(), "MeshTools::analyzeOverdraw(): index count not divisible by 3\n");
+}
+
+void AnalyzeOverdrawTest::wrongResolution() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    analyzeOverdraw(BackToFrontIndices, TwoQuads, 0);
+    analyzeOverdraw(BackToFrontIndices, TwoQuads, 4097);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::analyzeOverdraw(): expected resolution to be between 1 and 4096 but got 0\n"
+        "MeshTools::analyzeOverdraw(): expected resolution to be between 1 and 4096 but got 4097\n");
+}
+
+void AnalyzeOverdrawTest::indexOutOfBounds() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    const UnsignedInt indices[]{0, 1, 8};
+    analyzeOverdraw(indices, TwoQuads);
+    CORRADE_COMPARE(out.str(), "MeshTools::analyzeOverdraw(): index 8 out of bounds for 8 vertices\n");
+}
+
+template<class T> void AnalyzeOverdrawTest::erased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(BackToFrontIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(BackToFrontIndices); ++i)
+        indices[i] = BackToFrontIndices[i];
+
+    OverdrawStatistics out = analyzeOverdraw(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), TwoQuads);
+    CORRADE_COMPARE(out.coveredPixelCount, 256*256);
+    CORRADE_COMPARE(out.shadedPixelCount, 2*256*256);
+    CORRADE_COMPARE(out.overdraw, 2.0f);
+}
+
+void AnalyzeOverdrawTest::erasedNonContiguous() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const char indices[6*4]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    analyzeOverdraw(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, TwoQuads);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::analyzeOverdraw(): second index view dimension is not contiguous\n");
+}
+
+void AnalyzeOverdrawTest::erasedWrongIndexSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const char indices[6*3]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    analyzeOverdraw(Containers::StridedArrayView2D<const char>{indices, {6, 3}}.every(2), TwoQuads);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::analyzeOverdraw(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::AnalyzeOverdrawTest)
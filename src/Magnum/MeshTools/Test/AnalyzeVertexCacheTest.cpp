@@ -0,0 +1,168 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/MeshTools/AnalyzeVertexCache.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct AnalyzeVertexCacheTest: TestSuite::Tester {
+    explicit AnalyzeVertexCacheTest();
+
+    template<class T> void analyze();
+    void empty();
+    void wrongIndexCount();
+    void indexOutOfBounds();
+
+    template<class T> void erased();
+    void erasedNonContiguous();
+    void erasedWrongIndexSize();
+};
+
+AnalyzeVertexCacheTest::AnalyzeVertexCacheTest() {
+    addTests({&AnalyzeVertexCacheTest::analyze<UnsignedByte>,
+              &AnalyzeVertexCacheTest::analyze<UnsignedShort>,
+              &AnalyzeVertexCacheTest::analyze<UnsignedInt>,
+              &AnalyzeVertexCacheTest::empty,
+              &AnalyzeVertexCacheTest::wrongIndexCount,
+              &AnalyzeVertexCacheTest::indexOutOfBounds,
+
+              &AnalyzeVertexCacheTest::erased<UnsignedByte>,
+              &AnalyzeVertexCacheTest::erased<UnsignedShort>,
+              &AnalyzeVertexCacheTest::erased<UnsignedInt>,
+              &AnalyzeVertexCacheTest::erasedNonContiguous,
+              &AnalyzeVertexCacheTest::erasedWrongIndexSize});
+}
+
+/* With a cache of size 3, 0, 1, 2 are a miss, 2 and 1 a hit, 3 a miss,
+   evicting 0. Then 0 is a miss, evicting 1, which is a miss evicting 2,
+   which is again a miss. Vertex 4 is not referenced at all. */
+constexpr UnsignedByte Indices[]{
+    0, 1, 2,
+    2, 1, 3,
+    0, 1, 2
+};
+
+template<class T> void AnalyzeVertexCacheTest::analyze() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(Indices)];
+    for(std::size_t i = 0; i != Containers::arraySize(Indices); ++i)
+        indices[i] = Indices[i];
+
+    VertexCacheStatistics out = analyzeVertexCache(indices, 5, 3);
+    CORRADE_COMPARE(out.transformedVertexCount, 7);
+    CORRADE_COMPARE(out.acmr, 7.0f/3.0f);
+    CORRADE_COMPARE(out.atvr, 7.0f/4.0f);
+
+    /* With a bigger cache everything is transformed just once */
+    out = analyzeVertexCache(indices, 5, 4);
+    CORRADE_COMPARE(out.transformedVertexCount, 4);
+    CORRADE_COMPARE(out.acmr, 4.0f/3.0f);
+    CORRADE_COMPARE(out.atvr, 1.0f);
+}
+
+void AnalyzeVertexCacheTest::empty() {
+    VertexCacheStatistics out = analyzeVertexCache(Containers::StridedArrayView1D<const UnsignedInt>{}, 5, 16);
+    CORRADE_COMPARE(out.transformedVertexCount, 0);
+    CORRADE_COMPARE(out.acmr, 0.0f);
+    CORRADE_COMPARE(out.atvr, 0.0f);
+}
+
+void AnalyzeVertexCacheTest::wrongIndexCount() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    const UnsignedByte indices[7]{};
+    analyzeVertexCache(indices, 1, 16);
+    CORRADE_COMPARE(out.str(), "MeshTools::analyzeVertexCache(): index count not divisible by 3\n");
+}
+
+void AnalyzeVertexCacheTest::indexOutOfBounds() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    const UnsignedInt indices[]{0, 1, 2};
+    analyzeVertexCache(indices, 2, 16);
+    CORRADE_COMPARE(out.str(), "MeshTools::analyzeVertexCache(): index 2 out of bounds for 2 vertices\n");
+}
+
+template<class T> void AnalyzeVertexCacheTest::erased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(Indices)];
+    for(std::size_t i = 0; i != Containers::arraySize(Indices); ++i)
+        indices[i] = Indices[i];
+
+    VertexCacheStatistics out = analyzeVertexCache(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), 5, 3);
+    CORRADE_COMPARE(out.transformedVertexCount, 7);
+    CORRADE_COMPARE(out.acmr, 7.0f/3.0f);
+    CORRADE_COMPARE(out.atvr, 7.0f/4.0f);
+}
+
+void AnalyzeVertexCacheTest::erasedNonContiguous() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const char indices[6*4]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    analyzeVertexCache(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, 1, 16);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::analyzeVertexCache(): second index view dimension is not contiguous\n");
+}
+
+void AnalyzeVertexCacheTest::erasedWrongIndexSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const char indices[6*3]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    analyzeVertexCache(Containers::StridedArrayView2D<const char>{indices, {6, 3}}.every(2), 1, 16);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::analyzeVertexCache(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::AnalyzeVertexCacheTest)
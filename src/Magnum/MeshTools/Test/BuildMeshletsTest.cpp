@@ -0,0 +1,412 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/MeshTools/BuildMeshlets.h"
+#include "Magnum/Primitives/Cube.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct BuildMeshletsTest: TestSuite::Tester {
+    explicit BuildMeshletsTest();
+
+    template<class T> void grid();
+    void limits();
+    void coneCulling();
+    void empty();
+    void wrongIndexCount();
+    void invalidLimits();
+    void indexOutOfBounds();
+
+    template<class T> void erased();
+    void erasedNonContiguous();
+    void erasedWrongIndexSize();
+
+    void meshData();
+    void meshDataNotTriangles();
+    void meshDataNotIndexed();
+    void meshDataNoPositions();
+
+    private:
+        Containers::Array<UnsignedInt> verifyMeshlets(const Meshlets& meshlets, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount, UnsignedInt maxTriangleCount);
+};
+
+using namespace Math::Literals;
+
+BuildMeshletsTest::BuildMeshletsTest() {
+    addTests({&BuildMeshletsTest::grid<UnsignedByte>,
+              &BuildMeshletsTest::grid<UnsignedShort>,
+              &BuildMeshletsTest::grid<UnsignedInt>,
+              &BuildMeshletsTest::limits,
+              &BuildMeshletsTest::coneCulling,
+              &BuildMeshletsTest::empty,
+              &BuildMeshletsTest::wrongIndexCount,
+              &BuildMeshletsTest::invalidLimits,
+              &BuildMeshletsTest::indexOutOfBounds,
+
+              &BuildMeshletsTest::erased<UnsignedByte>,
+              &BuildMeshletsTest::erased<UnsignedShort>,
+              &BuildMeshletsTest::erased<UnsignedInt>,
+              &BuildMeshletsTest::erasedNonContiguous,
+              &BuildMeshletsTest::erasedWrongIndexSize,
+
+              &BuildMeshletsTest::meshData,
+              &BuildMeshletsTest::meshDataNotTriangles,
+              &BuildMeshletsTest::meshDataNotIndexed,
+              &BuildMeshletsTest::meshDataNoPositions});
+}
+
+/* A flat 10x10 quad grid in the XY plane facing +Z, 121 vertices and 200
+   triangles */
+constexpr UnsignedInt GridSize = 10;
+constexpr UnsignedInt GridVertexCount = (GridSize + 1)*(GridSize + 1);
+constexpr UnsignedInt GridIndexCount = GridSize*GridSize*6;
+
+Containers::Array<Vector3> gridPositions() {
+    Containers::Array<Vector3> positions{Containers::NoInit, GridVertexCount};
+    for(UnsignedInt y = 0; y != GridSize + 1; ++y)
+        for(UnsignedInt x = 0; x != GridSize + 1; ++x)
+            positions[y*(GridSize + 1) + x] = {Float(x), Float(y), 0.0f};
+    return positions;
+}
+
+template<class T> Containers::Array<T> gridIndices() {
+    Containers::Array<T> indices{Containers::NoInit, GridIndexCount};
+    std::size_t i = 0;
+    for(UnsignedInt y = 0; y != GridSize; ++y) {
+        for(UnsignedInt x = 0; x != GridSize; ++x) {
+            const T a = y*(GridSize + 1) + x;
+            const T b = a + 1;
+            const T c = a + GridSize + 1;
+            const T d = c + 1;
+            for(const T index: {a, b, d, a, d, c})
+                indices[i++] = index;
+        }
+    }
+    return indices;
+}
+
+/* Triangles packed into single sortable values */
+template<class T> Containers::Array<UnsignedLong> sortedTriangles(const Containers::ArrayView<const T> indices) {
+    Containers::Array<UnsignedLong> out{Containers::NoInit, indices.size()/3};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = UnsignedLong(indices[i*3 + 0]) << 40 |
+                 UnsignedLong(indices[i*3 + 1]) << 20 |
+                 UnsignedLong(indices[i*3 + 2]);
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+/* Verifies limits and bounds of all meshlets and returns the triangles
+   converted back to global indices. On failure returns an empty array. */
+Containers::Array<UnsignedInt> BuildMeshletsTest::verifyMeshlets(const Meshlets& meshlets, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    Containers::Array<UnsignedInt> indices{Containers::NoInit, meshlets.triangles.size()};
+    std::size_t index = 0;
+    UnsignedInt vertexOffset = 0, triangleOffset = 0;
+    for(std::size_t i = 0; i != meshlets.meshlets.size(); ++i) {
+        const Meshlet& meshlet = meshlets.meshlets[i];
+
+        /* Meshlets are stored consecutively */
+        if(meshlet.vertexOffset != vertexOffset || meshlet.triangleOffset != triangleOffset) {
+            Error{} << "Meshlet" << i << "not stored consecutively";
+            return {};
+        }
+        vertexOffset += meshlet.vertexCount;
+        triangleOffset += meshlet.triangleCount;
+
+        if(meshlet.vertexCount < 3 || meshlet.vertexCount > maxVertexCount || meshlet.triangleCount < 1 || meshlet.triangleCount > maxTriangleCount) {
+            Error{} << "Meshlet" << i << "has" << meshlet.vertexCount << "vertices and" << meshlet.triangleCount << "triangles";
+            return {};
+        }
+
+        for(UnsignedInt j = 0; j != meshlet.vertexCount; ++j) {
+            if((positions[meshlets.vertices[meshlet.vertexOffset + j]] - meshlet.center).length() > meshlet.radius*1.0001f) {
+                Error{} << "Meshlet" << i << "vertex" << j << "outside of the bounding sphere";
+                return {};
+            }
+        }
+
+        for(UnsignedInt j = 0; j != meshlet.triangleCount*3; ++j) {
+            const UnsignedByte local = meshlets.triangles[meshlet.triangleOffset*3 + j];
+            if(local >= meshlet.vertexCount) {
+                Error{} << "Meshlet" << i << "local index" << local << "out of bounds";
+                return {};
+            }
+            indices[index++] = meshlets.vertices[meshlet.vertexOffset + local];
+        }
+    }
+
+    if(vertexOffset != meshlets.vertices.size() || triangleOffset*3 != meshlets.triangles.size()) {
+        Error{} << "Meshlets don't span the whole output";
+        return {};
+    }
+
+    return indices;
+}
+
+template<class T> void BuildMeshletsTest::grid() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Containers::Array<T> indices = gridIndices<T>();
+    Containers::Array<Vector3> positions = gridPositions();
+
+    Meshlets meshlets = buildMeshlets(Containers::stridedArrayView(indices), positions);
+    CORRADE_COMPARE_AS(meshlets.meshlets.size(), 2, TestSuite::Compare::GreaterOrEqual);
+
+    /* All triangles are there exactly once, with the same winding */
+    Containers::Array<UnsignedInt> reconstructed = verifyMeshlets(meshlets, positions, 64, 124);
+    CORRADE_COMPARE(reconstructed.size(), indices.size());
+    CORRADE_COMPARE_AS(sortedTriangles<UnsignedInt>(reconstructed),
+        sortedTriangles<T>(indices),
+        TestSuite::Compare::Container);
+
+    /* All triangles face +Z, so the cone covers the whole back half-space */
+    for(std::size_t i = 0; i != meshlets.meshlets.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(meshlets.meshlets[i].coneAxis, Vector3::zAxis());
+        CORRADE_COMPARE(meshlets.meshlets[i].coneAngle, 180.0_degf);
+    }
+}
+
+void BuildMeshletsTest::limits() {
+    Containers::Array<UnsignedInt> indices = gridIndices<UnsignedInt>();
+    Containers::Array<Vector3> positions = gridPositions();
+
+    /* With three vertices only a single triangle fits */
+    {
+        Meshlets meshlets = buildMeshlets(Containers::stridedArrayView(indices), positions, 3, 124);
+        CORRADE_COMPARE(meshlets.meshlets.size(), GridIndexCount/3);
+        Containers::Array<UnsignedInt> reconstructed = verifyMeshlets(meshlets, positions, 3, 124);
+        CORRADE_COMPARE_AS(sortedTriangles<UnsignedInt>(reconstructed),
+            sortedTriangles<UnsignedInt>(indices),
+            TestSuite::Compare::Container);
+    }
+
+    /* Two triangles with four vertices are a single quad */
+    {
+        Meshlets meshlets = buildMeshlets(Containers::stridedArrayView(indices), positions, 64, 2);
+        CORRADE_COMPARE(meshlets.meshlets.size(), GridIndexCount/6);
+        for(std::size_t i = 0; i != meshlets.meshlets.size(); ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(meshlets.meshlets[i].vertexCount, 4);
+            CORRADE_COMPARE(meshlets.meshlets[i].triangleCount, 2);
+        }
+        Containers::Array<UnsignedInt> reconstructed = verifyMeshlets(meshlets, positions, 64, 2);
+        CORRADE_COMPARE_AS(sortedTriangles<UnsignedInt>(reconstructed),
+            sortedTriangles<UnsignedInt>(indices),
+            TestSuite::Compare::Container);
+    }
+}
+
+void BuildMeshletsTest::coneCulling() {
+    /* Each face of the cube is a separate meshlet */
+    Trade::MeshData cube = Primitives::cubeSolid();
+    Meshlets meshlets = buildMeshlets(cube, 64, 2);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 6);
+
+    /* Looking from +X, only the +X face is visible, all other faces are
+       either facing away or seen exactly from the side */
+    const Vector3 cameraPosition{10.0f, 0.0f, 0.0f};
+    std::size_t visibleCount = 0;
+    for(std::size_t i = 0; i != meshlets.meshlets.size(); ++i) {
+        CORRADE_ITERATION(i);
+        const Meshlet& meshlet = meshlets.meshlets[i];
+        CORRADE_COMPARE_AS(meshlet.radius, 2.0f, TestSuite::Compare::Less);
+        CORRADE_COMPARE(meshlet.coneAngle, 180.0_degf);
+        if(!Math::Intersection::pointCone(cameraPosition, meshlet.coneApex, -meshlet.coneAxis, meshlet.coneAngle)) {
+            ++visibleCount;
+            CORRADE_COMPARE(meshlet.coneAxis, Vector3::xAxis());
+        }
+    }
+    CORRADE_COMPARE(visibleCount, 1);
+}
+
+void BuildMeshletsTest::empty() {
+    Meshlets meshlets = buildMeshlets(Containers::StridedArrayView1D<const UnsignedInt>{}, Containers::StridedArrayView1D<const Vector3>{});
+    CORRADE_VERIFY(meshlets.meshlets.empty());
+    CORRADE_VERIFY(meshlets.vertices.empty());
+    CORRADE_VERIFY(meshlets.triangles.empty());
+}
+
+void BuildMeshletsTest::wrongIndexCount() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    const UnsignedByte indices[7]{};
+    const Vector3 positions[1];
+    buildMeshlets(indices, positions);
+    CORRADE_COMPARE(out.str(), "MeshTools::buildMeshlets(): index count not divisible by 3\n");
+}
+
+void BuildMeshletsTest::invalidLimits() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    const UnsignedByte indices[3]{};
+    const Vector3 positions[1];
+    buildMeshlets(indices, positions, 2, 124);
+    buildMeshlets(indices, positions, 257, 124);
+    buildMeshlets(indices, positions, 64, 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::buildMeshlets(): expected max vertex count to be between 3 and 256 but got 2\n"
+        "MeshTools::buildMeshlets(): expected max vertex count to be between 3 and 256 but got 257\n"
+        "MeshTools::buildMeshlets(): expected non-zero max triangle count\n");
+}
+
+void BuildMeshletsTest::indexOutOfBounds() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    const UnsignedInt indices[]{0, 1, 3};
+    const Vector3 positions[3];
+    buildMeshlets(indices, positions);
+    CORRADE_COMPARE(out.str(), "MeshTools::buildMeshlets(): index 3 out of bounds for 3 vertices\n");
+}
+
+template<class T> void BuildMeshletsTest::erased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Containers::Array<T> indices = gridIndices<T>();
+    Containers::Array<Vector3> positions = gridPositions();
+
+    Meshlets meshlets = buildMeshlets(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), positions, 64, 2);
+    CORRADE_COMPARE(meshlets.meshlets.size(), GridIndexCount/6);
+    Containers::Array<UnsignedInt> reconstructed = verifyMeshlets(meshlets, positions, 64, 2);
+    CORRADE_COMPARE_AS(sortedTriangles<UnsignedInt>(reconstructed),
+        sortedTriangles<T>(indices),
+        TestSuite::Compare::Container);
+}
+
+void BuildMeshletsTest::erasedNonContiguous() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const char indices[6*4]{};
+    const Vector3 positions[1];
+
+    std::stringstream out;
+    Error redirectError{&out};
+    buildMeshlets(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, positions);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::buildMeshlets(): second index view dimension is not contiguous\n");
+}
+
+void BuildMeshletsTest::erasedWrongIndexSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const char indices[6*3]{};
+    const Vector3 positions[1];
+
+    std::stringstream out;
+    Error redirectError{&out};
+    buildMeshlets(Containers::StridedArrayView2D<const char>{indices, {6, 3}}.every(2), positions);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::buildMeshlets(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void BuildMeshletsTest::meshData() {
+    Trade::MeshData cube = Primitives::cubeSolid();
+    Meshlets meshlets = buildMeshlets(cube);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets.meshlets[0].vertexCount, 24);
+    CORRADE_COMPARE(meshlets.meshlets[0].triangleCount, 12);
+    /* Triangle normals pointing everywhere, can't be culled */
+    CORRADE_COMPARE(meshlets.meshlets[0].coneAngle, 0.0_degf);
+
+    Containers::Array<Vector3> positions = cube.positions3DAsArray();
+    Containers::Array<UnsignedInt> reconstructed = verifyMeshlets(meshlets, positions, 64, 124);
+    CORRADE_COMPARE_AS(sortedTriangles<UnsignedInt>(reconstructed),
+        sortedTriangles<UnsignedInt>(cube.indicesAsArray()),
+        TestSuite::Compare::Container);
+}
+
+void BuildMeshletsTest::meshDataNotTriangles() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+    buildMeshlets(Trade::MeshData{MeshPrimitive::Lines, 2});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::buildMeshlets(): expected a triangle mesh, got MeshPrimitive::Lines\n");
+}
+
+void BuildMeshletsTest::meshDataNotIndexed() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+    buildMeshlets(Trade::MeshData{MeshPrimitive::Triangles, 3});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::buildMeshlets(): the mesh is not indexed\n");
+}
+
+void BuildMeshletsTest::meshDataNoPositions() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const UnsignedShort indices[]{0, 0, 0};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    buildMeshlets(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 1});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::buildMeshlets(): the mesh has no positions\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BuildMeshletsTest)
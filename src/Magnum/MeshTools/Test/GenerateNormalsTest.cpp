@@ -64,6 +64,10 @@ struct GenerateNormalsTest: TestSuite::Tester {
     void smoothOutOfBounds();
     void smoothIntoWrongSize();
 
+    template<class T> void smoothParallel();
+    void smoothParallelSmallMesh();
+    void smoothParallelOutOfBounds();
+
     template<class T> void smoothErased();
     void smoothErasedNonContiguous();
     void smoothErasedWrongIndexSize();
@@ -92,6 +96,12 @@ GenerateNormalsTest::GenerateNormalsTest() {
               &GenerateNormalsTest::smoothOutOfBounds,
               &GenerateNormalsTest::smoothIntoWrongSize,
 
+              &GenerateNormalsTest::smoothParallel<UnsignedByte>,
+              &GenerateNormalsTest::smoothParallel<UnsignedShort>,
+              &GenerateNormalsTest::smoothParallel<UnsignedInt>,
+              &GenerateNormalsTest::smoothParallelSmallMesh,
+              &GenerateNormalsTest::smoothParallelOutOfBounds,
+
               &GenerateNormalsTest::smoothErased<UnsignedByte>,
               &GenerateNormalsTest::smoothErased<UnsignedShort>,
               &GenerateNormalsTest::smoothErased<UnsignedInt>,
@@ -437,6 +447,68 @@ void GenerateNormalsTest::smoothIntoWrongSize() {
     CORRADE_COMPARE(out.str(), "MeshTools::generateSmoothNormalsInto(): bad output size, expected 3 but got 4\n");
 }
 
+void reverseOrderExecutor(UnsignedInt count, void(*task)(UnsignedInt, void*), void* state, void* userData) {
+    ++*static_cast<UnsignedInt*>(userData);
+    for(UnsignedInt i = count; i != 0; --i) task(i - 1, state);
+}
+
+template<class T> void GenerateNormalsTest::smoothParallel() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Large enough to be split into multiple tasks, with 8-bit indices
+       referencing each vertex many times */
+    const std::size_t vertexCount = sizeof(T) == 1 ? 256 : 10000;
+    Containers::Array<Vector3> positions{Containers::NoInit, vertexCount};
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        positions[i] = {Float(i % 17), Float(i % 23)*0.5f, Float(i % 29)*0.25f};
+    Containers::Array<T> indices{Containers::NoInit, 30000};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indices[i] = T((i*7919 + i/3) % vertexCount);
+
+    Containers::Array<Vector3> expected = generateSmoothNormals(Containers::stridedArrayView(indices), positions);
+
+    UnsignedInt executorCalls = 0;
+    Containers::Array<Vector3> actual{Containers::NoInit, vertexCount};
+    generateSmoothNormalsInto(Containers::stridedArrayView(indices), positions, actual, reverseOrderExecutor, &executorCalls);
+    CORRADE_VERIFY(executorCalls);
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+
+    /* Type-erased variant */
+    executorCalls = 0;
+    CORRADE_COMPARE_AS(generateSmoothNormals(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), positions, reverseOrderExecutor, &executorCalls),
+        expected, TestSuite::Compare::Container);
+    CORRADE_VERIFY(executorCalls);
+}
+
+void GenerateNormalsTest::smoothParallelSmallMesh() {
+    /* Too small to be worth splitting, the executor shouldn't get called at
+       all */
+    UnsignedInt executorCalls = 0;
+    CORRADE_COMPARE_AS(generateSmoothNormals(BeveledCubeIndices, BeveledCubePositions, reverseOrderExecutor, &executorCalls),
+        generateSmoothNormals(BeveledCubeIndices, BeveledCubePositions),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(executorCalls, 0);
+}
+
+void GenerateNormalsTest::smoothParallelOutOfBounds() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Vector3 positions[2];
+    UnsignedInt indices[9000]{};
+    indices[5000] = 3;
+    indices[8000] = 7;
+
+    std::stringstream out;
+    Error redirectError{&out};
+    UnsignedInt executorCalls = 0;
+    generateSmoothNormals(indices, positions, reverseOrderExecutor, &executorCalls);
+    /* Only the first out-of-bounds index is reported, even though the tasks
+       were executed in reverse order */
+    CORRADE_COMPARE(out.str(), "MeshTools::generateSmoothNormalsInto(): index 3 out of bounds for 2 elements\n");
+}
+
 void GenerateNormalsTest::benchmarkFlat() {
     Containers::Array<Vector3> positions = duplicate(
         Containers::stridedArrayView(BeveledCubeIndices),
@@ -0,0 +1,242 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/AnalyzeOverdraw.h"
+#include "Magnum/MeshTools/OptimizeOverdraw.h"
+#include "Magnum/MeshTools/OptimizeVertexCache.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct OptimizeOverdrawTest: TestSuite::Tester {
+    explicit OptimizeOverdrawTest();
+
+    template<class T> void optimize();
+    void preservesTriangles();
+    void empty();
+    void wrongIndexCount();
+    void zeroCacheSize();
+    void thresholdTooSmall();
+    void indexOutOfBounds();
+
+    template<class T> void erased();
+    void erasedNonContiguous();
+    void erasedWrongIndexSize();
+};
+
+OptimizeOverdrawTest::OptimizeOverdrawTest() {
+    addTests({&OptimizeOverdrawTest::optimize<UnsignedByte>,
+              &OptimizeOverdrawTest::optimize<UnsignedShort>,
+              &OptimizeOverdrawTest::optimize<UnsignedInt>,
+              &OptimizeOverdrawTest::preservesTriangles,
+              &OptimizeOverdrawTest::empty,
+              &OptimizeOverdrawTest::wrongIndexCount,
+              &OptimizeOverdrawTest::zeroCacheSize,
+              &OptimizeOverdrawTest::thresholdTooSmall,
+              &OptimizeOverdrawTest::indexOutOfBounds,
+
+              &OptimizeOverdrawTest::erased<UnsignedByte>,
+              &OptimizeOverdrawTest::erased<UnsignedShort>,
+              &OptimizeOverdrawTest::erased<UnsignedInt>,
+              &OptimizeOverdrawTest::erasedNonContiguous,
+              &OptimizeOverdrawTest::erasedWrongIndexSize});
+}
+
+/* Two unit quads facing +Z, one behind the other */
+constexpr Vector3 TwoQuads[]{
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {1.0f, 1.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+
+    {0.0f, 0.0f, 1.0f},
+    {1.0f, 0.0f, 1.0f},
+    {1.0f, 1.0f, 1.0f},
+    {0.0f, 1.0f, 1.0f}
+};
+
+constexpr UnsignedByte BackToFrontIndices[]{
+    0, 1, 2, 0, 2, 3,
+    4, 5, 6, 4, 6, 7
+};
+
+template<class T> void OptimizeOverdrawTest::optimize() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(BackToFrontIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(BackToFrontIndices); ++i)
+        indices[i] = BackToFrontIndices[i];
+    CORRADE_COMPARE(analyzeOverdraw(indices, TwoQuads).overdraw, 2.0f);
+
+    /* Each quad is a separate cluster as the cache gets fully flushed
+       between them, the front one should go first */
+    optimizeOverdrawInPlace(indices, TwoQuads, 16);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        4, 5, 6, 4, 6, 7,
+        0, 1, 2, 0, 2, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(analyzeOverdraw(indices, TwoQuads).overdraw, 1.0f);
+}
+
+void OptimizeOverdrawTest::preservesTriangles() {
+    Trade::MeshData sphere = Primitives::icosphereSolid(3);
+    Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+    Containers::Array<Vector3> positions = sphere.positions3DAsArray();
+    optimizeVertexCacheInPlace(indices, positions.size(), 16);
+
+    /* Triangles packed into a single sortable value */
+    Containers::Array<UnsignedLong> expected{Containers::NoInit, indices.size()/3};
+    for(std::size_t i = 0; i != expected.size(); ++i)
+        expected[i] = UnsignedLong(indices[i*3 + 0]) << 40 |
+                      UnsignedLong(indices[i*3 + 1]) << 20 |
+                      UnsignedLong(indices[i*3 + 2]);
+    std::sort(expected.begin(), expected.end());
+
+    /* A large threshold makes more clusters */
+    optimizeOverdrawInPlace(indices, positions, 16, 2.0f);
+
+    Containers::Array<UnsignedLong> actual{Containers::NoInit, indices.size()/3};
+    for(std::size_t i = 0; i != actual.size(); ++i)
+        actual[i] = UnsignedLong(indices[i*3 + 0]) << 40 |
+                    UnsignedLong(indices[i*3 + 1]) << 20 |
+                    UnsignedLong(indices[i*3 + 2]);
+    std::sort(actual.begin(), actual.end());
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+}
+
+void OptimizeOverdrawTest::empty() {
+    /* Shouldn't crash or anything */
+    optimizeOverdrawInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, TwoQuads, 16);
+    CORRADE_VERIFY(true);
+}
+
+void OptimizeOverdrawTest::wrongIndexCount() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    UnsignedByte indices[7]{};
+    optimizeOverdrawInPlace(indices, TwoQuads, 16);
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeOverdrawInPlace(): index count not divisible by 3\n");
+}
+
+void OptimizeOverdrawTest::zeroCacheSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    UnsignedByte indices[6]{};
+    optimizeOverdrawInPlace(indices, TwoQuads, 0);
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeOverdrawInPlace(): expected non-zero cache size\n");
+}
+
+void OptimizeOverdrawTest::thresholdTooSmall() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    UnsignedByte indices[6]{};
+    optimizeOverdrawInPlace(indices, TwoQuads, 16, 0.5f);
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeOverdrawInPlace(): expected threshold to be at least 1 but got 0.5\n");
+}
+
+void OptimizeOverdrawTest::indexOutOfBounds() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    UnsignedInt indices[]{0, 1, 8};
+    optimizeOverdrawInPlace(indices, TwoQuads, 16);
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeOverdrawInPlace(): index 8 out of bounds for 8 vertices\n");
+}
+
+template<class T> void OptimizeOverdrawTest::erased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(BackToFrontIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(BackToFrontIndices); ++i)
+        indices[i] = BackToFrontIndices[i];
+
+    optimizeOverdrawInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)), TwoQuads, 16);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        4, 5, 6, 4, 6, 7,
+        0, 1, 2, 0, 2, 3
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeOverdrawTest::erasedNonContiguous() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char indices[6*4]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    optimizeOverdrawInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, TwoQuads, 16);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeOverdrawInPlace(): second index view dimension is not contiguous\n");
+}
+
+void OptimizeOverdrawTest::erasedWrongIndexSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char indices[6*3]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    optimizeOverdrawInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}.every(2), TwoQuads, 16);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeOverdrawInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeOverdrawTest)
@@ -0,0 +1,260 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/MeshTools/AnalyzeVertexCache.h"
+#include "Magnum/MeshTools/OptimizeVertexCache.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct OptimizeVertexCacheTest: TestSuite::Tester {
+    explicit OptimizeVertexCacheTest();
+
+    template<class T> void optimize();
+    void empty();
+    void oneDegenerateTriangle();
+    void wrongIndexCount();
+    void cacheTooSmall();
+    void indexOutOfBounds();
+
+    template<class T> void erased();
+    void erasedNonContiguous();
+    void erasedWrongIndexSize();
+
+    void benchmarkTipsify();
+    void benchmarkOptimize();
+};
+
+OptimizeVertexCacheTest::OptimizeVertexCacheTest() {
+    addTests({&OptimizeVertexCacheTest::optimize<UnsignedByte>,
+              &OptimizeVertexCacheTest::optimize<UnsignedShort>,
+              &OptimizeVertexCacheTest::optimize<UnsignedInt>,
+              &OptimizeVertexCacheTest::empty,
+              &OptimizeVertexCacheTest::oneDegenerateTriangle,
+              &OptimizeVertexCacheTest::wrongIndexCount,
+              &OptimizeVertexCacheTest::cacheTooSmall,
+              &OptimizeVertexCacheTest::indexOutOfBounds,
+
+              &OptimizeVertexCacheTest::erased<UnsignedByte>,
+              &OptimizeVertexCacheTest::erased<UnsignedShort>,
+              &OptimizeVertexCacheTest::erased<UnsignedInt>,
+              &OptimizeVertexCacheTest::erasedNonContiguous,
+              &OptimizeVertexCacheTest::erasedWrongIndexSize});
+
+    addBenchmarks({&OptimizeVertexCacheTest::benchmarkTipsify,
+                   &OptimizeVertexCacheTest::benchmarkOptimize}, 10);
+}
+
+/* A regular grid of size*size vertices with triangles in a random order. The
+   random generator is default-seeded so the output is always the same. */
+template<class T> Containers::Array<T> shuffledGrid(const UnsignedInt size) {
+    Containers::Array<T> indices{Containers::NoInit, (size - 1)*(size - 1)*6};
+    std::size_t i = 0;
+    for(UnsignedInt y = 0; y != size - 1; ++y) {
+        for(UnsignedInt x = 0; x != size - 1; ++x) {
+            const UnsignedInt v = y*size + x;
+            indices[i++] = T(v);
+            indices[i++] = T(v + 1);
+            indices[i++] = T(v + size);
+            indices[i++] = T(v + 1);
+            indices[i++] = T(v + size + 1);
+            indices[i++] = T(v + size);
+        }
+    }
+
+    std::minstd_rand rng;
+    for(std::size_t t = indices.size()/3 - 1; t != 0; --t) {
+        const std::size_t other = rng() % (t + 1);
+        for(std::size_t j = 0; j != 3; ++j)
+            std::swap(indices[t*3 + j], indices[other*3 + j]);
+    }
+
+    return indices;
+}
+
+/* Triangles packed into a single sortable value, to verify that the output
+   contains the same triangles with the same winding */
+template<class T> Containers::Array<UnsignedLong> sortedTriangles(const Containers::ArrayView<const T> indices) {
+    Containers::Array<UnsignedLong> out{Containers::NoInit, indices.size()/3};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = UnsignedLong(indices[i*3 + 0]) << 40 |
+                 UnsignedLong(indices[i*3 + 1]) << 20 |
+                 UnsignedLong(indices[i*3 + 2]);
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+template<class T> void OptimizeVertexCacheTest::optimize() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* 16x16 vertices to fit into 8-bit indices */
+    Containers::Array<T> indices = shuffledGrid<T>(16);
+    const VertexCacheStatistics before = analyzeVertexCache(Containers::stridedArrayView(indices), 256, 16);
+
+    Containers::Array<UnsignedLong> expectedTriangles = sortedTriangles<T>(indices);
+    optimizeVertexCacheInPlace(Containers::stridedArrayView(indices), 256, 16);
+    CORRADE_COMPARE_AS(sortedTriangles<T>(indices), expectedTriangles,
+        TestSuite::Compare::Container);
+
+    /* The ideal ACMR for a grid is 0.5, a shuffled one is close to 3 */
+    const VertexCacheStatistics after = analyzeVertexCache(Containers::stridedArrayView(indices), 256, 16);
+    CORRADE_COMPARE_AS(after.acmr, before.acmr,
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(after.acmr, 1.0f,
+        TestSuite::Compare::Less);
+}
+
+void OptimizeVertexCacheTest::empty() {
+    /* Shouldn't crash or anything */
+    optimizeVertexCacheInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, 0, 16);
+    CORRADE_VERIFY(true);
+}
+
+void OptimizeVertexCacheTest::oneDegenerateTriangle() {
+    UnsignedInt indices[]{0, 0, 0};
+    optimizeVertexCacheInPlace(indices, 1, 16);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<UnsignedInt>({0, 0, 0}),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeVertexCacheTest::wrongIndexCount() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    UnsignedByte indices[7]{};
+    optimizeVertexCacheInPlace(indices, 1, 16);
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeVertexCacheInPlace(): index count not divisible by 3\n");
+}
+
+void OptimizeVertexCacheTest::cacheTooSmall() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    UnsignedByte indices[6]{};
+    optimizeVertexCacheInPlace(indices, 1, 3);
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeVertexCacheInPlace(): expected cache size to be at least 4 but got 3\n");
+}
+
+void OptimizeVertexCacheTest::indexOutOfBounds() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    UnsignedInt indices[]{0, 1, 2};
+    optimizeVertexCacheInPlace(indices, 2, 16);
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeVertexCacheInPlace(): index 2 out of bounds for 2 vertices\n");
+}
+
+template<class T> void OptimizeVertexCacheTest::erased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Containers::Array<T> expected = shuffledGrid<T>(16);
+    optimizeVertexCacheInPlace(Containers::stridedArrayView(expected), 256, 16);
+
+    /* Should give the same result as the typed variant */
+    Containers::Array<T> indices = shuffledGrid<T>(16);
+    optimizeVertexCacheInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)), 256, 16);
+    CORRADE_COMPARE_AS(indices, expected, TestSuite::Compare::Container);
+}
+
+void OptimizeVertexCacheTest::erasedNonContiguous() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char indices[6*4]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    optimizeVertexCacheInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, 1, 16);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeVertexCacheInPlace(): second index view dimension is not contiguous\n");
+}
+
+void OptimizeVertexCacheTest::erasedWrongIndexSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char indices[6*3]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    optimizeVertexCacheInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}.every(2), 1, 16);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeVertexCacheInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+/* Both benchmarks verify the resulting ACMR so the two algorithms can be
+   compared not just in speed but also in the output quality */
+constexpr UnsignedInt BenchmarkGridSize = 128;
+
+void OptimizeVertexCacheTest::benchmarkTipsify() {
+    Containers::Array<UnsignedInt> indices = shuffledGrid<UnsignedInt>(BenchmarkGridSize);
+
+    CORRADE_BENCHMARK(1)
+        tipsifyInPlace(indices, BenchmarkGridSize*BenchmarkGridSize, 16);
+
+    CORRADE_COMPARE_AS(analyzeVertexCache(Containers::stridedArrayView(indices), BenchmarkGridSize*BenchmarkGridSize, 16).acmr, 1.0f,
+        TestSuite::Compare::Less);
+}
+
+void OptimizeVertexCacheTest::benchmarkOptimize() {
+    Containers::Array<UnsignedInt> indices = shuffledGrid<UnsignedInt>(BenchmarkGridSize);
+
+    CORRADE_BENCHMARK(1)
+        optimizeVertexCacheInPlace(indices, BenchmarkGridSize*BenchmarkGridSize, 16);
+
+    CORRADE_COMPARE_AS(analyzeVertexCache(Containers::stridedArrayView(indices), BenchmarkGridSize*BenchmarkGridSize, 16).acmr, 1.0f,
+        TestSuite::Compare::Less);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeVertexCacheTest)
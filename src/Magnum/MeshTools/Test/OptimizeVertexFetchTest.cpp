@@ -0,0 +1,177 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/MeshTools/OptimizeVertexFetch.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct OptimizeVertexFetchTest: TestSuite::Tester {
+    explicit OptimizeVertexFetchTest();
+
+    template<class T> void optimize();
+    void empty();
+    void indexOutOfBounds();
+    void vertexDataNonContiguous();
+
+    template<class T> void erased();
+    void erasedNonContiguous();
+    void erasedWrongIndexSize();
+};
+
+OptimizeVertexFetchTest::OptimizeVertexFetchTest() {
+    addTests({&OptimizeVertexFetchTest::optimize<UnsignedByte>,
+              &OptimizeVertexFetchTest::optimize<UnsignedShort>,
+              &OptimizeVertexFetchTest::optimize<UnsignedInt>,
+              &OptimizeVertexFetchTest::empty,
+              &OptimizeVertexFetchTest::indexOutOfBounds,
+              &OptimizeVertexFetchTest::vertexDataNonContiguous,
+
+              &OptimizeVertexFetchTest::erased<UnsignedByte>,
+              &OptimizeVertexFetchTest::erased<UnsignedShort>,
+              &OptimizeVertexFetchTest::erased<UnsignedInt>,
+              &OptimizeVertexFetchTest::erasedNonContiguous,
+              &OptimizeVertexFetchTest::erasedWrongIndexSize});
+}
+
+/* Vertices 2 and 4 are not referenced */
+constexpr UnsignedByte Indices[]{
+    3, 1, 3,
+    0, 3, 1
+};
+
+template<class T> void OptimizeVertexFetchTest::optimize() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(Indices)];
+    for(std::size_t i = 0; i != Containers::arraySize(Indices); ++i)
+        indices[i] = Indices[i];
+    UnsignedInt vertices[]{10, 11, 12, 13, 14};
+
+    CORRADE_COMPARE(optimizeVertexFetchInPlace(indices, Containers::arrayCast<2, char>(Containers::stridedArrayView(vertices))), 3);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        0, 1, 0,
+        2, 0, 1
+    }), TestSuite::Compare::Container);
+    /* Unreferenced vertices are at the end, in the original order */
+    CORRADE_COMPARE_AS(Containers::arrayView(vertices), Containers::arrayView<UnsignedInt>({
+        13, 11, 10, 12, 14
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeVertexFetchTest::empty() {
+    UnsignedInt vertices[]{10, 11, 12};
+
+    CORRADE_COMPARE(optimizeVertexFetchInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, Containers::arrayCast<2, char>(Containers::stridedArrayView(vertices))), 0);
+    CORRADE_COMPARE_AS(Containers::arrayView(vertices), Containers::arrayView<UnsignedInt>({
+        10, 11, 12
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeVertexFetchTest::indexOutOfBounds() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    UnsignedInt indices[]{0, 1, 2};
+    UnsignedInt vertices[2]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    optimizeVertexFetchInPlace(indices, Containers::arrayCast<2, char>(Containers::stridedArrayView(vertices)));
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeVertexFetchInPlace(): index 2 out of bounds for 2 vertices\n");
+}
+
+void OptimizeVertexFetchTest::vertexDataNonContiguous() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    UnsignedInt indices[]{0, 1, 2};
+    char vertices[3*4]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    optimizeVertexFetchInPlace(indices, Containers::StridedArrayView2D<char>{vertices, {3, 2}, {4, 2}});
+    CORRADE_COMPARE(out.str(), "MeshTools::optimizeVertexFetchInPlace(): second vertex data view dimension is not contiguous\n");
+}
+
+template<class T> void OptimizeVertexFetchTest::erased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(Indices)];
+    for(std::size_t i = 0; i != Containers::arraySize(Indices); ++i)
+        indices[i] = Indices[i];
+    UnsignedInt vertices[]{10, 11, 12, 13, 14};
+
+    CORRADE_COMPARE(optimizeVertexFetchInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)), Containers::arrayCast<2, char>(Containers::stridedArrayView(vertices))), 3);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        0, 1, 0,
+        2, 0, 1
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(vertices), Containers::arrayView<UnsignedInt>({
+        13, 11, 10, 12, 14
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeVertexFetchTest::erasedNonContiguous() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char indices[6*4]{};
+    UnsignedInt vertices[1]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    optimizeVertexFetchInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, Containers::arrayCast<2, char>(Containers::stridedArrayView(vertices)));
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeVertexFetchInPlace(): second index view dimension is not contiguous\n");
+}
+
+void OptimizeVertexFetchTest::erasedWrongIndexSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char indices[6*3]{};
+    UnsignedInt vertices[1]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    optimizeVertexFetchInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}.every(2), Containers::arrayCast<2, char>(Containers::stridedArrayView(vertices)));
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeVertexFetchInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeVertexFetchTest)
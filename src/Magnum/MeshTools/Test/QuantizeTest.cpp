@@ -0,0 +1,441 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Quantize.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct QuantizeTest: TestSuite::Tester {
+    explicit QuantizeTest();
+
+    void positions3D();
+    void positions2D();
+    void positionsSinglePoint();
+    void normals();
+    void normalsHighPrecision();
+    void normalsOctahedral();
+    void tangents();
+    void textureCoordinates();
+    void textureCoordinatesOutOfRange();
+    void colors();
+    void passthrough();
+    void indices();
+    void empty();
+    void implementationSpecificFormat();
+};
+
+QuantizeTest::QuantizeTest() {
+    addTests({&QuantizeTest::positions3D,
+              &QuantizeTest::positions2D,
+              &QuantizeTest::positionsSinglePoint,
+              &QuantizeTest::normals,
+              &QuantizeTest::normalsHighPrecision,
+              &QuantizeTest::normalsOctahedral,
+              &QuantizeTest::tangents,
+              &QuantizeTest::textureCoordinates,
+              &QuantizeTest::textureCoordinatesOutOfRange,
+              &QuantizeTest::colors,
+              &QuantizeTest::passthrough,
+              &QuantizeTest::indices,
+              &QuantizeTest::empty,
+              &QuantizeTest::implementationSpecificFormat});
+}
+
+using namespace Math::Literals;
+
+void QuantizeTest::positions3D() {
+    const Vector3 positions[]{
+        {-1.0f, 2.0f, 3.0f},
+        {5.0f, -2.0f, 0.0f},
+        {1.0f, 1.0f, 1.0f},
+        {0.3f, 0.7f, 2.9f}
+    };
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    QuantizationInfo info;
+    Trade::MeshData quantized = quantize(mesh, {}, &info);
+    CORRADE_COMPARE(quantized.primitive(), MeshPrimitive::Points);
+    CORRADE_VERIFY(!quantized.isIndexed());
+    CORRADE_COMPARE(quantized.vertexCount(), 4);
+    CORRADE_COMPARE(quantized.attributeCount(), 1);
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector3s);
+    /* Six bytes, padded to eight */
+    CORRADE_COMPARE(quantized.attributeStride(0), 8);
+
+    /* Centered around the bounding box center, the largest half-extent
+       mapped to the full range */
+    CORRADE_COMPARE(info.positionDequantization.translation(), (Vector3{2.0f, 0.0f, 1.5f}));
+    CORRADE_COMPARE(info.positionDequantization.scaling(), Vector3{3.0f/32767.0f});
+    CORRADE_COMPARE(quantized.attribute<Vector3s>(0)[1].xy(), (Vector2s{32767, -21845}));
+
+    /* The error is at most half the quantization step in each direction */
+    CORRADE_COMPARE_AS(info.positionError, 0.0f, TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(info.positionError, Math::sqrt(3.0f)*0.5f*3.0f/32767.0f, TestSuite::Compare::LessOrEqual);
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        const Vector3 dequantized = info.positionDequantization.transformPoint(Vector3{quantized.attribute<Vector3s>(0)[i]});
+        CORRADE_COMPARE_AS((dequantized - positions[i]).length(), info.positionError*1.001f, TestSuite::Compare::LessOrEqual);
+    }
+
+    /* Other errors are zero */
+    CORRADE_COMPARE(info.directionError, 0.0_radf);
+    CORRADE_COMPARE(info.textureCoordinateError, 0.0f);
+    CORRADE_COMPARE(info.colorError, 0.0f);
+}
+
+void QuantizeTest::positions2D() {
+    const Vector2 positions[]{
+        {-2.0f, 1.0f},
+        {2.0f, 0.0f},
+        {0.5f, 3.0f}
+    };
+    Trade::MeshData mesh{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    QuantizationInfo info;
+    Trade::MeshData quantized = quantize(mesh, {}, &info);
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector2s);
+    CORRADE_COMPARE(quantized.attributeStride(0), 4);
+    CORRADE_COMPARE(info.positionDequantization.translation(), (Vector3{0.0f, 1.5f, 0.0f}));
+    CORRADE_COMPARE(info.positionDequantization.scaling(), Vector3{2.0f/32767.0f});
+    CORRADE_COMPARE(quantized.attribute<Vector2s>(0)[0], (Vector2s{-32767, -8192}));
+    CORRADE_COMPARE(quantized.attribute<Vector2s>(0)[1], (Vector2s{32767, -24575}));
+    CORRADE_COMPARE_AS(info.positionError, Math::sqrt(2.0f)*0.5f*2.0f/32767.0f, TestSuite::Compare::LessOrEqual);
+}
+
+void QuantizeTest::positionsSinglePoint() {
+    const Vector3 positions[]{
+        {1.0f, 2.0f, 3.0f},
+        {1.0f, 2.0f, 3.0f}
+    };
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    /* Shouldn't divide by zero */
+    QuantizationInfo info;
+    Trade::MeshData quantized = quantize(mesh, {}, &info);
+    CORRADE_COMPARE(info.positionDequantization, Matrix4::translation({1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(quantized.attribute<Vector3s>(0)[0], Vector3s{});
+    CORRADE_COMPARE(quantized.attribute<Vector3s>(0)[1], Vector3s{});
+    CORRADE_COMPARE(info.positionError, 0.0f);
+}
+
+const Vector3 Normals[]{
+    {1.0f, 0.0f, 0.0f},
+    {0.0f, -1.0f, 0.0f},
+    /* Not normalized, gets normalized */
+    {0.0f, 0.0f, 2.0f},
+    {0.267261f, 0.534522f, 0.801784f},
+    {-0.57735f, 0.57735f, -0.57735f},
+    /* Zero-length, stays zero and is ignored in the error calculation */
+    {0.0f, 0.0f, 0.0f}
+};
+
+void QuantizeTest::normals() {
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, Normals, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, Containers::arrayView(Normals)}
+    }};
+
+    QuantizationInfo info;
+    Trade::MeshData quantized = quantize(mesh, {}, &info);
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector3bNormalized);
+    CORRADE_COMPARE(quantized.attributeStride(0), 4);
+    CORRADE_COMPARE(quantized.attribute<Vector3b>(0)[0], (Vector3b{127, 0, 0}));
+    CORRADE_COMPARE(quantized.attribute<Vector3b>(0)[1], (Vector3b{0, -127, 0}));
+    CORRADE_COMPARE(quantized.attribute<Vector3b>(0)[2], (Vector3b{0, 0, 127}));
+    CORRADE_COMPARE(quantized.attribute<Vector3b>(0)[5], Vector3b{});
+
+    /* No positions, the dequantization is an identity */
+    CORRADE_COMPARE(info.positionDequantization, Matrix4{});
+    CORRADE_COMPARE(info.positionError, 0.0f);
+
+    /* Half a step of 1/127 is about 0.2 degrees in the worst case */
+    CORRADE_COMPARE_AS(info.directionError, 0.0_radf, TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(info.directionError, Rad{0.5_degf}, TestSuite::Compare::Less);
+
+    /* The decoded normals are what the accessor returns */
+    Containers::Array<Vector3> decoded = quantized.normalsAsArray();
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(Math::angle(decoded[i].normalized(), Normals[i].normalized()), info.directionError + 0.0001_radf, TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void QuantizeTest::normalsHighPrecision() {
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, Normals, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, Containers::arrayView(Normals)}
+    }};
+
+    QuantizationInfo info;
+    Trade::MeshData quantized = quantize(mesh, QuantizeFlag::HighPrecisionNormals, &info);
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector3sNormalized);
+    CORRADE_COMPARE(quantized.attributeStride(0), 8);
+    CORRADE_COMPARE(quantized.attribute<Vector3s>(0)[1], (Vector3s{0, -32767, 0}));
+    CORRADE_COMPARE_AS(info.directionError, Rad{0.005_degf}, TestSuite::Compare::Less);
+}
+
+void QuantizeTest::normalsOctahedral() {
+    struct Vertex {
+        Vector3 normal;
+        Vector4 tangent;
+    } vertices[6];
+    for(std::size_t i = 0; i != 6; ++i) {
+        vertices[i].normal = Normals[i];
+        vertices[i].tangent = {0.0f, 1.0f, 0.0f, -1.0f};
+    }
+    Containers::StridedArrayView1D<Vertex> view = vertices;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Tangent, view.slice(&Vertex::tangent)}
+    }};
+
+    QuantizationInfo info;
+    Trade::MeshData quantized = quantize(mesh, QuantizeFlag::OctahedralNormals, &info);
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector2bNormalized);
+    /* Four-component tangents can't be octahedral-encoded */
+    CORRADE_COMPARE(quantized.attributeFormat(1), VertexFormat::Vector4bNormalized);
+    CORRADE_COMPARE(quantized.attributeStride(0), 8);
+    CORRADE_COMPARE(quantized.attribute<Vector2b>(0)[0], (Vector2b{127, 0}));
+    CORRADE_COMPARE(quantized.attribute<Vector2b>(0)[1], (Vector2b{0, -127}));
+    /* Zero-length normal is encoded as zero */
+    CORRADE_COMPARE(quantized.attribute<Vector2b>(0)[5], Vector2b{});
+    CORRADE_COMPARE_AS(info.directionError, 0.0_radf, TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(info.directionError, Rad{0.7_degf}, TestSuite::Compare::Less);
+
+    Containers::Array<Vector3> decoded = quantized.normalsAsArray();
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(Math::angle(decoded[i], Normals[i].normalized()), info.directionError + 0.0001_radf, TestSuite::Compare::LessOrEqual);
+    }
+
+    /* 16-bit variant */
+    QuantizationInfo infoHighPrecision;
+    Trade::MeshData quantizedHighPrecision = quantize(mesh, QuantizeFlag::OctahedralNormals|QuantizeFlag::HighPrecisionNormals, &infoHighPrecision);
+    CORRADE_COMPARE(quantizedHighPrecision.attributeFormat(0), VertexFormat::Vector2sNormalized);
+    CORRADE_COMPARE(quantizedHighPrecision.attributeFormat(1), VertexFormat::Vector4sNormalized);
+    CORRADE_COMPARE_AS(infoHighPrecision.directionError, Rad{0.05_degf}, TestSuite::Compare::Less);
+}
+
+void QuantizeTest::tangents() {
+    struct Vertex {
+        Vector4 tangent;
+        Vector3 bitangent;
+    } vertices[]{
+        {{1.0f, 0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f}},
+        {{0.0f, 0.707107f, 0.707107f, 1.0f}, {1.0f, 0.0f, 0.0f}}
+    };
+    Containers::StridedArrayView1D<Vertex> view = vertices;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Tangent, view.slice(&Vertex::tangent)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Bitangent, view.slice(&Vertex::bitangent)}
+    }};
+
+    QuantizationInfo info;
+    Trade::MeshData quantized = quantize(mesh, {}, &info);
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector4bNormalized);
+    CORRADE_COMPARE(quantized.attributeFormat(1), VertexFormat::Vector3bNormalized);
+    CORRADE_COMPARE(quantized.attributeOffset(0), 0);
+    CORRADE_COMPARE(quantized.attributeOffset(1), 4);
+    CORRADE_COMPARE(quantized.attributeStride(0), 8);
+    CORRADE_COMPARE(quantized.attribute<Vector4b>(0)[0], (Vector4b{127, 0, 0, -127}));
+    CORRADE_COMPARE(quantized.attribute<Vector4b>(0)[1], (Vector4b{0, 90, 90, 127}));
+    CORRADE_COMPARE(quantized.attribute<Vector3b>(1)[0], (Vector3b{0, 127, 0}));
+    CORRADE_COMPARE(quantized.bitangentSignsAsArray()[0], -1.0f);
+    CORRADE_COMPARE_AS(info.directionError, Rad{0.5_degf}, TestSuite::Compare::Less);
+}
+
+void QuantizeTest::textureCoordinates() {
+    const Vector2 textureCoordinates[]{
+        {0.0f, 1.0f},
+        {0.5f, 0.25f},
+        {0.3f, 0.9f}
+    };
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, textureCoordinates, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, Containers::arrayView(textureCoordinates)}
+    }};
+
+    QuantizationInfo info;
+    Trade::MeshData quantized = quantize(mesh, {}, &info);
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector2usNormalized);
+    CORRADE_COMPARE(quantized.attributeStride(0), 4);
+    CORRADE_COMPARE(quantized.attribute<Vector2us>(0)[0], (Vector2us{0, 65535}));
+    CORRADE_COMPARE_AS(info.textureCoordinateError, 0.51f/65535.0f, TestSuite::Compare::LessOrEqual);
+
+    /* Forcing half-floats */
+    QuantizationInfo infoHalf;
+    Trade::MeshData quantizedHalf = quantize(mesh, QuantizeFlag::HalfTextureCoordinates, &infoHalf);
+    CORRADE_COMPARE(quantizedHalf.attributeFormat(0), VertexFormat::Vector2h);
+    CORRADE_COMPARE(quantizedHalf.textureCoordinates2DAsArray()[1], (Vector2{0.5f, 0.25f}));
+    CORRADE_COMPARE_AS(infoHalf.textureCoordinateError, 0.0f, TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(infoHalf.textureCoordinateError, 0.001f, TestSuite::Compare::Less);
+}
+
+void QuantizeTest::textureCoordinatesOutOfRange() {
+    const Vector2 textureCoordinates[]{
+        {0.0f, 1.0f},
+        {-0.5f, 3.25f}
+    };
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, textureCoordinates, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, Containers::arrayView(textureCoordinates)}
+    }};
+
+    QuantizationInfo info;
+    Trade::MeshData quantized = quantize(mesh, {}, &info);
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector2h);
+    CORRADE_COMPARE(quantized.textureCoordinates2DAsArray()[1], (Vector2{-0.5f, 3.25f}));
+    CORRADE_COMPARE(info.textureCoordinateError, 0.0f);
+}
+
+void QuantizeTest::colors() {
+    struct Vertex {
+        Color4 color;
+        Color3 hdr;
+    } vertices[]{
+        {{1.0f, 0.5f, 0.0f, 1.0f}, {2.0f, 0.5f, 0.25f}},
+        {{0.2f, 0.4f, 0.6f, 0.8f}, {0.0f, 1.0f, 16.0f}}
+    };
+    Containers::StridedArrayView1D<Vertex> view = vertices;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Color, view.slice(&Vertex::color)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Color, view.slice(&Vertex::hdr)}
+    }};
+
+    QuantizationInfo info;
+    Trade::MeshData quantized = quantize(mesh, {}, &info);
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector4ubNormalized);
+    CORRADE_COMPARE(quantized.attributeFormat(1), VertexFormat::Vector3h);
+    /* Four bytes and six bytes padded to eight */
+    CORRADE_COMPARE(quantized.attributeStride(0), 12);
+    CORRADE_COMPARE(quantized.attribute<Color4ub>(0)[0], 0xff8000ff_rgba);
+    CORRADE_COMPARE(quantized.colorsAsArray(1)[1], (Color4{0.0f, 1.0f, 16.0f, 1.0f}));
+    CORRADE_COMPARE_AS(info.colorError, 0.51f/255.0f, TestSuite::Compare::LessOrEqual);
+}
+
+void QuantizeTest::passthrough() {
+    struct Vertex {
+        Vector3b normal;
+        UnsignedShort objectId;
+        Float custom[2];
+    };
+    Vertex vertices[]{
+        {{127, 0, 0}, 15, {1.5f, 2.5f}},
+        {{0, -127, 0}, 3, {-0.5f, 3.0f}}
+    };
+    Containers::StridedArrayView1D<Vertex> view = vertices;
+    constexpr Trade::MeshAttribute Custom = Trade::meshAttributeCustom(3);
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, VertexFormat::Vector3bNormalized, view.slice(&Vertex::normal)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::ObjectId, view.slice(&Vertex::objectId)},
+        /* Array attributes aren't quantized */
+        Trade::MeshAttributeData{Custom, VertexFormat::Float,
+            Containers::stridedArrayView(vertices,
+                &vertices[0].custom, 2, sizeof(Vertex)), 2}
+    }};
+
+    QuantizationInfo info;
+    Trade::MeshData quantized = quantize(mesh, {}, &info);
+    CORRADE_COMPARE(quantized.attributeCount(), 3);
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector3bNormalized);
+    CORRADE_COMPARE(quantized.attributeFormat(1), VertexFormat::UnsignedShort);
+    CORRADE_COMPARE(quantized.attributeName(2), Custom);
+    CORRADE_COMPARE(quantized.attributeFormat(2), VertexFormat::Float);
+    CORRADE_COMPARE(quantized.attributeArraySize(2), 2);
+    CORRADE_COMPARE(quantized.attributeOffset(1), 4);
+    CORRADE_COMPARE(quantized.attributeOffset(2), 8);
+    CORRADE_COMPARE(quantized.attributeStride(0), 16);
+    CORRADE_COMPARE(quantized.attribute<Vector3b>(0)[1], (Vector3b{0, -127, 0}));
+    CORRADE_COMPARE(quantized.attribute<UnsignedShort>(1)[0], 15);
+    CORRADE_COMPARE(quantized.attribute<Float[]>(2)[1][1], 3.0f);
+    CORRADE_COMPARE(info.directionError, 0.0_radf);
+}
+
+void QuantizeTest::indices() {
+    const UnsignedShort indices[]{0, 1, 2, 2, 1, 0};
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    };
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+        }};
+
+    Trade::MeshData quantized = quantize(mesh);
+    CORRADE_VERIFY(quantized.isIndexed());
+    CORRADE_COMPARE(quantized.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(quantized.indexCount(), 6);
+    CORRADE_COMPARE(quantized.indices<UnsignedShort>()[3], 2);
+    /* The data is a copy */
+    CORRADE_VERIFY(quantized.indexData().data() != static_cast<const void*>(indices));
+}
+
+void QuantizeTest::empty() {
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, Containers::ArrayView<const void>{}, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr}
+    }};
+
+    QuantizationInfo info;
+    Trade::MeshData quantized = quantize(mesh, {}, &info);
+    CORRADE_COMPARE(quantized.vertexCount(), 0);
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector3s);
+    CORRADE_COMPARE(info.positionDequantization, Matrix4{});
+}
+
+void QuantizeTest::implementationSpecificFormat() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const Vector3 positions[2]{};
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertexFormatWrap(0xcaca), Containers::arrayView(positions)}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    quantize(mesh);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::quantize(): attribute 1 has an implementation-specific format 0xcaca\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::QuantizeTest)
@@ -24,12 +24,16 @@
 */
 
 #include <algorithm>
+#include <cstring>
 #include <random>
 #include <sstream>
+#include <unordered_map>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
@@ -44,6 +48,9 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     void removeDuplicates();
     void removeDuplicatesNonContiguous();
     void removeDuplicatesIntoWrongOutputSize();
+    void removeDuplicatesVertexSize();
+    void removeDuplicatesParallel();
+    void removeDuplicatesParallelNullExecutor();
 
     template<class T> void removeDuplicatesIndexedInPlace();
     void removeDuplicatesIndexedInPlaceSmallType();
@@ -57,6 +64,8 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     template<class T> void removeDuplicatesFuzzyInPlaceMoreDimensions();
     template<class T> void removeDuplicatesFuzzyInPlaceInto();
     void removeDuplicatesFuzzyInPlaceIntoWrongOutputSize();
+    template<class T> void removeDuplicatesFuzzyInPlaceGrid();
+    void removeDuplicatesFuzzyInPlaceGridTooManyDimensions();
     #ifdef MAGNUM_BUILD_DEPRECATED
     void removeDuplicatesFuzzyStl();
     #endif
@@ -72,6 +81,7 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
 
     void removeDuplicatesMeshData();
     void removeDuplicatesMeshDataAttributeless();
+    void removeDuplicatesMeshDataParallel();
 
     void removeDuplicatesMeshDataFuzzy();
     void removeDuplicatesMeshDataFuzzyDouble();
@@ -80,9 +90,45 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
 
     void soakTest();
     void soakTestFuzzy();
+    void soakTestFuzzyGrid();
+
+    void debugFuzzyMode();
 
     void benchmark();
+    void benchmarkReference();
     void benchmarkFuzzy();
+    void benchmarkFuzzyGrid();
+};
+
+const struct {
+    const char* name;
+    std::size_t size;
+} RemoveDuplicatesVertexSizeData[] {
+    {"1 byte", 1},
+    {"7 bytes", 7},
+    {"12 bytes", 12},
+    {"16 bytes", 16},
+    {"24 bytes", 24},
+    {"32 bytes", 32},
+    {"44 bytes", 44}
+};
+
+const struct {
+    const char* name;
+    std::size_t count;
+    std::size_t uniqueCount;
+} RemoveDuplicatesParallelData[] {
+    {"single task", 100, 30},
+    {"many tasks", 100000, 7000},
+    {"many tasks, all unique", 100000, 100000}
+};
+
+const struct {
+    const char* name;
+    std::size_t uniqueCount;
+} BenchmarkData[] {
+    {"100 unique", 100},
+    {"10000 unique", 10000}
 };
 
 const struct {
@@ -164,8 +210,17 @@ const struct {
 RemoveDuplicatesTest::RemoveDuplicatesTest() {
     addTests({&RemoveDuplicatesTest::removeDuplicates,
               &RemoveDuplicatesTest::removeDuplicatesNonContiguous,
-              &RemoveDuplicatesTest::removeDuplicatesIntoWrongOutputSize,
-              &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedByte>,
+              &RemoveDuplicatesTest::removeDuplicatesIntoWrongOutputSize});
+
+    addInstancedTests({&RemoveDuplicatesTest::removeDuplicatesVertexSize},
+        Containers::arraySize(RemoveDuplicatesVertexSizeData));
+
+    addInstancedTests({&RemoveDuplicatesTest::removeDuplicatesParallel},
+        Containers::arraySize(RemoveDuplicatesParallelData));
+
+    addTests({&RemoveDuplicatesTest::removeDuplicatesParallelNullExecutor});
+
+    addTests({&RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedByte>,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedShort>,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedInt>,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlaceSmallType,
@@ -184,6 +239,9 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
               &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceInto<Float>,
               &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceInto<Double>,
               &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceIntoWrongOutputSize,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceGrid<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceGrid<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceGridTooManyDimensions,
               #ifdef MAGNUM_BUILD_DEPRECATED
               &RemoveDuplicatesTest::removeDuplicatesFuzzyStl,
               #endif
@@ -208,7 +266,8 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
     addInstancedTests({&RemoveDuplicatesTest::removeDuplicatesMeshData},
         Containers::arraySize(RemoveDuplicatesMeshDataData));
 
-    addTests({&RemoveDuplicatesTest::removeDuplicatesMeshDataAttributeless});
+    addTests({&RemoveDuplicatesTest::removeDuplicatesMeshDataAttributeless,
+              &RemoveDuplicatesTest::removeDuplicatesMeshDataParallel});
 
     addInstancedTests({&RemoveDuplicatesTest::removeDuplicatesMeshDataFuzzy},
         Containers::arraySize(RemoveDuplicatesMeshDataFuzzyData));
@@ -219,10 +278,17 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
               &RemoveDuplicatesTest::removeDuplicatesMeshDataFuzzyImplementationSpecific});
 
     addRepeatedTests({&RemoveDuplicatesTest::soakTest,
-                      &RemoveDuplicatesTest::soakTestFuzzy}, 10);
+                      &RemoveDuplicatesTest::soakTestFuzzy,
+                      &RemoveDuplicatesTest::soakTestFuzzyGrid}, 10);
+
+    addTests({&RemoveDuplicatesTest::debugFuzzyMode});
 
-    addBenchmarks({&RemoveDuplicatesTest::benchmark,
-                   &RemoveDuplicatesTest::benchmarkFuzzy}, 10);
+    addInstancedBenchmarks({&RemoveDuplicatesTest::benchmark,
+                            &RemoveDuplicatesTest::benchmarkReference}, 10,
+        Containers::arraySize(BenchmarkData));
+
+    addBenchmarks({&RemoveDuplicatesTest::benchmarkFuzzy,
+                   &RemoveDuplicatesTest::benchmarkFuzzyGrid}, 10);
 }
 
 void RemoveDuplicatesTest::removeDuplicates() {
@@ -281,6 +347,127 @@ void RemoveDuplicatesTest::removeDuplicatesIntoWrongOutputSize() {
         "MeshTools::removeDuplicatesInPlaceInto(): output index array has 7 elements but expected 8\n");
 }
 
+void RemoveDuplicatesTest::removeDuplicatesVertexSize() {
+    auto&& data = RemoveDuplicatesVertexSizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The vertices differ only in the last byte to verify the hashing and
+       comparison doesn't ignore any part of the data */
+    const UnsignedInt ids[]{0, 1, 2, 0, 3, 4, 2, 1};
+    Containers::Array<char> vertices{Containers::ValueInit, Containers::arraySize(ids)*data.size};
+    Containers::StridedArrayView2D<char> view{vertices, {Containers::arraySize(ids), data.size}};
+    for(std::size_t i = 0; i != Containers::arraySize(ids); ++i) {
+        for(std::size_t j = 0; j != data.size; ++j)
+            view[i][j] = char(j*3);
+        view[i][data.size - 1] = char(ids[i]);
+    }
+
+    UnsignedInt indices[Containers::arraySize(ids)];
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInto(view, indices), 5);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 0, 4, 5, 2, 1}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInPlaceInto(view, indices), 5);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 0, 3, 4, 2, 1}),
+        TestSuite::Compare::Container);
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(view[i][data.size - 1], char(i));
+    }
+}
+
+/* Executes the tasks serially in reverse order, counting how many times it
+   was called */
+void reverseOrderExecutor(UnsignedInt count, void(*task)(UnsignedInt, void*), void* state, void* userData) {
+    ++*static_cast<UnsignedInt*>(userData);
+    for(UnsignedInt i = count; i != 0; --i) task(i - 1, state);
+}
+
+void RemoveDuplicatesTest::removeDuplicatesParallel() {
+    auto&& data = RemoveDuplicatesParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Vector3i> vertices{Containers::ValueInit, data.count};
+    for(std::size_t i = 0; i != data.count; ++i)
+        vertices[i].y() = i % data.uniqueCount;
+    std::shuffle(vertices.begin(), vertices.end(), std::minstd_rand{std::random_device{}()});
+
+    Containers::Array<UnsignedInt> indexData{Containers::NoInit, data.count*3};
+    for(std::size_t i = 0; i != indexData.size(); ++i)
+        indexData[i] = (i*7) % data.count;
+
+    /* Not in-place */
+    Containers::Array<UnsignedInt> expected{Containers::NoInit, data.count};
+    Containers::Array<UnsignedInt> actual{Containers::NoInit, data.count};
+    UnsignedInt executorCalls = 0;
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInto(
+        Containers::arrayCast<2, const char>(Containers::arrayView(vertices)),
+        expected), data.uniqueCount);
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInto(
+        Containers::arrayCast<2, const char>(Containers::arrayView(vertices)),
+        actual, reverseOrderExecutor, &executorCalls), data.uniqueCount);
+    CORRADE_VERIFY(executorCalls);
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+
+    /* In-place */
+    Containers::Array<Vector3i> expectedVertices{Containers::NoInit, data.count};
+    Utility::copy(vertices, expectedVertices);
+    executorCalls = 0;
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInPlaceInto(
+        Containers::arrayCast<2, char>(Containers::arrayView(expectedVertices)),
+        expected), data.uniqueCount);
+    Containers::Array<Vector3i> actualVertices{Containers::NoInit, data.count};
+    Utility::copy(vertices, actualVertices);
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInPlaceInto(
+        Containers::arrayCast<2, char>(Containers::arrayView(actualVertices)),
+        actual, reverseOrderExecutor, &executorCalls), data.uniqueCount);
+    CORRADE_VERIFY(executorCalls);
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(actualVertices.prefix(data.uniqueCount),
+        expectedVertices.prefix(data.uniqueCount),
+        TestSuite::Compare::Container);
+
+    /* Indexed in-place */
+    Containers::Array<UnsignedInt> expectedIndices{Containers::NoInit, indexData.size()};
+    Utility::copy(indexData, expectedIndices);
+    Utility::copy(vertices, expectedVertices);
+    CORRADE_COMPARE(MeshTools::removeDuplicatesIndexedInPlace(
+        Containers::stridedArrayView(expectedIndices),
+        Containers::arrayCast<2, char>(Containers::arrayView(expectedVertices))),
+        data.uniqueCount);
+    Containers::Array<UnsignedInt> actualIndices{Containers::NoInit, indexData.size()};
+    Utility::copy(indexData, actualIndices);
+    Utility::copy(vertices, actualVertices);
+    executorCalls = 0;
+    CORRADE_COMPARE(MeshTools::removeDuplicatesIndexedInPlace(
+        Containers::stridedArrayView(actualIndices),
+        Containers::arrayCast<2, char>(Containers::arrayView(actualVertices)),
+        reverseOrderExecutor, &executorCalls), data.uniqueCount);
+    CORRADE_VERIFY(executorCalls);
+    CORRADE_COMPARE_AS(actualIndices, expectedIndices,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(actualVertices.prefix(data.uniqueCount),
+        expectedVertices.prefix(data.uniqueCount),
+        TestSuite::Compare::Container);
+}
+
+void RemoveDuplicatesTest::removeDuplicatesParallelNullExecutor() {
+    Int data[]{-15, 32, 24, -15, 15, 7541, 24, 32};
+
+    /* Should fall back to the serial implementation */
+    std::pair<Containers::Array<UnsignedInt>, std::size_t> result =
+        MeshTools::removeDuplicatesInPlace(Containers::arrayCast<2, char>(Containers::arrayView(data)), nullptr);
+    CORRADE_COMPARE(result.second, 5);
+    CORRADE_COMPARE_AS(Containers::arrayView(result.first),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 0, 3, 4, 2, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(result.second),
+        Containers::arrayView<Int>({-15, 32, 24, 15, 7541}),
+        TestSuite::Compare::Container);
+}
+
 template<class T> void RemoveDuplicatesTest::removeDuplicatesIndexedInPlace() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -470,6 +657,52 @@ void RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceIntoWrongOutputSize() {
         "MeshTools::removeDuplicatesFuzzyInPlaceInto(): output index array has 7 elements but expected 8\n");
 }
 
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceGrid() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Vectors not further than 1 in any dimension should be merged, with the
+       earliest one picked if there's more candidates */
+    Math::Vector2<T> data[]{
+        {T(0.0), T(0.0)},
+        {T(2.0), T(0.0)},
+        {T(1.0), T(0.0)}, /* Close to both 0 and 1 */
+        {T(0.0), T(4.0)},
+        {T(1.0), T(5.0)},
+        {T(5.0), T(5.0)}
+    };
+
+    std::pair<Containers::Array<UnsignedInt>, std::size_t> result =
+        MeshTools::removeDuplicatesFuzzyInPlace(
+            Containers::arrayCast<2, T>(Containers::stridedArrayView(data)),
+            T(1.0), MeshTools::RemoveDuplicatesFuzzyMode::Grid);
+    CORRADE_COMPARE_AS(Containers::arrayView(result.first),
+        Containers::arrayView<UnsignedInt>({0, 1, 0, 2, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(result.second),
+        Containers::arrayView<Math::Vector2<T>>({
+            {T(0.0), T(0.0)},
+            {T(2.0), T(0.0)},
+            {T(0.0), T(4.0)},
+            {T(5.0), T(5.0)}
+        }), TestSuite::Compare::Container);
+}
+
+void RemoveDuplicatesTest::removeDuplicatesFuzzyInPlaceGridTooManyDimensions() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Float data[10]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::removeDuplicatesFuzzyInPlace(
+        Containers::StridedArrayView2D<Float>{data, {2, 5}},
+        1.0f, MeshTools::RemoveDuplicatesFuzzyMode::Grid);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): grid mode supports at most four dimensions but got 5\n");
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 void RemoveDuplicatesTest::removeDuplicatesFuzzyStl() {
     /* Same but with implicit bloat. HEH HEH */
@@ -726,6 +959,30 @@ void RemoveDuplicatesTest::removeDuplicatesMeshDataAttributeless() {
         "MeshTools::removeDuplicates(): can't remove duplicates in an attributeless mesh\n");
 }
 
+void RemoveDuplicatesTest::removeDuplicatesMeshDataParallel() {
+    Vector3 positions[20000];
+    for(std::size_t i = 0; i != Containers::arraySize(positions); ++i)
+        positions[i] = {Float(i % 37), Float(i % 5), 1.0f};
+
+    Trade::MeshData mesh{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::arrayView(positions)}
+    }};
+
+    UnsignedInt executorCalls = 0;
+    Trade::MeshData expected = MeshTools::removeDuplicates(mesh);
+    Trade::MeshData actual = MeshTools::removeDuplicates(mesh, reverseOrderExecutor, &executorCalls);
+    CORRADE_VERIFY(executorCalls);
+    CORRADE_COMPARE(actual.vertexCount(), 185);
+    CORRADE_COMPARE(actual.vertexCount(), expected.vertexCount());
+    CORRADE_COMPARE_AS(actual.indices<UnsignedInt>(),
+        expected.indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(actual.attribute<Vector3>(Trade::MeshAttribute::Position),
+        expected.attribute<Vector3>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+}
+
 void RemoveDuplicatesTest::removeDuplicatesMeshDataFuzzy() {
     auto&& data = RemoveDuplicatesMeshDataFuzzyData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -1084,9 +1341,107 @@ void RemoveDuplicatesTest::soakTestFuzzy() {
         100);
 }
 
+void RemoveDuplicatesTest::soakTestFuzzyGrid() {
+    /* Array of 100 unique items with 10 duplicates each, randomly shuffled */
+    Float data[1000];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
+        data[i] = Float(Int(i/10) + testCaseRepeatId()*909091);
+    std::shuffle(std::begin(data), std::end(data), std::minstd_rand{std::random_device{}()});
+
+    CORRADE_COMPARE(MeshTools::removeDuplicatesFuzzyInPlace(
+        Containers::arrayCast<2, Float>(Containers::arrayView(data)),
+        Math::TypeTraits<Float>::epsilon(),
+        MeshTools::RemoveDuplicatesFuzzyMode::Grid).second,
+        100);
+}
+
+void RemoveDuplicatesTest::debugFuzzyMode() {
+    std::ostringstream out;
+    Debug{&out} << MeshTools::RemoveDuplicatesFuzzyMode::Grid << MeshTools::RemoveDuplicatesFuzzyMode(0xfe);
+    CORRADE_COMPARE(out.str(), "MeshTools::RemoveDuplicatesFuzzyMode::Grid MeshTools::RemoveDuplicatesFuzzyMode(0xfe)\n");
+}
+
 void RemoveDuplicatesTest::benchmark() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Array of unique items with duplicates, shuffled */
+    Containers::Array<Vector3i> vertices{Containers::ValueInit, 10000};
+    for(std::size_t i = 0; i != vertices.size(); ++i)
+        vertices[i].x() = i % data.uniqueCount;
+    std::shuffle(vertices.begin(), vertices.end(), std::minstd_rand{std::random_device{}()});
+
+    std::size_t count;
+    UnsignedInt indices[10000];
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInPlaceInto(
+            Containers::arrayCast<2, char>(Containers::arrayView(vertices)),
+            indices);
+
+    CORRADE_COMPARE(count, data.uniqueCount);
+}
+
+/* What removeDuplicatesInPlaceInto() would look like with a std::unordered_map
+   and a generic hash function, for comparison */
+struct ReferenceEqual {
+    explicit ReferenceEqual(std::size_t size): _size{size} {}
+
+    bool operator()(const void* a, const void* b) const {
+        return std::memcmp(a, b, _size) == 0;
+    }
+
+    private: std::size_t _size;
+};
+
+struct ReferenceHash {
+    explicit ReferenceHash(std::size_t size): _size{size} {}
+
+    std::size_t operator()(const void* a) const {
+        return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), _size).byteArray());
+    }
+
+    private: std::size_t _size;
+};
+
+std::size_t removeDuplicatesInPlaceIntoReference(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    std::unordered_map<const void*, UnsignedInt, ReferenceHash, ReferenceEqual> table{
+        data.size()[0],
+        ReferenceHash{data.size()[1]},
+        ReferenceEqual{data.size()[1]}};
+
+    for(std::size_t i = 0; i != data.size()[0]; ++i) {
+        const Containers::ArrayView<char> dst = data[table.size()].asContiguous();
+        if(i != table.size())
+            Utility::copy(data[i].asContiguous(), dst);
+        indices[i] = table.emplace(dst, table.size()).first->second;
+    }
+
+    return table.size();
+}
+
+void RemoveDuplicatesTest::benchmarkReference() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Same as benchmark() above */
+    Containers::Array<Vector3i> vertices{Containers::ValueInit, 10000};
+    for(std::size_t i = 0; i != vertices.size(); ++i)
+        vertices[i].x() = i % data.uniqueCount;
+    std::shuffle(vertices.begin(), vertices.end(), std::minstd_rand{std::random_device{}()});
+
+    std::size_t count;
+    UnsignedInt indices[10000];
+    CORRADE_BENCHMARK(1)
+        count = removeDuplicatesInPlaceIntoReference(
+            Containers::arrayCast<2, char>(Containers::arrayView(vertices)),
+            indices);
+
+    CORRADE_COMPARE(count, data.uniqueCount);
+}
+
+void RemoveDuplicatesTest::benchmarkFuzzy() {
     /* Array of 100 unique items with 100 duplicates each, shuffled */
-    Vector3i data[10000];
+    Vector3 data[10000];
     for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
         data[i].x() = i/100;
     std::shuffle(std::begin(data), std::end(data), std::minstd_rand{std::random_device{}()});
@@ -1094,14 +1449,14 @@ void RemoveDuplicatesTest::benchmark() {
     std::size_t count;
     UnsignedInt indices[10000];
     CORRADE_BENCHMARK(1)
-        count = MeshTools::removeDuplicatesInPlaceInto(
-            Containers::arrayCast<2, char>(Containers::arrayView(data)),
+        count = MeshTools::removeDuplicatesFuzzyInPlaceInto(
+            Containers::arrayCast<2, Float>(Containers::arrayView(data)),
             indices);
 
     CORRADE_COMPARE(count, 100);
 }
 
-void RemoveDuplicatesTest::benchmarkFuzzy() {
+void RemoveDuplicatesTest::benchmarkFuzzyGrid() {
     /* Array of 100 unique items with 100 duplicates each, shuffled */
     Vector3 data[10000];
     for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
@@ -1113,7 +1468,8 @@ void RemoveDuplicatesTest::benchmarkFuzzy() {
     CORRADE_BENCHMARK(1)
         count = MeshTools::removeDuplicatesFuzzyInPlaceInto(
             Containers::arrayCast<2, Float>(Containers::arrayView(data)),
-            indices);
+            indices, Math::TypeTraits<Float>::epsilon(),
+            MeshTools::RemoveDuplicatesFuzzyMode::Grid);
 
     CORRADE_COMPARE(count, 100);
 }
@@ -0,0 +1,439 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Simplify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct SimplifyTest: TestSuite::Tester {
+    explicit SimplifyTest();
+
+    template<class T> void flat();
+    void targetIndexCount();
+    void targetError();
+    void seam();
+    void empty();
+    void wrongIndexCount();
+    void indexOutOfBounds();
+
+    template<class T> void erased();
+    void erasedNonContiguous();
+    void erasedWrongIndexSize();
+
+    void meshData();
+    void meshDataNotTriangles();
+    void meshDataNotIndexed();
+    void meshDataNoPositions();
+
+    void levels();
+    void levelsErrorLimit();
+    void levelsInvalid();
+};
+
+SimplifyTest::SimplifyTest() {
+    addTests({&SimplifyTest::flat<UnsignedByte>,
+              &SimplifyTest::flat<UnsignedShort>,
+              &SimplifyTest::flat<UnsignedInt>,
+              &SimplifyTest::targetIndexCount,
+              &SimplifyTest::targetError,
+              &SimplifyTest::seam,
+              &SimplifyTest::empty,
+              &SimplifyTest::wrongIndexCount,
+              &SimplifyTest::indexOutOfBounds,
+
+              &SimplifyTest::erased<UnsignedByte>,
+              &SimplifyTest::erased<UnsignedShort>,
+              &SimplifyTest::erased<UnsignedInt>,
+              &SimplifyTest::erasedNonContiguous,
+              &SimplifyTest::erasedWrongIndexSize,
+
+              &SimplifyTest::meshData,
+              &SimplifyTest::meshDataNotTriangles,
+              &SimplifyTest::meshDataNotIndexed,
+              &SimplifyTest::meshDataNoPositions,
+
+              &SimplifyTest::levels,
+              &SimplifyTest::levelsErrorLimit,
+              &SimplifyTest::levelsInvalid});
+}
+
+/* A flat 10x10 quad grid in the XY plane, 121 vertices and 600 indices */
+constexpr UnsignedInt GridSize = 10;
+constexpr UnsignedInt GridVertexCount = (GridSize + 1)*(GridSize + 1);
+constexpr UnsignedInt GridIndexCount = GridSize*GridSize*6;
+
+Containers::Array<Vector3> gridPositions() {
+    Containers::Array<Vector3> positions{Containers::NoInit, GridVertexCount};
+    for(UnsignedInt y = 0; y != GridSize + 1; ++y)
+        for(UnsignedInt x = 0; x != GridSize + 1; ++x)
+            positions[y*(GridSize + 1) + x] = {Float(x), Float(y), 0.0f};
+    return positions;
+}
+
+template<class T> Containers::Array<T> gridIndices() {
+    Containers::Array<T> indices{Containers::NoInit, GridIndexCount};
+    std::size_t i = 0;
+    for(UnsignedInt y = 0; y != GridSize; ++y) {
+        for(UnsignedInt x = 0; x != GridSize; ++x) {
+            const T a = y*(GridSize + 1) + x;
+            const T b = a + 1;
+            const T c = a + GridSize + 1;
+            const T d = c + 1;
+            for(const T index: {a, b, d, a, d, c})
+                indices[i++] = index;
+        }
+    }
+    return indices;
+}
+
+/* Sorted unique indices referenced by the mesh */
+template<class T> Containers::Array<UnsignedInt> referencedVertices(const Containers::ArrayView<const T> indices) {
+    Containers::Array<UnsignedInt> out{Containers::NoInit, indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i) out[i] = indices[i];
+    std::sort(out.begin(), out.end());
+    const std::size_t count = std::unique(out.begin(), out.end()) - out.begin();
+    Containers::Array<UnsignedInt> unique{Containers::NoInit, count};
+    for(std::size_t i = 0; i != count; ++i) unique[i] = out[i];
+    return unique;
+}
+
+template<class T> void SimplifyTest::flat() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Containers::Array<T> indices = gridIndices<T>();
+    Containers::Array<Vector3> positions = gridPositions();
+
+    /* A flat grid can be collapsed down to two triangles with no error,
+       keeping the four corners */
+    Float error = -1.0f;
+    std::size_t count = simplifyInPlace(Containers::stridedArrayView(indices), positions, 6, 1.0e-3f, &error);
+    CORRADE_COMPARE(count, 6);
+    CORRADE_COMPARE_AS(error, 1.0e-5f, TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(referencedVertices<T>(indices.prefix(count)),
+        Containers::arrayView<UnsignedInt>({0, 10, 110, 120}),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::targetIndexCount() {
+    Containers::Array<UnsignedInt> indices = gridIndices<UnsignedInt>();
+    Containers::Array<Vector3> positions = gridPositions();
+
+    /* Each collapse removes at most two triangles so it can't overshoot by
+       more than one */
+    std::size_t count = simplifyInPlace(Containers::stridedArrayView(indices), positions, 300);
+    CORRADE_COMPARE_AS(count, 300, TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(count, 297, TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE(count % 3, 0);
+
+    /* Target larger than the index count is a no-op */
+    Float error = -1.0f;
+    CORRADE_COMPARE(simplifyInPlace(Containers::stridedArrayView(indices).prefix(count), positions, 1000, 0.01f, &error), count);
+    CORRADE_COMPARE(error, 0.0f);
+}
+
+void SimplifyTest::targetError() {
+    Containers::Array<UnsignedInt> indices = gridIndices<UnsignedInt>();
+    Containers::Array<Vector3> positions = gridPositions();
+
+    /* Raise the center vertex, it's not possible to collapse it or anything
+       around it without a large error */
+    positions[60].z() = 1.0f;
+
+    Float error = -1.0f;
+    std::size_t count = simplifyInPlace(Containers::stridedArrayView(indices), positions, 0, 1.0e-3f, &error);
+    CORRADE_COMPARE_AS(count, 6, TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(error, 1.0e-3f, TestSuite::Compare::LessOrEqual);
+    Containers::Array<UnsignedInt> referenced = referencedVertices<UnsignedInt>(indices.prefix(count));
+    CORRADE_VERIFY(std::binary_search(referenced.begin(), referenced.end(), 60));
+
+    /* With a large enough error it collapses to just two triangles */
+    indices = gridIndices<UnsignedInt>();
+    count = simplifyInPlace(Containers::stridedArrayView(indices), positions, 6, 1.0f, &error);
+    CORRADE_COMPARE(count, 6);
+    CORRADE_COMPARE_AS(error, 1.0e-3f, TestSuite::Compare::Greater);
+}
+
+void SimplifyTest::seam() {
+    /* Duplicate the middle column of vertices and use the copies for the
+       right half of the grid, as if it had a texture coordinate seam */
+    Containers::Array<Vector3> grid = gridPositions();
+    Containers::Array<Vector3> positions{Containers::NoInit, GridVertexCount + GridSize + 1};
+    Containers::Array<UnsignedInt> indices = gridIndices<UnsignedInt>();
+    for(std::size_t i = 0; i != GridVertexCount; ++i)
+        positions[i] = grid[i];
+    for(UnsignedInt y = 0; y != GridSize + 1; ++y)
+        positions[GridVertexCount + y] = positions[y*(GridSize + 1) + 5];
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        if(positions[indices[i]].x() == 5.0f && (i/6)%GridSize >= 5)
+            indices[i] = GridVertexCount + indices[i]/(GridSize + 1);
+
+    Float error = -1.0f;
+    std::size_t count = simplifyInPlace(Containers::stridedArrayView(indices), positions, 6, 1.0e-3f, &error);
+    CORRADE_COMPARE_AS(count, 6, TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(count, GridIndexCount/4, TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(error, 1.0e-5f, TestSuite::Compare::Less);
+
+    /* All vertices on both sides of the seam are kept */
+    Containers::Array<UnsignedInt> referenced = referencedVertices<UnsignedInt>(indices.prefix(count));
+    for(UnsignedInt y = 0; y != GridSize + 1; ++y) {
+        CORRADE_ITERATION(y);
+        CORRADE_VERIFY(std::binary_search(referenced.begin(), referenced.end(), y*(GridSize + 1) + 5));
+        CORRADE_VERIFY(std::binary_search(referenced.begin(), referenced.end(), GridVertexCount + y));
+    }
+}
+
+void SimplifyTest::empty() {
+    /* Shouldn't crash or anything */
+    CORRADE_COMPARE(simplifyInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, Containers::StridedArrayView1D<const Vector3>{}, 0), 0);
+}
+
+void SimplifyTest::wrongIndexCount() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    UnsignedByte indices[7]{};
+    Vector3 positions[1];
+    simplifyInPlace(indices, positions, 0);
+    CORRADE_COMPARE(out.str(), "MeshTools::simplifyInPlace(): index count not divisible by 3\n");
+}
+
+void SimplifyTest::indexOutOfBounds() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    UnsignedInt indices[]{0, 1, 3};
+    Vector3 positions[3];
+    simplifyInPlace(indices, positions, 0);
+    CORRADE_COMPARE(out.str(), "MeshTools::simplifyInPlace(): index 3 out of bounds for 3 vertices\n");
+}
+
+template<class T> void SimplifyTest::erased() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Containers::Array<T> indices = gridIndices<T>();
+    Containers::Array<Vector3> positions = gridPositions();
+
+    std::size_t count = simplifyInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)), positions, 6);
+    CORRADE_COMPARE(count, 6);
+    CORRADE_COMPARE_AS(referencedVertices<T>(indices.prefix(count)),
+        Containers::arrayView<UnsignedInt>({0, 10, 110, 120}),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::erasedNonContiguous() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char indices[6*4]{};
+    Vector3 positions[1];
+
+    std::stringstream out;
+    Error redirectError{&out};
+    simplifyInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, positions, 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplifyInPlace(): second index view dimension is not contiguous\n");
+}
+
+void SimplifyTest::erasedWrongIndexSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char indices[6*3]{};
+    Vector3 positions[1];
+
+    std::stringstream out;
+    Error redirectError{&out};
+    simplifyInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}.every(2), positions, 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplifyInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+/* Deliberately not interleaved to verify the function handles that */
+struct GridVertexData {
+    Vector3 positions[GridVertexCount];
+    Vector2 textureCoordinates[GridVertexCount];
+};
+
+Trade::MeshData gridMesh(GridVertexData& vertexData, const Containers::ArrayView<const UnsignedShort> indices) {
+    Containers::Array<Vector3> positions = gridPositions();
+    for(std::size_t i = 0; i != GridVertexCount; ++i) {
+        vertexData.positions[i] = positions[i];
+        vertexData.textureCoordinates[i] = positions[i].xy()/Float(GridSize);
+    }
+
+    return Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, Containers::arrayView(&vertexData, 1), {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::arrayView(vertexData.positions)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+                Containers::arrayView(vertexData.textureCoordinates)}
+        }};
+}
+
+void SimplifyTest::meshData() {
+    Containers::Array<UnsignedShort> indices = gridIndices<UnsignedShort>();
+    GridVertexData vertexData[1];
+    Trade::MeshData mesh = gridMesh(vertexData[0], indices);
+
+    Float error = -1.0f;
+    Trade::MeshData simplified = simplify(mesh, 6, 1.0e-3f, &error);
+    CORRADE_COMPARE(simplified.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(simplified.isIndexed());
+    CORRADE_COMPARE(simplified.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(simplified.indexCount(), 6);
+    CORRADE_COMPARE_AS(error, 1.0e-5f, TestSuite::Compare::Less);
+
+    /* Unreferenced vertices are removed, attributes stay matched to each
+       other */
+    CORRADE_COMPARE(simplified.vertexCount(), 4);
+    CORRADE_COMPARE(simplified.attributeCount(), 2);
+    Containers::Array<Vector3> positions = simplified.positions3DAsArray();
+    Containers::Array<Vector2> textureCoordinates = simplified.textureCoordinates2DAsArray();
+    for(std::size_t i = 0; i != simplified.vertexCount(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(textureCoordinates[i], positions[i].xy()/Float(GridSize));
+        CORRADE_VERIFY(positions[i].x() == 0.0f || positions[i].x() == Float(GridSize));
+        CORRADE_VERIFY(positions[i].y() == 0.0f || positions[i].y() == Float(GridSize));
+    }
+}
+
+void SimplifyTest::meshDataNotTriangles() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+    simplify(Trade::MeshData{MeshPrimitive::Lines, 2}, 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplify(): expected a triangle mesh, got MeshPrimitive::Lines\n");
+}
+
+void SimplifyTest::meshDataNotIndexed() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+    simplify(Trade::MeshData{MeshPrimitive::Triangles, 3}, 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplify(): the mesh is not indexed\n");
+}
+
+void SimplifyTest::meshDataNoPositions() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const UnsignedShort indices[]{0, 0, 0};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    simplify(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 1}, 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplify(): the mesh has no positions\n");
+}
+
+void SimplifyTest::levels() {
+    Containers::Array<UnsignedShort> indices = gridIndices<UnsignedShort>();
+    GridVertexData vertexData[1];
+    Trade::MeshData mesh = gridMesh(vertexData[0], indices);
+
+    Containers::Array<Trade::MeshData> levels = simplifyLevels(mesh, 4);
+    CORRADE_COMPARE(levels.size(), 4);
+
+    /* First level is the original */
+    CORRADE_COMPARE(levels[0].indexCount(), GridIndexCount);
+    CORRADE_COMPARE(levels[0].vertexCount(), GridVertexCount);
+    CORRADE_COMPARE_AS(levels[0].indices<UnsignedShort>(),
+        Containers::stridedArrayView(indices),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE_AS(levels[1].indexCount(), GridIndexCount/2, TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(levels[2].indexCount(), GridIndexCount/4, TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(levels[3].indexCount(), GridIndexCount/8, TestSuite::Compare::LessOrEqual);
+    for(std::size_t i = 1; i != levels.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(levels[i].vertexCount(), levels[i - 1].vertexCount(), TestSuite::Compare::Less);
+    }
+}
+
+void SimplifyTest::levelsErrorLimit() {
+    Containers::Array<UnsignedShort> indices = gridIndices<UnsignedShort>();
+    GridVertexData vertexData[1];
+    Trade::MeshData mesh = gridMesh(vertexData[0], indices);
+
+    /* The grid can't get below two triangles, so the chain stops early */
+    Containers::Array<Trade::MeshData> levels = simplifyLevels(mesh, 16);
+    CORRADE_COMPARE_AS(levels.size(), 16, TestSuite::Compare::Less);
+    CORRADE_COMPARE(levels[levels.size() - 1].indexCount(), 6);
+    for(std::size_t i = 1; i != levels.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(levels[i].indexCount(), levels[i - 1].indexCount(), TestSuite::Compare::Less);
+    }
+}
+
+void SimplifyTest::levelsInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+    simplifyLevels(Trade::MeshData{MeshPrimitive::Triangles, 3}, 0);
+    simplifyLevels(Trade::MeshData{MeshPrimitive::Triangles, 3}, 2, 1.0f);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplifyLevels(): expected at least one level\n"
+        "MeshTools::simplifyLevels(): expected ratio to be between 0 and 1 but got 1\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyTest)
@@ -24,9 +24,12 @@
 */
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <set>
 #include <sstream>
+#include <thread>
+#include <vector>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/DebugStl.h>
@@ -76,7 +79,8 @@ information.
 @code{.sh}
 magnum-sceneconverter [-h|--help] [-I|--importer IMPORTER]
     [-I|--converter CONVERTER]... [--plugin-dir DIR] [--remove-duplicates]
-    [--remove-duplicates-fuzzy EPSILON]
+    [--remove-duplicates-fuzzy EPSILON] [--remove-duplicates-fuzzy-grid]
+    [--threads N]
     [-i|--importer-options key=val,key2=val2,…]
     [-c|--converter-options key=val,key2=val2,…]... [--mesh MESH]
     [--level LEVEL] [--info] [--bounds] [-v|--verbose] [--profile]
@@ -97,8 +101,13 @@ Arguments:
 -   `--remove-duplicates` --- remove duplicate vertices using
     @ref MeshTools::removeDuplicates(const Trade::MeshData&) after import
 -   `--remove-duplicates-fuzzy EPSILON` --- remove duplicate vertices using
-    @ref MeshTools::removeDuplicatesFuzzy(const Trade::MeshData&, Float, Double)
+    @ref MeshTools::removeDuplicatesFuzzy(const Trade::MeshData&, Float, Double, MeshTools::RemoveDuplicatesFuzzyMode)
     after import
+-   `--remove-duplicates-fuzzy-grid` --- use
+    @ref MeshTools::RemoveDuplicatesFuzzyMode::Grid for
+    `--remove-duplicates-fuzzy`
+-   `--threads N` --- number of threads to use for operations that support
+    parallel execution, such as `--remove-duplicates` (default: `1`)
 -   `-i`, `--importer-options key=val,key2=val2,…` --- configuration options to
     pass to the importer
 -   `-c`, `--converter-options key=val,key2=val2,…` --- configuration options
@@ -177,6 +186,22 @@ struct Duration {
         std::chrono::high_resolution_clock::time_point _t;
 };
 
+/* Executes the tasks on given count of threads, including the calling one,
+   each picking the next task from a shared counter */
+void threadExecutor(const UnsignedInt count, void(*const task)(UnsignedInt, void*), void* const state, void* const userData) {
+    const UnsignedInt threadCount = Math::min(*static_cast<const UnsignedInt*>(userData), count);
+    std::atomic<UnsignedInt> next{0};
+    const auto worker = [&]() {
+        for(UnsignedInt i; (i = next++) < count; ) task(i, state);
+    };
+
+    std::vector<std::thread> threads;
+    for(UnsignedInt i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for(std::thread& thread: threads) thread.join();
+}
+
 /** @todo const Array& doesn't work, minmax() would fail to match */
 template<class T> std::string calculateBounds(Containers::Array<T>&& attribute) {
     /** @todo clean up when Debug::toString() exists */
@@ -206,6 +231,8 @@ int main(int argc, char** argv) {
         .addOption("only-attributes").setHelp("only-attributes", "include only attributes of given IDs in the output", "\"i j …\"")
         .addBooleanOption("remove-duplicates").setHelp("remove-duplicates", "remove duplicate vertices in the mesh after import")
         .addOption("remove-duplicates-fuzzy").setHelp("remove-duplicates-fuzzy", "remove duplicate vertices with fuzzy comparison in the mesh after import", "EPSILON")
+        .addBooleanOption("remove-duplicates-fuzzy-grid").setHelp("remove-duplicates-fuzzy-grid", "use grid-based neighbor lookup for fuzzy duplicate removal")
+        .addOption("threads", "1").setHelp("threads", "number of threads to use for operations that support parallel execution", "N")
         .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
         .addArrayOption('c', "converter-options").setHelp("converter-options", "configuration options to pass to the converter(s)", "key=val,key2=val2,…")
         .addOption("mesh", "0").setHelp("mesh", "mesh to import")
@@ -728,7 +755,11 @@ used.)")
         const UnsignedInt beforeVertexCount = mesh->vertexCount();
         {
             Duration d{conversionTime};
-            mesh = MeshTools::removeDuplicates(*std::move(mesh));
+            UnsignedInt threadCount = args.value<UnsignedInt>("threads");
+            if(threadCount > 1)
+                mesh = MeshTools::removeDuplicates(*std::move(mesh), threadExecutor, &threadCount);
+            else
+                mesh = MeshTools::removeDuplicates(*std::move(mesh));
         }
         if(args.isSet("verbose"))
             Debug{} << "Duplicate removal:" << beforeVertexCount << "->" << mesh->vertexCount() << "vertices";
@@ -740,7 +771,12 @@ used.)")
         const UnsignedInt beforeVertexCount = mesh->vertexCount();
         {
             Duration d{conversionTime};
-            mesh = MeshTools::removeDuplicatesFuzzy(*std::move(mesh), args.value<Float>("remove-duplicates-fuzzy"));
+            mesh = MeshTools::removeDuplicatesFuzzy(*std::move(mesh),
+                args.value<Float>("remove-duplicates-fuzzy"),
+                Math::TypeTraits<Double>::epsilon(),
+                args.isSet("remove-duplicates-fuzzy-grid") ?
+                    MeshTools::RemoveDuplicatesFuzzyMode::Grid :
+                    MeshTools::RemoveDuplicatesFuzzyMode::Discretized);
         }
         if(args.isSet("verbose"))
             Debug{} << "Fuzzy duplicate removal:" << beforeVertexCount << "->" << mesh->vertexCount() << "vertices";
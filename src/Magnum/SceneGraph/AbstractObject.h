@@ -31,6 +31,7 @@
 
 #include <functional>
 #include <vector>
+#include <Corrade/Containers/Containers.h>
 #include <Corrade/Containers/LinkedList.h>
 
 #include "Magnum/DimensionTraits.h"
@@ -185,6 +186,21 @@ template<UnsignedInt dimensions, class T> class AbstractObject
             return doTransformationMatrices(objects, finalTransformationMatrix);
         }
 
+        /**
+         * @brief Calculate transformation matrices of given set of objects relative to this object into a pre-allocated view
+         * @m_since_latest
+         *
+         * Same as @ref transformationMatrices(), but puts the result into
+         * @p transformationMatrices instead of allocating a new array.
+         * Expects that both views have the same size.
+         * @warning This function cannot check if all objects are of the same
+         *      @ref Object type, use typesafe
+         *      @ref Object::transformationMatricesInto() when possible.
+         */
+        void transformationMatricesInto(const Containers::StridedArrayView1D<AbstractObject<dimensions, T>* const>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix = MatrixType()) const {
+            doTransformationMatricesInto(objects, transformationMatrices, finalTransformationMatrix);
+        }
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -270,6 +286,7 @@ template<UnsignedInt dimensions, class T> class AbstractObject
         virtual MatrixType doTransformationMatrix() const = 0;
         virtual MatrixType doAbsoluteTransformationMatrix() const = 0;
         virtual std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& finalTransformationMatrix) const = 0;
+        virtual void doTransformationMatricesInto(const Containers::StridedArrayView1D<AbstractObject<dimensions, T>* const>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix) const = 0;
 
         virtual bool doIsDirty() const = 0;
         virtual void doSetDirty() = 0;
@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::SceneGraph::Camera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, alias @ref Magnum::SceneGraph::BasicCamera2D, @ref Magnum::SceneGraph::BasicCamera3D, typedef @ref Magnum::SceneGraph::Camera2D, @ref Magnum::SceneGraph::Camera3D
  */
 
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneGraph/AbstractFeature.h"
@@ -196,14 +198,78 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
          */
         std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> drawableTransformations(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Calculate drawable transformations into a pre-allocated view
+         * @m_since_latest
+         *
+         * Puts camera-relative transformation of each drawable in @p group
+         * into the corresponding item of @p transformations. Expects that
+         * the view has the same size as @p group. Unlike
+         * @ref drawableTransformations(), once the internal temporary storage
+         * grows large enough, this function doesn't allocate. The
+         * transformations can be then passed to @ref Drawable::draw()
+         * directly.
+         * @see @ref Object::transformationMatricesInto()
+         */
+        void drawableTransformationsInto(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, T>>& transformations);
+
         /**
          * @brief Draw
          *
-         * Draws given group of drawables.
+         * Draws given group of drawables. Temporary storage for drawable
+         * transformations is kept in the camera and reused by subsequent
+         * calls, so once it grows large enough, drawing doesn't allocate.
          * @see @ref draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&)
          */
         void draw(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Draw with frustum culling
+         * @m_since_latest
+         *
+         * Like @ref draw(DrawableGroup<dimensions, T>&), but calls
+         * @ref Drawable::draw() only for drawables whose bounding volume
+         * intersects the camera frustum. Drawables with
+         * @ref DrawableBoundingVolume::None are always drawn. As the
+         * drawable transformations are already relative to the camera, the
+         * bounding volumes are transformed with them and tested against
+         * @ref Math::Frustum::fromMatrix() "Frustum::fromMatrix()" of
+         * @ref projectionMatrix() alone, which is equivalent to testing
+         * world-space volumes against a frustum made from
+         * @cpp projectionMatrix()*cameraMatrix() @ce. The transformed volumes
+         * are gathered into separate contiguous arrays for spheres and
+         * boxes and tested using @ref Math::Intersection::sphereFrustum()
+         * and @ref Math::Intersection::aabbFrustum(). A 2D projection is
+         * treated as a 3D one with the Z coordinate left untouched.
+         *
+         * Counts of visible and culled drawables are available through
+         * @ref visibleDrawableCount() and @ref culledDrawableCount()
+         * afterwards. Like with @ref draw(DrawableGroup<dimensions, T>&), the
+         * temporary storage is kept in the camera and reused by subsequent
+         * calls. See @ref SceneGraph-Drawable-bounding-volumes for more
+         * information.
+         */
+        void drawCulled(DrawableGroup<dimensions, T>& group);
+
+        /**
+         * @brief Count of drawables drawn by last @ref drawCulled() call
+         * @m_since_latest
+         *
+         * Includes drawables that have no bounding volume. Initially
+         * @cpp 0 @ce.
+         * @see @ref culledDrawableCount()
+         */
+        std::size_t visibleDrawableCount() const { return _visibleDrawableCount; }
+
+        /**
+         * @brief Count of drawables culled by last @ref drawCulled() call
+         * @m_since_latest
+         *
+         * Initially @cpp 0 @ce.
+         * @see @ref visibleDrawableCount()
+         */
+        std::size_t culledDrawableCount() const { return _culledDrawableCount; }
+
         /**
          * @brief Draw given drawables with transformations
          *
@@ -228,6 +294,24 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         MatrixTypeFor<dimensions, T> _cameraMatrix;
 
         Vector2i _viewport;
+
+        /* Scratch storage for drawable transformation calculation, kept
+           across frames to avoid repeated allocations */
+        Containers::Array<AbstractObject<dimensions, T>*> _drawableObjects;
+        Containers::Array<MatrixTypeFor<dimensions, T>> _drawableTransformations;
+
+        /* Scratch storage for drawCulled(). Camera-relative bounding volumes
+           are split by type into SoA arrays, together with index of the
+           drawable they belong to. The visibility flags are used as a stack
+           like _drawableTransformations. */
+        Containers::Array<Math::Vector3<T>> _cullSphereCenters;
+        Containers::Array<T> _cullSphereRadii;
+        Containers::Array<UnsignedInt> _cullSphereDrawables;
+        Containers::Array<Math::Vector3<T>> _cullBoxCenters;
+        Containers::Array<Math::Vector3<T>> _cullBoxExtents;
+        Containers::Array<UnsignedInt> _cullBoxDrawables;
+        Containers::Array<bool> _drawableVisible;
+        std::size_t _visibleDrawableCount{}, _culledDrawableCount{};
 };
 
 /**
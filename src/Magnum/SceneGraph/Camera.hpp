@@ -29,7 +29,12 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Camera.h
  */
 
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Intersection.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
 
@@ -53,6 +58,21 @@ template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRat
         Math::Vector2<T>(T(1), relativeAspectRatio.x()/relativeAspectRatio.y()), T(1)));
 }
 
+template<class T> inline Math::Matrix4<T> cullingProjectionMatrix(const Math::Matrix4<T>& projection) {
+    return projection;
+}
+
+/* Embeds a 2D projection into 3D, leaving the Z coordinate untouched. The
+   near and far planes are then Z = -W and Z = +W, which always contain the
+   Z = 0 plane the 2D bounding volumes are padded to. */
+template<class T> Math::Matrix4<T> cullingProjectionMatrix(const Math::Matrix3<T>& projection) {
+    return Math::Matrix4<T>{
+        Math::Vector4<T>{projection[0][0], projection[0][1], T(0), projection[0][2]},
+        Math::Vector4<T>{projection[1][0], projection[1][1], T(0), projection[1][2]},
+        Math::Vector4<T>{T(0), T(0), T(1), T(0)},
+        Math::Vector4<T>{projection[2][0], projection[2][1], T(0), projection[2][2]}};
+}
+
 }
 
 template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
@@ -83,47 +103,152 @@ template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::setViewpor
 }
 
 template<UnsignedInt dimensions, class T> std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> Camera<dimensions, T>::drawableTransformations(DrawableGroup<dimensions, T>& group) {
-    AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
-    CORRADE_ASSERT(scene, "Camera::draw(): cannot draw when camera is not part of any scene", {});
+    CORRADE_ASSERT(AbstractFeature<dimensions, T>::object().scene(), "Camera::draw(): cannot draw when camera is not part of any scene", {});
 
-    /* Compute camera matrix */
-    AbstractFeature<dimensions, T>::object().setClean();
-
-    /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
-    for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
-    std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
+    /* Compute transformations of all objects in the group relative to the
+       camera. The drawables may call into the camera recursively when
+       drawing, so the scratch storage is used as a stack. */
+    const std::size_t offset = _drawableTransformations.size();
+    Containers::arrayResize(_drawableTransformations, Containers::NoInit, offset + group.size());
+    drawableTransformationsInto(group, _drawableTransformations.slice(offset, offset + group.size()));
 
     /* Combine drawable references and transformation matrices */
     std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> combined;
     combined.reserve(group.size());
     for(std::size_t i = 0; i != group.size(); ++i)
-        combined.emplace_back(group[i], transformations[i]);
+        combined.emplace_back(group[i], _drawableTransformations[offset + i]);
 
+    Containers::arrayResize(_drawableTransformations, Containers::NoInit, offset);
     return combined;
 }
 
-template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group) {
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::drawableTransformationsInto(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, T>>& transformations) {
+    CORRADE_ASSERT(transformations.size() == group.size(),
+        "SceneGraph::Camera::drawableTransformationsInto(): expected" << group.size() << "transformations but got" << transformations.size(), );
     AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
-    CORRADE_ASSERT(scene, "SceneGraph::Camera::draw(): cannot draw when camera is not part of any scene", );
+    CORRADE_ASSERT(scene, "SceneGraph::Camera::drawableTransformationsInto(): camera is not part of any scene", );
 
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object().setClean();
 
-    /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
+    /* Compute transformations of all objects in the group relative to the
+       camera. Nothing in between can call back into the camera, so the
+       object list doesn't need to be treated as a stack. */
+    Containers::arrayResize(_drawableObjects, Containers::NoInit, group.size());
     for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
-    std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
+        _drawableObjects[i] = &group[i].object();
+    scene->transformationMatricesInto(Containers::arrayView(_drawableObjects), transformations, _cameraMatrix);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group) {
+    CORRADE_ASSERT(AbstractFeature<dimensions, T>::object().scene(), "SceneGraph::Camera::draw(): cannot draw when camera is not part of any scene", );
+
+    /* Compute transformations of all objects in the group relative to the
+       camera. The drawables may call into the camera recursively when
+       drawing, so the scratch storage is used as a stack. */
+    const std::size_t offset = _drawableTransformations.size();
+    Containers::arrayResize(_drawableTransformations, Containers::NoInit, offset + group.size());
+    drawableTransformationsInto(group, _drawableTransformations.slice(offset, offset + group.size()));
+
+    /* Perform the drawing. The transformation is copied out as a nested
+       draw() may grow the scratch storage, invalidating any references to
+       it. */
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        const MatrixTypeFor<dimensions, T> transformation = _drawableTransformations[offset + i];
+        group[i].draw(transformation, *this);
+    }
+
+    Containers::arrayResize(_drawableTransformations, Containers::NoInit, offset);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::drawCulled(DrawableGroup<dimensions, T>& group) {
+    CORRADE_ASSERT(AbstractFeature<dimensions, T>::object().scene(), "SceneGraph::Camera::drawCulled(): cannot draw when camera is not part of any scene", );
+
+    /* Compute transformations of all objects in the group relative to the
+       camera. Same as in draw(), the drawables may call into the camera
+       recursively, so the transformations and visibility flags are used as
+       a stack. */
+    const std::size_t offset = _drawableTransformations.size();
+    const std::size_t visibleOffset = _drawableVisible.size();
+    Containers::arrayResize(_drawableTransformations, Containers::NoInit, offset + group.size());
+    Containers::arrayResize(_drawableVisible, Containers::NoInit, visibleOffset + group.size());
+    drawableTransformationsInto(group, _drawableTransformations.slice(offset, offset + group.size()));
+
+    /* Transform the bounding volumes to be relative to the camera and gather
+       them into contiguous arrays. The rest of the scratch storage isn't
+       touched by anything until the intersection tests are done, so it
+       doesn't need to be treated as a stack. */
+    Containers::arrayResize(_cullSphereCenters, Containers::NoInit, group.size());
+    Containers::arrayResize(_cullSphereRadii, Containers::NoInit, group.size());
+    Containers::arrayResize(_cullSphereDrawables, Containers::NoInit, group.size());
+    Containers::arrayResize(_cullBoxCenters, Containers::NoInit, group.size());
+    Containers::arrayResize(_cullBoxExtents, Containers::NoInit, group.size());
+    Containers::arrayResize(_cullBoxDrawables, Containers::NoInit, group.size());
+    std::size_t sphereCount = 0, boxCount = 0;
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        const Drawable<dimensions, T>& drawable = group[i];
+        const MatrixTypeFor<dimensions, T>& transformation = _drawableTransformations[offset + i];
+
+        switch(drawable.boundingVolume()) {
+            case DrawableBoundingVolume::None:
+                _drawableVisible[visibleOffset + i] = true;
+                break;
+
+            /* Non-uniform scaling makes the sphere an ellipsoid, take the
+               largest axis */
+            case DrawableBoundingVolume::Sphere:
+                _cullSphereCenters[sphereCount] = Math::Vector3<T>::pad(transformation.transformPoint(drawable.boundingCenter()));
+                _cullSphereRadii[sphereCount] = drawable.boundingRadius()*transformation.scaling().max();
+                _cullSphereDrawables[sphereCount] = UnsignedInt(i);
+                ++sphereCount;
+                break;
+
+            /* Extents of an axis-aligned box enclosing the transformed box
+               are a sum of absolute values of the rotation-scaling columns
+               multiplied by the original extents */
+            case DrawableBoundingVolume::Box: {
+                const auto rotationScaling = transformation.rotationScaling();
+                const VectorTypeFor<dimensions, T> extents = drawable.boundingExtents();
+                Math::Vector<dimensions, T> transformedExtents;
+                for(std::size_t j = 0; j != dimensions; ++j)
+                    transformedExtents += Math::abs(rotationScaling[j])*extents[j];
+
+                _cullBoxCenters[boxCount] = Math::Vector3<T>::pad(transformation.transformPoint(drawable.boundingCenter()));
+                _cullBoxExtents[boxCount] = Math::Vector3<T>::pad(transformedExtents);
+                _cullBoxDrawables[boxCount] = UnsignedInt(i);
+                ++boxCount;
+            } break;
+        }
+    }
+
+    /* The sphere test measures distance from the planes, so they need to be
+       normalized. The box test is independent of the plane scale. */
+    Math::Frustum<T> frustum = Math::Frustum<T>::fromMatrix(Implementation::cullingProjectionMatrix(_projectionMatrix));
+    for(std::size_t i = 0; i != 6; ++i)
+        frustum[i] /= frustum[i].xyz().length();
+
+    for(std::size_t i = 0; i != sphereCount; ++i)
+        _drawableVisible[visibleOffset + _cullSphereDrawables[i]] = Math::Intersection::sphereFrustum(_cullSphereCenters[i], _cullSphereRadii[i], frustum);
+    for(std::size_t i = 0; i != boxCount; ++i)
+        _drawableVisible[visibleOffset + _cullBoxDrawables[i]] = Math::Intersection::aabbFrustum(_cullBoxCenters[i], _cullBoxExtents[i], frustum);
 
     /* Perform the drawing */
-    for(std::size_t i = 0; i != transformations.size(); ++i)
-        group[i].draw(transformations[i], *this);
+    std::size_t visibleCount = 0;
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        if(!_drawableVisible[visibleOffset + i]) continue;
+        /* Copied out for the same reason as in draw() */
+        const MatrixTypeFor<dimensions, T> transformation = _drawableTransformations[offset + i];
+        group[i].draw(transformation, *this);
+        ++visibleCount;
+    }
+
+    /* Update the stats only after drawing so recursive calls don't overwrite
+       them */
+    _visibleDrawableCount = visibleCount;
+    _culledDrawableCount = group.size() - visibleCount;
+
+    Containers::arrayResize(_drawableTransformations, Containers::NoInit, offset);
+    Containers::arrayResize(_drawableVisible, Containers::NoInit, visibleOffset);
 }
 
 template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>& drawableTransformations) {
@@ -29,10 +29,42 @@
  * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
  */
 
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+#include "Magnum/SceneGraph/visibility.h"
 
 namespace Magnum { namespace SceneGraph {
 
+/**
+@brief Drawable bounding volume type
+@m_since_latest
+
+@see @ref Drawable::boundingVolume(), @ref Camera::drawCulled()
+*/
+enum class DrawableBoundingVolume: UnsignedByte {
+    /**
+     * No bounding volume. The drawable is never culled. Default.
+     */
+    None,
+
+    /**
+     * Bounding sphere, set with @ref Drawable::setBoundingSphere().
+     */
+    Sphere,
+
+    /**
+     * Axis-aligned bounding box, set with @ref Drawable::setBoundingBox().
+     */
+    Box
+};
+
+/**
+@debugoperatorenum{DrawableBoundingVolume}
+@m_since_latest
+*/
+MAGNUM_SCENEGRAPH_EXPORT Debug& operator<<(Debug& debug, DrawableBoundingVolume value);
+
 /**
 @brief Drawable
 
@@ -133,6 +165,18 @@ get used in any way except being passed to the draw function:
 
 @snippet MagnumSceneGraph.cpp Drawable-culling
 
+@section SceneGraph-Drawable-bounding-volumes Built-in frustum culling
+
+Alternatively, each drawable can have a bounding sphere or a bounding box
+assigned via @ref setBoundingSphere() or @ref setBoundingBox(). Contrary to the
+above, the volumes are *local* to the object the drawable is attached to and
+are transformed together with it. Drawing the group with
+@ref Camera::drawCulled() then calls @ref draw() only for drawables whose
+bounding volume intersects the camera frustum. Drawables without a bounding
+volume are always drawn.
+
+@snippet MagnumSceneGraph.cpp Drawable-bounding-volumes
+
 @section SceneGraph-Drawable-explicit-specializations Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -178,6 +222,97 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
             return AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>::group();
         }
 
+        /**
+         * @brief Bounding volume type
+         * @m_since_latest
+         *
+         * Default is @ref DrawableBoundingVolume::None.
+         * @see @ref setBoundingSphere(), @ref setBoundingBox(),
+         *      @ref resetBoundingVolume()
+         */
+        DrawableBoundingVolume boundingVolume() const { return _boundingVolume; }
+
+        /**
+         * @brief Bounding volume center
+         * @m_since_latest
+         *
+         * Center of the bounding sphere or the bounding box, relative to the
+         * object the drawable is attached to. If @ref boundingVolume() is
+         * @ref DrawableBoundingVolume::None, returns a zero vector.
+         */
+        VectorTypeFor<dimensions, T> boundingCenter() const { return _boundingCenter; }
+
+        /**
+         * @brief Bounding sphere radius
+         * @m_since_latest
+         *
+         * If @ref boundingVolume() is not @ref DrawableBoundingVolume::Sphere,
+         * returns @cpp 0 @ce.
+         */
+        T boundingRadius() const {
+            return _boundingVolume == DrawableBoundingVolume::Sphere ? _boundingExtents[0] : T(0);
+        }
+
+        /**
+         * @brief Bounding box half-extents
+         * @m_since_latest
+         *
+         * If @ref boundingVolume() is not @ref DrawableBoundingVolume::Box,
+         * returns a zero vector.
+         */
+        VectorTypeFor<dimensions, T> boundingExtents() const {
+            return _boundingVolume == DrawableBoundingVolume::Box ? _boundingExtents : VectorTypeFor<dimensions, T>{};
+        }
+
+        /**
+         * @brief Set a bounding sphere
+         * @param center    Sphere center, relative to the object
+         * @param radius    Sphere radius
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Any non-uniform scaling of the object is accounted for by scaling
+         * the radius with the largest scaling factor.
+         * @see @ref Camera::drawCulled()
+         */
+        Drawable<dimensions, T>& setBoundingSphere(const VectorTypeFor<dimensions, T>& center, T radius) {
+            _boundingVolume = DrawableBoundingVolume::Sphere;
+            _boundingCenter = center;
+            _boundingExtents = VectorTypeFor<dimensions, T>{radius};
+            return *this;
+        }
+
+        /**
+         * @brief Set a bounding box
+         * @param box       Axis-aligned box, relative to the object
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * When transformed, the box is enlarged to an axis-aligned box
+         * enclosing all its corners.
+         * @see @ref Camera::drawCulled()
+         */
+        Drawable<dimensions, T>& setBoundingBox(const RangeTypeFor<dimensions, T>& box) {
+            _boundingVolume = DrawableBoundingVolume::Box;
+            _boundingCenter = box.center();
+            _boundingExtents = box.size()*T(0.5);
+            return *this;
+        }
+
+        /**
+         * @brief Reset the bounding volume
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * The drawable is then never culled by @ref Camera::drawCulled().
+         */
+        Drawable<dimensions, T>& resetBoundingVolume() {
+            _boundingVolume = DrawableBoundingVolume::None;
+            _boundingCenter = {};
+            _boundingExtents = {};
+            return *this;
+        }
+
         /**
          * @brief Draw the object using given camera
          * @param transformationMatrix  Object transformation relative to camera
@@ -187,6 +322,11 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          * @ref SceneGraph::Camera::projectionMatrix() "Camera::projectionMatrix()".
          */
         virtual void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) = 0;
+
+    private:
+        /* For a sphere all components of the extents are the radius */
+        VectorTypeFor<dimensions, T> _boundingCenter, _boundingExtents;
+        DrawableBoundingVolume _boundingVolume{};
 };
 
 /**
@@ -0,0 +1,351 @@
+#ifndef Magnum_SceneGraph_FlatHierarchy_h
+#define Magnum_SceneGraph_FlatHierarchy_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::FlatHierarchy
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/TaskExecutor.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Flat transformation hierarchy
+@m_since_latest
+
+Data-oriented alternative to the @ref Object tree for large scenes. Instead of
+heap-allocated objects linked together, the hierarchy is stored as contiguous
+arrays of parent indices, local transformations and absolute transformations,
+ordered so each node comes after its parent. Absolute transformations of all
+nodes are then calculated in @ref update() with a single linear pass over the
+arrays. There's no limit on the node count apart from available memory.
+
+The @p Transformation template parameter is one of the transformation
+implementations such as @ref MatrixTransformation3D or
+@ref RigidMatrixTransformation3D. Its @cpp DataType @ce is used for storing
+the transformations, which are then composed the same way as in the
+@ref Object tree:
+
+@snippet MagnumSceneGraph.cpp FlatHierarchy-usage
+
+@section SceneGraph-FlatHierarchy-order Node order
+
+Nodes are identified by their index, in order of @ref addNode() calls. A node
+can have only one of the preceding nodes as a parent, which keeps the arrays
+sorted parents-first without any extra work. The same holds for
+@ref setParent().
+
+@section SceneGraph-FlatHierarchy-dirty Incremental updates
+
+Changing a node transformation or parent, or adding a new node, marks the node
+dirty with @ref setDirty(), which records it in a queue. The next
+@ref update() then recalculates only subtrees of the queued nodes, going from
+the nodes with lowest indices so each node is recalculated at most once. In a
+mostly static scene with a few moving nodes the update is thus proportional to
+the size of the moving subtrees and not the size of the whole scene. The
+@ref updatedNodeCount() statistic shows how many nodes were recalculated in
+the last update.
+
+Modifying transformations through the mutable @ref transformations() view
+isn't tracked and thus causes the next @ref update() to recalculate all nodes.
+If only a few transformations are changed that way, use
+@ref setTransformation() instead.
+
+@section SceneGraph-FlatHierarchy-parallel Parallel updates
+
+For hierarchies with hundreds of thousands of nodes where a large part changes
+every frame, such as with skeletal animation of many characters, the
+@ref update(TaskExecutor, void*) overload distributes the work across tasks
+dispatched through a user-supplied @ref TaskExecutor. Nodes are grouped by
+their depth in the hierarchy and each level, if large enough, is split into
+independent tasks, as all parents of a level were calculated in the previous
+one. The results are bit-identical to the serial @ref update().
+
+@section SceneGraph-FlatHierarchy-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into the @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type or special transformation class) you have to use the
+@ref FlatHierarchy.hpp implementation file to avoid linker errors. See
+@ref compilation-speedup-hpp for more information.
+
+-   @ref FlatHierarchy "FlatHierarchy<DualComplexTransformation>"
+-   @ref FlatHierarchy "FlatHierarchy<DualQuaternionTransformation>"
+-   @ref FlatHierarchy "FlatHierarchy<MatrixTransformation2D>"
+-   @ref FlatHierarchy "FlatHierarchy<MatrixTransformation3D>"
+-   @ref FlatHierarchy "FlatHierarchy<RigidMatrixTransformation2D>"
+-   @ref FlatHierarchy "FlatHierarchy<RigidMatrixTransformation3D>"
+-   @ref FlatHierarchy "FlatHierarchy<TranslationRotationScalingTransformation2D>"
+-   @ref FlatHierarchy "FlatHierarchy<TranslationRotationScalingTransformation3D>"
+-   @ref FlatHierarchy "FlatHierarchy<TranslationTransformation2D>"
+-   @ref FlatHierarchy "FlatHierarchy<TranslationTransformation3D>"
+
+@see @ref scenegraph, @ref Object
+*/
+template<class Transformation> class FlatHierarchy {
+    public:
+        /** @brief Underlying transformation type */
+        typedef typename Transformation::DataType DataType;
+
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<Transformation::Dimensions, typename Transformation::Type> MatrixType;
+
+        enum: UnsignedInt {
+            /** Parent index of root nodes */
+            NoParent = 0xffffffffu
+        };
+
+        /**
+         * @brief Constructor
+         *
+         * Creates an empty hierarchy.
+         */
+        explicit FlatHierarchy();
+
+        /** @brief Copying is not allowed */
+        FlatHierarchy(const FlatHierarchy<Transformation>&) = delete;
+
+        /** @brief Move constructor */
+        FlatHierarchy(FlatHierarchy<Transformation>&&) noexcept;
+
+        ~FlatHierarchy();
+
+        /** @brief Copying is not allowed */
+        FlatHierarchy<Transformation>& operator=(const FlatHierarchy<Transformation>&) = delete;
+
+        /** @brief Move assignment */
+        FlatHierarchy<Transformation>& operator=(FlatHierarchy<Transformation>&&) noexcept;
+
+        /** @brief Node count */
+        std::size_t nodeCount() const { return _parents.size(); }
+
+        /**
+         * @brief Reserve memory for given node count
+         * @return Reference to self (for method chaining)
+         *
+         * Useful to avoid reallocations when the final node count is known
+         * upfront.
+         */
+        FlatHierarchy<Transformation>& reserve(std::size_t capacity);
+
+        /**
+         * @brief Add a node
+         * @param parent            Parent node index or @ref NoParent
+         * @param transformation    Local transformation
+         * @return Index of the new node
+         *
+         * Expects that @p parent is either @ref NoParent or less than
+         * @ref nodeCount(). The new node is marked as dirty, its absolute
+         * transformation is available after the next @ref update().
+         */
+        UnsignedInt addNode(UnsignedInt parent, const DataType& transformation = {});
+
+        /**
+         * @brief Parent indices
+         *
+         * Root nodes have the parent set to @ref NoParent, for all other
+         * nodes the parent index is less than the node index.
+         */
+        Containers::ArrayView<const UnsignedInt> parents() const { return _parents; }
+
+        /**
+         * @brief Parent index of given node
+         *
+         * Expects that @p node is less than @ref nodeCount().
+         * @see @ref parents()
+         */
+        UnsignedInt parent(UnsignedInt node) const;
+
+        /**
+         * @brief Set parent of given node
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p node is less than @ref nodeCount() and @p parent is
+         * either @ref NoParent or less than @p node. Marks the node as dirty.
+         * @see @ref setDirty()
+         */
+        FlatHierarchy<Transformation>& setParent(UnsignedInt node, UnsignedInt parent);
+
+        /** @brief Local transformations of all nodes */
+        Containers::ArrayView<const DataType> transformations() const { return _transformations; }
+
+        /**
+         * @brief Mutable local transformations of all nodes
+         *
+         * Meant for updating transformations of many nodes at once, for
+         * example from an animation. As modifications through the view can't
+         * be tracked, calling this function causes the next @ref update() to
+         * recalculate all nodes. See @ref SceneGraph-FlatHierarchy-dirty for
+         * more information.
+         */
+        Containers::ArrayView<DataType> transformations();
+
+        /**
+         * @brief Local transformation of given node
+         *
+         * Expects that @p node is less than @ref nodeCount().
+         */
+        DataType transformation(UnsignedInt node) const;
+
+        /**
+         * @brief Set local transformation of given node
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p node is less than @ref nodeCount(). Marks the node
+         * as dirty.
+         * @see @ref setDirty()
+         */
+        FlatHierarchy<Transformation>& setTransformation(UnsignedInt node, const DataType& transformation);
+
+        /**
+         * @brief Whether the hierarchy needs an update
+         *
+         * Returns @cpp true @ce if any node was marked as dirty since the last
+         * @ref update() or the mutable @ref transformations() view was
+         * accessed, @cpp false @ce otherwise.
+         */
+        bool isDirty() const;
+
+        /**
+         * @brief Mark a subtree as dirty
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p node is less than @ref nodeCount(). Records @p node
+         * in a queue of subtrees to be recalculated in the next
+         * @ref update(). Marking a node whose ancestor is already marked is
+         * cheap, as such node is then skipped during the update. Called
+         * implicitly from @ref addNode(), @ref setParent() and
+         * @ref setTransformation().
+         */
+        FlatHierarchy<Transformation>& setDirty(UnsignedInt node);
+
+        /**
+         * @brief Absolute transformations of all nodes
+         *
+         * Calculated in the last @ref update() call. If nodes were added
+         * since, the view contains just the nodes that were present at that
+         * point.
+         */
+        Containers::ArrayView<const DataType> absoluteTransformations() const {
+            return _absoluteTransformations;
+        }
+
+        /**
+         * @brief Absolute transformation of given node
+         *
+         * Calculated in the last @ref update() call. Expects that @p node is
+         * less than size of @ref absoluteTransformations().
+         */
+        DataType absoluteTransformation(UnsignedInt node) const;
+
+        /**
+         * @brief Absolute transformation matrix of given node
+         *
+         * Same as @ref absoluteTransformation() converted to a matrix.
+         */
+        MatrixType absoluteTransformationMatrix(UnsignedInt node) const;
+
+        /**
+         * @brief Update absolute transformations
+         * @return Reference to self (for method chaining)
+         *
+         * Composes local transformation of each node in subtrees marked with
+         * @ref setDirty() with the absolute transformation of its parent,
+         * going from the lowest node indices so parents are always updated
+         * before their children. If the mutable @ref transformations() view
+         * was accessed since the last update, goes through all nodes in a
+         * single linear pass instead. If nothing is dirty, the function is a
+         * no-op.
+         * @see @ref absoluteTransformations(), @ref updatedNodeCount()
+         */
+        FlatHierarchy<Transformation>& update();
+
+        /**
+         * @brief Count of nodes recalculated in the last update
+         *
+         * Useful for verifying that only the expected part of the hierarchy
+         * gets recalculated. Initially @cpp 0 @ce.
+         */
+        std::size_t updatedNodeCount() const { return _updatedNodeCount; }
+
+        /**
+         * @brief Update absolute transformations using a parallel task executor
+         * @return Reference to self (for method chaining)
+         *
+         * Same as @ref update(), but with the work distributed across tasks
+         * dispatched via @p executor, which gets passed
+         * @p executorUserData. The nodes are processed level by level, each
+         * level waiting for the previous one to finish, and only levels
+         * large enough to benefit from it are split into multiple tasks. The
+         * grouping into levels is recalculated only after @ref addNode() or
+         * @ref setParent() was called. Unlike @ref update(), this function
+         * always goes through all nodes to find the dirty subtrees, so it's
+         * best suited for cases where a large part of the hierarchy changes
+         * --- for a few moving nodes in a large static scene the serial
+         * variant will be faster. The output is always the same as with
+         * the serial variant. If @p executor is @cpp nullptr @ce, the serial
+         * variant is used.
+         * @see @ref SceneGraph-FlatHierarchy-parallel
+         */
+        FlatHierarchy<Transformation>& update(TaskExecutor executor, void* executorUserData = nullptr);
+
+    private:
+        MAGNUM_SCENEGRAPH_LOCAL void attach(UnsignedInt node, UnsignedInt parent);
+        MAGNUM_SCENEGRAPH_LOCAL void detach(UnsignedInt node, UnsignedInt parent);
+        MAGNUM_SCENEGRAPH_LOCAL void updateLevels();
+        MAGNUM_SCENEGRAPH_LOCAL static void updateLevelTask(UnsignedInt id, void* state);
+
+        Containers::Array<UnsignedInt> _parents;
+        /* Intrusive child lists for traversing subtrees of dirty nodes,
+           NoParent marks the end */
+        Containers::Array<UnsignedInt> _firstChildren;
+        Containers::Array<UnsignedInt> _nextSiblings;
+        Containers::Array<DataType> _transformations;
+        Containers::Array<DataType> _absoluteTransformations;
+        /* Nodes passed to setDirty() since the last update, each at most once
+           thanks to the flags */
+        Containers::Array<bool> _dirty;
+        Containers::Array<UnsignedInt> _dirtyNodes;
+        /* Node indices grouped by their depth for parallel updates, the
+           offsets have an extra item at the end. Calculated lazily, only
+           if _levelsDirty is set. */
+        Containers::Array<UnsignedInt> _levelNodes;
+        Containers::Array<UnsignedInt> _levelOffsets;
+        std::size_t _updatedNodeCount{};
+        bool _allDirty{};
+        bool _levelsDirty{};
+};
+
+}}
+
+#endif
@@ -0,0 +1,351 @@
+#ifndef Magnum_SceneGraph_FlatHierarchy_hpp
+#define Magnum_SceneGraph_FlatHierarchy_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FlatHierarchy.h
+ * @m_since_latest
+ */
+
+#include <algorithm>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/SceneGraph/FlatHierarchy.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+template<class Transformation> struct FlatHierarchyUpdateState {
+    /* Splitting each level into at most 256 tasks, each having at least 1024
+       nodes so the task dispatch overhead doesn't dominate */
+    enum: UnsignedInt {
+        MaxTaskCount = 256,
+        MinTaskSize = 1024
+    };
+
+    const UnsignedInt* parents;
+    const UnsignedInt* levelNodes;
+    const typename Transformation::DataType* transformations;
+    typename Transformation::DataType* absoluteTransformations;
+    bool* dirty;
+    std::size_t levelBegin, levelEnd;
+    UnsignedInt taskCount;
+    std::size_t updatedNodeCounts[MaxTaskCount];
+};
+
+}
+
+template<class Transformation> FlatHierarchy<Transformation>::FlatHierarchy() = default;
+
+template<class Transformation> FlatHierarchy<Transformation>::FlatHierarchy(FlatHierarchy<Transformation>&&) noexcept = default;
+
+template<class Transformation> FlatHierarchy<Transformation>::~FlatHierarchy() = default;
+
+template<class Transformation> FlatHierarchy<Transformation>& FlatHierarchy<Transformation>::operator=(FlatHierarchy<Transformation>&&) noexcept = default;
+
+template<class Transformation> FlatHierarchy<Transformation>& FlatHierarchy<Transformation>::reserve(const std::size_t capacity) {
+    Containers::arrayReserve(_parents, capacity);
+    Containers::arrayReserve(_firstChildren, capacity);
+    Containers::arrayReserve(_nextSiblings, capacity);
+    Containers::arrayReserve(_transformations, capacity);
+    Containers::arrayReserve(_dirty, capacity);
+    return *this;
+}
+
+template<class Transformation> UnsignedInt FlatHierarchy<Transformation>::addNode(const UnsignedInt parent, const DataType& transformation) {
+    CORRADE_ASSERT(parent == NoParent || parent < _parents.size(),
+        "SceneGraph::FlatHierarchy::addNode(): parent index" << parent << "out of range for" << _parents.size() << "nodes", {});
+
+    const UnsignedInt id = _parents.size();
+    Containers::arrayAppend(_parents, parent);
+    Containers::arrayAppend(_firstChildren, UnsignedInt(NoParent));
+    Containers::arrayAppend(_nextSiblings, UnsignedInt(NoParent));
+    Containers::arrayAppend(_transformations, transformation);
+    Containers::arrayAppend(_dirty, false);
+    attach(id, parent);
+    setDirty(id);
+    _levelsDirty = true;
+    return id;
+}
+
+template<class Transformation> void FlatHierarchy<Transformation>::attach(const UnsignedInt node, const UnsignedInt parent) {
+    if(parent == NoParent) return;
+    _nextSiblings[node] = _firstChildren[parent];
+    _firstChildren[parent] = node;
+}
+
+template<class Transformation> void FlatHierarchy<Transformation>::detach(const UnsignedInt node, const UnsignedInt parent) {
+    if(parent == NoParent) return;
+    UnsignedInt* next = &_firstChildren[parent];
+    while(*next != node) next = &_nextSiblings[*next];
+    *next = _nextSiblings[node];
+    _nextSiblings[node] = NoParent;
+}
+
+template<class Transformation> UnsignedInt FlatHierarchy<Transformation>::parent(const UnsignedInt node) const {
+    CORRADE_ASSERT(node < _parents.size(),
+        "SceneGraph::FlatHierarchy::parent(): index" << node << "out of range for" << _parents.size() << "nodes", {});
+    return _parents[node];
+}
+
+template<class Transformation> FlatHierarchy<Transformation>& FlatHierarchy<Transformation>::setParent(const UnsignedInt node, const UnsignedInt parent) {
+    CORRADE_ASSERT(node < _parents.size(),
+        "SceneGraph::FlatHierarchy::setParent(): index" << node << "out of range for" << _parents.size() << "nodes", *this);
+    CORRADE_ASSERT(parent == NoParent || parent < node,
+        "SceneGraph::FlatHierarchy::setParent(): parent index" << parent << "doesn't precede node" << node, *this);
+    if(_parents[node] == parent) return *this;
+    detach(node, _parents[node]);
+    attach(node, parent);
+    _parents[node] = parent;
+    _levelsDirty = true;
+    return setDirty(node);
+}
+
+template<class Transformation> auto FlatHierarchy<Transformation>::transformation(const UnsignedInt node) const -> DataType {
+    CORRADE_ASSERT(node < _transformations.size(),
+        "SceneGraph::FlatHierarchy::transformation(): index" << node << "out of range for" << _transformations.size() << "nodes", {});
+    return _transformations[node];
+}
+
+template<class Transformation> FlatHierarchy<Transformation>& FlatHierarchy<Transformation>::setTransformation(const UnsignedInt node, const DataType& transformation) {
+    CORRADE_ASSERT(node < _transformations.size(),
+        "SceneGraph::FlatHierarchy::setTransformation(): index" << node << "out of range for" << _transformations.size() << "nodes", *this);
+    _transformations[node] = transformation;
+    return setDirty(node);
+}
+
+template<class Transformation> Containers::ArrayView<typename Transformation::DataType> FlatHierarchy<Transformation>::transformations() {
+    _allDirty = true;
+    return _transformations;
+}
+
+template<class Transformation> bool FlatHierarchy<Transformation>::isDirty() const {
+    return _allDirty || !_dirtyNodes.empty();
+}
+
+template<class Transformation> FlatHierarchy<Transformation>& FlatHierarchy<Transformation>::setDirty(const UnsignedInt node) {
+    CORRADE_ASSERT(node < _dirty.size(),
+        "SceneGraph::FlatHierarchy::setDirty(): index" << node << "out of range for" << _dirty.size() << "nodes", *this);
+    if(!_dirty[node]) {
+        _dirty[node] = true;
+        Containers::arrayAppend(_dirtyNodes, node);
+    }
+    return *this;
+}
+
+template<class Transformation> auto FlatHierarchy<Transformation>::absoluteTransformation(const UnsignedInt node) const -> DataType {
+    CORRADE_ASSERT(node < _absoluteTransformations.size(),
+        "SceneGraph::FlatHierarchy::absoluteTransformation(): index" << node << "out of range for" << _absoluteTransformations.size() << "updated nodes", {});
+    return _absoluteTransformations[node];
+}
+
+template<class Transformation> auto FlatHierarchy<Transformation>::absoluteTransformationMatrix(const UnsignedInt node) const -> MatrixType {
+    CORRADE_ASSERT(node < _absoluteTransformations.size(),
+        "SceneGraph::FlatHierarchy::absoluteTransformationMatrix(): index" << node << "out of range for" << _absoluteTransformations.size() << "updated nodes", {});
+    return Implementation::Transformation<Transformation>::toMatrix(_absoluteTransformations[node]);
+}
+
+template<class Transformation> FlatHierarchy<Transformation>& FlatHierarchy<Transformation>::update() {
+    const std::size_t nodeCount = _parents.size();
+    if(_absoluteTransformations.size() != nodeCount)
+        Containers::arrayResize(_absoluteTransformations, Containers::NoInit, nodeCount);
+
+    /* Caching the pointers to avoid function calls in debug builds */
+    const UnsignedInt* const parents = _parents.data();
+    const DataType* const transformations = _transformations.data();
+    DataType* const absoluteTransformations = _absoluteTransformations.data();
+    bool* const dirty = _dirty.data();
+
+    /* The mutable view was accessed, we don't know what changed so
+       recalculate everything in a single linear pass */
+    if(_allDirty) {
+        for(std::size_t i = 0; i != nodeCount; ++i) {
+            const UnsignedInt parent = parents[i];
+            absoluteTransformations[i] = parent == NoParent ? transformations[i] :
+                Implementation::Transformation<Transformation>::compose(absoluteTransformations[parent], transformations[i]);
+            dirty[i] = false;
+        }
+
+        _updatedNodeCount = nodeCount;
+
+    /* Otherwise recalculate just the dirty subtrees. Processing them in
+       ascending order means an ancestor always gets processed before its
+       descendants, and its traversal clears their dirty flags so they're not
+       visited again. */
+    } else {
+        const UnsignedInt* const firstChildren = _firstChildren.data();
+        const UnsignedInt* const nextSiblings = _nextSiblings.data();
+        std::sort(_dirtyNodes.begin(), _dirtyNodes.end());
+
+        std::size_t updatedNodeCount = 0;
+        for(const UnsignedInt root: _dirtyNodes) {
+            if(!dirty[root]) continue;
+
+            /* Depth-first traversal without a stack, using the child and
+               sibling links and climbing back up through parents */
+            UnsignedInt node = root;
+            for(;;) {
+                const UnsignedInt parent = parents[node];
+                absoluteTransformations[node] = parent == NoParent ? transformations[node] :
+                    Implementation::Transformation<Transformation>::compose(absoluteTransformations[parent], transformations[node]);
+                dirty[node] = false;
+                ++updatedNodeCount;
+
+                if(firstChildren[node] != NoParent) {
+                    node = firstChildren[node];
+                    continue;
+                }
+
+                while(node != root && nextSiblings[node] == NoParent)
+                    node = parents[node];
+                if(node == root) break;
+                node = nextSiblings[node];
+            }
+        }
+
+        _updatedNodeCount = updatedNodeCount;
+    }
+
+    Containers::arrayResize(_dirtyNodes, Containers::NoInit, 0);
+    _allDirty = false;
+    return *this;
+}
+
+template<class Transformation> void FlatHierarchy<Transformation>::updateLevels() {
+    /* Calculate depth of each node, again relying on parents being first */
+    const std::size_t nodeCount = _parents.size();
+    Containers::Array<UnsignedInt> depths{Containers::NoInit, nodeCount};
+    UnsignedInt levelCount = 0;
+    for(std::size_t i = 0; i != nodeCount; ++i) {
+        const UnsignedInt parent = _parents[i];
+        depths[i] = parent == NoParent ? 0 : depths[parent] + 1;
+        if(depths[i] + 1 > levelCount) levelCount = depths[i] + 1;
+    }
+
+    /* Count nodes in each level and turn the counts into offsets */
+    _levelOffsets = Containers::Array<UnsignedInt>{Containers::ValueInit, std::size_t(levelCount) + 1};
+    for(std::size_t i = 0; i != nodeCount; ++i)
+        ++_levelOffsets[depths[i] + 1];
+    for(std::size_t i = 1; i <= levelCount; ++i)
+        _levelOffsets[i] += _levelOffsets[i - 1];
+
+    /* Scatter the nodes to their levels, keeping them in ascending order
+       inside each level. The offsets get shifted by one level in the
+       process, shift them back. */
+    if(_levelNodes.size() != nodeCount)
+        _levelNodes = Containers::Array<UnsignedInt>{Containers::NoInit, nodeCount};
+    for(std::size_t i = 0; i != nodeCount; ++i)
+        _levelNodes[_levelOffsets[depths[i]]++] = UnsignedInt(i);
+    for(std::size_t i = levelCount; i != 0; --i)
+        _levelOffsets[i] = _levelOffsets[i - 1];
+    _levelOffsets[0] = 0;
+}
+
+template<class Transformation> void FlatHierarchy<Transformation>::updateLevelTask(const UnsignedInt id, void* const statePointer) {
+    auto& state = *static_cast<Implementation::FlatHierarchyUpdateState<Transformation>*>(statePointer);
+    const std::size_t levelSize = state.levelEnd - state.levelBegin;
+    const std::size_t begin = state.levelBegin + std::size_t(UnsignedLong(levelSize)*id/state.taskCount);
+    const std::size_t end = state.levelBegin + std::size_t(UnsignedLong(levelSize)*(id + 1)/state.taskCount);
+
+    /* A node is recalculated if it was marked as dirty or if its parent was
+       recalculated in the previous level, in which case it gets marked as
+       dirty for the next level. Each task writes only flags of nodes in its
+       own range and reads only flags from the previous level, so there's no
+       data race. */
+    std::size_t updatedNodeCount = 0;
+    for(std::size_t i = begin; i != end; ++i) {
+        const UnsignedInt node = state.levelNodes[i];
+        const UnsignedInt parent = state.parents[node];
+        if(parent == NoParent) {
+            if(!state.dirty[node]) continue;
+            state.absoluteTransformations[node] = state.transformations[node];
+        } else {
+            if(!state.dirty[node] && !state.dirty[parent]) continue;
+            state.dirty[node] = true;
+            state.absoluteTransformations[node] = Implementation::Transformation<Transformation>::compose(state.absoluteTransformations[parent], state.transformations[node]);
+        }
+        ++updatedNodeCount;
+    }
+
+    state.updatedNodeCounts[id] += updatedNodeCount;
+}
+
+template<class Transformation> FlatHierarchy<Transformation>& FlatHierarchy<Transformation>::update(const TaskExecutor executor, void* const executorUserData) {
+    if(!executor) return update();
+
+    if(!isDirty()) {
+        _updatedNodeCount = 0;
+        return *this;
+    }
+
+    const std::size_t nodeCount = _parents.size();
+    if(_absoluteTransformations.size() != nodeCount)
+        Containers::arrayResize(_absoluteTransformations, Containers::NoInit, nodeCount);
+    if(_levelsDirty) {
+        updateLevels();
+        _levelsDirty = false;
+    }
+    if(_allDirty) std::fill_n(_dirty.data(), nodeCount, true);
+
+    typedef Implementation::FlatHierarchyUpdateState<Transformation> State;
+    State state;
+    state.parents = _parents.data();
+    state.levelNodes = _levelNodes.data();
+    state.transformations = _transformations.data();
+    state.absoluteTransformations = _absoluteTransformations.data();
+    state.dirty = _dirty.data();
+    std::fill_n(state.updatedNodeCounts, std::size_t(State::MaxTaskCount), std::size_t{});
+
+    /* Levels have to be processed one after another, only nodes inside a
+       level are independent. Small levels are processed directly without
+       going through the executor. */
+    for(std::size_t level = 0; level + 1 < _levelOffsets.size(); ++level) {
+        state.levelBegin = _levelOffsets[level];
+        state.levelEnd = _levelOffsets[level + 1];
+        const std::size_t levelSize = state.levelEnd - state.levelBegin;
+        state.taskCount = 1;
+        while(state.taskCount < State::MaxTaskCount && state.taskCount*std::size_t(State::MinTaskSize) < levelSize)
+            state.taskCount *= 2;
+
+        if(state.taskCount == 1) updateLevelTask(0, &state);
+        else executor(state.taskCount, updateLevelTask, &state, executorUserData);
+    }
+
+    _updatedNodeCount = 0;
+    for(const std::size_t count: state.updatedNodeCounts)
+        _updatedNodeCount += count;
+
+    std::fill_n(_dirty.data(), nodeCount, false);
+    Containers::arrayResize(_dirtyNodes, Containers::NoInit, 0);
+    _allDirty = false;
+    return *this;
+}
+
+}}
+
+#endif
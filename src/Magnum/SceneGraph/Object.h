@@ -304,6 +304,38 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
             #endif
             ) const;
 
+        /**
+         * @brief Calculate transformation matrices of given set of objects relative to this object into a pre-allocated view
+         * @m_since_latest
+         *
+         * Same as @ref transformationMatrices(), but puts the result into
+         * @p transformationMatrices instead of allocating a new array.
+         * Expects that both views have the same size. Temporary storage
+         * needed for the calculation is kept in the @ref Scene and reused by
+         * subsequent calls, so once it grows large enough the function
+         * doesn't allocate anymore.
+         * @see @ref transformationsInto()
+         */
+        void transformationMatricesInto(const Containers::StridedArrayView1D<Object<Transformation>* const>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix = MatrixType()) const;
+
+        /**
+         * @brief Calculate transformations of given set of objects relative to this object into a pre-allocated view
+         * @m_since_latest
+         *
+         * Same as @ref transformations(), but puts the result into
+         * @p transformations instead of allocating a new array. Expects that
+         * both views have the same size. See
+         * @ref transformationMatricesInto() for more information about
+         * memory allocation.
+         */
+        void transformationsInto(const Containers::StridedArrayView1D<Object<Transformation>* const>& objects, const Containers::StridedArrayView1D<typename Transformation::DataType>& transformations, const typename Transformation::DataType& finalTransformation =
+            #ifndef CORRADE_MSVC2015_COMPATIBILITY /* I hate this inconsistency */
+            typename Transformation::DataType()
+            #else
+            Transformation::DataType()
+            #endif
+            ) const;
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -388,8 +420,10 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         }
 
         std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& finalTransformationMatrix) const override final;
+        void doTransformationMatricesInto(const Containers::StridedArrayView1D<AbstractObject<Transformation::Dimensions, typename Transformation::Type>* const>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix) const override final;
 
-        typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const;
+        bool MAGNUM_SCENEGRAPH_LOCAL transformationsInternal(const Scene<Transformation>& scene, std::size_t objectOffset, const typename Transformation::DataType& finalTransformation) const;
+        typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(Object<Transformation>* const* jointObjects, typename Transformation::DataType* jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const;
 
         bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return isDirty(); }
         void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
@@ -400,7 +434,7 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
 
         typedef Implementation::ObjectFlag Flag;
         typedef Implementation::ObjectFlags Flags;
-        UnsignedShort counter;
+        UnsignedInt counter;
         Flags flags;
 };
 
@@ -30,7 +30,8 @@
  */
 
 #include <algorithm>
-#include <stack>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/SceneGraph/AbstractTransformation.h"
 #include "Magnum/SceneGraph/Object.h"
@@ -43,7 +44,7 @@ template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~Abstra
 
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 
-template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFu), flags(Flag::Dirty) {
+template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFFFFFu), flags(Flag::Dirty) {
     setParent(parent);
 }
 
@@ -137,12 +138,18 @@ template<class Transformation> void Object<Transformation>::setClean() {
     /* The object (and all its parents) are already clean, nothing to do */
     if(!(flags & Flag::Dirty)) return;
 
-    /* Collect all parents, compute base transformation */
-    std::stack<Object<Transformation>*> objects;
+    /* Collect all parents, compute base transformation. If the object is
+       part of a scene, its scratch storage is used to avoid allocating
+       every time. The features cleaned below may recursively clean other
+       objects, so it's used as a stack and indexed instead of iterated. */
+    Scene<Transformation>* const scene = this->scene();
+    Containers::Array<Object<Transformation>*> localObjects;
+    Containers::Array<Object<Transformation>*>& objects = scene ? scene->_scratchObjects : localObjects;
+    const std::size_t objectOffset = objects.size();
     typename Transformation::DataType absoluteTransformation;
     Object<Transformation>* p = static_cast<Object<Transformation>*>(this);
     for(;;) {
-        objects.push(p);
+        Containers::arrayAppend(objects, p);
 
         p = p->parent();
 
@@ -158,9 +165,8 @@ template<class Transformation> void Object<Transformation>::setClean() {
     }
 
     /* Clean features on every collected object, going down from root object */
-    while(!objects.empty()) {
-        Object<Transformation>* o = objects.top();
-        objects.pop();
+    for(std::size_t i = objects.size(); i != objectOffset; --i) {
+        Object<Transformation>* o = objects[i - 1];
 
         /* Compose transformation and clean object */
         absoluteTransformation = Implementation::Transformation<Transformation>::compose(absoluteTransformation, o->transformation());
@@ -168,6 +174,8 @@ template<class Transformation> void Object<Transformation>::setClean() {
         o->setCleanInternal(absoluteTransformation);
         CORRADE_ASSERT(!o->isDirty(), "SceneGraph::Object::setClean(): original implementation was not called", );
     }
+
+    Containers::arrayResize(objects, Containers::NoInit, objectOffset);
 }
 
 template<class Transformation> auto Object<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& finalTransformationMatrix) const -> std::vector<MatrixType> {
@@ -188,6 +196,86 @@ template<class Transformation> auto Object<Transformation>::transformationMatric
     return transformationMatrices;
 }
 
+template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& finalTransformation) const {
+    const Scene<Transformation>* const scene = this->scene();
+    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
+
+    const std::size_t objectOffset = scene->_scratchObjects.size();
+    const std::size_t transformationOffset = scene->_scratchTransformations.size();
+    for(Object<Transformation>& object: objects)
+        Containers::arrayAppend(scene->_scratchObjects, &object);
+
+    std::vector<typename Transformation::DataType> transformations;
+    if(transformationsInternal(*scene, objectOffset, finalTransformation)) {
+        const typename Transformation::DataType* const data = scene->_scratchTransformations.data() + transformationOffset;
+        transformations.assign(data, data + objects.size());
+    }
+
+    Containers::arrayResize(scene->_scratchObjects, Containers::NoInit, objectOffset);
+    Containers::arrayResize(scene->_scratchTransformations, Containers::NoInit, transformationOffset);
+    return transformations;
+}
+
+template<class Transformation> void Object<Transformation>::transformationsInto(const Containers::StridedArrayView1D<Object<Transformation>* const>& objects, const Containers::StridedArrayView1D<typename Transformation::DataType>& transformations, const typename Transformation::DataType& finalTransformation) const {
+    CORRADE_ASSERT(transformations.size() == objects.size(),
+        "SceneGraph::Object::transformationsInto(): expected" << objects.size() << "transformations but got" << transformations.size(), );
+    const Scene<Transformation>* const scene = this->scene();
+    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationsInto(): currently implemented only for Scene", );
+
+    const std::size_t objectOffset = scene->_scratchObjects.size();
+    const std::size_t transformationOffset = scene->_scratchTransformations.size();
+    for(Object<Transformation>* const object: objects)
+        Containers::arrayAppend(scene->_scratchObjects, object);
+
+    if(transformationsInternal(*scene, objectOffset, finalTransformation)) {
+        for(std::size_t i = 0; i != objects.size(); ++i)
+            transformations[i] = scene->_scratchTransformations[transformationOffset + i];
+    }
+
+    Containers::arrayResize(scene->_scratchObjects, Containers::NoInit, objectOffset);
+    Containers::arrayResize(scene->_scratchTransformations, Containers::NoInit, transformationOffset);
+}
+
+template<class Transformation> void Object<Transformation>::transformationMatricesInto(const Containers::StridedArrayView1D<Object<Transformation>* const>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix) const {
+    CORRADE_ASSERT(transformationMatrices.size() == objects.size(),
+        "SceneGraph::Object::transformationMatricesInto(): expected" << objects.size() << "transformations but got" << transformationMatrices.size(), );
+    const Scene<Transformation>* const scene = this->scene();
+    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatricesInto(): currently implemented only for Scene", );
+
+    const std::size_t objectOffset = scene->_scratchObjects.size();
+    const std::size_t transformationOffset = scene->_scratchTransformations.size();
+    for(Object<Transformation>* const object: objects)
+        Containers::arrayAppend(scene->_scratchObjects, object);
+
+    if(transformationsInternal(*scene, objectOffset, Implementation::Transformation<Transformation>::fromMatrix(finalTransformationMatrix))) {
+        for(std::size_t i = 0; i != objects.size(); ++i)
+            transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(scene->_scratchTransformations[transformationOffset + i]);
+    }
+
+    Containers::arrayResize(scene->_scratchObjects, Containers::NoInit, objectOffset);
+    Containers::arrayResize(scene->_scratchTransformations, Containers::NoInit, transformationOffset);
+}
+
+template<class Transformation> void Object<Transformation>::doTransformationMatricesInto(const Containers::StridedArrayView1D<AbstractObject<Transformation::Dimensions, typename Transformation::Type>* const>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix) const {
+    CORRADE_ASSERT(transformationMatrices.size() == objects.size(),
+        "SceneGraph::AbstractObject::transformationMatricesInto(): expected" << objects.size() << "transformations but got" << transformationMatrices.size(), );
+    const Scene<Transformation>* const scene = this->scene();
+    CORRADE_ASSERT(scene == this, "SceneGraph::AbstractObject::transformationMatricesInto(): currently implemented only for Scene", );
+
+    const std::size_t objectOffset = scene->_scratchObjects.size();
+    const std::size_t transformationOffset = scene->_scratchTransformations.size();
+    for(AbstractObject<Transformation::Dimensions, typename Transformation::Type>* const object: objects)
+        Containers::arrayAppend(scene->_scratchObjects, static_cast<Object<Transformation>*>(object));
+
+    if(transformationsInternal(*scene, objectOffset, Implementation::Transformation<Transformation>::fromMatrix(finalTransformationMatrix))) {
+        for(std::size_t i = 0; i != objects.size(); ++i)
+            transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(scene->_scratchTransformations[transformationOffset + i]);
+    }
+
+    Containers::arrayResize(scene->_scratchObjects, Containers::NoInit, objectOffset);
+    Containers::arrayResize(scene->_scratchTransformations, Containers::NoInit, transformationOffset);
+}
+
 /*
 Computing absolute transformations for given list of objects
 
@@ -201,123 +289,124 @@ divided into two groups:
 Then for all joints their transformation (relative to parent joint) is
 computed and recursively concatenated together. Resulting transformations for
 joints which were originally in `object` list is then returned.
+
+The objects are expected to be at the end of scene scratch storage starting at
+`objectOffset`, newly discovered joints are appended after them. The resulting
+transformations are appended to the scene transformation scratch storage, with
+the first items corresponding to the objects. The caller is responsible for
+removing both from the scratch storage after.
 */
-template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& finalTransformation) const {
-    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
+template<class Transformation> bool Object<Transformation>::transformationsInternal(const Scene<Transformation>& scene, const std::size_t objectOffset, const typename Transformation::DataType& finalTransformation) const {
+    Containers::Array<Object<Transformation>*>& jointObjects = scene._scratchObjects;
 
     /* Remember object count for later */
-    std::size_t objectCount = objects.size();
+    const std::size_t objectCount = jointObjects.size() - objectOffset;
+
+    /* Mark all original objects as joints, they form the initial list of
+       joints */
+    for(std::size_t i = 0; i != objectCount; ++i) {
+        Object<Transformation>& o = *jointObjects[objectOffset + i];
 
-    /* Mark all original objects as joints and create initial list of joints
-       from them */
-    for(std::size_t i = 0; i != objects.size(); ++i) {
         /* Multiple occurences of one object in the array, don't overwrite it
            with different counter */
-        if(objects[i].get().counter != 0xFFFFu) continue;
+        if(o.counter != 0xFFFFFFFFu) continue;
 
-        objects[i].get().counter = UnsignedShort(i);
-        objects[i].get().flags |= Flag::Joint;
+        o.counter = UnsignedInt(i);
+        o.flags |= Flag::Joint;
     }
-    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects(objects);
 
-    #ifndef CORRADE_NO_ASSERT
-    /* Scene object */
-    const Scene<Transformation>* scene = this->scene();
-    #endif
+    /* Mark all objects up the hierarchy as visited. Each object is walked up
+       only until it reaches an object that's already visited or is a joint,
+       so every object is visited just once. */
+    for(std::size_t i = 0; i != objectCount; ++i) {
+        Object<Transformation>* o = jointObjects[objectOffset + i];
 
-    /* Nearest common ancestor not yet implemented - assert this is done on scene */
-    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
+        /* Already visited (duplicate occurence), nothing to do */
+        if(o->flags & Flag::Visited) continue;
 
-    /* Mark all objects up the hierarchy as visited */
-    auto it = objects.begin();
-    while(!objects.empty()) {
-        /* Already visited, remove and continue to next (duplicate occurence) */
-        if(it->get().flags & Flag::Visited) {
-            it = objects.erase(it);
-            continue;
-        }
+        for(;;) {
+            /* Mark the object as visited */
+            o->flags |= Flag::Visited;
 
-        /* Mark the object as visited */
-        it->get().flags |= Flag::Visited;
+            Object<Transformation>* parent = o->parent();
 
-        Object<Transformation>* parent = it->get().parent();
-
-        /* If this is root object, remove from list */
-        if(!parent) {
-            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
-            it = objects.erase(it);
-
-        /* Parent is an joint or already visited - remove current from list */
-        } else if(parent->flags & (Flag::Visited|Flag::Joint)) {
-            it = objects.erase(it);
-
-            /* If not already marked as joint, mark it as such and add it to
-               list of joint objects */
-            if(!(parent->flags & Flag::Joint)) {
-                CORRADE_ASSERT(jointObjects.size() < 0xFFFFu,
-                               "SceneGraph::Object::transformations(): too large scene", {});
-                CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFu);
-                parent->counter = UnsignedShort(jointObjects.size());
-                parent->flags |= Flag::Joint;
-                jointObjects.push_back(*parent);
+            /* If this is root object, done */
+            if(!parent) {
+                CORRADE_ASSERT(o == &scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", false);
+                break;
             }
 
-        /* Else go up the hierarchy */
-        } else *it = *parent;
+            /* Parent is a joint or already visited, done */
+            if(parent->flags & (Flag::Visited|Flag::Joint)) {
+                /* If not already marked as joint, mark it as such and add it
+                   to list of joint objects */
+                if(!(parent->flags & Flag::Joint)) {
+                    CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFFFFFu);
+                    parent->counter = UnsignedInt(jointObjects.size() - objectOffset);
+                    parent->flags |= Flag::Joint;
+                    Containers::arrayAppend(jointObjects, parent);
+                }
+                break;
+            }
 
-        /* Cycle if reached end */
-        if(it == objects.end()) it = objects.begin();
+            /* Else go up the hierarchy */
+            o = parent;
+        }
     }
 
     /* Array of absolute transformations in joints */
-    std::vector<typename Transformation::DataType> jointTransformations(jointObjects.size());
+    const std::size_t jointCount = jointObjects.size() - objectOffset;
+    Containers::Array<typename Transformation::DataType>& scratchTransformations = scene._scratchTransformations;
+    const std::size_t transformationOffset = scratchTransformations.size();
+    Containers::arrayResize(scratchTransformations, Containers::NoInit, transformationOffset + jointCount);
+    Object<Transformation>* const* const joints = jointObjects.data() + objectOffset;
+    typename Transformation::DataType* const jointTransformations = scratchTransformations.data() + transformationOffset;
 
     /* Compute transformations for all joints */
-    for(std::size_t i = 0; i != jointTransformations.size(); ++i)
-        computeJointTransformation(jointObjects, jointTransformations, i, finalTransformation);
+    for(std::size_t i = 0; i != jointCount; ++i)
+        computeJointTransformation(joints, jointTransformations, i, finalTransformation);
 
     /* Copy transformation for second or next occurences from first occurence
        of duplicate object */
     for(std::size_t i = 0; i != objectCount; ++i) {
-        if(jointObjects[i].get().counter != i)
-            jointTransformations[i] = jointTransformations[jointObjects[i].get().counter];
+        if(joints[i]->counter != i)
+            jointTransformations[i] = jointTransformations[joints[i]->counter];
     }
 
     /* All visited marks are now cleaned, clean joint marks and counters */
-    for(auto i: jointObjects) {
+    for(std::size_t i = 0; i != jointCount; ++i) {
         /* All not-already cleaned objects (...duplicate occurences) should
            have joint mark */
-        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFu || i.get().flags & Flag::Joint);
-        i.get().flags &= ~Flag::Joint;
-        i.get().counter = 0xFFFFu;
+        Object<Transformation>& o = *joints[i];
+        CORRADE_INTERNAL_ASSERT(o.counter == 0xFFFFFFFFu || o.flags & Flag::Joint);
+        o.flags &= ~Flag::Joint;
+        o.counter = 0xFFFFFFFFu;
     }
 
-    /* Shrink the array to contain only transformations of requested objects and return */
-    jointTransformations.resize(objectCount);
-    return jointTransformations;
+    return true;
 }
 
-template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const {
-    std::reference_wrapper<Object<Transformation>> o = jointObjects[joint];
+template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(Object<Transformation>* const* const jointObjects, typename Transformation::DataType* const jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const {
+    Object<Transformation>* o = jointObjects[joint];
 
     /* Transformation already computed ("unvisited" by this function before
        either due to recursion or duplicate object occurences), done */
-    if(!(o.get().flags & Flag::Visited)) return jointTransformations[joint];
+    if(!(o->flags & Flag::Visited)) return jointTransformations[joint];
 
     /* Initialize transformation */
-    jointTransformations[joint] = o.get().transformation();
+    jointTransformations[joint] = o->transformation();
 
     /* Go up until next joint or root */
     for(;;) {
         /* Clean visited mark */
-        CORRADE_INTERNAL_ASSERT(o.get().flags & Flag::Visited);
-        o.get().flags &= ~Flag::Visited;
+        CORRADE_INTERNAL_ASSERT(o->flags & Flag::Visited);
+        o->flags &= ~Flag::Visited;
 
-        Object<Transformation>* parent = o.get().parent();
+        Object<Transformation>* parent = o->parent();
 
         /* Root object, compose transformation with final, done */
         if(!parent) {
-            CORRADE_INTERNAL_ASSERT(o.get().isScene());
+            CORRADE_INTERNAL_ASSERT(o->isScene());
             return (jointTransformations[joint] =
                 Implementation::Transformation<Transformation>::compose(finalTransformation, jointTransformations[joint]));
 
@@ -329,7 +418,7 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
         /* Else compose transformation with parent, go up the hierarchy */
         } else {
             jointTransformations[joint] = Implementation::Transformation<Transformation>::compose(parent->transformation(), jointTransformations[joint]);
-            o = *parent;
+            o = parent;
         }
     }
 }
@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::SceneGraph::Scene
  */
 
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/SceneGraph/Object.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -52,7 +54,18 @@ template<class Transformation> class Scene: public Object<Transformation> {
         explicit Scene() = default;
 
     private:
+        #ifndef DOXYGEN_GENERATING_OUTPUT /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
+        friend Object<Transformation>;
+        #endif
+
         bool isScene() const override final { return true; }
+
+        /* Scratch storage for Object::transformations() and setClean(), kept
+           across calls so calculating transformations every frame doesn't
+           allocate. Used as a stack, each call appends its data at the end
+           and removes them again before returning. */
+        mutable Containers::Array<Object<Transformation>*> _scratchObjects;
+        mutable Containers::Array<typename Transformation::DataType> _scratchTransformations;
 };
 
 }}
@@ -100,6 +100,7 @@ template<class T> using BasicCamera3D = Camera<3, T>;
 typedef BasicCamera2D<Float> Camera2D;
 typedef BasicCamera3D<Float> Camera3D;
 
+enum class DrawableBoundingVolume: UnsignedByte;
 template<UnsignedInt, class> class Drawable;
 template<class T> using BasicDrawable2D = Drawable<2, T>;
 template<class T> using BasicDrawable3D = Drawable<3, T>;
@@ -123,6 +124,8 @@ template<class T> using BasicDrawableGroup3D = DrawableGroup<3, T>;
 typedef BasicDrawableGroup2D<Float> DrawableGroup2D;
 typedef BasicDrawableGroup3D<Float> DrawableGroup3D;
 
+template<class> class FlatHierarchy;
+
 template<class> class BasicMatrixTransformation2D;
 template<class> class BasicMatrixTransformation3D;
 typedef BasicMatrixTransformation2D<Float> MatrixTransformation2D;
@@ -24,8 +24,11 @@
 */
 
 #include <algorithm>
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/SceneGraph/AbstractFeature.hpp"
 #include "Magnum/SceneGraph/Camera.hpp"
@@ -53,6 +56,18 @@ struct CameraTest: TestSuite::Tester {
 
     template<class T> void draw();
     template<class T> void drawOrdered();
+    template<class T> void drawRecursive();
+    template<class T> void drawReusesScratchStorage();
+    template<class T> void drawableTransformationsInto();
+    template<class T> void drawableTransformationsIntoWrongSize();
+
+    template<class T> void boundingVolume();
+    template<class T> void drawCulled();
+    template<class T> void drawCulledTransformed();
+    template<class T> void drawCulled2D();
+    template<class T> void drawCulledRecursive();
+
+    void debugBoundingVolume();
 };
 
 CameraTest::CameraTest() {
@@ -77,13 +92,49 @@ CameraTest::CameraTest() {
         &CameraTest::draw<Float>,
         &CameraTest::draw<Double>,
         &CameraTest::drawOrdered<Float>,
-        &CameraTest::drawOrdered<Double>});
+        &CameraTest::drawOrdered<Double>,
+        &CameraTest::drawRecursive<Float>,
+        &CameraTest::drawRecursive<Double>,
+        &CameraTest::drawReusesScratchStorage<Float>,
+        &CameraTest::drawReusesScratchStorage<Double>,
+        &CameraTest::drawableTransformationsInto<Float>,
+        &CameraTest::drawableTransformationsInto<Double>,
+        &CameraTest::drawableTransformationsIntoWrongSize<Float>,
+        &CameraTest::drawableTransformationsIntoWrongSize<Double>,
+
+        &CameraTest::boundingVolume<Float>,
+        &CameraTest::boundingVolume<Double>,
+        &CameraTest::drawCulled<Float>,
+        &CameraTest::drawCulled<Double>,
+        &CameraTest::drawCulledTransformed<Float>,
+        &CameraTest::drawCulledTransformed<Double>,
+        &CameraTest::drawCulled2D<Float>,
+        &CameraTest::drawCulled2D<Double>,
+        &CameraTest::drawCulledRecursive<Float>,
+        &CameraTest::drawCulledRecursive<Double>});
+
+    addTests({&CameraTest::debugBoundingVolume});
 }
 
 template<class T> using Object2D = SceneGraph::Object<SceneGraph::BasicMatrixTransformation2D<T>>;
 template<class T> using Object3D = SceneGraph::Object<SceneGraph::BasicMatrixTransformation3D<T>>;
+template<class T> using Scene2D = SceneGraph::Scene<SceneGraph::BasicMatrixTransformation2D<T>>;
 template<class T> using Scene3D = SceneGraph::Scene<SceneGraph::BasicMatrixTransformation3D<T>>;
 
+/* Records its ID when drawn */
+template<UnsignedInt dimensions, class T> class IdDrawable: public SceneGraph::Drawable<dimensions, T> {
+    public:
+        explicit IdDrawable(AbstractObject<dimensions, T>& object, FeatureGroup<dimensions, SceneGraph::Drawable<dimensions, T>, T>& group, std::vector<Int>& drawn, Int id): SceneGraph::Drawable<dimensions, T>{object, &group}, _drawn(drawn), _id{id} {}
+
+    private:
+        void draw(const MatrixTypeFor<dimensions, T>&, Camera<dimensions, T>&) override {
+            _drawn.push_back(_id);
+        }
+
+        std::vector<Int>& _drawn;
+        Int _id;
+};
+
 template<class T> void CameraTest::fixAspectRatio() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -302,6 +353,431 @@ template<class T> void CameraTest::drawOrdered() {
     }), TestSuite::Compare::Container);
 }
 
+template<class T> void CameraTest::drawRecursive() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group, std::vector<Math::Matrix4<T>>& result, BasicDrawableGroup3D<T>* nested = nullptr): SceneGraph::BasicDrawable3D<T>{object, group}, _result(result), _nested{nested} {}
+
+        protected:
+            void draw(const Math::Matrix4<T>& transformationMatrix, BasicCamera3D<T>& camera) override {
+                /* Drawing another group with the same camera in the middle,
+                   which reuses its scratch storage */
+                if(_nested) camera.draw(*_nested);
+                _result.push_back(transformationMatrix);
+            }
+
+        private:
+            std::vector<Math::Matrix4<T>>& _result;
+            BasicDrawableGroup3D<T>* _nested;
+    };
+
+    BasicDrawableGroup3D<T> group, nestedGroup;
+    Scene3D<T> scene;
+
+    std::vector<Math::Matrix4<T>> transformations, nestedTransformations;
+
+    Object3D<T> first{&scene};
+    first.translate(Math::Vector3<T>::xAxis(T(1.0)));
+    new Drawable{first, &group, transformations, &nestedGroup};
+
+    Object3D<T> second{&scene};
+    second.translate(Math::Vector3<T>::xAxis(T(2.0)));
+    new Drawable{second, &group, transformations};
+
+    /* Enough nested drawables to make the camera scratch storage grow while
+       the outer draw() is in progress. The transformation passed to the
+       outer drawable should stay valid even then. */
+    Object3D<T> nested{&scene};
+    nested.translate(Math::Vector3<T>::xAxis(T(3.0)));
+    for(std::size_t i = 0; i != 100; ++i)
+        new Drawable{nested, &nestedGroup, nestedTransformations};
+
+    BasicCamera3D<T> camera{scene};
+    camera.draw(group);
+
+    CORRADE_COMPARE_AS(transformations, (std::vector<Math::Matrix4<T>>{
+        Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(1.0))), /* first */
+        Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(2.0))) /* second */
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(nestedTransformations,
+        std::vector<Math::Matrix4<T>>(100, Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(3.0)))),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawReusesScratchStorage() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            explicit Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group, std::vector<Math::Matrix4<T>>& result): SceneGraph::BasicDrawable3D<T>{object, group}, _result(result) {}
+
+        protected:
+            void draw(const Math::Matrix4<T>& transformationMatrix, BasicCamera3D<T>&) override {
+                _result.push_back(transformationMatrix);
+            }
+
+        private:
+            std::vector<Math::Matrix4<T>>& _result;
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+
+    std::vector<Math::Matrix4<T>> first, second;
+
+    Object3D<T> a{&scene};
+    a.translate(Math::Vector3<T>::xAxis(T(1.0)));
+    new Drawable{a, &group, first};
+
+    Object3D<T> b{&a};
+    b.translate(Math::Vector3<T>::yAxis(T(2.0)));
+    new Drawable{b, &group, first};
+
+    Object3D<T> c{&scene};
+    c.translate(Math::Vector3<T>::zAxis(T(3.0)));
+    new Drawable{c, &group, first};
+
+    BasicCamera3D<T> camera{scene};
+    camera.draw(group);
+    CORRADE_COMPARE(first.size(), 3);
+
+    /* Drawing the unchanged scene again reuses the scratch storage left over
+       from the previous call and should give the same result */
+    first.swap(second);
+    camera.draw(group);
+    CORRADE_COMPARE_AS(first, second, TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawableTransformationsInto() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            explicit Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group): SceneGraph::BasicDrawable3D<T>{object, group} {}
+
+        protected:
+            void draw(const Math::Matrix4<T>&, BasicCamera3D<T>&) override {}
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+
+    Object3D<T> first{&scene};
+    first.scale(Math::Vector3<T>{T(5.0)});
+    new Drawable{first, &group};
+
+    Object3D<T> second{&scene};
+    second.translate(Math::Vector3<T>::yAxis(T(3.0)));
+    new Drawable{second, &group};
+
+    Object3D<T> third{&second};
+    third.translate(Math::Vector3<T>::zAxis(T(-1.5)));
+    new Drawable{third, &group};
+
+    BasicCamera3D<T> camera{third};
+
+    /* Calling it repeatedly reuses the internal storage and gives the same
+       result */
+    for(std::size_t i = 0; i != 2; ++i) {
+        CORRADE_ITERATION(i);
+
+        Math::Matrix4<T> transformations[3];
+        camera.drawableTransformationsInto(group, transformations);
+        CORRADE_COMPARE(transformations[0], Math::Matrix4<T>::translation({T(0.0), T(-3.0), T(1.5)})*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(5.0))));
+        CORRADE_COMPARE(transformations[1], Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(1.5))));
+        CORRADE_COMPARE(transformations[2], Math::Matrix4<T>{});
+    }
+}
+
+template<class T> void CameraTest::drawableTransformationsIntoWrongSize() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            explicit Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group): SceneGraph::BasicDrawable3D<T>{object, group} {}
+
+        protected:
+            void draw(const Math::Matrix4<T>&, BasicCamera3D<T>&) override {}
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    Object3D<T> object{&scene};
+    new Drawable{object, &group};
+    Object3D<T> orphan;
+    BasicCamera3D<T> camera{object};
+    BasicCamera3D<T> orphanCamera{orphan};
+
+    Math::Matrix4<T> transformations[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    camera.drawableTransformationsInto(group, transformations);
+    orphanCamera.drawableTransformationsInto(group, Containers::arrayView(transformations).prefix(1));
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::Camera::drawableTransformationsInto(): expected 1 transformations but got 2\n"
+        "SceneGraph::Camera::drawableTransformationsInto(): camera is not part of any scene\n");
+}
+
+template<class T> void CameraTest::boundingVolume() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    BasicDrawableGroup3D<T> group;
+    Object3D<T> object;
+    std::vector<Int> drawn;
+    IdDrawable<3, T> drawable{object, group, drawn, 0};
+    CORRADE_COMPARE(drawable.boundingVolume(), DrawableBoundingVolume::None);
+    CORRADE_COMPARE(drawable.boundingCenter(), Math::Vector3<T>{});
+    CORRADE_COMPARE(drawable.boundingRadius(), T(0.0));
+    CORRADE_COMPARE(drawable.boundingExtents(), Math::Vector3<T>{});
+
+    drawable.setBoundingSphere({T(1.0), T(2.0), T(3.0)}, T(0.5));
+    CORRADE_COMPARE(drawable.boundingVolume(), DrawableBoundingVolume::Sphere);
+    CORRADE_COMPARE(drawable.boundingCenter(), (Math::Vector3<T>{T(1.0), T(2.0), T(3.0)}));
+    CORRADE_COMPARE(drawable.boundingRadius(), T(0.5));
+    CORRADE_COMPARE(drawable.boundingExtents(), Math::Vector3<T>{});
+
+    drawable.setBoundingBox({{T(-1.0), T(0.0), T(1.0)}, {T(3.0), T(1.0), T(2.0)}});
+    CORRADE_COMPARE(drawable.boundingVolume(), DrawableBoundingVolume::Box);
+    CORRADE_COMPARE(drawable.boundingCenter(), (Math::Vector3<T>{T(1.0), T(0.5), T(1.5)}));
+    CORRADE_COMPARE(drawable.boundingRadius(), T(0.0));
+    CORRADE_COMPARE(drawable.boundingExtents(), (Math::Vector3<T>{T(2.0), T(0.5), T(0.5)}));
+
+    drawable.resetBoundingVolume();
+    CORRADE_COMPARE(drawable.boundingVolume(), DrawableBoundingVolume::None);
+    CORRADE_COMPARE(drawable.boundingCenter(), Math::Vector3<T>{});
+    CORRADE_COMPARE(drawable.boundingExtents(), Math::Vector3<T>{});
+}
+
+template<class T> void CameraTest::drawCulled() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    std::vector<Int> drawn;
+
+    /* No bounding volume, always drawn even though it's behind the camera */
+    Object3D<T> a{&scene};
+    a.translate(Math::Vector3<T>::zAxis(T(50.0)));
+    new IdDrawable<3, T>{a, group, drawn, 0};
+
+    /* Sphere in front of the camera */
+    Object3D<T> b{&scene};
+    b.translate(Math::Vector3<T>::zAxis(T(-10.0)));
+    (new IdDrawable<3, T>{b, group, drawn, 1})
+        ->setBoundingSphere({}, T(1.0));
+
+    /* Sphere behind the camera */
+    Object3D<T> c{&scene};
+    c.translate(Math::Vector3<T>::zAxis(T(10.0)));
+    (new IdDrawable<3, T>{c, group, drawn, 2})
+        ->setBoundingSphere({}, T(1.0));
+
+    /* Spheres to the right of the frustum, 1.5/sqrt(2) away from the right
+       plane. The first is culled, the second not. */
+    Object3D<T> d{&scene};
+    (new IdDrawable<3, T>{d, group, drawn, 3})
+        ->setBoundingSphere({T(11.5), T(0.0), T(-10.0)}, T(1.0));
+    (new IdDrawable<3, T>{d, group, drawn, 4})
+        ->setBoundingSphere({T(11.5), T(0.0), T(-10.0)}, T(2.0));
+
+    /* Box behind the far plane */
+    Object3D<T> e{&scene};
+    e.translate(Math::Vector3<T>::zAxis(T(-200.0)));
+    (new IdDrawable<3, T>{e, group, drawn, 5})
+        ->setBoundingBox({Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}});
+
+    /* Box in front of the camera */
+    Object3D<T> f{&scene};
+    (new IdDrawable<3, T>{f, group, drawn, 6})
+        ->setBoundingBox({{T(-0.5), T(-0.5), T(-5.5)}, {T(0.5), T(0.5), T(-4.5)}});
+
+    Object3D<T> cameraObject{&scene};
+    BasicCamera3D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix4<T>::perspectiveProjection(Math::Deg<T>(T(90.0)), T(1.0), T(1.0), T(100.0)));
+    CORRADE_COMPARE(camera.visibleDrawableCount(), 0);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 0);
+
+    camera.drawCulled(group);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 1, 4, 6}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(camera.visibleDrawableCount(), 4);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 3);
+
+    /* The plain draw doesn't cull anything and doesn't touch the counts */
+    drawn.clear();
+    camera.draw(group);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 1, 2, 3, 4, 5, 6}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(camera.visibleDrawableCount(), 4);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 3);
+}
+
+template<class T> void CameraTest::drawCulledTransformed() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    std::vector<Int> drawn;
+
+    /* Camera moved back, the objects are at Z = 0, so 10 units in front of
+       it, where the frustum spans [-10, 10] in X and Y */
+    Object3D<T> cameraObject{&scene};
+    cameraObject.translate(Math::Vector3<T>::zAxis(T(10.0)));
+    BasicCamera3D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix4<T>::perspectiveProjection(Math::Deg<T>(T(90.0)), T(1.0), T(1.0), T(100.0)));
+
+    /* Box spanning [11, 19] in X, culled */
+    Object3D<T> a{&scene};
+    a.translate(Math::Vector3<T>::xAxis(T(15.0)));
+    (new IdDrawable<3, T>{a, group, drawn, 0})
+        ->setBoundingBox({{T(-4.0), T(-0.5), T(-0.5)}, {T(4.0), T(0.5), T(0.5)}});
+
+    /* Scaled twice in X to span [7, 23], visible */
+    Object3D<T> b{&scene};
+    b.scale({T(2.0), T(1.0), T(1.0)})
+     .translate(Math::Vector3<T>::xAxis(T(15.0)));
+    (new IdDrawable<3, T>{b, group, drawn, 1})
+        ->setBoundingBox({{T(-4.0), T(-0.5), T(-0.5)}, {T(4.0), T(0.5), T(0.5)}});
+
+    /* Sphere 2/sqrt(2) away from the right plane, culled */
+    Object3D<T> c{&scene};
+    c.translate(Math::Vector3<T>::xAxis(T(12.0)));
+    (new IdDrawable<3, T>{c, group, drawn, 2})
+        ->setBoundingSphere({}, T(1.0));
+
+    /* Non-uniformly scaled, the radius is scaled by the largest factor and
+       it's visible */
+    Object3D<T> d{&scene};
+    d.scale({T(1.0), T(2.0), T(1.0)})
+     .translate(Math::Vector3<T>::xAxis(T(12.0)));
+    (new IdDrawable<3, T>{d, group, drawn, 3})
+        ->setBoundingSphere({}, T(1.0));
+
+    /* Box rotated to span [9, 17] in Y instead of [12.5, 13.5], visible */
+    Object3D<T> e{&scene};
+    e.rotateZ(Math::Deg<T>(T(90.0)))
+     .translate(Math::Vector3<T>::yAxis(T(13.0)));
+    (new IdDrawable<3, T>{e, group, drawn, 4})
+        ->setBoundingBox({{T(-4.0), T(-0.5), T(-0.5)}, {T(4.0), T(0.5), T(0.5)}});
+
+    camera.drawCulled(group);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{1, 3, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(camera.visibleDrawableCount(), 3);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 2);
+}
+
+template<class T> void CameraTest::drawCulled2D() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    BasicDrawableGroup2D<T> group;
+    Scene2D<T> scene;
+    std::vector<Int> drawn;
+
+    Object2D<T> object{&scene};
+    /* Circle in the center, visible */
+    (new IdDrawable<2, T>{object, group, drawn, 0})
+        ->setBoundingSphere({}, T(1.0));
+    /* Circle 1.5 units right of the view, culled */
+    (new IdDrawable<2, T>{object, group, drawn, 1})
+        ->setBoundingSphere({T(11.5), T(0.0)}, T(1.0));
+    /* Box overlapping the right edge, visible */
+    (new IdDrawable<2, T>{object, group, drawn, 2})
+        ->setBoundingBox({{T(9.0), T(-2.0)}, {T(13.0), T(2.0)}});
+    /* Box below the view, culled */
+    (new IdDrawable<2, T>{object, group, drawn, 3})
+        ->setBoundingBox({{T(-1.0), T(-16.0)}, {T(1.0), T(-14.0)}});
+
+    Object2D<T> cameraObject{&scene};
+    BasicCamera2D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix3<T>::projection({T(20.0), T(20.0)}));
+
+    camera.drawCulled(group);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(camera.visibleDrawableCount(), 2);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 2);
+}
+
+template<class T> void CameraTest::drawCulledRecursive() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group, std::vector<Math::Matrix4<T>>& result, BasicDrawableGroup3D<T>* nested = nullptr): SceneGraph::BasicDrawable3D<T>{object, group}, _result(result), _nested{nested} {}
+
+        protected:
+            void draw(const Math::Matrix4<T>& transformationMatrix, BasicCamera3D<T>& camera) override {
+                if(_nested) camera.drawCulled(*_nested);
+                _result.push_back(transformationMatrix);
+            }
+
+        private:
+            std::vector<Math::Matrix4<T>>& _result;
+            BasicDrawableGroup3D<T>* _nested;
+    };
+
+    BasicDrawableGroup3D<T> group, nestedGroup;
+    Scene3D<T> scene;
+
+    std::vector<Math::Matrix4<T>> transformations, nestedTransformations;
+
+    Object3D<T> first{&scene};
+    first.translate(Math::Vector3<T>::zAxis(T(-10.0)));
+    (new Drawable{first, &group, transformations, &nestedGroup})
+        ->setBoundingSphere({}, T(1.0));
+
+    /* Behind the camera, culled */
+    Object3D<T> second{&scene};
+    second.translate(Math::Vector3<T>::zAxis(T(10.0)));
+    (new Drawable{second, &group, transformations})
+        ->setBoundingSphere({}, T(1.0));
+
+    Object3D<T> third{&scene};
+    third.translate(Math::Vector3<T>::zAxis(T(-20.0)));
+    (new Drawable{third, &group, transformations})
+        ->setBoundingSphere({}, T(1.0));
+
+    /* Enough nested drawables to make the camera scratch storage grow while
+       the outer drawCulled() is in progress. The transformation passed to
+       the outer drawable should stay valid even then. */
+    Object3D<T> nested{&scene};
+    nested.translate(Math::Vector3<T>::zAxis(T(-5.0)));
+    for(std::size_t i = 0; i != 100; ++i)
+        (new Drawable{nested, &nestedGroup, nestedTransformations})
+            ->setBoundingSphere({}, T(1.0));
+
+    Object3D<T> cameraObject{&scene};
+    BasicCamera3D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix4<T>::perspectiveProjection(Math::Deg<T>(T(90.0)), T(1.0), T(1.0), T(100.0)));
+
+    camera.drawCulled(group);
+    CORRADE_COMPARE_AS(transformations, (std::vector<Math::Matrix4<T>>{
+        Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(-10.0))), /* first */
+        Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(-20.0))) /* third */
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(nestedTransformations,
+        std::vector<Math::Matrix4<T>>(100, Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(-5.0)))),
+        TestSuite::Compare::Container);
+
+    /* The stats are from the outer call, which finished last */
+    CORRADE_COMPARE(camera.visibleDrawableCount(), 2);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 1);
+}
+
+void CameraTest::debugBoundingVolume() {
+    std::ostringstream out;
+    Debug{&out} << DrawableBoundingVolume::Sphere << DrawableBoundingVolume(0xbe);
+    CORRADE_COMPARE(out.str(), "SceneGraph::DrawableBoundingVolume::Sphere SceneGraph::DrawableBoundingVolume(0xbe)\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
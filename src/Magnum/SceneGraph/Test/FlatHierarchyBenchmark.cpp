@@ -0,0 +1,154 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/FlatHierarchy.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct FlatHierarchyBenchmark: TestSuite::Tester {
+    explicit FlatHierarchyBenchmark();
+
+    void updateSerial();
+    void updateParallel();
+    void updateSerialIncremental();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ThreadData[] {
+    {"1 thread", 1},
+    {"2 threads", 2},
+    {"4 threads", 4},
+    {"8 threads", 8}
+};
+
+/* 1000 characters with 1000 nodes each, ten levels deep */
+enum: UnsignedInt {
+    RootCount = 1000,
+    LevelCount = 10,
+    NodesPerLevel = 100
+};
+
+FlatHierarchyBenchmark::FlatHierarchyBenchmark() {
+    addBenchmarks({&FlatHierarchyBenchmark::updateSerial}, 10);
+
+    addInstancedBenchmarks({&FlatHierarchyBenchmark::updateParallel}, 10,
+        Containers::arraySize(ThreadData));
+
+    addBenchmarks({&FlatHierarchyBenchmark::updateSerialIncremental}, 10);
+}
+
+typedef SceneGraph::FlatHierarchy<SceneGraph::MatrixTransformation3D> FlatHierarchy3D;
+
+/* Same as the one in sceneconverter, a real-world application would have a
+   persistent thread pool instead of spawning new threads every time */
+void threadExecutor(const UnsignedInt count, void(*const task)(UnsignedInt, void*), void* const state, void* const userData) {
+    const UnsignedInt threadCount = Math::min(*static_cast<const UnsignedInt*>(userData), count);
+    std::atomic<UnsignedInt> next{0};
+    const auto worker = [&]() {
+        for(UnsignedInt i; (i = next++) < count; ) task(i, state);
+    };
+
+    std::vector<std::thread> threads;
+    for(UnsignedInt i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for(std::thread& thread: threads) thread.join();
+}
+
+/* Adds all roots first, then the first level of all characters etc., so
+   every level has 100k nodes */
+FlatHierarchy3D populate() {
+    FlatHierarchy3D hierarchy;
+    hierarchy.reserve(RootCount*(1 + LevelCount*NodesPerLevel));
+    for(UnsignedInt i = 0; i != RootCount; ++i)
+        hierarchy.addNode(FlatHierarchy3D::NoParent, Matrix4::translation({Float(i), 0.0f, 0.0f}));
+    UnsignedInt previousLevel = 0;
+    UnsignedInt previousLevelSize = RootCount;
+    for(UnsignedInt level = 0; level != LevelCount; ++level) {
+        const UnsignedInt currentLevel = hierarchy.nodeCount();
+        for(UnsignedInt i = 0; i != RootCount*NodesPerLevel; ++i)
+            hierarchy.addNode(previousLevel + i % previousLevelSize, Matrix4::rotationY(Deg(Float(i % 360)))*Matrix4::translation(Vector3::yAxis(0.1f)));
+        previousLevel = currentLevel;
+        previousLevelSize = RootCount*NodesPerLevel;
+    }
+    return hierarchy;
+}
+
+void FlatHierarchyBenchmark::updateSerial() {
+    FlatHierarchy3D hierarchy = populate();
+
+    /* Everything animated each frame */
+    CORRADE_BENCHMARK(1) {
+        hierarchy.transformations();
+        hierarchy.update();
+    }
+
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), hierarchy.nodeCount());
+}
+
+void FlatHierarchyBenchmark::updateParallel() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    FlatHierarchy3D hierarchy = populate();
+
+    /* Calculate the levels outside of the benchmark loop */
+    UnsignedInt threadCount = data.threadCount;
+    hierarchy.update(threadExecutor, &threadCount);
+
+    CORRADE_BENCHMARK(1) {
+        hierarchy.transformations();
+        hierarchy.update(threadExecutor, &threadCount);
+    }
+
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), hierarchy.nodeCount());
+}
+
+void FlatHierarchyBenchmark::updateSerialIncremental() {
+    FlatHierarchy3D hierarchy = populate();
+    hierarchy.update();
+
+    /* Just 1% of the characters moving each frame */
+    CORRADE_BENCHMARK(1) {
+        for(UnsignedInt i = 0; i != RootCount/100; ++i)
+            hierarchy.setDirty(i*100);
+        hierarchy.update();
+    }
+
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), RootCount/100*(1 + LevelCount*NodesPerLevel));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatHierarchyBenchmark)
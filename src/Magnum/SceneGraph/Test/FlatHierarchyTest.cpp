@@ -0,0 +1,617 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <type_traits>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/SceneGraph/DualQuaternionTransformation.h"
+#include "Magnum/SceneGraph/FlatHierarchy.hpp"
+#include "Magnum/SceneGraph/MatrixTransformation3D.hpp"
+#include "Magnum/SceneGraph/Object.hpp"
+#include "Magnum/SceneGraph/RigidMatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct FlatHierarchyTest: TestSuite::Tester {
+    explicit FlatHierarchyTest();
+
+    void construct();
+    void constructMove();
+
+    void addNode();
+    void addNodeInvalidParent();
+    void setParent();
+    void setParentInvalid();
+    void setTransformation();
+    void accessOutOfRange();
+
+    template<class T> void update();
+    void updateRigid();
+    void updateDualQuaternion();
+    void updateAddedNodes();
+    void updateLarge();
+
+    void updateDirty();
+    void updateDirtyNested();
+    void updateDirtySetParent();
+    void updateDirtyMutableView();
+    void updateDirtyNothing();
+
+    void updateParallel();
+    void updateParallelIncremental();
+    void updateParallelNullExecutor();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt rootCount, childCount;
+    bool expectExecutorCalls;
+} UpdateParallelData[] {
+    {"single task", 3, 10, false},
+    {"many tasks", 10, 5000, true}
+};
+
+FlatHierarchyTest::FlatHierarchyTest() {
+    addTests({&FlatHierarchyTest::construct,
+              &FlatHierarchyTest::constructMove,
+
+              &FlatHierarchyTest::addNode,
+              &FlatHierarchyTest::addNodeInvalidParent,
+              &FlatHierarchyTest::setParent,
+              &FlatHierarchyTest::setParentInvalid,
+              &FlatHierarchyTest::setTransformation,
+              &FlatHierarchyTest::accessOutOfRange,
+
+              &FlatHierarchyTest::update<Float>,
+              &FlatHierarchyTest::update<Double>,
+              &FlatHierarchyTest::updateRigid,
+              &FlatHierarchyTest::updateDualQuaternion,
+              &FlatHierarchyTest::updateAddedNodes,
+              &FlatHierarchyTest::updateLarge,
+
+              &FlatHierarchyTest::updateDirty,
+              &FlatHierarchyTest::updateDirtyNested,
+              &FlatHierarchyTest::updateDirtySetParent,
+              &FlatHierarchyTest::updateDirtyMutableView,
+              &FlatHierarchyTest::updateDirtyNothing});
+
+    addInstancedTests({&FlatHierarchyTest::updateParallel},
+        Containers::arraySize(UpdateParallelData));
+
+    addTests({&FlatHierarchyTest::updateParallelIncremental,
+              &FlatHierarchyTest::updateParallelNullExecutor});
+}
+
+using namespace Math::Literals;
+
+typedef SceneGraph::FlatHierarchy<SceneGraph::MatrixTransformation3D> FlatHierarchy3D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+void FlatHierarchyTest::construct() {
+    FlatHierarchy3D hierarchy;
+    CORRADE_COMPARE(hierarchy.nodeCount(), 0);
+    CORRADE_VERIFY(hierarchy.parents().empty());
+    CORRADE_VERIFY(hierarchy.transformations().empty());
+    CORRADE_VERIFY(hierarchy.absoluteTransformations().empty());
+
+    /* Updating an empty hierarchy should do nothing */
+    hierarchy.update();
+    CORRADE_VERIFY(hierarchy.absoluteTransformations().empty());
+}
+
+void FlatHierarchyTest::constructMove() {
+    FlatHierarchy3D a;
+    a.addNode(FlatHierarchy3D::NoParent, Matrix4::translation(Vector3::xAxis(3.0f)));
+    a.addNode(0, Matrix4::scaling(Vector3{2.0f}));
+    a.update();
+
+    FlatHierarchy3D b{std::move(a)};
+    CORRADE_COMPARE(b.nodeCount(), 2);
+    CORRADE_COMPARE(b.absoluteTransformations().size(), 2);
+    CORRADE_COMPARE(b.absoluteTransformation(1),
+        Matrix4::translation(Vector3::xAxis(3.0f))*Matrix4::scaling(Vector3{2.0f}));
+
+    FlatHierarchy3D c;
+    c.addNode(FlatHierarchy3D::NoParent);
+    c = std::move(b);
+    CORRADE_COMPARE(c.nodeCount(), 2);
+    CORRADE_COMPARE(c.parent(1), 0);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<FlatHierarchy3D>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<FlatHierarchy3D>::value);
+}
+
+void FlatHierarchyTest::addNode() {
+    FlatHierarchy3D hierarchy;
+    hierarchy.reserve(4);
+    CORRADE_COMPARE(hierarchy.addNode(FlatHierarchy3D::NoParent), 0);
+    CORRADE_COMPARE(hierarchy.addNode(0, Matrix4::translation(Vector3::yAxis(1.0f))), 1);
+    CORRADE_COMPARE(hierarchy.addNode(FlatHierarchy3D::NoParent, Matrix4::scaling(Vector3{0.5f})), 2);
+    CORRADE_COMPARE(hierarchy.addNode(1), 3);
+    CORRADE_COMPARE(hierarchy.nodeCount(), 4);
+
+    const UnsignedInt expectedParents[]{FlatHierarchy3D::NoParent, 0, FlatHierarchy3D::NoParent, 1};
+    CORRADE_COMPARE(hierarchy.parents().size(), 4);
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(hierarchy.parents()[i], expectedParents[i]);
+        CORRADE_COMPARE(hierarchy.parent(i), expectedParents[i]);
+    }
+
+    CORRADE_COMPARE(hierarchy.transformation(0), Matrix4{});
+    CORRADE_COMPARE(hierarchy.transformation(1), Matrix4::translation(Vector3::yAxis(1.0f)));
+    CORRADE_COMPARE(hierarchy.transformations()[2], Matrix4::scaling(Vector3{0.5f}));
+    CORRADE_COMPARE(hierarchy.transformations()[3], Matrix4{});
+}
+
+void FlatHierarchyTest::addNodeInvalidParent() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    FlatHierarchy3D hierarchy;
+    hierarchy.addNode(FlatHierarchy3D::NoParent);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    hierarchy.addNode(1);
+    CORRADE_COMPARE(hierarchy.nodeCount(), 1);
+    CORRADE_COMPARE(out.str(), "SceneGraph::FlatHierarchy::addNode(): parent index 1 out of range for 1 nodes\n");
+}
+
+void FlatHierarchyTest::setParent() {
+    FlatHierarchy3D hierarchy;
+    hierarchy.addNode(FlatHierarchy3D::NoParent, Matrix4::translation(Vector3::xAxis(1.0f)));
+    hierarchy.addNode(FlatHierarchy3D::NoParent, Matrix4::translation(Vector3::yAxis(2.0f)));
+    hierarchy.addNode(0, Matrix4::translation(Vector3::zAxis(3.0f)));
+
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(2), Matrix4::translation({1.0f, 0.0f, 3.0f}));
+
+    hierarchy.setParent(2, 1);
+    CORRADE_COMPARE(hierarchy.parent(2), 1);
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(2), Matrix4::translation({0.0f, 2.0f, 3.0f}));
+
+    hierarchy.setParent(2, FlatHierarchy3D::NoParent);
+    CORRADE_COMPARE(hierarchy.parent(2), FlatHierarchy3D::NoParent);
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(2), Matrix4::translation({0.0f, 0.0f, 3.0f}));
+}
+
+void FlatHierarchyTest::setParentInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    FlatHierarchy3D hierarchy;
+    hierarchy.addNode(FlatHierarchy3D::NoParent);
+    hierarchy.addNode(0);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    hierarchy.setParent(2, 0);
+    /* The parent has to be before the node, which means a node can't be its
+       own parent either */
+    hierarchy.setParent(0, 1);
+    hierarchy.setParent(1, 1);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatHierarchy::setParent(): index 2 out of range for 2 nodes\n"
+        "SceneGraph::FlatHierarchy::setParent(): parent index 1 doesn't precede node 0\n"
+        "SceneGraph::FlatHierarchy::setParent(): parent index 1 doesn't precede node 1\n");
+}
+
+void FlatHierarchyTest::setTransformation() {
+    FlatHierarchy3D hierarchy;
+    hierarchy.addNode(FlatHierarchy3D::NoParent);
+    hierarchy.addNode(0);
+
+    hierarchy.setTransformation(0, Matrix4::rotationX(90.0_degf))
+             .setTransformation(1, Matrix4::translation(Vector3::yAxis(2.0f)));
+    CORRADE_COMPARE(hierarchy.transformation(0), Matrix4::rotationX(90.0_degf));
+    CORRADE_COMPARE(hierarchy.transformation(1), Matrix4::translation(Vector3::yAxis(2.0f)));
+
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(1), Matrix4::rotationX(90.0_degf)*Matrix4::translation(Vector3::yAxis(2.0f)));
+    CORRADE_COMPARE(hierarchy.absoluteTransformationMatrix(1), Matrix4::rotationX(90.0_degf)*Matrix4::translation(Vector3::yAxis(2.0f)));
+
+    /* Bulk update through the mutable view */
+    hierarchy.transformations()[1] = Matrix4::translation(Vector3::zAxis(2.0f));
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(1), Matrix4::translation(Vector3::yAxis(-2.0f)));
+}
+
+void FlatHierarchyTest::accessOutOfRange() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    FlatHierarchy3D hierarchy;
+    hierarchy.addNode(FlatHierarchy3D::NoParent);
+    hierarchy.update();
+    hierarchy.addNode(0);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    hierarchy.parent(2);
+    hierarchy.transformation(2);
+    hierarchy.setTransformation(2, {});
+    hierarchy.setDirty(2);
+    /* The second node isn't updated yet */
+    hierarchy.absoluteTransformation(1);
+    hierarchy.absoluteTransformationMatrix(1);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatHierarchy::parent(): index 2 out of range for 2 nodes\n"
+        "SceneGraph::FlatHierarchy::transformation(): index 2 out of range for 2 nodes\n"
+        "SceneGraph::FlatHierarchy::setTransformation(): index 2 out of range for 2 nodes\n"
+        "SceneGraph::FlatHierarchy::setDirty(): index 2 out of range for 2 nodes\n"
+        "SceneGraph::FlatHierarchy::absoluteTransformation(): index 1 out of range for 1 updated nodes\n"
+        "SceneGraph::FlatHierarchy::absoluteTransformationMatrix(): index 1 out of range for 1 updated nodes\n");
+}
+
+template<class T> void FlatHierarchyTest::update() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Build the same hierarchy in both the object tree and the flat
+       representation and verify the results are the same */
+    typedef SceneGraph::BasicMatrixTransformation3D<T> Transformation;
+    Scene<Transformation> scene;
+    Object<Transformation> a{&scene};
+    Object<Transformation> b{&a};
+    Object<Transformation> c{&a};
+    Object<Transformation> d{&c};
+    Object<Transformation> e{&scene};
+    a.rotateZ(Math::Deg<T>(35.0))
+     .translate(Math::Vector3<T>::xAxis(T(2.0)));
+    b.scale(Math::Vector3<T>{T(3.0)});
+    c.rotateX(Math::Deg<T>(-90.0));
+    d.translate(Math::Vector3<T>{T(1.0), T(-2.0), T(0.5)});
+    e.rotateY(Math::Deg<T>(17.5));
+
+    SceneGraph::FlatHierarchy<Transformation> hierarchy;
+    const UnsignedInt ia = hierarchy.addNode(SceneGraph::FlatHierarchy<Transformation>::NoParent, a.transformation());
+    const UnsignedInt ib = hierarchy.addNode(ia, b.transformation());
+    const UnsignedInt ic = hierarchy.addNode(ia, c.transformation());
+    const UnsignedInt id = hierarchy.addNode(ic, d.transformation());
+    const UnsignedInt ie = hierarchy.addNode(SceneGraph::FlatHierarchy<Transformation>::NoParent, e.transformation());
+    hierarchy.update();
+
+    CORRADE_COMPARE(hierarchy.absoluteTransformations().size(), 5);
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(ia), a.absoluteTransformation());
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(ib), b.absoluteTransformation());
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(ic), c.absoluteTransformation());
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(id), d.absoluteTransformation());
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(ie), e.absoluteTransformation());
+}
+
+void FlatHierarchyTest::updateRigid() {
+    typedef SceneGraph::FlatHierarchy<SceneGraph::RigidMatrixTransformation3D> FlatHierarchy;
+
+    FlatHierarchy hierarchy;
+    hierarchy.addNode(FlatHierarchy::NoParent, Matrix4::rotationY(90.0_degf));
+    hierarchy.addNode(0, Matrix4::translation(Vector3::xAxis(1.0f)));
+    hierarchy.update();
+
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(1), Matrix4::translation(Vector3::zAxis(-1.0f))*Matrix4::rotationY(90.0_degf));
+}
+
+void FlatHierarchyTest::updateDualQuaternion() {
+    typedef SceneGraph::FlatHierarchy<SceneGraph::DualQuaternionTransformation> FlatHierarchy;
+
+    FlatHierarchy hierarchy;
+    hierarchy.addNode(FlatHierarchy::NoParent, DualQuaternion::rotation(90.0_degf, Vector3::yAxis()));
+    hierarchy.addNode(0, DualQuaternion::translation(Vector3::xAxis(1.0f)));
+    hierarchy.update();
+
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(1), DualQuaternion::translation(Vector3::zAxis(-1.0f))*DualQuaternion::rotation(90.0_degf, Vector3::yAxis()));
+    /* The matrix conversion is done through the transformation traits */
+    CORRADE_COMPARE(hierarchy.absoluteTransformationMatrix(1), Matrix4::translation(Vector3::zAxis(-1.0f))*Matrix4::rotationY(90.0_degf));
+}
+
+void FlatHierarchyTest::updateAddedNodes() {
+    FlatHierarchy3D hierarchy;
+    hierarchy.addNode(FlatHierarchy3D::NoParent, Matrix4::translation(Vector3::xAxis(1.0f)));
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.absoluteTransformations().size(), 1);
+
+    /* The absolute transformations get updated only on update() */
+    hierarchy.addNode(0, Matrix4::translation(Vector3::xAxis(2.0f)));
+    CORRADE_COMPARE(hierarchy.absoluteTransformations().size(), 1);
+
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.absoluteTransformations().size(), 2);
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(1), Matrix4::translation(Vector3::xAxis(3.0f)));
+}
+
+void FlatHierarchyTest::updateLarge() {
+    /* Way more nodes than the object tree could handle in transformations()
+       in the past, all in a single chain to verify there's no recursion
+       involved */
+    FlatHierarchy3D hierarchy;
+    hierarchy.reserve(100000);
+    hierarchy.addNode(FlatHierarchy3D::NoParent);
+    for(UnsignedInt i = 1; i != 100000; ++i)
+        hierarchy.addNode(i - 1, Matrix4::translation(Vector3::xAxis(1.0f)));
+    hierarchy.update();
+
+    /* Every node is translated by the count of its ancestors */
+    for(UnsignedInt i: {0u, 1u, 2u, 65535u, 65536u, 99999u}) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(hierarchy.absoluteTransformation(i), Matrix4::translation(Vector3::xAxis(Float(i))));
+    }
+}
+
+/* Two independent subtrees:
+
+    0       4
+   / \      |
+  1   3     5
+  |         |
+  2         6
+*/
+void populateDirty(FlatHierarchy3D& hierarchy) {
+    hierarchy.addNode(FlatHierarchy3D::NoParent, Matrix4::translation(Vector3::xAxis(1.0f)));
+    hierarchy.addNode(0, Matrix4::translation(Vector3::xAxis(2.0f)));
+    hierarchy.addNode(1, Matrix4::translation(Vector3::xAxis(4.0f)));
+    hierarchy.addNode(0, Matrix4::translation(Vector3::xAxis(8.0f)));
+    hierarchy.addNode(FlatHierarchy3D::NoParent, Matrix4::translation(Vector3::yAxis(1.0f)));
+    hierarchy.addNode(4, Matrix4::translation(Vector3::yAxis(2.0f)));
+    hierarchy.addNode(5, Matrix4::translation(Vector3::yAxis(4.0f)));
+}
+
+void FlatHierarchyTest::updateDirty() {
+    FlatHierarchy3D hierarchy;
+    CORRADE_VERIFY(!hierarchy.isDirty());
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 0);
+
+    populateDirty(hierarchy);
+    CORRADE_VERIFY(hierarchy.isDirty());
+
+    /* All nodes are new, so all get updated */
+    hierarchy.update();
+    CORRADE_VERIFY(!hierarchy.isDirty());
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 7);
+
+    /* Changing node 1 updates only it and its child */
+    hierarchy.setTransformation(1, Matrix4::translation(Vector3::xAxis(16.0f)));
+    CORRADE_VERIFY(hierarchy.isDirty());
+    hierarchy.update();
+    CORRADE_VERIFY(!hierarchy.isDirty());
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 2);
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(1), Matrix4::translation(Vector3::xAxis(17.0f)));
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(2), Matrix4::translation(Vector3::xAxis(21.0f)));
+    /* Sibling subtree is untouched */
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(3), Matrix4::translation(Vector3::xAxis(9.0f)));
+
+    /* Changing a leaf in one subtree and a root of the other updates four
+       nodes */
+    hierarchy.setTransformation(3, Matrix4::translation(Vector3::xAxis(32.0f)))
+        .setTransformation(4, Matrix4::translation(Vector3::yAxis(8.0f)));
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 4);
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(3), Matrix4::translation(Vector3::xAxis(33.0f)));
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(6), Matrix4::translation(Vector3::yAxis(14.0f)));
+
+    /* Adding a node updates just the node */
+    hierarchy.addNode(2, Matrix4::translation(Vector3::zAxis(1.0f)));
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 1);
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(7), Matrix4::translation({21.0f, 0.0f, 1.0f}));
+}
+
+void FlatHierarchyTest::updateDirtyNested() {
+    FlatHierarchy3D hierarchy;
+    populateDirty(hierarchy);
+    hierarchy.update();
+
+    /* Marking a descendant before its ancestor still updates each node just
+       once */
+    hierarchy.setTransformation(6, Matrix4::translation(Vector3::yAxis(16.0f)))
+        .setTransformation(2, Matrix4::translation(Vector3::xAxis(64.0f)))
+        .setDirty(5)
+        .setDirty(0)
+        /* Marking the same node again is a no-op */
+        .setDirty(0);
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 6);
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(2), Matrix4::translation(Vector3::xAxis(67.0f)));
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(6), Matrix4::translation(Vector3::yAxis(19.0f)));
+}
+
+void FlatHierarchyTest::updateDirtySetParent() {
+    FlatHierarchy3D hierarchy;
+    populateDirty(hierarchy);
+    hierarchy.update();
+
+    /* Moving node 5 under node 1 updates it and its child, and the child
+       lists of both the old and the new parent are updated accordingly */
+    hierarchy.setParent(5, 1);
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 2);
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(5), Matrix4::translation({3.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(6), Matrix4::translation({3.0f, 6.0f, 0.0f}));
+
+    /* Node 1 now has two children */
+    hierarchy.setDirty(1);
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 4);
+
+    /* Node 4 has no children anymore */
+    hierarchy.setDirty(4);
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 1);
+
+    /* Setting the same parent again doesn't make the node dirty */
+    hierarchy.setParent(5, 1);
+    CORRADE_VERIFY(!hierarchy.isDirty());
+
+    /* Detaching node 2 from its parent makes it a root */
+    hierarchy.setParent(2, FlatHierarchy3D::NoParent);
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 1);
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(2), Matrix4::translation(Vector3::xAxis(4.0f)));
+    hierarchy.setDirty(1);
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 3);
+}
+
+void FlatHierarchyTest::updateDirtyMutableView() {
+    FlatHierarchy3D hierarchy;
+    populateDirty(hierarchy);
+    hierarchy.update();
+    CORRADE_VERIFY(!hierarchy.isDirty());
+
+    /* Changes through the mutable view can't be tracked, so everything gets
+       updated */
+    hierarchy.transformations()[6] = Matrix4::translation(Vector3::zAxis(1.0f));
+    CORRADE_VERIFY(hierarchy.isDirty());
+    hierarchy.update();
+    CORRADE_VERIFY(!hierarchy.isDirty());
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 7);
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(6), Matrix4::translation({0.0f, 3.0f, 1.0f}));
+
+    /* Subsequent updates are incremental again */
+    hierarchy.setDirty(5);
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 2);
+}
+
+void FlatHierarchyTest::updateDirtyNothing() {
+    FlatHierarchy3D hierarchy;
+    populateDirty(hierarchy);
+    hierarchy.update();
+
+    /* Nothing is dirty, nothing gets updated */
+    hierarchy.update();
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 0);
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(6), Matrix4::translation(Vector3::yAxis(7.0f)));
+}
+
+/* Executes the tasks serially in reverse order, counting how many times it
+   was called */
+void reverseOrderExecutor(UnsignedInt count, void(*task)(UnsignedInt, void*), void* state, void* userData) {
+    ++*static_cast<UnsignedInt*>(userData);
+    for(UnsignedInt i = count; i != 0; --i) task(i - 1, state);
+}
+
+/* A few roots, each with a lot of children having a child on their own and
+   the nodes interleaved so each level is scattered across the whole range */
+void populateParallel(FlatHierarchy3D& hierarchy, UnsignedInt rootCount, UnsignedInt childCount) {
+    for(UnsignedInt i = 0; i != rootCount; ++i)
+        hierarchy.addNode(FlatHierarchy3D::NoParent, Matrix4::rotationY(Deg(i*17.0f))*Matrix4::translation({1.5f, 0.0f, Float(i)}));
+    for(UnsignedInt i = 0; i != childCount; ++i) {
+        const UnsignedInt child = hierarchy.addNode(i % rootCount, Matrix4::rotationX(Deg(i*0.7f))*Matrix4::scaling(Vector3{1.01f}));
+        hierarchy.addNode(child, Matrix4::translation({0.1f, Float(i)*0.01f, 0.3f})*Matrix4::rotationZ(Deg(i*1.3f)));
+    }
+}
+
+void FlatHierarchyTest::updateParallel() {
+    auto&& data = UpdateParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    FlatHierarchy3D expected;
+    populateParallel(expected, data.rootCount, data.childCount);
+    expected.update();
+
+    FlatHierarchy3D actual;
+    populateParallel(actual, data.rootCount, data.childCount);
+    UnsignedInt executorCalls = 0;
+    actual.update(reverseOrderExecutor, &executorCalls);
+    CORRADE_COMPARE(executorCalls != 0, data.expectExecutorCalls);
+    CORRADE_COMPARE(actual.updatedNodeCount(), expected.updatedNodeCount());
+
+    /* The output has to be bit-identical */
+    CORRADE_COMPARE(actual.absoluteTransformations().size(), expected.nodeCount());
+    CORRADE_VERIFY(std::memcmp(actual.absoluteTransformations().data(), expected.absoluteTransformations().data(), expected.nodeCount()*sizeof(Matrix4)) == 0);
+
+    /* Everything modified through the mutable view, processed again */
+    for(Matrix4& i: expected.transformations()) i = Matrix4::translation(Vector3::xAxis(0.5f))*i;
+    for(Matrix4& i: actual.transformations()) i = Matrix4::translation(Vector3::xAxis(0.5f))*i;
+    expected.update();
+    actual.update(reverseOrderExecutor, &executorCalls);
+    CORRADE_COMPARE(actual.updatedNodeCount(), expected.nodeCount());
+    CORRADE_VERIFY(std::memcmp(actual.absoluteTransformations().data(), expected.absoluteTransformations().data(), expected.nodeCount()*sizeof(Matrix4)) == 0);
+}
+
+void FlatHierarchyTest::updateParallelIncremental() {
+    FlatHierarchy3D expected;
+    populateDirty(expected);
+    expected.update();
+
+    FlatHierarchy3D actual;
+    populateDirty(actual);
+    UnsignedInt executorCalls = 0;
+    actual.update(reverseOrderExecutor, &executorCalls);
+    CORRADE_COMPARE(actual.updatedNodeCount(), 7);
+    /* The levels are too small to go through the executor */
+    CORRADE_COMPARE(executorCalls, 0);
+
+    /* Only dirty subtrees are updated, same as in the serial case */
+    expected.setTransformation(1, Matrix4::translation(Vector3::xAxis(16.0f)))
+        .setTransformation(6, Matrix4::translation(Vector3::yAxis(16.0f)))
+        .setDirty(2);
+    actual.setTransformation(1, Matrix4::translation(Vector3::xAxis(16.0f)))
+        .setTransformation(6, Matrix4::translation(Vector3::yAxis(16.0f)))
+        .setDirty(2);
+    expected.update();
+    actual.update(reverseOrderExecutor, &executorCalls);
+    CORRADE_VERIFY(!actual.isDirty());
+    CORRADE_COMPARE(expected.updatedNodeCount(), 3);
+    CORRADE_COMPARE(actual.updatedNodeCount(), 3);
+    CORRADE_VERIFY(std::memcmp(actual.absoluteTransformations().data(), expected.absoluteTransformations().data(), expected.nodeCount()*sizeof(Matrix4)) == 0);
+
+    /* Reparenting changes the levels, which get recalculated */
+    expected.setParent(5, 2);
+    actual.setParent(5, 2);
+    expected.update();
+    actual.update(reverseOrderExecutor, &executorCalls);
+    CORRADE_COMPARE(actual.updatedNodeCount(), 2);
+    CORRADE_COMPARE(actual.absoluteTransformation(6), Matrix4::translation({21.0f, 18.0f, 0.0f}));
+    CORRADE_VERIFY(std::memcmp(actual.absoluteTransformations().data(), expected.absoluteTransformations().data(), expected.nodeCount()*sizeof(Matrix4)) == 0);
+
+    /* Nothing dirty, nothing updated */
+    actual.update(reverseOrderExecutor, &executorCalls);
+    CORRADE_COMPARE(actual.updatedNodeCount(), 0);
+}
+
+void FlatHierarchyTest::updateParallelNullExecutor() {
+    FlatHierarchy3D hierarchy;
+    populateDirty(hierarchy);
+
+    /* Should fall back to the serial implementation */
+    hierarchy.update(nullptr);
+    CORRADE_COMPARE(hierarchy.updatedNodeCount(), 7);
+    CORRADE_COMPARE(hierarchy.absoluteTransformation(6), Matrix4::translation(Vector3::yAxis(7.0f)));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatHierarchyTest)
@@ -25,6 +25,7 @@
 
 #include <sstream>
 #include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/FormatStl.h>
@@ -52,9 +53,13 @@ struct ObjectTest: TestSuite::Tester {
     template<class T> void transformationsRelative();
     template<class T> void transformationsOrphan();
     template<class T> void transformationsDuplicate();
+    template<class T> void transformationsLarge();
+    template<class T> void transformationsInto();
+    template<class T> void transformationsIntoWrongSize();
     template<class T> void setClean();
     template<class T> void setCleanListHierarchy();
     template<class T> void setCleanListBulk();
+    template<class T> void setCleanRecursive();
 
     template<class T> void rangeBasedForChildren();
     template<class T> void rangeBasedForFeatures();
@@ -89,12 +94,20 @@ ObjectTest::ObjectTest() {
         &ObjectTest::transformationsOrphan<Double>,
         &ObjectTest::transformationsDuplicate<Float>,
         &ObjectTest::transformationsDuplicate<Double>,
+        &ObjectTest::transformationsLarge<Float>,
+        &ObjectTest::transformationsLarge<Double>,
+        &ObjectTest::transformationsInto<Float>,
+        &ObjectTest::transformationsInto<Double>,
+        &ObjectTest::transformationsIntoWrongSize<Float>,
+        &ObjectTest::transformationsIntoWrongSize<Double>,
         &ObjectTest::setClean<Float>,
         &ObjectTest::setClean<Double>,
         &ObjectTest::setCleanListHierarchy<Float>,
         &ObjectTest::setCleanListHierarchy<Double>,
         &ObjectTest::setCleanListBulk<Float>,
         &ObjectTest::setCleanListBulk<Double>,
+        &ObjectTest::setCleanRecursive<Float>,
+        &ObjectTest::setCleanRecursive<Double>,
 
         &ObjectTest::rangeBasedForChildren<Float>,
         &ObjectTest::rangeBasedForChildren<Double>,
@@ -398,6 +411,107 @@ template<class T> void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+template<class T> void ObjectTest::transformationsInto() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Scene3D<T> s;
+    Object3D<T> first(&s);
+    first.rotateZ(Math::Deg<T>{T(30.0)});
+    Object3D<T> second(&first);
+    second.scale(Math::Vector3<T>(T(0.5)));
+    Object3D<T> third(&first);
+    third.translate(Math::Vector3<T>::xAxis(T(5.0)));
+
+    Math::Matrix4<T> initial = Math::Matrix4<T>::rotationX(Math::Deg<T>{90.0}).inverted();
+    Math::Matrix4<T> firstExpected = initial*Math::Matrix4<T>::rotationZ(Math::Deg<T>{30.0});
+    Math::Matrix4<T> secondExpected = initial*Math::Matrix4<T>::rotationZ(Math::Deg<T>{30.0})*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(0.5)));
+    Math::Matrix4<T> thirdExpected = initial*Math::Matrix4<T>::rotationZ(Math::Deg<T>{30.0})*Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(T(5.0)));
+
+    /* Including a duplicate and a foreign joint */
+    Object3D<T>* objects[]{&second, &third, &second, &s};
+    Math::Matrix4<T> transformations[4];
+    s.transformationsInto(objects, transformations, initial);
+    CORRADE_COMPARE(transformations[0], secondExpected);
+    CORRADE_COMPARE(transformations[1], thirdExpected);
+    CORRADE_COMPARE(transformations[2], secondExpected);
+    CORRADE_COMPARE(transformations[3], initial);
+
+    /* Matrix variant, calling it again reuses the scratch storage and gives
+       the same result */
+    Math::Matrix4<T> transformationMatrices[4];
+    s.transformationMatricesInto(objects, transformationMatrices, initial);
+    CORRADE_COMPARE(transformationMatrices[0], secondExpected);
+    CORRADE_COMPARE(transformationMatrices[1], thirdExpected);
+    CORRADE_COMPARE(transformationMatrices[2], secondExpected);
+    CORRADE_COMPARE(transformationMatrices[3], initial);
+
+    /* Type-erased variant, with a strided output */
+    AbstractBasicObject3D<T>* abstractObjects[]{&first, &third};
+    struct Data {
+        Math::Matrix4<T> transformation;
+        Int other;
+    } abstractTransformations[2];
+    static_cast<const AbstractBasicObject3D<T>&>(s).transformationMatricesInto(abstractObjects, Containers::StridedArrayView1D<Math::Matrix4<T>>{abstractTransformations, &abstractTransformations[0].transformation, 2, sizeof(Data)}, initial);
+    CORRADE_COMPARE(abstractTransformations[0].transformation, firstExpected);
+    CORRADE_COMPARE(abstractTransformations[1].transformation, thirdExpected);
+
+    /* The original vector API gives the same results */
+    CORRADE_COMPARE(s.transformations({first, third}, initial), (std::vector<Math::Matrix4<T>>{firstExpected, thirdExpected}));
+}
+
+template<class T> void ObjectTest::transformationsIntoWrongSize() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Scene3D<T> s;
+    Object3D<T> first(&s);
+    Object3D<T>* objects[]{&first, &s};
+    AbstractBasicObject3D<T>* abstractObjects[]{&first, &s};
+    Math::Matrix4<T> transformations[3];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    s.transformationsInto(objects, transformations);
+    s.transformationMatricesInto(objects, transformations);
+    static_cast<const AbstractBasicObject3D<T>&>(s).transformationMatricesInto(abstractObjects, transformations);
+    first.transformationsInto(objects, Containers::arrayView(transformations).prefix(2));
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::Object::transformationsInto(): expected 2 transformations but got 3\n"
+        "SceneGraph::Object::transformationMatricesInto(): expected 2 transformations but got 3\n"
+        "SceneGraph::AbstractObject::transformationMatricesInto(): expected 2 transformations but got 3\n"
+        "SceneGraph::Object::transformationsInto(): currently implemented only for Scene\n");
+}
+
+template<class T> void ObjectTest::transformationsLarge() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* More objects than fits into 16 bits, which used to be a limit */
+    Scene3D<T> s;
+    Object3D<T>* groups[10];
+    for(std::size_t i = 0; i != 10; ++i) {
+        groups[i] = new Object3D<T>{&s};
+        groups[i]->translate(Math::Vector3<T>::yAxis(T(i)));
+    }
+
+    std::vector<std::reference_wrapper<Object3D<T>>> objects;
+    objects.reserve(70000);
+    for(std::size_t i = 0; i != 70000; ++i) {
+        Object3D<T>* o = new Object3D<T>{groups[i % 10]};
+        o->translate(Math::Vector3<T>::xAxis(T(i)));
+        objects.push_back(*o);
+    }
+
+    std::vector<Math::Matrix4<T>> transformations = s.transformations(objects);
+    CORRADE_COMPARE(transformations.size(), 70000);
+    for(std::size_t i: {0, 1, 65535, 65536, 69999}) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(transformations[i], Math::Matrix4<T>::translation({T(i), T(i % 10), T(0.0)}));
+    }
+}
+
 template<class T> void ObjectTest::setClean() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -584,6 +698,47 @@ template<class T> void ObjectTest::setCleanListBulk() {
     CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0)))*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(-2.0))));
 }
 
+template<class T> void ObjectTest::setCleanRecursive() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Feature that cleans another object when being cleaned, which means the
+       scratch storage in the scene gets used recursively */
+    class RecursiveFeature: public AbstractBasicFeature3D<T> {
+        public:
+            explicit RecursiveFeature(AbstractBasicObject3D<T>& object, Object3D<T>& other): AbstractBasicFeature3D<T>{object}, _other(other) {
+                this->setCachedTransformations(CachedTransformation::Absolute);
+            }
+
+            void clean(const Math::Matrix4<T>&) override {
+                _other.setClean();
+            }
+
+        private:
+            Object3D<T>& _other;
+    };
+
+    Scene3D<T> scene;
+    CachingObject<T> a{&scene};
+    a.translate(Math::Vector3<T>::xAxis(T(1.0)));
+    CachingObject<T> b{&a};
+    b.translate(Math::Vector3<T>::yAxis(T(2.0)));
+    CachingObject<T> c{&scene};
+    c.translate(Math::Vector3<T>::zAxis(T(3.0)));
+    CachingObject<T> d{&c};
+    d.translate(Math::Vector3<T>::xAxis(T(4.0)));
+    new RecursiveFeature{a, d};
+
+    b.setClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_VERIFY(!d.isDirty());
+    CORRADE_COMPARE(a.cleanedAbsoluteTransformation, Math::Matrix4<T>::translation({T(1.0), T(0.0), T(0.0)}));
+    CORRADE_COMPARE(b.cleanedAbsoluteTransformation, Math::Matrix4<T>::translation({T(1.0), T(2.0), T(0.0)}));
+    CORRADE_COMPARE(c.cleanedAbsoluteTransformation, Math::Matrix4<T>::translation({T(0.0), T(0.0), T(3.0)}));
+    CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Math::Matrix4<T>::translation({T(4.0), T(0.0), T(3.0)}));
+}
+
 template<class T> void ObjectTest::rangeBasedForChildren() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -30,6 +30,7 @@
 #include "Magnum/SceneGraph/DualComplexTransformation.h"
 #include "Magnum/SceneGraph/DualQuaternionTransformation.h"
 #include "Magnum/SceneGraph/FeatureGroup.hpp"
+#include "Magnum/SceneGraph/FlatHierarchy.hpp"
 #include "Magnum/SceneGraph/MatrixTransformation2D.hpp"
 #include "Magnum/SceneGraph/MatrixTransformation3D.hpp"
 #include "Magnum/SceneGraph/Object.hpp"
@@ -89,6 +90,17 @@ template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicTranslationRotationScali
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicTranslationRotationScalingTransformation3D<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<TranslationTransformation<2, Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<TranslationTransformation<3, Float>>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<BasicDualComplexTransformation<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<BasicDualQuaternionTransformation<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<BasicMatrixTransformation2D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<BasicMatrixTransformation3D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<BasicRigidMatrixTransformation2D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<BasicRigidMatrixTransformation3D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<BasicTranslationRotationScalingTransformation2D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<BasicTranslationRotationScalingTransformation3D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<TranslationTransformation<2, Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatHierarchy<TranslationTransformation<3, Float>>;
 #endif
 
 }}
@@ -0,0 +1,72 @@
+#ifndef Magnum_TaskExecutor_h
+#define Magnum_TaskExecutor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Typedef @ref Magnum::TaskExecutor
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum {
+
+/**
+@brief Parallel task executor
+@m_since_latest
+
+Used by parallel variants of various algorithms to distribute work across
+multiple threads without Magnum itself depending on any particular threading
+implementation. The executor is expected to call @p task exactly once for
+every ID in the @f$ [0, count) @f$ range, passing the @p state pointer through,
+and return only once all tasks finish. The tasks are independent of each other
+and can be executed in any order and from arbitrary threads. The @p userData
+pointer is what was passed to the algorithm together with the executor, for
+example a pointer to an existing thread pool.
+
+A minimal implementation spawning a thread for every task could look like
+this, a real-world implementation would instead reuse a pool of worker
+threads:
+
+@code{.cpp}
+void executor(UnsignedInt count, void(*task)(UnsignedInt, void*), void* state, void*) {
+    std::vector<std::thread> threads;
+    for(UnsignedInt i = 0; i != count; ++i)
+        threads.emplace_back(task, i, state);
+    for(std::thread& thread: threads)
+        thread.join();
+}
+@endcode
+
+The outputs of algorithms accepting a task executor are always the same as
+of their serial counterparts, independently of the order in which the tasks
+were executed.
+*/
+typedef void(*TaskExecutor)(UnsignedInt count, void(*task)(UnsignedInt id, void* state), void* state, void* userData);
+
+}
+
+#endif
@@ -24,6 +24,8 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/DebugStl.h>
 
@@ -35,10 +37,16 @@ struct FileCallbackTest: TestSuite::Tester {
     explicit FileCallbackTest();
 
     void debugInputFileCallbackPolicy();
+
+    void mappedNotFound();
+    void mappedCloseNotLoaded();
 };
 
 FileCallbackTest::FileCallbackTest() {
-    addTests({&FileCallbackTest::debugInputFileCallbackPolicy});
+    addTests({&FileCallbackTest::debugInputFileCallbackPolicy,
+
+              &FileCallbackTest::mappedNotFound,
+              &FileCallbackTest::mappedCloseNotLoaded});
 }
 
 void FileCallbackTest::debugInputFileCallbackPolicy() {
@@ -48,6 +56,26 @@ void FileCallbackTest::debugInputFileCallbackPolicy() {
     CORRADE_COMPARE(out.str(), "InputFileCallbackPolicy::Close InputFileCallbackPolicy(0xf0)\n");
 }
 
+void FileCallbackTest::mappedNotFound() {
+    MappedFileCallback files;
+
+    /* The caller is expected to print the message, so this should be
+       silent */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MappedFileCallback::callback("nonexistent.bin", InputFileCallbackPolicy::LoadTemporary, files));
+    CORRADE_COMPARE(files.fileCount(), 0);
+    CORRADE_COMPARE(out.str(), "");
+}
+
+void FileCallbackTest::mappedCloseNotLoaded() {
+    MappedFileCallback files;
+
+    /* Closing a file that was never loaded should do nothing */
+    CORRADE_VERIFY(!MappedFileCallback::callback("nonexistent.bin", InputFileCallbackPolicy::Close, files));
+    CORRADE_COMPARE(files.fileCount(), 0);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Test::FileCallbackTest)
@@ -174,13 +174,18 @@ bool AbstractImporter::openFile(const std::string& filename) {
               file loading to the default implementation (callback used in the
               base doOpenFile() implementation, because this branch is never
               taken in that case) */
-        const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, InputFileCallbackPolicy::LoadTemporary, _fileCallbackUserData);
+        /* If the input is meant to be persistent, the importer may
+           reference the data after, so load it permanently and don't close
+           it */
+        const bool persistent = !!(_flags & ImporterFlag::PersistentInput);
+        const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, persistent ? InputFileCallbackPolicy::LoadPermanent : InputFileCallbackPolicy::LoadTemporary, _fileCallbackUserData);
         if(!data) {
             Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
             return isOpened();
         }
         doOpenData(*data);
-        _fileCallback(filename, InputFileCallbackPolicy::Close, _fileCallbackUserData);
+        if(!persistent)
+            _fileCallback(filename, InputFileCallbackPolicy::Close, _fileCallbackUserData);
 
     /* Shouldn't get here, the assert is fired already in setFileCallback() */
     } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
@@ -194,13 +199,15 @@ void AbstractImporter::doOpenFile(const std::string& filename) {
     /* If callbacks are set, use them. This is the same implementation as in
        openFile(), see the comment there for details. */
     if(_fileCallback) {
-        const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, InputFileCallbackPolicy::LoadTemporary, _fileCallbackUserData);
+        const bool persistent = !!(_flags & ImporterFlag::PersistentInput);
+        const Containers::Optional<Containers::ArrayView<const char>> data = _fileCallback(filename, persistent ? InputFileCallbackPolicy::LoadPermanent : InputFileCallbackPolicy::LoadTemporary, _fileCallbackUserData);
         if(!data) {
             Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
             return;
         }
         doOpenData(*data);
-        _fileCallback(filename, InputFileCallbackPolicy::Close, _fileCallbackUserData);
+        if(!persistent)
+            _fileCallback(filename, InputFileCallbackPolicy::Close, _fileCallbackUserData);
 
     /* Otherwise open the file directly */
     } else {
@@ -209,7 +216,12 @@ void AbstractImporter::doOpenFile(const std::string& filename) {
             return;
         }
 
+        /* The data are a temporary here, so the importer can't reference
+           them after even if the input is meant to be persistent otherwise */
+        const ImporterFlags flags = _flags;
+        _flags &= ~ImporterFlag::PersistentInput;
         doOpenData(Utility::Directory::read(filename));
+        _flags = flags;
     }
 }
 
@@ -1100,6 +1112,7 @@ Debug& operator<<(Debug& debug, const ImporterFlag value) {
         /* LCOV_EXCL_START */
         #define _c(v) case ImporterFlag::v: return debug << "::" #v;
         _c(Verbose)
+        _c(PersistentInput)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1109,7 +1122,8 @@ Debug& operator<<(Debug& debug, const ImporterFlag value) {
 
 Debug& operator<<(Debug& debug, const ImporterFlags value) {
     return Containers::enumSetDebugOutput(debug, value, "Trade::ImporterFlags{}", {
-        ImporterFlag::Verbose});
+        ImporterFlag::Verbose,
+        ImporterFlag::PersistentInput});
 }
 
 }}
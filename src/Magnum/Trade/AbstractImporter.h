@@ -109,6 +109,31 @@ enum class ImporterFlag: UnsignedByte {
      */
     Verbose = 1 << 0,
 
+    /**
+     * Memory passed to @ref AbstractImporter::openData() or returned by the
+     * callback set in @ref AbstractImporter::setFileCallback() is guaranteed
+     * to stay valid and unchanged until the importer is destroyed and all
+     * data returned from it are discarded. Importers can then avoid copying
+     * the input and return data referencing it directly, with
+     * @ref DataFlag::Owned not present in their @ref DataFlags. See
+     * documentation of particular importers for whether they make use of
+     * this flag.
+     *
+     * With this flag set, a file opened through
+     * @ref AbstractImporter::openFile() using a file callback is loaded with
+     * @ref InputFileCallbackPolicy::LoadPermanent and the callback isn't
+     * called with @ref InputFileCallbackPolicy::Close afterwards. Files read
+     * by the default @ref AbstractImporter::openFile() implementation without
+     * a callback are temporary and so this flag doesn't apply to them.
+     * @ref MappedFileCallback is a convenient way to fulfill the lifetime
+     * guarantees while avoiding having the whole file in memory:
+     *
+     * @snippet MagnumTrade.cpp MappedFileCallback
+     *
+     * @m_since_latest
+     */
+    PersistentInput = 1 << 1,
+
     /** @todo Y flip for images, "I want to import just once, don't copy" ... */
 };
 
@@ -466,8 +491,12 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          * implementation of that particular importer) and after that the
          * callback is called again with @ref InputFileCallbackPolicy::Close
          * because the semantics of @ref openData() don't require the data to
-         * be alive after. In case you need a different behavior, use
-         * @ref openData() directly.
+         * be alive after. If @ref ImporterFlag::PersistentInput is set, the
+         * file is loaded with @ref InputFileCallbackPolicy::LoadPermanent
+         * instead and the callback isn't called with
+         * @ref InputFileCallbackPolicy::Close, as the importer is allowed to
+         * reference the data for as long as it exists. In case you need a
+         * different behavior, use @ref openData() directly.
          *
          * In case @p callback is @cpp nullptr @ce, the current callback (if
          * any) is reset. This function expects that the importer supports
@@ -25,8 +25,11 @@
 
 #include "AnimationData.h"
 
+#include <cstring>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Animation/Compression.h"
+#include "Magnum/Math/DualQuaternion.h"
 #include "Magnum/Math/Vector4.h"
 #include "Magnum/Math/Quaternion.h"
 #include "Magnum/Trade/Implementation/arrayUtilities.h"
@@ -118,6 +121,143 @@ template<class V, class R> auto animationInterpolatorFor(Animation::Interpolatio
     return Animation::interpolatorFor<V, R>(interpolation);
 }
 
+namespace {
+
+std::size_t animationTrackTypeSize(const AnimationTrackType type) {
+    switch(type) {
+        case AnimationTrackType::Bool: return sizeof(bool);
+        case AnimationTrackType::Float: return sizeof(Float);
+        case AnimationTrackType::UnsignedInt: return sizeof(UnsignedInt);
+        case AnimationTrackType::Int: return sizeof(Int);
+        case AnimationTrackType::BoolVector2: return sizeof(Math::BoolVector<2>);
+        case AnimationTrackType::BoolVector3: return sizeof(Math::BoolVector<3>);
+        case AnimationTrackType::BoolVector4: return sizeof(Math::BoolVector<4>);
+        case AnimationTrackType::Vector2: return sizeof(Vector2);
+        case AnimationTrackType::Vector2ui: return sizeof(Vector2ui);
+        case AnimationTrackType::Vector2i: return sizeof(Vector2i);
+        case AnimationTrackType::Vector3: return sizeof(Vector3);
+        case AnimationTrackType::Vector3ui: return sizeof(Vector3ui);
+        case AnimationTrackType::Vector3i: return sizeof(Vector3i);
+        case AnimationTrackType::Vector4: return sizeof(Vector4);
+        case AnimationTrackType::Vector4ui: return sizeof(Vector4ui);
+        case AnimationTrackType::Vector4i: return sizeof(Vector4i);
+        case AnimationTrackType::Complex: return sizeof(Complex);
+        case AnimationTrackType::Quaternion: return sizeof(Quaternion);
+        case AnimationTrackType::DualQuaternion: return sizeof(DualQuaternion);
+        case AnimationTrackType::CubicHermite1D: return sizeof(CubicHermite1D);
+        case AnimationTrackType::CubicHermite2D: return sizeof(CubicHermite2D);
+        case AnimationTrackType::CubicHermite3D: return sizeof(CubicHermite3D);
+        case AnimationTrackType::CubicHermiteComplex: return sizeof(CubicHermiteComplex);
+        case AnimationTrackType::CubicHermiteQuaternion: return sizeof(CubicHermiteQuaternion);
+        case AnimationTrackType::Vector3us: return sizeof(Vector3us);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+template<class V> Containers::Array<std::size_t> reduceTrack(const Animation::TrackViewStorage<const Float>& track, const Float tolerance) {
+    const auto& view = static_cast<const Animation::TrackView<const Float, const V, V>&>(track);
+    return Animation::Implementation::reduceKeyframeIndices(view.keys(), view.values(), view.interpolator(), tolerance);
+}
+
+constexpr std::size_t alignedSize(const std::size_t size) {
+    return (size + 3) & ~std::size_t{3};
+}
+
+}
+
+AnimationData compressAnimation(const AnimationData& animation, const Float tolerance) {
+    const UnsignedInt trackCount = animation.trackCount();
+
+    /* Decide which keyframes to keep and what the output type is for every
+       track, calculate the total data size with each key and value array
+       aligned to four bytes */
+    Containers::Array<Containers::Array<std::size_t>> indices{trackCount};
+    Containers::Array<AnimationTrackType> types{Containers::NoInit, trackCount};
+    std::size_t dataSize = 0;
+    for(UnsignedInt i = 0; i != trackCount; ++i) {
+        const Animation::TrackViewStorage<const Float>& track = animation.track(i);
+        const AnimationTrackType type = animation.trackType(i);
+        const bool sameResultType = type == animation.trackResultType(i);
+        const bool linearOrConstant =
+            track.interpolation() == Animation::Interpolation::Constant ||
+            track.interpolation() == Animation::Interpolation::Linear;
+
+        if(sameResultType && type == AnimationTrackType::Float)
+            indices[i] = reduceTrack<Float>(track, tolerance);
+        else if(sameResultType && type == AnimationTrackType::Vector2)
+            indices[i] = reduceTrack<Vector2>(track, tolerance);
+        else if(sameResultType && type == AnimationTrackType::Vector3)
+            indices[i] = reduceTrack<Vector3>(track, tolerance);
+        else if(sameResultType && type == AnimationTrackType::Vector4)
+            indices[i] = reduceTrack<Vector4>(track, tolerance);
+        else if(sameResultType && type == AnimationTrackType::Complex)
+            indices[i] = reduceTrack<Complex>(track, tolerance);
+        else if(sameResultType && type == AnimationTrackType::Quaternion)
+            indices[i] = reduceTrack<Quaternion>(track, tolerance);
+        else {
+            indices[i] = Containers::Array<std::size_t>{Containers::NoInit, track.size()};
+            for(std::size_t j = 0; j != track.size(); ++j) indices[i][j] = j;
+        }
+
+        types[i] = type;
+        /* Only rotations are quantized, as they decode back to the original
+           result type. Vectors quantized relative to their range would
+           interpolate to a different value than the result type suggests. */
+        if(sameResultType && linearOrConstant && type == AnimationTrackType::Quaternion)
+            types[i] = AnimationTrackType::Vector3us;
+
+        dataSize += alignedSize(indices[i].size()*sizeof(Float)) +
+            alignedSize(indices[i].size()*animationTrackTypeSize(types[i]));
+    }
+
+    Containers::Array<char> data{Containers::ValueInit, dataSize};
+    Containers::Array<AnimationTrackData> tracks{trackCount};
+    std::size_t offset = 0;
+    for(UnsignedInt i = 0; i != trackCount; ++i) {
+        const Animation::TrackViewStorage<const Float>& track = animation.track(i);
+        const Containers::ArrayView<const std::size_t> trackIndices = indices[i];
+        const std::size_t count = trackIndices.size();
+
+        Containers::StridedArrayView1D<Float> keys{data, reinterpret_cast<Float*>(data.data() + offset), count, sizeof(Float)};
+        for(std::size_t j = 0; j != count; ++j)
+            keys[j] = track.keys()[trackIndices[j]];
+        offset += alignedSize(count*sizeof(Float));
+
+        char* const values = data.data() + offset;
+        offset += alignedSize(count*animationTrackTypeSize(types[i]));
+
+        /* Quaternions packed to the smallest-three representation. Imported
+           data don't need to be exactly normalized, so normalize them
+           first. */
+        if(types[i] == AnimationTrackType::Vector3us && animation.trackType(i) == AnimationTrackType::Quaternion) {
+            const auto& view = static_cast<const Animation::TrackView<const Float, const Quaternion, Quaternion>&>(track);
+            Containers::StridedArrayView1D<Vector3us> packed{data, reinterpret_cast<Vector3us*>(values), count, sizeof(Vector3us)};
+            for(std::size_t j = 0; j != count; ++j)
+                packed[j] = Animation::packSmallestThree(view.values()[trackIndices[j]].normalized());
+            tracks[i] = AnimationTrackData{AnimationTrackType::Vector3us, AnimationTrackType::Quaternion, animation.trackTargetType(i), animation.trackTarget(i),
+                Animation::TrackView<const Float, const Vector3us, Quaternion>{keys, packed, view.interpolation(),
+                    view.interpolation() == Animation::Interpolation::Constant ?
+                        Animation::selectSmallestThree : Animation::slerpSmallestThree,
+                    view.before(), view.after()}};
+
+        /* Everything else copied as-is, with the original interpolator. The
+           type-erased char view is only used to transfer the interpolator
+           pointer, it's never called with it. */
+        } else {
+            const std::size_t valueSize = animationTrackTypeSize(types[i]);
+            for(std::size_t j = 0; j != count; ++j)
+                std::memcpy(values + j*valueSize, &track.values()[trackIndices[j]], valueSize);
+            const auto& view = static_cast<const Animation::TrackView<const Float, const char, char>&>(track);
+            tracks[i] = AnimationTrackData{types[i], animation.trackResultType(i), animation.trackTargetType(i), animation.trackTarget(i),
+                Animation::TrackView<const Float, const char, char>{keys, Containers::StridedArrayView1D<const char>{data, values, count, std::ptrdiff_t(valueSize)}, view.interpolation(), view.interpolator(), view.before(), view.after()}};
+        }
+    }
+
+    CORRADE_INTERNAL_ASSERT(offset == dataSize);
+    return AnimationData{std::move(data), std::move(tracks), animation.duration()};
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<bool, bool>(Animation::Interpolation) -> bool(*)(const bool&, const bool&, Float);
 template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<Float, Float>(Animation::Interpolation) -> Float(*)(const Float&, const Float&, Float);
@@ -174,6 +314,7 @@ Debug& operator<<(Debug& debug, const AnimationTrackType value) {
         _c(CubicHermite3D)
         _c(CubicHermiteComplex)
         _c(CubicHermiteQuaternion)
+        _c(Vector3us)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -115,7 +115,16 @@ enum class AnimationTrackType: UnsignedByte {
      * @ref Magnum::CubicHermiteQuaternion "CubicHermiteQuaternion". Usually
      * used for spline-interpolated @ref AnimationTrackTargetType::Rotation3D.
      */
-    CubicHermiteQuaternion
+    CubicHermiteQuaternion,
+
+    /**
+     * @ref Magnum::Vector3us "Vector3us". Used for compressed rotation
+     * tracks produced by @ref compressAnimation(), with
+     * @ref AnimationTrackType::Quaternion as a result type. The value is a
+     * quaternion encoded with @ref Animation::packSmallestThree().
+     * @m_since_latest
+     */
+    Vector3us
 };
 
 /** @debugoperatorenum{AnimationTrackType} */
@@ -601,6 +610,50 @@ plugin binary to avoid dangling function pointers on plugin unload.
 */
 template<class V, class R = Animation::ResultOf<V>> MAGNUM_TRADE_EXPORT auto animationInterpolatorFor(Animation::Interpolation interpolation) -> R(*)(const V&, const V&, Float);
 
+/** @relatesalso AnimationData
+@brief Compress an animation
+@param animation     Input animation
+@param tolerance     Maximal error introduced by keyframe reduction
+@m_since_latest
+
+Returns a copy of @p animation with all keyframe data in a compact form,
+chosen per track:
+
+-   @ref AnimationTrackType::Float, @ref AnimationTrackType::Vector2,
+    @ref AnimationTrackType::Vector3, @ref AnimationTrackType::Vector4,
+    @ref AnimationTrackType::Complex and @ref AnimationTrackType::Quaternion
+    tracks that have the same result type go through
+    @ref Animation::reduceKeyframes() with given @p tolerance, which is a
+    distance for scalars and vectors and an angle in radians for rotations.
+-   @ref AnimationTrackType::Quaternion tracks with
+    @ref Animation::Interpolation::Constant or
+    @ref Animation::Interpolation::Linear are normalized and converted to
+    @ref AnimationTrackType::Vector3us with
+    @ref Animation::packSmallestThree(). The result type stays
+    @ref AnimationTrackType::Quaternion, the values are decoded during
+    interpolation using @ref Animation::selectSmallestThree() or
+    @ref Animation::slerpSmallestThree().
+
+All other tracks are copied unchanged. The first and last keyframe of every
+track is always kept, so the @ref AnimationData::duration() is the same as
+in @p animation. Every track interpolates to values of its
+@ref AnimationData::trackResultType(), so the compressed animation can be
+used in place of the original without any changes on the consumer side.
+Together, the reduction and quantization typically make skeletal animations
+several times smaller:
+
+@snippet MagnumTrade.cpp compressAnimation
+
+Vector tracks are only reduced, not quantized, as the values quantized by
+@ref Animation::quantizeVectors() interpolate to the @f$ [0, 1] @f$ range
+and need to be scaled back by the consumer. If that's desired, quantize the
+translation and scaling tracks explicitly with
+@ref Animation::quantizeVectors() and keep the returned ranges alongside.
+
+@see @ref AnimationData::trackResultType()
+*/
+MAGNUM_TRADE_EXPORT AnimationData compressAnimation(const AnimationData& animation, Float tolerance);
+
 namespace Implementation {
     /* LCOV_EXCL_START */
     template<class> constexpr AnimationTrackType animationTypeFor();
@@ -630,6 +683,9 @@ namespace Implementation {
     template<> constexpr AnimationTrackType animationTypeFor<Math::Vector<3, UnsignedInt>>() { return AnimationTrackType::Vector3ui; }
     template<> constexpr AnimationTrackType animationTypeFor<Math::Vector<4, UnsignedInt>>() { return AnimationTrackType::Vector4ui; }
 
+    template<> constexpr AnimationTrackType animationTypeFor<Vector3us>() { return AnimationTrackType::Vector3us; }
+    template<> constexpr AnimationTrackType animationTypeFor<Math::Vector<3, UnsignedShort>>() { return AnimationTrackType::Vector3us; }
+
     template<> constexpr AnimationTrackType animationTypeFor<Vector2i>() { return AnimationTrackType::Vector2i; }
     template<> constexpr AnimationTrackType animationTypeFor<Vector3i>() { return AnimationTrackType::Vector3i; }
     template<> constexpr AnimationTrackType animationTypeFor<Vector4i>() { return AnimationTrackType::Vector4i; }
@@ -0,0 +1,328 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImporterPool.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+template<UnsignedInt dimensions> std::size_t dataSize(const ImageData<dimensions>& data) {
+    return data.data().size();
+}
+
+std::size_t dataSize(const MeshData& data) {
+    return data.indexData().size() + data.vertexData().size();
+}
+
+std::size_t dataSize(const MaterialData& data) {
+    return data.attributeData().size()*sizeof(MaterialAttributeData);
+}
+
+std::size_t dataSize(const AnimationData& data) {
+    return data.data().size();
+}
+
+}
+
+struct ImporterPool::Request {
+    explicit Request(UnsignedInt id, UnsignedInt level, void* userData): id{id}, level{level}, userData{userData} {}
+
+    virtual ~Request() = default;
+
+    /* Called from a worker thread */
+    virtual void import(AbstractImporter& importer) = 0;
+
+    /* Called from the thread calling process() */
+    virtual std::size_t dataSize() const = 0;
+    virtual void deliver() = 0;
+
+    UnsignedInt id, level;
+    void* userData;
+};
+
+template<class T> struct ImporterPool::TypedRequest: ImporterPool::Request {
+    explicit TypedRequest(UnsignedInt id, UnsignedInt level, Containers::Optional<T>(*importFunction)(AbstractImporter&, UnsignedInt, UnsignedInt), void(*callback)(UnsignedInt, Containers::Optional<T>&&, void*), void* userData): Request{id, level, userData}, importFunction{importFunction}, callback{callback} {}
+
+    void import(AbstractImporter& importer) override {
+        result = importFunction(importer, id, level);
+    }
+
+    std::size_t dataSize() const override {
+        return result ? Trade::dataSize(*result) : 0;
+    }
+
+    void deliver() override {
+        callback(id, std::move(result), userData);
+    }
+
+    Containers::Optional<T>(*importFunction)(AbstractImporter&, UnsignedInt, UnsignedInt);
+    void(*callback)(UnsignedInt, Containers::Optional<T>&&, void*);
+    Containers::Optional<T> result;
+};
+
+struct ImporterPool::State {
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers;
+    std::vector<Containers::Pointer<Request>> requests;
+    std::size_t maxInFlightMemory{};
+    /* Largest item imported so far, used to estimate how many items fit into
+       maxInFlightMemory */
+    std::size_t maxDataSize{};
+    bool opened{};
+};
+
+ImporterPool::ImporterPool(Containers::Array<Containers::Pointer<AbstractImporter>>&& importers): _state{new State} {
+    CORRADE_ASSERT(!importers.empty(),
+        "Trade::ImporterPool: no importers passed", );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != importers.size(); ++i)
+        CORRADE_ASSERT(importers[i],
+            "Trade::ImporterPool: importer" << i << "is null", );
+    #endif
+
+    _state->importers = std::move(importers);
+    for(Containers::Pointer<AbstractImporter>& importer: _state->importers)
+        importer->close();
+}
+
+ImporterPool::ImporterPool(ImporterPool&&) noexcept = default;
+
+ImporterPool::~ImporterPool() = default;
+
+ImporterPool& ImporterPool::operator=(ImporterPool&&) noexcept = default;
+
+UnsignedInt ImporterPool::count() const {
+    return _state->importers.size();
+}
+
+AbstractImporter& ImporterPool::importer(const UnsignedInt id) {
+    return const_cast<AbstractImporter&>(const_cast<const ImporterPool&>(*this).importer(id));
+}
+
+const AbstractImporter& ImporterPool::importer(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _state->importers.size(),
+        "Trade::ImporterPool::importer(): index" << id << "out of range for" << _state->importers.size() << "entries", *_state->importers[0]);
+    return *_state->importers[id];
+}
+
+bool ImporterPool::isOpened() const { return _state->opened; }
+
+bool ImporterPool::openFile(const std::string& filename) {
+    close();
+    for(Containers::Pointer<AbstractImporter>& importer: _state->importers) {
+        if(!importer->openFile(filename)) {
+            close();
+            return false;
+        }
+    }
+
+    _state->opened = true;
+    return true;
+}
+
+bool ImporterPool::openData(const Containers::ArrayView<const char> data) {
+    close();
+    for(Containers::Pointer<AbstractImporter>& importer: _state->importers) {
+        if(!importer->openData(data)) {
+            close();
+            return false;
+        }
+    }
+
+    _state->opened = true;
+    return true;
+}
+
+void ImporterPool::close() {
+    for(Containers::Pointer<AbstractImporter>& importer: _state->importers)
+        importer->close();
+    _state->requests.clear();
+    _state->maxDataSize = 0;
+    _state->opened = false;
+}
+
+std::size_t ImporterPool::maxInFlightMemory() const {
+    return _state->maxInFlightMemory;
+}
+
+ImporterPool& ImporterPool::setMaxInFlightMemory(const std::size_t bytes) {
+    _state->maxInFlightMemory = bytes;
+    return *this;
+}
+
+std::size_t ImporterPool::pendingCount() const {
+    return _state->requests.size();
+}
+
+void ImporterPool::request(Containers::Pointer<Request>&& request) {
+    _state->requests.push_back(std::move(request));
+}
+
+ImporterPool& ImporterPool::requestImage1D(const UnsignedInt id, const UnsignedInt level, void(*const callback)(UnsignedInt, Containers::Optional<ImageData1D>&&, void*), void* const userData) {
+    CORRADE_ASSERT(_state->opened,
+        "Trade::ImporterPool::requestImage1D(): no file opened", *this);
+    CORRADE_ASSERT(id < _state->importers[0]->image1DCount(),
+        "Trade::ImporterPool::requestImage1D(): index" << id << "out of range for" << _state->importers[0]->image1DCount() << "entries", *this);
+    CORRADE_ASSERT(level < _state->importers[0]->image1DLevelCount(id),
+        "Trade::ImporterPool::requestImage1D(): level" << level << "out of range for" << _state->importers[0]->image1DLevelCount(id) << "entries", *this);
+    CORRADE_ASSERT(callback,
+        "Trade::ImporterPool::requestImage1D(): callback is null", *this);
+    request(Containers::Pointer<Request>{new TypedRequest<ImageData1D>{id, level, [](AbstractImporter& importer, UnsignedInt itemId, UnsignedInt itemLevel) {
+        return importer.image1D(itemId, itemLevel);
+    }, callback, userData}});
+    return *this;
+}
+
+ImporterPool& ImporterPool::requestImage2D(const UnsignedInt id, const UnsignedInt level, void(*const callback)(UnsignedInt, Containers::Optional<ImageData2D>&&, void*), void* const userData) {
+    CORRADE_ASSERT(_state->opened,
+        "Trade::ImporterPool::requestImage2D(): no file opened", *this);
+    CORRADE_ASSERT(id < _state->importers[0]->image2DCount(),
+        "Trade::ImporterPool::requestImage2D(): index" << id << "out of range for" << _state->importers[0]->image2DCount() << "entries", *this);
+    CORRADE_ASSERT(level < _state->importers[0]->image2DLevelCount(id),
+        "Trade::ImporterPool::requestImage2D(): level" << level << "out of range for" << _state->importers[0]->image2DLevelCount(id) << "entries", *this);
+    CORRADE_ASSERT(callback,
+        "Trade::ImporterPool::requestImage2D(): callback is null", *this);
+    request(Containers::Pointer<Request>{new TypedRequest<ImageData2D>{id, level, [](AbstractImporter& importer, UnsignedInt itemId, UnsignedInt itemLevel) {
+        return importer.image2D(itemId, itemLevel);
+    }, callback, userData}});
+    return *this;
+}
+
+ImporterPool& ImporterPool::requestImage3D(const UnsignedInt id, const UnsignedInt level, void(*const callback)(UnsignedInt, Containers::Optional<ImageData3D>&&, void*), void* const userData) {
+    CORRADE_ASSERT(_state->opened,
+        "Trade::ImporterPool::requestImage3D(): no file opened", *this);
+    CORRADE_ASSERT(id < _state->importers[0]->image3DCount(),
+        "Trade::ImporterPool::requestImage3D(): index" << id << "out of range for" << _state->importers[0]->image3DCount() << "entries", *this);
+    CORRADE_ASSERT(level < _state->importers[0]->image3DLevelCount(id),
+        "Trade::ImporterPool::requestImage3D(): level" << level << "out of range for" << _state->importers[0]->image3DLevelCount(id) << "entries", *this);
+    CORRADE_ASSERT(callback,
+        "Trade::ImporterPool::requestImage3D(): callback is null", *this);
+    request(Containers::Pointer<Request>{new TypedRequest<ImageData3D>{id, level, [](AbstractImporter& importer, UnsignedInt itemId, UnsignedInt itemLevel) {
+        return importer.image3D(itemId, itemLevel);
+    }, callback, userData}});
+    return *this;
+}
+
+ImporterPool& ImporterPool::requestMesh(const UnsignedInt id, const UnsignedInt level, void(*const callback)(UnsignedInt, Containers::Optional<MeshData>&&, void*), void* const userData) {
+    CORRADE_ASSERT(_state->opened,
+        "Trade::ImporterPool::requestMesh(): no file opened", *this);
+    CORRADE_ASSERT(id < _state->importers[0]->meshCount(),
+        "Trade::ImporterPool::requestMesh(): index" << id << "out of range for" << _state->importers[0]->meshCount() << "entries", *this);
+    CORRADE_ASSERT(level < _state->importers[0]->meshLevelCount(id),
+        "Trade::ImporterPool::requestMesh(): level" << level << "out of range for" << _state->importers[0]->meshLevelCount(id) << "entries", *this);
+    CORRADE_ASSERT(callback,
+        "Trade::ImporterPool::requestMesh(): callback is null", *this);
+    request(Containers::Pointer<Request>{new TypedRequest<MeshData>{id, level, [](AbstractImporter& importer, UnsignedInt itemId, UnsignedInt itemLevel) {
+        return importer.mesh(itemId, itemLevel);
+    }, callback, userData}});
+    return *this;
+}
+
+ImporterPool& ImporterPool::requestMaterial(const UnsignedInt id, void(*const callback)(UnsignedInt, Containers::Optional<MaterialData>&&, void*), void* const userData) {
+    CORRADE_ASSERT(_state->opened,
+        "Trade::ImporterPool::requestMaterial(): no file opened", *this);
+    CORRADE_ASSERT(id < _state->importers[0]->materialCount(),
+        "Trade::ImporterPool::requestMaterial(): index" << id << "out of range for" << _state->importers[0]->materialCount() << "entries", *this);
+    CORRADE_ASSERT(callback,
+        "Trade::ImporterPool::requestMaterial(): callback is null", *this);
+    request(Containers::Pointer<Request>{new TypedRequest<MaterialData>{id, 0, [](AbstractImporter& importer, UnsignedInt itemId, UnsignedInt) {
+        /* With MAGNUM_BUILD_DEPRECATED this returns a derived type, which
+           can't be returned from the lambda directly */
+        return Containers::Optional<MaterialData>{importer.material(itemId)};
+    }, callback, userData}});
+    return *this;
+}
+
+ImporterPool& ImporterPool::requestAnimation(const UnsignedInt id, void(*const callback)(UnsignedInt, Containers::Optional<AnimationData>&&, void*), void* const userData) {
+    CORRADE_ASSERT(_state->opened,
+        "Trade::ImporterPool::requestAnimation(): no file opened", *this);
+    CORRADE_ASSERT(id < _state->importers[0]->animationCount(),
+        "Trade::ImporterPool::requestAnimation(): index" << id << "out of range for" << _state->importers[0]->animationCount() << "entries", *this);
+    CORRADE_ASSERT(callback,
+        "Trade::ImporterPool::requestAnimation(): callback is null", *this);
+    request(Containers::Pointer<Request>{new TypedRequest<AnimationData>{id, 0, [](AbstractImporter& importer, UnsignedInt itemId, UnsignedInt) {
+        return importer.animation(itemId);
+    }, callback, userData}});
+    return *this;
+}
+
+std::size_t ImporterPool::process(const TaskExecutor executor, void* const executorUserData, const std::size_t maxCount) {
+    CORRADE_ASSERT(_state->opened,
+        "Trade::ImporterPool::process(): no file opened", {});
+
+    std::size_t processed = 0;
+    while(!_state->requests.empty() && processed < maxCount) {
+        /* Import at most one item on each importer instance. If the memory
+           is bounded, import only as many as are estimated to fit, starting
+           with a single one if there's nothing to estimate from yet. */
+        std::size_t roundSize = executor ? _state->importers.size() : 1;
+        if(_state->maxInFlightMemory)
+            roundSize = std::max(std::size_t{1}, std::min(roundSize, _state->maxDataSize ? _state->maxInFlightMemory/_state->maxDataSize : 1));
+        roundSize = std::min({roundSize, _state->requests.size(), maxCount - processed});
+
+        /* Take the requests out of the queue, as the callbacks may be adding
+           new ones */
+        std::vector<Containers::Pointer<Request>> round(
+            std::make_move_iterator(_state->requests.begin()),
+            std::make_move_iterator(_state->requests.begin() + roundSize));
+        _state->requests.erase(_state->requests.begin(), _state->requests.begin() + roundSize);
+
+        /* Each task uses a different importer instance, so they're
+           independent of each other */
+        if(roundSize == 1) round[0]->import(*_state->importers[0]);
+        else {
+            std::pair<std::vector<Containers::Pointer<Request>>*, Containers::Array<Containers::Pointer<AbstractImporter>>*> taskState{&round, &_state->importers};
+            executor(roundSize, [](UnsignedInt i, void* userData) {
+                auto& s = *static_cast<std::pair<std::vector<Containers::Pointer<Request>>*, Containers::Array<Containers::Pointer<AbstractImporter>>*>*>(userData);
+                (*s.first)[i]->import(*(*s.second)[i]);
+            }, &taskState, executorUserData);
+        }
+
+        /* Deliver the results in the order they were requested */
+        for(Containers::Pointer<Request>& request: round) {
+            _state->maxDataSize = std::max(_state->maxDataSize, request->dataSize());
+            request->deliver();
+        }
+
+        processed += roundSize;
+    }
+
+    return processed;
+}
+
+}}
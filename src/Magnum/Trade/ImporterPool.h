@@ -0,0 +1,317 @@
+#ifndef Magnum_Trade_ImporterPool_h
+#define Magnum_Trade_ImporterPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::ImporterPool
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Utility/StlForwardString.h>
+
+#include "Magnum/TaskExecutor.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Pool of importers for parallel data import
+@m_since_latest
+
+Each @ref AbstractImporter instance imports one item at a time from the
+calling thread. This class opens the same file in several importer instances
+and imports queued items on all of them in parallel, delivering the results
+to completion callbacks. It works with any importer plugin, as each instance
+is only ever used from one thread at a time.
+
+@section Trade-ImporterPool-usage Usage
+
+Create the importer instances and set up their flags, configuration and file
+callbacks, then pass them to the pool and open a file. The file is opened by
+each instance separately, so expensive opening of large files is repeated in
+each. Then queue import requests with a callback for each and call
+@ref process() with a @ref TaskExecutor that distributes the work across
+threads. The callbacks are called on the thread that called @ref process(), in
+the order the items were requested, so they don't need to be thread-safe:
+
+@snippet MagnumTrade.cpp ImporterPool-usage
+
+If you need the import to not block the main thread, for example when streaming
+a level in a game, call @ref process() from a dedicated background thread and
+pass the results to the main thread from the callbacks. It's also possible to
+limit the count of items processed in a single @ref process() call and call it
+repeatedly, for example once each frame.
+
+Thanks to the callbacks being called on the calling thread, they can queue more
+requests, for example requesting textures and images referenced by an imported
+material. The newly queued requests get processed in the same
+@ref process() call.
+
+@section Trade-ImporterPool-memory Bounding in-flight memory
+
+The items are imported in rounds. A round imports at most @ref count() items,
+one on each importer instance, and calls the callbacks for all of them before
+the next round starts. Imported data thus occupy memory only until the
+callbacks consume them. To limit peak memory use with large items, set
+@ref setMaxInFlightMemory(). The size of imported items isn't known upfront, so
+the pool estimates it from the largest item imported so far. The first round
+then imports only a single item, and each later round imports as many items as
+fit into the limit, but always at least one. The limit is thus a
+best-effort bound for items of similar size and not a hard guarantee.
+
+@section Trade-ImporterPool-threads Thread safety
+
+Each importer instance is used by at most one task at a time. As long as the
+plugin doesn't share global state between its instances without
+synchronization, the import is thread-safe. File callbacks set on the
+instances, however, can be called from the worker threads if the plugin loads
+external files lazily during import, such as glTF buffers or images. They
+either need to be thread-safe or, preferably, each instance should use a
+separate callback state.
+
+If Corrade is built with @ref CORRADE_BUILD_MULTITHREADED, which is the
+default, @ref Corrade::Utility::Error redirection is thread-local. Messages
+printed by the plugins on worker threads thus aren't affected by redirection
+done on the thread calling @ref process().
+
+@see @ref TaskExecutor
+*/
+class MAGNUM_TRADE_EXPORT ImporterPool {
+    public:
+        /**
+         * @brief Constructor
+         * @param importers     Importer instances
+         *
+         * Expects that @p importers is not empty and all instances are
+         * non-null. The instances should all be the same plugin with the same
+         * configuration, as items are imported by whichever instance is free.
+         * Any file opened in the instances is closed.
+         */
+        explicit ImporterPool(Containers::Array<Containers::Pointer<AbstractImporter>>&& importers);
+
+        /** @brief Copying is not allowed */
+        ImporterPool(const ImporterPool&) = delete;
+
+        /** @brief Move constructor */
+        ImporterPool(ImporterPool&&) noexcept;
+
+        ~ImporterPool();
+
+        /** @brief Copying is not allowed */
+        ImporterPool& operator=(const ImporterPool&) = delete;
+
+        /** @brief Move assignment */
+        ImporterPool& operator=(ImporterPool&&) noexcept;
+
+        /** @brief Count of importer instances */
+        UnsignedInt count() const;
+
+        /**
+         * @brief Importer instance
+         *
+         * Expects that @p id is less than @ref count(). Meant for setting up
+         * the instances and querying data counts and names, the items
+         * themselves should be imported through the pool. Don't open or close
+         * files on the instances directly, use @ref openFile(),
+         * @ref openData() and @ref close() instead.
+         */
+        AbstractImporter& importer(UnsignedInt id);
+        const AbstractImporter& importer(UnsignedInt id) const; /**< @overload */
+
+        /** @brief Whether a file is opened */
+        bool isOpened() const;
+
+        /**
+         * @brief Open a file
+         *
+         * Closes the previous file, if any, and opens @p filename in all
+         * instances. On failure the file is closed in all instances again and
+         * @cpp false @ce is returned. Any pending requests from the previous
+         * file are discarded.
+         * @see @ref AbstractImporter::openFile()
+         */
+        bool openFile(const std::string& filename);
+
+        /**
+         * @brief Open raw data
+         *
+         * Closes the previous file, if any, and opens @p data in all
+         * instances. On failure the file is closed in all instances again and
+         * @cpp false @ce is returned. Any pending requests from the previous
+         * file are discarded. Plugins usually make a copy of the data in each
+         * instance, set @ref ImporterFlag::PersistentInput on the instances to
+         * avoid that with plugins that support it.
+         * @see @ref AbstractImporter::openData()
+         */
+        bool openData(Containers::ArrayView<const char> data);
+
+        /**
+         * @brief Close currently opened file
+         *
+         * Closes the file in all instances and discards any pending requests.
+         * @see @ref AbstractImporter::close()
+         */
+        void close();
+
+        /**
+         * @brief Max memory occupied by imported items
+         *
+         * Default is @cpp 0 @ce, which means no limit.
+         */
+        std::size_t maxInFlightMemory() const;
+
+        /**
+         * @brief Set max memory occupied by imported items
+         * @return Reference to self (for method chaining)
+         *
+         * Limits the count of items imported in a single round, see
+         * @ref Trade-ImporterPool-memory for details. Set to @cpp 0 @ce to
+         * import up to @ref count() items in each round.
+         */
+        ImporterPool& setMaxInFlightMemory(std::size_t bytes);
+
+        /**
+         * @brief Count of pending requests
+         *
+         * Requests that were queued but not processed yet.
+         */
+        std::size_t pendingCount() const;
+
+        /**
+         * @brief Request a 1D image
+         * @param id        Image ID, from range [0, @ref AbstractImporter::image1DCount())
+         * @param level     Mip level, from range [0, @ref AbstractImporter::image1DLevelCount())
+         * @param callback  Completion callback
+         * @param userData  User data passed to the callback
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that a file is opened. The @p callback gets called with
+         * @p id and the result of @ref AbstractImporter::image1D() from
+         * @ref process().
+         */
+        ImporterPool& requestImage1D(UnsignedInt id, UnsignedInt level, void(*callback)(UnsignedInt, Containers::Optional<ImageData1D>&&, void*), void* userData = nullptr);
+
+        /**
+         * @brief Request a 2D image
+         * @param id        Image ID, from range [0, @ref AbstractImporter::image2DCount())
+         * @param level     Mip level, from range [0, @ref AbstractImporter::image2DLevelCount())
+         * @param callback  Completion callback
+         * @param userData  User data passed to the callback
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that a file is opened. The @p callback gets called with
+         * @p id and the result of @ref AbstractImporter::image2D() from
+         * @ref process().
+         */
+        ImporterPool& requestImage2D(UnsignedInt id, UnsignedInt level, void(*callback)(UnsignedInt, Containers::Optional<ImageData2D>&&, void*), void* userData = nullptr);
+
+        /**
+         * @brief Request a 3D image
+         * @param id        Image ID, from range [0, @ref AbstractImporter::image3DCount())
+         * @param level     Mip level, from range [0, @ref AbstractImporter::image3DLevelCount())
+         * @param callback  Completion callback
+         * @param userData  User data passed to the callback
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that a file is opened. The @p callback gets called with
+         * @p id and the result of @ref AbstractImporter::image3D() from
+         * @ref process().
+         */
+        ImporterPool& requestImage3D(UnsignedInt id, UnsignedInt level, void(*callback)(UnsignedInt, Containers::Optional<ImageData3D>&&, void*), void* userData = nullptr);
+
+        /**
+         * @brief Request a mesh
+         * @param id        Mesh ID, from range [0, @ref AbstractImporter::meshCount())
+         * @param level     Mesh level, from range [0, @ref AbstractImporter::meshLevelCount())
+         * @param callback  Completion callback
+         * @param userData  User data passed to the callback
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that a file is opened. The @p callback gets called with
+         * @p id and the result of @ref AbstractImporter::mesh() from
+         * @ref process().
+         */
+        ImporterPool& requestMesh(UnsignedInt id, UnsignedInt level, void(*callback)(UnsignedInt, Containers::Optional<MeshData>&&, void*), void* userData = nullptr);
+
+        /**
+         * @brief Request a material
+         * @param id        Material ID, from range [0, @ref AbstractImporter::materialCount())
+         * @param callback  Completion callback
+         * @param userData  User data passed to the callback
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that a file is opened. The @p callback gets called with
+         * @p id and the result of @ref AbstractImporter::material() from
+         * @ref process().
+         */
+        ImporterPool& requestMaterial(UnsignedInt id, void(*callback)(UnsignedInt, Containers::Optional<MaterialData>&&, void*), void* userData = nullptr);
+
+        /**
+         * @brief Request an animation
+         * @param id        Animation ID, from range [0, @ref AbstractImporter::animationCount())
+         * @param callback  Completion callback
+         * @param userData  User data passed to the callback
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that a file is opened. The @p callback gets called with
+         * @p id and the result of @ref AbstractImporter::animation() from
+         * @ref process().
+         */
+        ImporterPool& requestAnimation(UnsignedInt id, void(*callback)(UnsignedInt, Containers::Optional<AnimationData>&&, void*), void* userData = nullptr);
+
+        /**
+         * @brief Process pending requests
+         * @param executor          Task executor
+         * @param executorUserData  User data passed to the executor
+         * @param maxCount          Max count of requests to process
+         * @return Count of processed requests
+         *
+         * Expects that a file is opened. Imports pending requests in rounds
+         * of up to @ref count() items, calling @p executor with one task for
+         * each item in the round, and calls their callbacks in the order the
+         * items were requested once the round finishes. Processes requests
+         * queued by the callbacks as well, until there are no more pending
+         * requests or @p maxCount requests were processed. If @p executor is
+         * @cpp nullptr @ce, the items are imported serially on the calling
+         * thread using the first importer instance.
+         */
+        std::size_t process(TaskExecutor executor, void* executorUserData, std::size_t maxCount = ~std::size_t{});
+
+    private:
+        struct Request;
+        template<class> struct TypedRequest;
+        struct State;
+
+        MAGNUM_TRADE_LOCAL void request(Containers::Pointer<Request>&& request);
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
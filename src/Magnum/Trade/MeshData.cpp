@@ -578,6 +578,10 @@ void tangentsOrNormalsInto(const Containers::StridedArrayView1D<const void> attr
         Math::unpackInto(Containers::arrayCast<2, const Byte>(attributeData, 3), destination3f);
     else if(format == VertexFormat::Vector3sNormalized)
         Math::unpackInto(Containers::arrayCast<2, const Short>(attributeData, 3), destination3f);
+    else if(format == VertexFormat::Vector2bNormalized)
+        Math::unpackOctahedralInto(Containers::arrayCast<const Vector2b>(attributeData), destination);
+    else if(format == VertexFormat::Vector2sNormalized)
+        Math::unpackOctahedralInto(Containers::arrayCast<const Vector2s>(attributeData), destination);
     else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 }
 
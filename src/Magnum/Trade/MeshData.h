@@ -76,7 +76,10 @@ enum class MeshAttribute: UnsignedShort {
      * Tangent, optionally including bitangent sign. In the first case the type
      * is usually @ref VertexFormat::Vector3, but can be also
      * @ref VertexFormat::Vector3h, @ref VertexFormat::Vector3bNormalized or
-     * @ref VertexFormat::Vector3sNormalized; in the second case the type is
+     * @ref VertexFormat::Vector3sNormalized, or octahedral-encoded in
+     * @ref VertexFormat::Vector2bNormalized or
+     * @ref VertexFormat::Vector2sNormalized as described for
+     * @ref MeshAttribute::Normal; in the second case the type is
      * @ref VertexFormat::Vector4 (or @ref VertexFormat::Vector4h,
      * @ref VertexFormat::Vector4bNormalized,
      * @ref VertexFormat::Vector4sNormalized) and the fourth component is a
@@ -95,8 +98,11 @@ enum class MeshAttribute: UnsignedShort {
 
     /**
      * Bitangent. Type is usually @ref VertexFormat::Vector3, but can be also
-     * @ref VertexFormat::Vector3h, @ref VertexFormat::Vector3bNormalized or
-     * @ref VertexFormat::Vector3sNormalized. For better storage efficiency,
+     * @ref VertexFormat::Vector3h, @ref VertexFormat::Vector3bNormalized,
+     * @ref VertexFormat::Vector3sNormalized, or octahedral-encoded in
+     * @ref VertexFormat::Vector2bNormalized or
+     * @ref VertexFormat::Vector2sNormalized as described for
+     * @ref MeshAttribute::Normal. For better storage efficiency,
      * the bitangent can be also reconstructed from the normal and tangent, see
      * @ref MeshAttribute::Tangent for more information. Corresponds to
      * @ref Shaders::Generic::Bitangent.
@@ -109,7 +115,25 @@ enum class MeshAttribute: UnsignedShort {
      * @ref VertexFormat::Vector3h. @ref VertexFormat::Vector3bNormalized or
      * @ref VertexFormat::Vector3sNormalized. Corresponds to
      * @ref Shaders::Generic::Normal.
-     * @see @ref MeshData::normalsAsArray()
+     *
+     * Additionally, a two-component
+     * @ref VertexFormat::Vector2bNormalized or
+     * @ref VertexFormat::Vector2sNormalized denotes an octahedral-encoded
+     * unit vector, which takes two thirds of the space of the equivalent
+     * three-component format at a comparable precision. See
+     * @ref Math::packOctahedral() for details about the encoding. GPUs
+     * can't decode this format natively, a shader consuming it is expected to
+     * reconstruct the direction like this:
+     *
+     * @code{.glsl}
+     * vec3 unpackOctahedral(vec2 packed) {
+     *     vec3 n = vec3(packed, 1.0 - abs(packed.x) - abs(packed.y));
+     *     if(n.z < 0.0) n.xy = (1.0 - abs(n.yx))*vec2(
+     *         n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+     *     return normalize(n);
+     * }
+     * @endcode
+     * @see @ref MeshData::normalsAsArray(), @ref Math::unpackOctahedral()
      */
     Normal,
 
@@ -2016,7 +2040,9 @@ namespace Implementation {
                  format == VertexFormat::Vector3s ||
                  format == VertexFormat::Vector3sNormalized)) ||
             (name == MeshAttribute::Tangent &&
-                (format == VertexFormat::Vector3 ||
+                (format == VertexFormat::Vector2bNormalized ||
+                 format == VertexFormat::Vector2sNormalized ||
+                 format == VertexFormat::Vector3 ||
                  format == VertexFormat::Vector3h ||
                  format == VertexFormat::Vector3bNormalized ||
                  format == VertexFormat::Vector3sNormalized ||
@@ -2025,7 +2051,9 @@ namespace Implementation {
                  format == VertexFormat::Vector4bNormalized ||
                  format == VertexFormat::Vector4sNormalized)) ||
             ((name == MeshAttribute::Bitangent || name == MeshAttribute::Normal) &&
-                (format == VertexFormat::Vector3 ||
+                (format == VertexFormat::Vector2bNormalized ||
+                 format == VertexFormat::Vector2sNormalized ||
+                 format == VertexFormat::Vector3 ||
                  format == VertexFormat::Vector3h ||
                  format == VertexFormat::Vector3bNormalized ||
                  format == VertexFormat::Vector3sNormalized)) ||
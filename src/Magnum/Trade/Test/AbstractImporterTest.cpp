@@ -70,6 +70,7 @@ struct AbstractImporterTest: TestSuite::Tester {
 
     void openData();
     void openFileAsData();
+    void openFileAsDataPersistentInput();
     void openFileAsDataNotFound();
 
     void openFileNotImplemented();
@@ -90,6 +91,10 @@ struct AbstractImporterTest: TestSuite::Tester {
     void setFileCallbackOpenFileThroughBaseImplementationFailed();
     void setFileCallbackOpenFileAsData();
     void setFileCallbackOpenFileAsDataFailed();
+    void setFileCallbackOpenFileAsDataPersistentInput();
+    void setFileCallbackMapped();
+    void setFileCallbackMappedTemporary();
+    void setFileCallbackMappedPermanentThenTemporary();
 
     void thingCountNotImplemented();
     void thingCountNoFile();
@@ -293,6 +298,7 @@ AbstractImporterTest::AbstractImporterTest() {
 
               &AbstractImporterTest::openData,
               &AbstractImporterTest::openFileAsData,
+              &AbstractImporterTest::openFileAsDataPersistentInput,
               &AbstractImporterTest::openFileAsDataNotFound,
 
               &AbstractImporterTest::openFileNotImplemented,
@@ -313,6 +319,10 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::setFileCallbackOpenFileThroughBaseImplementationFailed,
               &AbstractImporterTest::setFileCallbackOpenFileAsData,
               &AbstractImporterTest::setFileCallbackOpenFileAsDataFailed,
+              &AbstractImporterTest::setFileCallbackOpenFileAsDataPersistentInput,
+              &AbstractImporterTest::setFileCallbackMapped,
+              &AbstractImporterTest::setFileCallbackMappedTemporary,
+              &AbstractImporterTest::setFileCallbackMappedPermanentThenTemporary,
 
               &AbstractImporterTest::thingCountNotImplemented,
               &AbstractImporterTest::thingCountNoFile,
@@ -637,6 +647,32 @@ void AbstractImporterTest::openFileAsData() {
     CORRADE_VERIFY(!importer.isOpened());
 }
 
+void AbstractImporterTest::openFileAsDataPersistentInput() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenData(Containers::ArrayView<const char>) override {
+            persistentInput = !!(flags() & ImporterFlag::PersistentInput);
+            _opened = true;
+        }
+
+        bool _opened = false;
+        bool persistentInput = true;
+    } importer;
+
+    importer.setFlags(ImporterFlag::PersistentInput);
+
+    /* The data read by doOpenFile() are a temporary, so the flag shouldn't be
+       visible to doOpenData() */
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_VERIFY(!importer.persistentInput);
+
+    /* But it should be restored after */
+    CORRADE_COMPARE(importer.flags(), ImporterFlag::PersistentInput);
+}
+
 void AbstractImporterTest::openFileAsDataNotFound() {
     struct Importer: AbstractImporter {
         ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
@@ -1070,6 +1106,150 @@ void AbstractImporterTest::setFileCallbackOpenFileAsDataFailed() {
     CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::openFile(): cannot open file file.dat\n");
 }
 
+void AbstractImporterTest::setFileCallbackOpenFileAsDataPersistentInput() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenData(Containers::ArrayView<const char> data) override {
+            _opened = (data.size() == 1 && data[0] == '\xb0');
+        }
+
+        bool _opened = false;
+    } importer;
+
+    struct State {
+        const char data = '\xb0';
+        bool loaded = false;
+        bool closed = false;
+        bool calledNotSureWhy = false;
+    } state;
+
+    importer.setFlags(ImporterFlag::PersistentInput);
+    importer.setFileCallback([](const std::string& filename, InputFileCallbackPolicy policy, State& state) -> Containers::Optional<Containers::ArrayView<const char>> {
+        if(filename == "file.dat" && policy == InputFileCallbackPolicy::LoadPermanent) {
+            state.loaded = true;
+            return Containers::arrayView(&state.data, 1);
+        }
+
+        if(filename == "file.dat" && policy == InputFileCallbackPolicy::Close) {
+            state.closed = true;
+            return {};
+        }
+
+        state.calledNotSureWhy = true;
+        return {};
+    }, state);
+
+    /* The data are loaded permanently and not closed after, as the importer
+       is allowed to reference them */
+    CORRADE_VERIFY(importer.openFile("file.dat"));
+    CORRADE_VERIFY(state.loaded);
+    CORRADE_VERIFY(!state.closed);
+    CORRADE_VERIFY(!state.calledNotSureWhy);
+}
+
+void AbstractImporterTest::setFileCallbackMapped() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenData(Containers::ArrayView<const char> data) override {
+            _data = data;
+            _opened = (data.size() == 1 && data[0] == '\xa5');
+        }
+
+        bool _opened = false;
+        Containers::ArrayView<const char> _data;
+    } importer;
+
+    MappedFileCallback files;
+    importer.setFileCallback(&MappedFileCallback::callback, files);
+    importer.setFlags(ImporterFlag::PersistentInput);
+
+    const std::string filename = Utility::Directory::join(TRADE_TEST_DIR, "file.bin");
+    CORRADE_VERIFY(importer.openFile(filename));
+    CORRADE_COMPARE(files.fileCount(), 1);
+
+    /* The file stays available after the importer is closed, calling the
+       callback again gives back the same memory, and closing it doesn't
+       discard it as it was loaded permanently */
+    importer.close();
+    CORRADE_COMPARE(files.fileCount(), 1);
+    Containers::Optional<Containers::ArrayView<const char>> data = MappedFileCallback::callback(filename, InputFileCallbackPolicy::LoadTemporary, files);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(static_cast<const void*>(data->data()), static_cast<const void*>(importer._data.data()));
+    CORRADE_COMPARE(files.fileCount(), 1);
+
+    MappedFileCallback::callback(filename, InputFileCallbackPolicy::Close, files);
+    CORRADE_COMPARE(files.fileCount(), 1);
+}
+
+void AbstractImporterTest::setFileCallbackMappedTemporary() {
+    struct Importer: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenData(Containers::ArrayView<const char> data) override {
+            _opened = (data.size() == 1 && data[0] == '\xa5');
+        }
+
+        bool _opened = false;
+    } importer;
+
+    MappedFileCallback files;
+    importer.setFileCallback(&MappedFileCallback::callback, files);
+
+    /* Without PersistentInput the file is closed right after opening */
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_COMPARE(files.fileCount(), 0);
+}
+
+void AbstractImporterTest::setFileCallbackMappedPermanentThenTemporary() {
+    struct Importer: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenData(Containers::ArrayView<const char> data) override {
+            _data = data;
+            _opened = (data.size() == 1 && data[0] == '\xa5');
+        }
+
+        bool _opened = false;
+        Containers::ArrayView<const char> _data;
+    };
+
+    MappedFileCallback files;
+    const std::string filename = Utility::Directory::join(TRADE_TEST_DIR, "file.bin");
+
+    /* The first importer references the mapping */
+    Importer persistent;
+    persistent.setFileCallback(&MappedFileCallback::callback, files);
+    persistent.setFlags(ImporterFlag::PersistentInput);
+    CORRADE_VERIFY(persistent.openFile(filename));
+    CORRADE_COMPARE(files.fileCount(), 1);
+
+    /* The second opens the same file temporarily, getting the same mapping
+       and closing it after. That shouldn't discard the mapping the first
+       importer still references. */
+    Importer temporary;
+    temporary.setFileCallback(&MappedFileCallback::callback, files);
+    CORRADE_VERIFY(temporary.openFile(filename));
+    CORRADE_COMPARE(static_cast<const void*>(temporary._data.data()), static_cast<const void*>(persistent._data.data()));
+    CORRADE_COMPARE(files.fileCount(), 1);
+
+    /* The memory is still accessible */
+    Containers::Optional<Containers::ArrayView<const char>> data = MappedFileCallback::callback(filename, InputFileCallbackPolicy::LoadTemporary, files);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(static_cast<const void*>(data->data()), static_cast<const void*>(persistent._data.data()));
+    CORRADE_COMPARE(persistent._data.size(), 1);
+    CORRADE_COMPARE(persistent._data[0], '\xa5');
+}
+
 void AbstractImporterTest::thingCountNotImplemented() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return {}; }
@@ -4654,8 +4834,8 @@ void AbstractImporterTest::debugFlag() {
 void AbstractImporterTest::debugFlags() {
     std::ostringstream out;
 
-    Debug{&out} << (ImporterFlag::Verbose|ImporterFlag(0xf0)) << ImporterFlags{};
-    CORRADE_COMPARE(out.str(), "Trade::ImporterFlag::Verbose|Trade::ImporterFlag(0xf0) Trade::ImporterFlags{}\n");
+    Debug{&out} << (ImporterFlag::Verbose|ImporterFlag::PersistentInput|ImporterFlag(0xf0)) << ImporterFlags{};
+    CORRADE_COMPARE(out.str(), "Trade::ImporterFlag::Verbose|Trade::ImporterFlag::PersistentInput|Trade::ImporterFlag(0xf0) Trade::ImporterFlags{}\n");
 }
 
 }}}}
@@ -25,10 +25,12 @@
 
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/Math/CubicHermite.h"
 #include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Trade/AnimationData.h"
 
 namespace Magnum { namespace Trade { namespace Test { namespace {
@@ -61,6 +63,9 @@ struct AnimationDataTest: TestSuite::Tester {
 
     void release();
 
+    void compress();
+    void compressTwice();
+
     void debugAnimationTrackType();
     void debugAnimationTrackTargetType();
 };
@@ -102,6 +107,9 @@ AnimationDataTest::AnimationDataTest() {
 
               &AnimationDataTest::release,
 
+              &AnimationDataTest::compress,
+              &AnimationDataTest::compressTwice,
+
               &AnimationDataTest::debugAnimationTrackType,
               &AnimationDataTest::debugAnimationTrackTargetType});
 }
@@ -654,6 +662,127 @@ void AnimationDataTest::release() {
     CORRADE_COMPARE(static_cast<const void*>(released.data()), keyframes);
 }
 
+const Float CompressTranslationKeys[]{0.0f, 1.0f, 2.0f, 3.0f};
+const Vector3 CompressTranslations[]{
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {2.0f, 0.0f, 0.0f},
+    {2.0f, 4.0f, 0.0f}
+};
+const Float CompressRotationKeys[]{0.0f, 1.0f, 2.0f};
+const Quaternion CompressRotations[]{
+    Quaternion::rotation(0.0_degf, Vector3::yAxis()),
+    Quaternion::rotation(10.0_degf, Vector3::yAxis()),
+    Quaternion::rotation(20.0_degf, Vector3::yAxis())
+};
+const Float CompressCustomKeys[]{0.0f, 1.0f, 2.0f};
+const bool CompressCustom[]{true, true, false};
+
+AnimationData compressData() {
+    return AnimationData{DataFlags{}, nullptr, {
+        AnimationTrackData{AnimationTrackTargetType::Translation3D, 3,
+            Animation::TrackView<const Float, const Vector3>{
+                CompressTranslationKeys, CompressTranslations,
+                Animation::Interpolation::Linear,
+                animationInterpolatorFor<Vector3>(Animation::Interpolation::Linear)}},
+        AnimationTrackData{AnimationTrackTargetType::Rotation3D, 5,
+            Animation::TrackView<const Float, const Quaternion>{
+                CompressRotationKeys, CompressRotations,
+                Animation::Interpolation::Linear,
+                animationInterpolatorFor<Quaternion>(Animation::Interpolation::Linear),
+                Animation::Extrapolation::DefaultConstructed,
+                Animation::Extrapolation::Constant}},
+        AnimationTrackData{AnimationTrackTargetType(129), 7,
+            Animation::TrackView<const Float, const bool>{
+                CompressCustomKeys, CompressCustom,
+                Animation::Interpolation::Constant,
+                animationInterpolatorFor<bool>(Animation::Interpolation::Constant)}}
+    }};
+}
+
+void AnimationDataTest::compress() {
+    const AnimationData data = compressData();
+
+    AnimationData compressed = compressAnimation(data, 0.001f);
+    CORRADE_COMPARE(compressed.dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(compressed.duration(), (Range1D{0.0f, 3.0f}));
+    CORRADE_COMPARE(compressed.trackCount(), 3);
+
+    /* Translation reduced to three keyframes but not quantized. Rotation
+       reduced to two keyframes, 6 bytes per value. The custom track copied
+       as-is, with the single-byte values padded. */
+    CORRADE_COMPARE(compressed.data().size(), 12 + 36 + 8 + 12 + 12 + 4);
+
+    {
+        /* Vectors are only reduced, so they still interpolate to the
+           original values */
+        CORRADE_COMPARE(compressed.trackType(0), AnimationTrackType::Vector3);
+        CORRADE_COMPARE(compressed.trackResultType(0), AnimationTrackType::Vector3);
+        CORRADE_COMPARE(compressed.trackTargetType(0), AnimationTrackTargetType::Translation3D);
+        CORRADE_COMPARE(compressed.trackTarget(0), 3);
+
+        const auto& track = compressed.track<Vector3>(0);
+        CORRADE_COMPARE_AS(track.keys(), Containers::arrayView<Float>({
+            0.0f, 2.0f, 3.0f
+        }), TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(track.values(), Containers::arrayView<Vector3>({
+            {0.0f, 0.0f, 0.0f},
+            {2.0f, 0.0f, 0.0f},
+            {2.0f, 4.0f, 0.0f}
+        }), TestSuite::Compare::Container);
+        CORRADE_COMPARE(track.interpolation(), Animation::Interpolation::Linear);
+        CORRADE_COMPARE(track.at(1.0f), (Vector3{1.0f, 0.0f, 0.0f}));
+        CORRADE_COMPARE(track.at(2.5f), (Vector3{2.0f, 2.0f, 0.0f}));
+    } {
+        CORRADE_COMPARE(compressed.trackType(1), AnimationTrackType::Vector3us);
+        CORRADE_COMPARE(compressed.trackResultType(1), AnimationTrackType::Quaternion);
+        CORRADE_COMPARE(compressed.trackTargetType(1), AnimationTrackTargetType::Rotation3D);
+        CORRADE_COMPARE(compressed.trackTarget(1), 5);
+
+        const auto& track = compressed.track<Vector3us, Quaternion>(1);
+        CORRADE_COMPARE_AS(track.keys(), Containers::arrayView<Float>({
+            0.0f, 2.0f
+        }), TestSuite::Compare::Container);
+        CORRADE_COMPARE(track.interpolation(), Animation::Interpolation::Linear);
+        CORRADE_COMPARE(track.before(), Animation::Extrapolation::DefaultConstructed);
+        CORRADE_COMPARE(track.after(), Animation::Extrapolation::Constant);
+        CORRADE_COMPARE(Math::abs(Math::dot(track.at(1.0f), Quaternion::rotation(10.0_degf, Vector3::yAxis()))), 1.0f);
+    } {
+        CORRADE_COMPARE(compressed.trackType(2), AnimationTrackType::Bool);
+        CORRADE_COMPARE(compressed.trackResultType(2), AnimationTrackType::Bool);
+        CORRADE_COMPARE(compressed.trackTargetType(2), AnimationTrackTargetType(129));
+        CORRADE_COMPARE(compressed.trackTarget(2), 7);
+
+        const auto& track = compressed.track<bool>(2);
+        CORRADE_COMPARE_AS(track.keys(), Containers::arrayView<Float>({
+            0.0f, 1.0f, 2.0f
+        }), TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(track.values(), Containers::arrayView<bool>({
+            true, true, false
+        }), TestSuite::Compare::Container);
+        CORRADE_COMPARE(track.interpolation(), Animation::Interpolation::Constant);
+        CORRADE_COMPARE(track.at(1.5f), true);
+        CORRADE_COMPARE(track.at(2.5f), false);
+    }
+}
+
+void AnimationDataTest::compressTwice() {
+    const AnimationData data = compressData();
+
+    /* Compressing already compressed data shouldn't reinterpret the packed
+       rotations as quaternions again */
+    AnimationData compressed = compressAnimation(compressAnimation(data, 0.001f), 0.001f);
+    CORRADE_COMPARE(compressed.trackCount(), 3);
+    CORRADE_COMPARE(compressed.trackType(1), AnimationTrackType::Vector3us);
+    CORRADE_COMPARE(compressed.trackResultType(1), AnimationTrackType::Quaternion);
+
+    const auto& track = compressed.track<Vector3us, Quaternion>(1);
+    CORRADE_COMPARE_AS(track.keys(), Containers::arrayView<Float>({
+        0.0f, 2.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(Math::abs(Math::dot(track.at(1.0f), Quaternion::rotation(10.0_degf, Vector3::yAxis()))), 1.0f);
+}
+
 void AnimationDataTest::debugAnimationTrackType() {
     std::ostringstream out;
 
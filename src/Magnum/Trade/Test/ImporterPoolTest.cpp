@@ -0,0 +1,488 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImporterPool.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct ImporterPoolTest: TestSuite::Tester {
+    explicit ImporterPoolTest();
+
+    void construct();
+    void constructNoImporters();
+    void constructNullImporter();
+    void constructMove();
+
+    void openData();
+    void openDataFailed();
+    void close();
+
+    void process();
+    void processSerial();
+    void processMaxCount();
+    void processMaxInFlightMemory();
+    void processRequestFromCallback();
+    void processMeshMaterial();
+
+    void importerOutOfRange();
+    void requestNotOpened();
+    void requestOutOfRange();
+    void processNotOpened();
+};
+
+ImporterPoolTest::ImporterPoolTest() {
+    addTests({&ImporterPoolTest::construct,
+              &ImporterPoolTest::constructNoImporters,
+              &ImporterPoolTest::constructNullImporter,
+              &ImporterPoolTest::constructMove,
+
+              &ImporterPoolTest::openData,
+              &ImporterPoolTest::openDataFailed,
+              &ImporterPoolTest::close,
+
+              &ImporterPoolTest::process,
+              &ImporterPoolTest::processSerial,
+              &ImporterPoolTest::processMaxCount,
+              &ImporterPoolTest::processMaxInFlightMemory,
+              &ImporterPoolTest::processRequestFromCallback,
+              &ImporterPoolTest::processMeshMaterial,
+
+              &ImporterPoolTest::importerOutOfRange,
+              &ImporterPoolTest::requestNotOpened,
+              &ImporterPoolTest::requestOutOfRange,
+              &ImporterPoolTest::processNotOpened});
+}
+
+struct Importer: AbstractImporter {
+    explicit Importer(bool failOpen = false): failOpen{failOpen} {}
+
+    ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+    bool doIsOpened() const override { return _opened; }
+    void doClose() override { _opened = false; }
+    void doOpenData(Containers::ArrayView<const char>) override {
+        _opened = !failOpen;
+    }
+
+    /* The importer state is used to check which instance imported what */
+    UnsignedInt doImage2DCount() const override { return 10; }
+    Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+        return ImageData2D{PixelFormat::R8Unorm, {4, 1}, Containers::Array<char>{4}, this};
+    }
+
+    UnsignedInt doMeshCount() const override { return 3; }
+    Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt) override {
+        return MeshData{MeshPrimitive::Points, id + 1, this};
+    }
+
+    UnsignedInt doMaterialCount() const override { return 2; }
+    Containers::Optional<MaterialData> doMaterial(UnsignedInt id) override {
+        return MaterialData{MaterialType::Phong, {
+            {MaterialAttribute::Shininess, Float(id)}
+        }, this};
+    }
+
+    bool failOpen;
+    bool _opened = false;
+};
+
+Containers::Array<Containers::Pointer<AbstractImporter>> importers(UnsignedInt count) {
+    Containers::Array<Containers::Pointer<AbstractImporter>> out{count};
+    for(Containers::Pointer<AbstractImporter>& importer: out)
+        importer.reset(new Importer);
+    return out;
+}
+
+/* Records sizes of all rounds and executes the tasks serially in a reverse
+   order to verify the result doesn't depend on it */
+void reverseExecutor(UnsignedInt count, void(*task)(UnsignedInt, void*), void* state, void* userData) {
+    static_cast<std::vector<UnsignedInt>*>(userData)->push_back(count);
+    for(UnsignedInt i = count; i != 0; --i) task(i - 1, state);
+}
+
+struct Results {
+    std::vector<UnsignedInt> ids;
+    std::vector<const void*> importerStates;
+};
+
+void imageCallback(UnsignedInt id, Containers::Optional<ImageData2D>&& image, void* userData) {
+    Results& results = *static_cast<Results*>(userData);
+    results.ids.push_back(id);
+    results.importerStates.push_back(image ? image->importerState() : nullptr);
+}
+
+void ImporterPoolTest::construct() {
+    Containers::Array<Containers::Pointer<AbstractImporter>> instances = importers(3);
+    AbstractImporter* second = instances[1].get();
+
+    ImporterPool pool{std::move(instances)};
+    CORRADE_COMPARE(pool.count(), 3);
+    CORRADE_COMPARE(&pool.importer(1), second);
+    CORRADE_VERIFY(!pool.isOpened());
+    CORRADE_COMPARE(pool.maxInFlightMemory(), 0);
+    CORRADE_COMPARE(pool.pendingCount(), 0);
+}
+
+void ImporterPoolTest::constructNoImporters() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    ImporterPool pool{Containers::Array<Containers::Pointer<AbstractImporter>>{}};
+    CORRADE_COMPARE(out.str(), "Trade::ImporterPool: no importers passed\n");
+}
+
+void ImporterPoolTest::constructNullImporter() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Containers::Array<Containers::Pointer<AbstractImporter>> instances = importers(3);
+    instances[1] = nullptr;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    ImporterPool pool{std::move(instances)};
+    CORRADE_COMPARE(out.str(), "Trade::ImporterPool: importer 1 is null\n");
+}
+
+void ImporterPoolTest::constructMove() {
+    ImporterPool a{importers(2)};
+    a.setMaxInFlightMemory(1024);
+
+    ImporterPool b{std::move(a)};
+    CORRADE_COMPARE(b.count(), 2);
+    CORRADE_COMPARE(b.maxInFlightMemory(), 1024);
+
+    ImporterPool c{importers(3)};
+    c = std::move(b);
+    CORRADE_COMPARE(c.count(), 2);
+    CORRADE_COMPARE(c.maxInFlightMemory(), 1024);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<ImporterPool>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<ImporterPool>::value);
+}
+
+void ImporterPoolTest::openData() {
+    ImporterPool pool{importers(3)};
+
+    const char data[]{'\x00'};
+    CORRADE_VERIFY(pool.openData(data));
+    CORRADE_VERIFY(pool.isOpened());
+    for(UnsignedInt i = 0; i != pool.count(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(pool.importer(i).isOpened());
+    }
+}
+
+void ImporterPoolTest::openDataFailed() {
+    Containers::Array<Containers::Pointer<AbstractImporter>> instances = importers(3);
+    instances[2].reset(new Importer{true});
+    ImporterPool pool{std::move(instances)};
+
+    /* If any instance fails, the file gets closed in all of them */
+    const char data[]{'\x00'};
+    CORRADE_VERIFY(!pool.openData(data));
+    CORRADE_VERIFY(!pool.isOpened());
+    for(UnsignedInt i = 0; i != pool.count(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(!pool.importer(i).isOpened());
+    }
+}
+
+void ImporterPoolTest::close() {
+    ImporterPool pool{importers(2)};
+
+    const char data[]{'\x00'};
+    CORRADE_VERIFY(pool.openData(data));
+
+    Results results;
+    pool.requestImage2D(0, 0, imageCallback, &results)
+        .requestImage2D(1, 0, imageCallback, &results);
+    CORRADE_COMPARE(pool.pendingCount(), 2);
+
+    /* Pending requests are discarded on close */
+    pool.close();
+    CORRADE_VERIFY(!pool.isOpened());
+    CORRADE_VERIFY(!pool.importer(0).isOpened());
+    CORRADE_VERIFY(!pool.importer(1).isOpened());
+    CORRADE_COMPARE(pool.pendingCount(), 0);
+    CORRADE_VERIFY(results.ids.empty());
+}
+
+void ImporterPoolTest::process() {
+    ImporterPool pool{importers(3)};
+
+    const char data[]{'\x00'};
+    CORRADE_VERIFY(pool.openData(data));
+
+    Results results;
+    for(UnsignedInt i: {3, 1, 4, 1, 5, 9, 2})
+        pool.requestImage2D(i, 0, imageCallback, &results);
+    CORRADE_COMPARE(pool.pendingCount(), 7);
+
+    std::vector<UnsignedInt> rounds;
+    CORRADE_COMPARE(pool.process(reverseExecutor, &rounds), 7);
+    CORRADE_COMPARE(pool.pendingCount(), 0);
+
+    /* Rounds of at most three items, one on each instance, a single item is
+       imported without going through the executor */
+    CORRADE_COMPARE_AS(rounds, (std::vector<UnsignedInt>{3, 3}),
+        TestSuite::Compare::Container);
+
+    /* The callbacks are called in the order of requests */
+    CORRADE_COMPARE_AS(results.ids, (std::vector<UnsignedInt>{3, 1, 4, 1, 5, 9, 2}),
+        TestSuite::Compare::Container);
+
+    /* Each item in a round is imported by a different instance */
+    const void* first = &pool.importer(0);
+    const void* second = &pool.importer(1);
+    const void* third = &pool.importer(2);
+    CORRADE_COMPARE_AS(results.importerStates, (std::vector<const void*>{
+        first, second, third,
+        first, second, third,
+        first
+    }), TestSuite::Compare::Container);
+}
+
+void ImporterPoolTest::processSerial() {
+    ImporterPool pool{importers(3)};
+
+    const char data[]{'\x00'};
+    CORRADE_VERIFY(pool.openData(data));
+
+    Results results;
+    for(UnsignedInt i: {0, 1, 2, 3})
+        pool.requestImage2D(i, 0, imageCallback, &results);
+
+    /* Without an executor everything is imported on the first instance */
+    CORRADE_COMPARE(pool.process(nullptr, nullptr), 4);
+    CORRADE_COMPARE_AS(results.ids, (std::vector<UnsignedInt>{0, 1, 2, 3}),
+        TestSuite::Compare::Container);
+    const void* first = &pool.importer(0);
+    CORRADE_COMPARE_AS(results.importerStates, (std::vector<const void*>{
+        first, first, first, first
+    }), TestSuite::Compare::Container);
+}
+
+void ImporterPoolTest::processMaxCount() {
+    ImporterPool pool{importers(3)};
+
+    const char data[]{'\x00'};
+    CORRADE_VERIFY(pool.openData(data));
+
+    Results results;
+    for(UnsignedInt i = 0; i != 7; ++i)
+        pool.requestImage2D(i, 0, imageCallback, &results);
+
+    std::vector<UnsignedInt> rounds;
+    CORRADE_COMPARE(pool.process(reverseExecutor, &rounds, 5), 5);
+    CORRADE_COMPARE(pool.pendingCount(), 2);
+    CORRADE_COMPARE_AS(rounds, (std::vector<UnsignedInt>{3, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(results.ids, (std::vector<UnsignedInt>{0, 1, 2, 3, 4}),
+        TestSuite::Compare::Container);
+
+    /* The rest gets processed in the next call */
+    CORRADE_COMPARE(pool.process(reverseExecutor, &rounds), 2);
+    CORRADE_COMPARE(pool.pendingCount(), 0);
+    CORRADE_COMPARE_AS(rounds, (std::vector<UnsignedInt>{3, 2, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(results.ids, (std::vector<UnsignedInt>{0, 1, 2, 3, 4, 5, 6}),
+        TestSuite::Compare::Container);
+}
+
+void ImporterPoolTest::processMaxInFlightMemory() {
+    ImporterPool pool{importers(4)};
+    pool.setMaxInFlightMemory(9);
+    CORRADE_COMPARE(pool.maxInFlightMemory(), 9);
+
+    const char data[]{'\x00'};
+    CORRADE_VERIFY(pool.openData(data));
+
+    Results results;
+    for(UnsignedInt i = 0; i != 6; ++i)
+        pool.requestImage2D(i, 0, imageCallback, &results);
+
+    /* The first round imports a single item to have something to estimate
+       from, then each image is four bytes, so two fit into the limit */
+    std::vector<UnsignedInt> rounds;
+    CORRADE_COMPARE(pool.process(reverseExecutor, &rounds), 6);
+    CORRADE_COMPARE_AS(rounds, (std::vector<UnsignedInt>{2, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(results.ids, (std::vector<UnsignedInt>{0, 1, 2, 3, 4, 5}),
+        TestSuite::Compare::Container);
+}
+
+void ImporterPoolTest::processRequestFromCallback() {
+    ImporterPool pool{importers(2)};
+
+    const char data[]{'\x00'};
+    CORRADE_VERIFY(pool.openData(data));
+
+    struct State {
+        ImporterPool& pool;
+        Results results;
+        std::vector<UnsignedInt> meshes;
+    } state{pool, {}, {}};
+
+    /* Each mesh callback requests an image, which should get processed in the
+       same call */
+    for(UnsignedInt i: {2, 0})
+        pool.requestMesh(i, 0, [](UnsignedInt id, Containers::Optional<MeshData>&& mesh, void* userData) {
+            State& state = *static_cast<State*>(userData);
+            if(mesh) state.meshes.push_back(id);
+            state.pool.requestImage2D(id + 5, 0, imageCallback, &state.results);
+        }, &state);
+
+    std::vector<UnsignedInt> rounds;
+    CORRADE_COMPARE(pool.process(reverseExecutor, &rounds), 4);
+    CORRADE_COMPARE(pool.pendingCount(), 0);
+    CORRADE_COMPARE_AS(rounds, (std::vector<UnsignedInt>{2, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(state.meshes, (std::vector<UnsignedInt>{2, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(state.results.ids, (std::vector<UnsignedInt>{7, 5}),
+        TestSuite::Compare::Container);
+}
+
+void ImporterPoolTest::processMeshMaterial() {
+    ImporterPool pool{importers(2)};
+
+    const char data[]{'\x00'};
+    CORRADE_VERIFY(pool.openData(data));
+
+    struct State {
+        UnsignedInt vertexCount{};
+        Float shininess{};
+    } state;
+
+    pool.requestMesh(2, 0, [](UnsignedInt, Containers::Optional<MeshData>&& mesh, void* userData) {
+        if(mesh) static_cast<State*>(userData)->vertexCount = mesh->vertexCount();
+    }, &state);
+    pool.requestMaterial(1, [](UnsignedInt, Containers::Optional<MaterialData>&& material, void* userData) {
+        if(material) static_cast<State*>(userData)->shininess = material->attribute<Float>(MaterialAttribute::Shininess);
+    }, &state);
+
+    std::vector<UnsignedInt> rounds;
+    CORRADE_COMPARE(pool.process(reverseExecutor, &rounds), 2);
+    CORRADE_COMPARE(state.vertexCount, 3);
+    CORRADE_COMPARE(state.shininess, 1.0f);
+}
+
+void ImporterPoolTest::importerOutOfRange() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImporterPool pool{importers(3)};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pool.importer(3);
+    CORRADE_COMPARE(out.str(), "Trade::ImporterPool::importer(): index 3 out of range for 3 entries\n");
+}
+
+void ImporterPoolTest::requestNotOpened() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImporterPool pool{importers(2)};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pool.requestImage1D(0, 0, [](UnsignedInt, Containers::Optional<ImageData1D>&&, void*) {})
+        .requestImage2D(0, 0, imageCallback)
+        .requestImage3D(0, 0, [](UnsignedInt, Containers::Optional<ImageData3D>&&, void*) {})
+        .requestMesh(0, 0, [](UnsignedInt, Containers::Optional<MeshData>&&, void*) {})
+        .requestMaterial(0, [](UnsignedInt, Containers::Optional<MaterialData>&&, void*) {})
+        .requestAnimation(0, [](UnsignedInt, Containers::Optional<AnimationData>&&, void*) {});
+    CORRADE_COMPARE(pool.pendingCount(), 0);
+    CORRADE_COMPARE(out.str(),
+        "Trade::ImporterPool::requestImage1D(): no file opened\n"
+        "Trade::ImporterPool::requestImage2D(): no file opened\n"
+        "Trade::ImporterPool::requestImage3D(): no file opened\n"
+        "Trade::ImporterPool::requestMesh(): no file opened\n"
+        "Trade::ImporterPool::requestMaterial(): no file opened\n"
+        "Trade::ImporterPool::requestAnimation(): no file opened\n");
+}
+
+void ImporterPoolTest::requestOutOfRange() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImporterPool pool{importers(2)};
+
+    const char data[]{'\x00'};
+    CORRADE_VERIFY(pool.openData(data));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pool.requestImage2D(10, 0, imageCallback)
+        .requestImage2D(0, 1, imageCallback)
+        .requestImage2D(0, 0, nullptr)
+        .requestMesh(3, 0, [](UnsignedInt, Containers::Optional<MeshData>&&, void*) {})
+        .requestMaterial(2, [](UnsignedInt, Containers::Optional<MaterialData>&&, void*) {});
+    CORRADE_COMPARE(pool.pendingCount(), 0);
+    CORRADE_COMPARE(out.str(),
+        "Trade::ImporterPool::requestImage2D(): index 10 out of range for 10 entries\n"
+        "Trade::ImporterPool::requestImage2D(): level 1 out of range for 1 entries\n"
+        "Trade::ImporterPool::requestImage2D(): callback is null\n"
+        "Trade::ImporterPool::requestMesh(): index 3 out of range for 3 entries\n"
+        "Trade::ImporterPool::requestMaterial(): index 2 out of range for 2 entries\n");
+}
+
+void ImporterPoolTest::processNotOpened() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    ImporterPool pool{importers(2)};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pool.process(nullptr, nullptr);
+    CORRADE_COMPARE(out.str(), "Trade::ImporterPool::process(): no file opened\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ImporterPoolTest)
@@ -26,10 +26,12 @@
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Half.h"
+#include "Magnum/Math/Packing.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace Trade { namespace Test { namespace {
@@ -126,6 +128,7 @@ struct MeshDataTest: TestSuite::Tester {
     void positions3DIntoArrayInvalidSize();
     template<class T> void tangentsAsArray();
     template<class T> void tangentsAsArrayPackedSignedNormalized();
+    template<class T> void tangentsAsArrayPackedOctahedral();
     void tangentsIntoArrayInvalidSize();
     template<class T> void bitangentSignsAsArray();
     template<class T> void bitangentSignsAsArrayPackedSignedNormalized();
@@ -136,6 +139,7 @@ struct MeshDataTest: TestSuite::Tester {
     void bitangentsIntoArrayInvalidSize();
     template<class T> void normalsAsArray();
     template<class T> void normalsAsArrayPackedSignedNormalized();
+    template<class T> void normalsAsArrayPackedOctahedral();
     void normalsIntoArrayInvalidSize();
     template<class T> void textureCoordinates2DAsArray();
     template<class T> void textureCoordinates2DAsArrayPackedUnsigned();
@@ -328,6 +332,8 @@ MeshDataTest::MeshDataTest() {
               &MeshDataTest::tangentsAsArrayPackedSignedNormalized<Vector3s>,
               &MeshDataTest::tangentsAsArrayPackedSignedNormalized<Vector4b>,
               &MeshDataTest::tangentsAsArrayPackedSignedNormalized<Vector4s>,
+              &MeshDataTest::tangentsAsArrayPackedOctahedral<Vector2b>,
+              &MeshDataTest::tangentsAsArrayPackedOctahedral<Vector2s>,
               &MeshDataTest::tangentsIntoArrayInvalidSize,
               &MeshDataTest::bitangentSignsAsArray<Float>,
               &MeshDataTest::bitangentSignsAsArray<Half>,
@@ -344,6 +350,8 @@ MeshDataTest::MeshDataTest() {
               &MeshDataTest::normalsAsArray<Vector3h>,
               &MeshDataTest::normalsAsArrayPackedSignedNormalized<Vector3b>,
               &MeshDataTest::normalsAsArrayPackedSignedNormalized<Vector3s>,
+              &MeshDataTest::normalsAsArrayPackedOctahedral<Vector2b>,
+              &MeshDataTest::normalsAsArrayPackedOctahedral<Vector2s>,
               &MeshDataTest::normalsIntoArrayInvalidSize,
               &MeshDataTest::textureCoordinates2DAsArray<Vector2>,
               &MeshDataTest::textureCoordinates2DAsArray<Vector2h>,
@@ -2181,6 +2189,25 @@ template<class T> void MeshDataTest::tangentsAsArrayPackedSignedNormalized() {
     }), TestSuite::Compare::Container);
 }
 
+template<class T> void MeshDataTest::tangentsAsArrayPackedOctahedral() {
+    setTestCaseTemplateName(NameTraits<T>::name());
+
+    Containers::Array<char> vertexData{3*sizeof(T)};
+    auto tangentsView = Containers::arrayCast<T>(vertexData);
+    tangentsView[0] = Math::packOctahedral<T>(Vector3{1.0f, 0.0f, 0.0f});
+    tangentsView[1] = Math::packOctahedral<T>(Vector3{0.0f, -1.0f, 0.0f});
+    tangentsView[2] = Math::packOctahedral<T>(Vector3{0.0f, 0.6f, -0.8f});
+
+    MeshData data{MeshPrimitive::Points, std::move(vertexData), {MeshAttributeData{MeshAttribute::Tangent,
+        /* Assuming the normalized enum is always after the non-normalized */
+        VertexFormat(UnsignedInt(Implementation::vertexFormatFor<T>()) + 1),
+        tangentsView}}};
+    Containers::Array<Vector3> tangents = data.tangentsAsArray();
+    CORRADE_COMPARE(tangents[0], (Vector3{1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(tangents[1], (Vector3{0.0f, -1.0f, 0.0f}));
+    CORRADE_COMPARE(tangents[2], Math::unpackOctahedral<Vector3>(tangentsView[2]));
+}
+
 void MeshDataTest::tangentsIntoArrayInvalidSize() {
     #ifdef CORRADE_NO_ASSERT
     CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
@@ -2349,6 +2376,26 @@ template<class T> void MeshDataTest::normalsAsArrayPackedSignedNormalized() {
     }), TestSuite::Compare::Container);
 }
 
+template<class T> void MeshDataTest::normalsAsArrayPackedOctahedral() {
+    setTestCaseTemplateName(NameTraits<T>::name());
+
+    Containers::Array<char> vertexData{3*sizeof(T)};
+    auto normalsView = Containers::arrayCast<T>(vertexData);
+    normalsView[0] = Math::packOctahedral<T>(Vector3{0.0f, 0.0f, 1.0f});
+    normalsView[1] = Math::packOctahedral<T>(Vector3{0.0f, 0.0f, -1.0f});
+    normalsView[2] = Math::packOctahedral<T>(Vector3{0.0f, 0.6f, -0.8f});
+
+    MeshData data{MeshPrimitive::Points, std::move(vertexData), {MeshAttributeData{MeshAttribute::Normal,
+        /* Assuming the normalized enum is always after the non-normalized */
+        VertexFormat(UnsignedInt(Implementation::vertexFormatFor<T>()) + 1),
+        normalsView}}};
+    Containers::Array<Vector3> normals = data.normalsAsArray();
+    CORRADE_COMPARE(normals[0], (Vector3{0.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(normals[1], (Vector3{0.0f, 0.0f, -1.0f}));
+    CORRADE_COMPARE(normals[2], Math::unpackOctahedral<Vector3>(normalsView[2]));
+    CORRADE_COMPARE_AS(Math::angle(normals[2], Vector3{0.0f, 0.6f, -0.8f}), Rad{1.0_degf}, TestSuite::Compare::Less);
+}
+
 void MeshDataTest::normalsIntoArrayInvalidSize() {
     #ifdef CORRADE_NO_ASSERT
     CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
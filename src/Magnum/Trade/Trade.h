@@ -78,6 +78,8 @@ typedef ImageData<1> ImageData1D;
 typedef ImageData<2> ImageData2D;
 typedef ImageData<3> ImageData3D;
 
+class ImporterPool;
+
 class LightData;
 
 enum class MeshAttribute: UnsignedShort;
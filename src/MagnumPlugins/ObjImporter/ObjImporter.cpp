@@ -25,18 +25,20 @@
 
 #include "ObjImporter.h"
 
-#include <fstream>
-#include <limits>
-#include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
 #include <unordered_map>
-#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/DebugStl.h>
-#include <Corrade/Utility/String.h>
+#include <Corrade/Utility/Directory.h>
 
 #include "Magnum/Mesh.h"
-#include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/Math/Color.h"
@@ -44,358 +46,725 @@
 
 namespace Magnum { namespace Trade {
 
-struct ObjImporter::File {
-    std::unordered_map<std::string, UnsignedInt> meshesForName;
-    std::vector<std::string> meshNames;
-    std::vector<std::tuple<std::streampos, std::streampos, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
-    Containers::Pointer<std::istream> in;
-};
-
 namespace {
 
-void ignoreLine(std::istream& in) {
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-}
-
-template<std::size_t size> Math::Vector<size, Float> extractFloatData(const std::string& str, Float* extra = nullptr) {
-    std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(str, ' ');
-    if(data.size() < size || data.size() > size + (extra ? 1 : 0)) {
-        Error() << "Trade::ObjImporter::mesh(): invalid float array size";
-        throw 0;
-    }
-
-    Math::Vector<size, Float> output;
-
-    for(std::size_t i = 0; i != size; ++i)
-        output[i] = std::stof(data[i]);
+/* Count of vertex data and index tuples in a part of the file */
+struct Counts {
+    std::size_t positions, textureCoordinates, normals, indices;
+};
 
-    if(data.size() == size+1) {
-        /* This should be obvious from the first if, but add this just to make
-           Clang Analyzer happy */
-        CORRADE_INTERNAL_ASSERT(extra);
+Counts& operator+=(Counts& a, const Counts& b) {
+    a.positions += b.positions;
+    a.textureCoordinates += b.textureCoordinates;
+    a.normals += b.normals;
+    a.indices += b.indices;
+    return a;
+}
 
-        *extra = std::stof(data.back());
-    }
+Counts operator+(Counts a, const Counts& b) { return a += b; }
 
-    return output;
+Counts operator-(const Counts& a, const Counts& b) {
+    return {a.positions - b.positions,
+            a.textureCoordinates - b.textureCoordinates,
+            a.normals - b.normals,
+            a.indices - b.indices};
 }
 
-}
+/* Byte range of a mesh in the file together with counts of all data before
+   it, used to turn the global indices into mesh-relative ones, and counts of
+   data in it, used to allocate the output upfront in doMesh() */
+struct Mesh {
+    std::size_t begin, end;
+    Counts offset, count;
+};
 
-ObjImporter::ObjImporter() = default;
+}
 
-ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
+struct ObjImporter::File {
+    /* Copy of the data passed to openData() or contents of the file passed
+       to openFile(). Everything is parsed directly from here. */
+    Containers::Array<char> in;
+    std::unordered_map<std::string, UnsignedInt> meshesForName;
+    std::vector<std::string> meshNames;
+    std::vector<Mesh> meshes;
+};
 
-ObjImporter::~ObjImporter() = default;
+namespace {
 
-ImporterFeatures ObjImporter::doFeatures() const { return ImporterFeature::OpenData; }
+/* Whitespace except for newlines, which delimit the lines */
+inline bool isSpace(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
 
-void ObjImporter::doClose() { _file.reset(); }
+inline bool isDigit(const char c) {
+    return c >= '0' && c <= '9';
+}
 
-bool ObjImporter::doIsOpened() const { return !!_file; }
+const char* skipSpace(const char* it, const char* const end) {
+    while(it != end && isSpace(*it)) ++it;
+    return it;
+}
 
-void ObjImporter::doOpenFile(const std::string& filename) {
-    Containers::Pointer<std::istream> in{new std::ifstream{filename, std::ios::binary}};
-    if(!in->good()) {
-        Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
-        return;
-    }
+inline bool equals(const Containers::ArrayView<const char> token, const char* const string) {
+    const std::size_t size = std::strlen(string);
+    return token.size() == size && std::memcmp(token.data(), string, size) == 0;
+}
 
-    _file.reset(new File);
-    _file->in = std::move(in);
-    parseMeshNames();
+/* Returns end of the line starting at it, excluding the newline */
+inline const char* findLineEnd(const char* const it, const char* const end) {
+    const void* const found = std::memchr(it, '\n', end - it);
+    return found ? static_cast<const char*>(found) : end;
 }
 
-void ObjImporter::doOpenData(Containers::ArrayView<const char> data) {
-    _file.reset(new File);
-    _file->in.reset(new std::istringstream{{data.begin(), data.size()}});
+/* Splits a line into a keyword and the position where its contents start.
+   Returns false for empty lines and comments. */
+bool parseKeyword(const char* it, const char* const end, Containers::ArrayView<const char>& keyword, const char*& contents) {
+    it = skipSpace(it, end);
+    if(it == end || *it == '#') return false;
 
-    parseMeshNames();
+    const char* const keywordBegin = it;
+    while(it != end && !isSpace(*it)) ++it;
+    keyword = {keywordBegin, std::size_t(it - keywordBegin)};
+    contents = skipSpace(it, end);
+    return true;
 }
 
-void ObjImporter::parseMeshNames() {
-    /* First mesh starts at the beginning, its indices start from 1. The end
-       offset will be updated to proper value later. */
-    UnsignedInt positionIndexOffset = 1;
-    UnsignedInt normalIndexOffset = 1;
-    UnsignedInt textureCoordinateIndexOffset = 1;
-    _file->meshes.emplace_back(0, 0, positionIndexOffset, normalIndexOffset, textureCoordinateIndexOffset);
-
-    /* The first mesh doesn't have name by default but we might find it later,
-       so we need to track whether there are any data before first name */
-    bool thisIsFirstMeshAndItHasNoData = true;
-    _file->meshNames.emplace_back();
-
-    while(_file->in->good()) {
-        /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
+/* Splits a line into whitespace-separated tokens, saving up to `capacity` of
+   them. Returns the total token count, which may be larger than
+   `capacity`. */
+std::size_t splitTokens(const char* it, const char* const end, Containers::ArrayView<const char>* const tokens, const std::size_t capacity) {
+    std::size_t count = 0;
+    for(;;) {
+        it = skipSpace(it, end);
+        if(it == end) return count;
+
+        const char* const tokenBegin = it;
+        while(it != end && !isSpace(*it)) ++it;
+        if(count < capacity) tokens[count] = {tokenBegin, std::size_t(it - tokenBegin)};
+        ++count;
+    }
+}
 
-        /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
+/* Parses a float, expecting the whole token to be consumed. Plain decimal
+   numbers with a mantissa of at most 2^24 and a decimal exponent of at most
+   10 in magnitude, which covers most of what OBJ exporters produce, are
+   converted using a single single-precision multiplication or division. Both
+   operands are exactly representable in a float, so the result is correctly
+   rounded and thus bit-identical to std::strtof(). Everything else (more
+   digits, larger exponents, infinities, NaNs, hexadecimal floats) is passed
+   to std::strtof(). */
+bool parseFloat(const Containers::ArrayView<const char> token, Float& out) {
+    const char* it = token.begin();
+    const char* const end = token.end();
+
+    bool negative = false;
+    if(it != end && (*it == '-' || *it == '+')) negative = *it++ == '-';
+
+    UnsignedLong mantissa = 0;
+    Int significantDigits = 0;
+    Int exponent = 0;
+    bool hasDigits = false;
+    for(; it != end && isDigit(*it); ++it) {
+        hasDigits = true;
+        mantissa = mantissa*10 + (*it - '0');
+        if(mantissa) ++significantDigits;
+    }
+    if(it != end && *it == '.') for(++it; it != end && isDigit(*it); ++it) {
+        hasDigits = true;
+        mantissa = mantissa*10 + (*it - '0');
+        if(mantissa) ++significantDigits;
+        --exponent;
+    }
+    if(hasDigits && it != end && (*it == 'e' || *it == 'E')) {
+        ++it;
+        bool negativeExponent = false;
+        if(it != end && (*it == '-' || *it == '+')) negativeExponent = *it++ == '-';
+        Int explicitExponent = 0;
+        bool hasExponentDigits = false;
+        for(; it != end && isDigit(*it) && explicitExponent < 1000; ++it) {
+            hasExponentDigits = true;
+            explicitExponent = explicitExponent*10 + (*it - '0');
         }
+        if(!hasExponentDigits) hasDigits = false;
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
 
-        /* Parse the keyword */
-        std::string keyword;
-        *_file->in >> keyword;
-
-        /* Mesh name */
-        if(keyword == "o") {
-            std::string name;
-            std::getline(*_file->in, name);
-            name = Utility::String::trim(name);
+    /* Fast path. Powers of ten up to 1e10 are exactly representable in a
+       float, as is a mantissa of at most 2^24. Going through a double instead
+       would round twice and could differ from std::strtof() in the last bit.
+       The digit count check is there only to catch mantissa overflow. */
+    if(hasDigits && it == end && significantDigits <= 15 && mantissa <= (1ull << 24) && exponent >= -10 && exponent <= 10) {
+        constexpr static Float PowersOf10[]{
+            1.0e0f, 1.0e1f, 1.0e2f, 1.0e3f, 1.0e4f, 1.0e5f, 1.0e6f, 1.0e7f,
+            1.0e8f, 1.0e9f, 1.0e10f
+        };
+        const Float value = exponent < 0 ?
+            Float(mantissa)/PowersOf10[-exponent] :
+            Float(mantissa)*PowersOf10[exponent];
+        out = negative ? -value : value;
+        return true;
+    }
 
-            /* This is the name of first mesh */
-            if(thisIsFirstMeshAndItHasNoData) {
-                thisIsFirstMeshAndItHasNoData = false;
+    /* Slow path, needs a null-terminated copy */
+    char buffer[128];
+    if(token.empty() || token.size() >= sizeof(buffer)) return false;
+    std::memcpy(buffer, token.data(), token.size());
+    buffer[token.size()] = '\0';
+    char* parsedEnd;
+    out = std::strtof(buffer, &parsedEnd);
+    return parsedEnd == buffer + token.size();
+}
 
-                /* Update its name and add it to name map */
-                if(!name.empty())
-                    _file->meshesForName.emplace(name, _file->meshes.size() - 1);
-                _file->meshNames.back() = std::move(name);
+/* Parses an unsigned index, expecting the whole token to be consumed */
+bool parseIndex(const Containers::ArrayView<const char> token, UnsignedInt& out) {
+    if(token.empty()) return false;
 
-                /* Update its begin offset to be more precise */
-                std::get<0>(_file->meshes.back()) = _file->in->tellg();
+    UnsignedLong value = 0;
+    for(const char c: token) {
+        if(!isDigit(c)) return false;
+        value = value*10 + (c - '0');
+        if(value > 0xffffffffu) return false;
+    }
 
-            /* Otherwise this is a name of new mesh */
-            } else {
-                /* Set end of the previous one */
-                std::get<1>(_file->meshes.back()) = end;
-
-                /* Save name and offset of the new one. The end offset will be
-                   updated later. */
-                if(!name.empty())
-                    _file->meshesForName.emplace(name, _file->meshes.size());
-                _file->meshNames.emplace_back(std::move(name));
-                _file->meshes.emplace_back(_file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
-            }
+    out = UnsignedInt(value);
+    return true;
+}
 
-            continue;
-
-        /* If there are any data/indices before the first name, it means that
-           the first object is unnamed. We need to check for them. */
-
-        /* Vertex data, update index offset for the following meshes */
-        } else if(keyword == "v") {
-            ++positionIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vt") {
-            ++textureCoordinateIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vn") {
-            ++normalIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
-
-        /* Index data, just mark that we found something for first unnamed
-           object */
-        } else if(thisIsFirstMeshAndItHasNoData) for(const std::string& data: {"p", "l", "f"}) {
-            if(keyword == data) {
-                thisIsFirstMeshAndItHasNoData = false;
-                break;
-            }
-        }
+template<std::size_t size> bool parseFloatData(const char* const begin, const char* const end, Math::Vector<size, Float>& out, Float* extra, std::ostream* const errorOutput) {
+    Containers::ArrayView<const char> tokens[size + 1];
+    const std::size_t count = splitTokens(begin, end, tokens, size + 1);
+    if(count < size || count > size + (extra ? 1 : 0)) {
+        Error{errorOutput} << "Trade::ObjImporter::mesh(): invalid float array size";
+        return false;
+    }
 
-        /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
+    for(std::size_t i = 0; i != size; ++i) if(!parseFloat(tokens[i], out[i])) {
+        Error{errorOutput} << "Trade::ObjImporter::mesh(): error while converting numeric data";
+        return false;
     }
 
-    /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    std::get<1>(_file->meshes.back()) = _file->in->tellg();
-}
+    if(count == size + 1) {
+        /* This should be obvious from the first if, but add this just to make
+           Clang Analyzer happy */
+        CORRADE_INTERNAL_ASSERT(extra);
 
-UnsignedInt ObjImporter::doMeshCount() const { return _file->meshes.size(); }
+        if(!parseFloat(tokens[size], *extra)) {
+            Error{errorOutput} << "Trade::ObjImporter::mesh(): error while converting numeric data";
+            return false;
+        }
+    }
 
-Int ObjImporter::doMeshForName(const std::string& name) {
-    const auto it = _file->meshesForName.find(name);
-    return it == _file->meshesForName.end() ? -1 : it->second;
+    return true;
 }
 
-std::string ObjImporter::doMeshName(UnsignedInt id) {
-    return _file->meshNames[id];
-}
+/* Below this size it's not worth to spawn a thread */
+constexpr std::size_t MinChunkSize = 256*1024;
+
+/* An `o` line found while scanning a chunk */
+struct Name {
+    std::size_t lineBegin, contentsEnd;
+    std::string name;
+    /* Counts of data in the chunk before this line and whether there were any
+       data lines at all */
+    Counts countsBefore;
+    bool hasDataBefore;
+};
 
-namespace {
+/* A part of the file ending at a line boundary together with what was found
+   in it */
+struct Chunk {
+    std::size_t begin, end;
+    std::vector<Name> names;
+    Counts counts;
+    bool hasData;
+};
 
-template<class T> bool checkAndDuplicateInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::Array<T>& data, const Containers::StridedArrayView1D<T>& out, UnsignedInt offset) {
-    /* Check that indices are in range. Add back the original index offset for
-       easier data debugging. */
-    for(UnsignedInt i: indices) if(i >= data.size()) {
-        Error{} << "Trade::ObjImporter::mesh(): index" << (i + offset) << "out of range for" << data.size() << "vertices";
-        return false;
-    }
+/* Result of parsing mesh data in a chunk */
+struct ParsedChunk {
+    Containers::Optional<MeshPrimitive> primitive;
+    std::size_t textureCoordinateIndexCount, normalIndexCount;
+    bool success;
+};
 
-    MeshTools::duplicateInto(indices, stridedArrayView(data), out);
-    return true;
+UnsignedInt configuredThreadCount(const Utility::ConfigurationGroup& configuration) {
+    const UnsignedInt count = configuration.value<UnsignedInt>("threads");
+    return count ? count : std::max(std::thread::hardware_concurrency(), 1u);
 }
 
+/* Executes the tasks on given count of threads, including the calling one,
+   each picking the next task from a shared counter */
+void threadExecutor(const UnsignedInt count, void(*const task)(UnsignedInt, void*), void* const state, void* const userData) {
+    const UnsignedInt threadCount = std::min(*static_cast<const UnsignedInt*>(userData), count);
+    std::atomic<UnsignedInt> next{0};
+    const auto worker = [&]() {
+        for(UnsignedInt i; (i = next++) < count; ) task(i, state);
+    };
+
+    std::vector<std::thread> threads;
+    for(UnsignedInt i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for(std::thread& thread: threads) thread.join();
 }
 
-Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt) {
-    /* Seek the file, set mesh parsing parameters */
-    std::streampos begin, end;
-    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
-    std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
-    _file->in->seekg(begin);
+/* Splits the [begin, end) range into at most `count` chunks of roughly the
+   same size but not smaller than MinChunkSize, each except the last ending
+   right after a newline */
+std::vector<Chunk> splitChunks(const char* const data, const std::size_t begin, const std::size_t end, const UnsignedInt count) {
+    const std::size_t size = end - begin;
+    const std::size_t chunkCount = std::max(std::min(std::size_t(count), size/MinChunkSize), std::size_t{1});
+
+    std::vector<Chunk> chunks;
+    std::size_t chunkBegin = begin;
+    for(std::size_t i = 1; i < chunkCount && chunkBegin < end; ++i) {
+        const std::size_t split = std::max(chunkBegin, begin + size*i/chunkCount);
+        const std::size_t chunkEnd = std::min(std::size_t(findLineEnd(data + split, data + end) - data) + 1, end);
+        chunks.push_back(Chunk{chunkBegin, chunkEnd, {}, {}, false});
+        chunkBegin = chunkEnd;
+    }
+    if(chunkBegin < end || chunks.empty())
+        chunks.push_back(Chunk{chunkBegin, end, {}, {}, false});
 
-    Containers::Optional<MeshPrimitive> primitive;
-    Containers::Array<Vector3> positions;
-    Containers::Array<Vector3> normals;
-    Containers::Array<Vector2> textureCoordinates;
-    /* Taking a shortcut as there's fortunately nothing else than just 3 types
-       of data. First positions, then normals, then texture coordinates. */
-    Containers::Array<Vector3ui> indices;
-    std::size_t textureCoordinateIndexCount = 0, normalIndexCount = 0;
+    return chunks;
+}
 
-    try { while(_file->in->good() && _file->in->tellg() < end) {
-        /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
+/* Counts data in given chunk and records positions of all `o` lines */
+void scanChunk(const char* const data, Chunk& chunk) {
+    const char* const end = data + chunk.end;
+    for(const char* it = data + chunk.begin; it < end; ) {
+        const char* const lineBegin = it;
+        const char* const lineEnd = findLineEnd(it, end);
+        it = lineEnd + 1;
+
+        /* Skip empty lines and comments */
+        Containers::ArrayView<const char> keyword;
+        const char* contents;
+        if(!parseKeyword(lineBegin, lineEnd, keyword, contents)) continue;
+
+        /* Mesh name. The mesh data start on the next line. */
+        if(equals(keyword, "o")) {
+            const char* nameEnd = lineEnd;
+            while(nameEnd != contents && isSpace(nameEnd[-1])) --nameEnd;
+            chunk.names.push_back(Name{std::size_t(lineBegin - data),
+                std::size_t(std::min(it, end) - data),
+                std::string{contents, std::size_t(nameEnd - contents)},
+                chunk.counts, chunk.hasData});
+
+        /* Vertex data */
+        } else if(equals(keyword, "v")) {
+            ++chunk.counts.positions;
+            chunk.hasData = true;
+        } else if(equals(keyword, "vt")) {
+            ++chunk.counts.textureCoordinates;
+            chunk.hasData = true;
+        } else if(equals(keyword, "vn")) {
+            ++chunk.counts.normals;
+            chunk.hasData = true;
+
+        /* Index data */
+        } else if(equals(keyword, "p") || equals(keyword, "l") || equals(keyword, "f")) {
+            chunk.counts.indices += splitTokens(contents, lineEnd, nullptr, 0);
+            chunk.hasData = true;
         }
+    }
+}
 
-        /* Get the line */
-        std::string line;
-        std::getline(*_file->in, line);
-        line = Utility::String::trim(line);
-
-        /* Ignore empty lines */
-        if(line.empty()) continue;
-
-        /* Split the line into keyword and contents */
-        const std::size_t keywordEnd = line.find(' ');
-        const std::string keyword = line.substr(0, keywordEnd);
-        const std::string contents = keywordEnd != std::string::npos ?
-            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
+/* Parses mesh data in given chunk, writing them to the output arrays at
+   offsets given by counts of data in the preceding chunks. Errors are printed
+   to errorOutput, which is null when parsing in parallel. */
+bool parseMeshData(const char* const data, const Mesh& mesh, const Chunk& chunk, const Counts& offset, const Containers::ArrayView<Vector3> positions, const Containers::ArrayView<Vector2> textureCoordinates, const Containers::ArrayView<Vector3> normals, const Containers::ArrayView<Vector3ui> indices, ParsedChunk& out, std::ostream* const errorOutput) {
+    /* Indices in the file are global and one-based */
+    const UnsignedInt positionIndexOffset = mesh.offset.positions + 1;
+    const UnsignedInt textureCoordinateIndexOffset = mesh.offset.textureCoordinates + 1;
+    const UnsignedInt normalIndexOffset = mesh.offset.normals + 1;
+
+    std::size_t positionCount = offset.positions;
+    std::size_t textureCoordinateCount = offset.textureCoordinates;
+    std::size_t normalCount = offset.normals;
+    std::size_t indexCount = offset.indices;
+
+    const char* const end = data + chunk.end;
+    for(const char* it = data + chunk.begin; it < end; ) {
+        const char* const lineEnd = findLineEnd(it, end);
+        const char* const lineBegin = it;
+        it = lineEnd + 1;
+
+        /* Ignore empty lines and comments */
+        Containers::ArrayView<const char> keyword;
+        const char* contents;
+        if(!parseKeyword(lineBegin, lineEnd, keyword, contents)) continue;
 
         /* Vertex position */
-        if(keyword == "v") {
+        if(equals(keyword, "v")) {
+            Vector3 value;
             Float extra{1.0f};
-            const Vector3 data = extractFloatData<3>(contents, &extra);
+            if(!parseFloatData(contents, lineEnd, value, &extra, errorOutput))
+                return false;
             if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
-                Error() << "Trade::ObjImporter::mesh(): homogeneous coordinates are not supported";
-                return Containers::NullOpt;
+                Error{errorOutput} << "Trade::ObjImporter::mesh(): homogeneous coordinates are not supported";
+                return false;
             }
 
-            arrayAppend(positions, data);
+            positions[positionCount++] = value;
 
         /* Texture coordinate */
-        } else if(keyword == "vt") {
+        } else if(equals(keyword, "vt")) {
+            Vector2 value;
             Float extra{0.0f};
-            const Vector2 data = extractFloatData<2>(contents, &extra);
+            if(!parseFloatData(contents, lineEnd, value, &extra, errorOutput))
+                return false;
             if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
-                Error() << "Trade::ObjImporter::mesh(): 3D texture coordinates are not supported";
-                return Containers::NullOpt;
+                Error{errorOutput} << "Trade::ObjImporter::mesh(): 3D texture coordinates are not supported";
+                return false;
             }
 
-            arrayAppend(textureCoordinates, data);
+            textureCoordinates[textureCoordinateCount++] = value;
 
         /* Normal */
-        } else if(keyword == "vn") {
-            arrayAppend(normals, Vector3{extractFloatData<3>(contents)});
+        } else if(equals(keyword, "vn")) {
+            Vector3 value;
+            if(!parseFloatData(contents, lineEnd, value, nullptr, errorOutput))
+                return false;
+
+            normals[normalCount++] = value;
 
         /* Indices */
-        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
-            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
+        } else if(equals(keyword, "p") || equals(keyword, "l") || equals(keyword, "f")) {
+            const std::size_t indexTupleCount = splitTokens(contents, lineEnd, nullptr, 0);
 
             /* Points */
-            if(keyword == "p") {
+            if(equals(keyword, "p")) {
                 /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Points) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
-                    return Containers::NullOpt;
+                if(out.primitive && out.primitive != MeshPrimitive::Points) {
+                    Error{errorOutput} << "Trade::ObjImporter::mesh(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Points;
+                    return false;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 1) {
-                    Error() << "Trade::ObjImporter::mesh(): wrong index count for point";
-                    return Containers::NullOpt;
+                if(indexTupleCount != 1) {
+                    Error{errorOutput} << "Trade::ObjImporter::mesh(): wrong index count for point";
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Points;
+                out.primitive = MeshPrimitive::Points;
 
             /* Lines */
-            } else if(keyword == "l") {
+            } else if(equals(keyword, "l")) {
                 /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Lines) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
-                    return Containers::NullOpt;
+                if(out.primitive && out.primitive != MeshPrimitive::Lines) {
+                    Error{errorOutput} << "Trade::ObjImporter::mesh(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Lines;
+                    return false;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 2) {
-                    Error() << "Trade::ObjImporter::mesh(): wrong index count for line";
-                    return Containers::NullOpt;
+                if(indexTupleCount != 2) {
+                    Error{errorOutput} << "Trade::ObjImporter::mesh(): wrong index count for line";
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Lines;
+                out.primitive = MeshPrimitive::Lines;
 
             /* Faces */
-            } else if(keyword == "f") {
+            } else {
                 /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Triangles) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
-                    return Containers::NullOpt;
+                if(out.primitive && out.primitive != MeshPrimitive::Triangles) {
+                    Error{errorOutput} << "Trade::ObjImporter::mesh(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Triangles;
+                    return false;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() < 3) {
-                    Error() << "Trade::ObjImporter::mesh(): wrong index count for triangle";
-                    return Containers::NullOpt;
-                } else if(indexTuples.size() != 3) {
-                    Error() << "Trade::ObjImporter::mesh(): polygons are not supported";
-                    return Containers::NullOpt;
+                if(indexTupleCount < 3) {
+                    Error{errorOutput} << "Trade::ObjImporter::mesh(): wrong index count for triangle";
+                    return false;
+                } else if(indexTupleCount != 3) {
+                    Error{errorOutput} << "Trade::ObjImporter::mesh(): polygons are not supported";
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Triangles;
-
-            } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+                out.primitive = MeshPrimitive::Triangles;
+            }
 
-            for(const std::string& indexTuple: indexTuples) {
-                std::vector<std::string> indexStrings = Utility::String::split(indexTuple, '/');
-                if(indexStrings.size() > 3) {
-                    Error() << "Trade::ObjImporter::mesh(): invalid index data";
-                    return Containers::NullOpt;
+            /* At most three tuples per line, as checked above */
+            Containers::ArrayView<const char> indexTuples[3];
+            splitTokens(contents, lineEnd, indexTuples, 3);
+            for(std::size_t i = 0; i != indexTupleCount; ++i) {
+                /* Split the tuple into at most three parts separated by a
+                   slash */
+                const Containers::ArrayView<const char> indexTuple = indexTuples[i];
+                Containers::ArrayView<const char> indexStrings[3];
+                std::size_t indexStringCount = 0;
+                const char* partBegin = indexTuple.begin();
+                for(const char* c = indexTuple.begin(); ; ++c) {
+                    if(c != indexTuple.end() && *c != '/') continue;
+                    if(indexStringCount == 3) {
+                        Error{errorOutput} << "Trade::ObjImporter::mesh(): invalid index data";
+                        return false;
+                    }
+                    indexStrings[indexStringCount++] = {partBegin, std::size_t(c - partBegin)};
+                    if(c == indexTuple.end()) break;
+                    partBegin = c + 1;
                 }
 
                 Vector3ui index;
 
                 /* Position indices */
-                index[0] = std::stoul(indexStrings[0]) - positionIndexOffset;
+                if(!parseIndex(indexStrings[0], index[0])) {
+                    Error{errorOutput} << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                    return false;
+                }
+                index[0] -= positionIndexOffset;
 
                 /* Texture coordinates */
-                if(indexStrings.size() == 2 || (indexStrings.size() == 3 && !indexStrings[1].empty())) {
-                    index[2] = std::stoul(indexStrings[1]) - textureCoordinateIndexOffset;
-                    ++textureCoordinateIndexCount;
+                if(indexStringCount == 2 || (indexStringCount == 3 && !indexStrings[1].empty())) {
+                    if(!parseIndex(indexStrings[1], index[2])) {
+                        Error{errorOutput} << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                        return false;
+                    }
+                    index[2] -= textureCoordinateIndexOffset;
+                    ++out.textureCoordinateIndexCount;
                 }
 
                 /* Normal indices */
-                if(indexStrings.size() == 3) {
-                    index[1] = std::stoul(indexStrings[2]) - normalIndexOffset;
-                    ++normalIndexCount;
+                if(indexStringCount == 3) {
+                    if(!parseIndex(indexStrings[2], index[1])) {
+                        Error{errorOutput} << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                        return false;
+                    }
+                    index[1] -= normalIndexOffset;
+                    ++out.normalIndexCount;
                 }
 
-                arrayAppend(indices, index);
+                indices[indexCount++] = index;
             }
 
         /* Ignore unsupported keywords, error out on unknown keywords */
-        } else if(![&keyword](){
-            /* Using lambda to emulate for-else construct like in Python */
-            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
-                if(keyword == expected) return true;
+        } else if(!equals(keyword, "mtllib") &&
+                  !equals(keyword, "usemtl") &&
+                  !equals(keyword, "g") &&
+                  !equals(keyword, "s")) {
+            Error{errorOutput} << "Trade::ObjImporter::mesh(): unknown keyword" << std::string{keyword.data(), keyword.size()};
             return false;
-        }()) {
-            Error() << "Trade::ObjImporter::mesh(): unknown keyword" << keyword;
-            return Containers::NullOpt;
         }
+    }
 
-    }} catch(const std::exception&) {
-        Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
-        return Containers::NullOpt;
-    } catch(...) {
-        /* Error message already printed */
+    /* Both passes split the lines the same way, so the counts match */
+    CORRADE_INTERNAL_ASSERT(
+        positionCount == offset.positions + chunk.counts.positions &&
+        textureCoordinateCount == offset.textureCoordinates + chunk.counts.textureCoordinates &&
+        normalCount == offset.normals + chunk.counts.normals &&
+        indexCount == offset.indices + chunk.counts.indices);
+    return true;
+}
+
+}
+
+ObjImporter::ObjImporter() = default;
+
+ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, const std::string& plugin): AbstractImporter{manager, plugin} {}
+
+ObjImporter::~ObjImporter() = default;
+
+ImporterFeatures ObjImporter::doFeatures() const { return ImporterFeature::OpenData; }
+
+void ObjImporter::doClose() { _file.reset(); }
+
+bool ObjImporter::doIsOpened() const { return !!_file; }
+
+void ObjImporter::doOpenFile(const std::string& filename) {
+    if(!Utility::Directory::exists(filename)) {
+        Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    /* Read the file directly into the storage used for parsing, without going
+       through doOpenData() which would need to make another copy */
+    _file.reset(new File);
+    _file->in = Utility::Directory::read(filename);
+    parseMeshNames();
+}
+
+void ObjImporter::doOpenData(Containers::ArrayView<const char> data) {
+    _file.reset(new File);
+
+    /* The parser only reads the data, so if they're guaranteed to outlive us,
+       reference them directly instead of making a copy */
+    if(flags() & ImporterFlag::PersistentInput)
+        _file->in = Containers::Array<char>{const_cast<char*>(data.data()), data.size(), [](char*, std::size_t) {}};
+    else {
+        _file->in = Containers::Array<char>{Containers::NoInit, data.size()};
+        Utility::copy(data, _file->in);
+    }
+
+    parseMeshNames();
+}
+
+void ObjImporter::parseMeshNames() {
+    const char* const data = _file->in.data();
+    const std::size_t size = _file->in.size();
+
+    /* Scan the file in parallel chunks, each counting data and recording
+       mesh names independently */
+    UnsignedInt threadCount = configuredThreadCount(configuration());
+    std::vector<Chunk> chunks = splitChunks(data, 0, size, threadCount);
+    std::pair<const char*, std::vector<Chunk>*> state{data, &chunks};
+    threadExecutor(UnsignedInt(chunks.size()), [](UnsignedInt i, void* userData) {
+        auto& s = *static_cast<std::pair<const char*, std::vector<Chunk>*>*>(userData);
+        scanChunk(s.first, (*s.second)[i]);
+    }, &state, &threadCount);
+
+    /* First mesh starts at the beginning, the end offset and counts will be
+       updated to proper values later. The first mesh doesn't have name by
+       default but we might find it later, if there are no data before the
+       first name. */
+    Mesh mesh{0, 0, {}, {}};
+    _file->meshNames.emplace_back();
+    bool isFirstName = true;
+
+    /* Go through the chunks in order, turning chunk-local counts into global
+       ones using a prefix sum of the counts in all previous chunks */
+    Counts counts{};
+    bool hasData = false;
+    for(Chunk& chunk: chunks) {
+        for(Name& name: chunk.names) {
+            const Counts countsBefore = counts + name.countsBefore;
+
+            /* This is the name of first mesh. Update its name, add it to name
+               map and update its begin offset to be more precise. */
+            if(isFirstName && !hasData && !name.hasDataBefore) {
+                if(!name.name.empty())
+                    _file->meshesForName.emplace(name.name, 0);
+                _file->meshNames.back() = std::move(name.name);
+                mesh.begin = name.contentsEnd;
+
+            /* Otherwise this is a name of new mesh. Set end of the previous
+               one, save name and offset of the new one. */
+            } else {
+                mesh.end = name.lineBegin;
+                mesh.count = countsBefore - mesh.offset;
+                _file->meshes.push_back(mesh);
+
+                if(!name.name.empty())
+                    _file->meshesForName.emplace(name.name, _file->meshes.size());
+                _file->meshNames.push_back(std::move(name.name));
+                mesh = Mesh{name.contentsEnd, 0, countsBefore, {}};
+            }
+
+            isFirstName = false;
+        }
+
+        counts += chunk.counts;
+        hasData = hasData || chunk.hasData;
+    }
+
+    /* Set end of the last mesh */
+    mesh.end = size;
+    mesh.count = counts - mesh.offset;
+    _file->meshes.push_back(mesh);
+}
+
+UnsignedInt ObjImporter::doMeshCount() const { return _file->meshes.size(); }
+
+Int ObjImporter::doMeshForName(const std::string& name) {
+    const auto it = _file->meshesForName.find(name);
+    return it == _file->meshesForName.end() ? -1 : it->second;
+}
+
+std::string ObjImporter::doMeshName(UnsignedInt id) {
+    return _file->meshNames[id];
+}
+
+namespace {
+
+template<class T> bool checkAndDuplicateInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::Array<T>& data, const Containers::StridedArrayView1D<T>& out, UnsignedInt offset) {
+    /* Check that indices are in range. Add back the original index offset for
+       easier data debugging. */
+    for(UnsignedInt i: indices) if(i >= data.size()) {
+        Error{} << "Trade::ObjImporter::mesh(): index" << (i + offset) << "out of range for" << data.size() << "vertices";
+        return false;
+    }
+
+    MeshTools::duplicateInto(indices, stridedArrayView(data), out);
+    return true;
+}
+
+}
+
+Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt) {
+    const char* const data = _file->in.data();
+    const Mesh& mesh = _file->meshes[id];
+
+    /* All data are allocated upfront based on the counts gathered in
+       parseMeshNames() */
+    Containers::Array<Vector3> positions{Containers::NoInit, mesh.count.positions};
+    Containers::Array<Vector3> normals{Containers::NoInit, mesh.count.normals};
+    Containers::Array<Vector2> textureCoordinates{Containers::NoInit, mesh.count.textureCoordinates};
+    /* Taking a shortcut as there's fortunately nothing else than just 3 types
+       of data. First positions, then normals, then texture coordinates. */
+    Containers::Array<Vector3ui> indices{Containers::NoInit, mesh.count.indices};
+
+    /* Split the mesh into chunks. If there's just one, its counts are known
+       already, otherwise count the data in each chunk to know where to put
+       its output. */
+    UnsignedInt threadCount = configuredThreadCount(configuration());
+    std::vector<Chunk> chunks = splitChunks(data, mesh.begin, mesh.end, threadCount);
+    if(chunks.size() == 1) chunks[0].counts = mesh.count;
+    else {
+        std::pair<const char*, std::vector<Chunk>*> state{data, &chunks};
+        threadExecutor(UnsignedInt(chunks.size()), [](UnsignedInt i, void* userData) {
+            auto& s = *static_cast<std::pair<const char*, std::vector<Chunk>*>*>(userData);
+            scanChunk(s.first, (*s.second)[i]);
+        }, &state, &threadCount);
+    }
+
+    /* Parse the chunks in parallel, each into its own part of the output
+       arrays. When parsing in parallel, errors are not printed but the mesh
+       is parsed again serially to report the same error as a serial parse
+       would. */
+    struct State {
+        const char* data;
+        const Mesh& mesh;
+        const std::vector<Chunk>& chunks;
+        Containers::Array<Counts> offsets;
+        Containers::Array<ParsedChunk> parsed;
+        Containers::ArrayView<Vector3> positions;
+        Containers::ArrayView<Vector2> textureCoordinates;
+        Containers::ArrayView<Vector3> normals;
+        Containers::ArrayView<Vector3ui> indices;
+        std::ostream* errorOutput;
+    } state{data, mesh, chunks,
+        Containers::Array<Counts>{Containers::NoInit, chunks.size()},
+        Containers::Array<ParsedChunk>{chunks.size()},
+        positions, textureCoordinates, normals, indices,
+        chunks.size() == 1 ? Error::output() : nullptr};
+    Counts offset{};
+    for(std::size_t i = 0; i != chunks.size(); ++i) {
+        state.offsets[i] = offset;
+        offset += chunks[i].counts;
+    }
+    threadExecutor(UnsignedInt(chunks.size()), [](UnsignedInt i, void* userData) {
+        State& s = *static_cast<State*>(userData);
+        s.parsed[i].success = parseMeshData(s.data, s.mesh, s.chunks[i], s.offsets[i], s.positions, s.textureCoordinates, s.normals, s.indices, s.parsed[i], s.errorOutput);
+    }, &state, &threadCount);
+
+    /* Merge the results. All chunks should have the same primitive. */
+    Containers::Optional<MeshPrimitive> primitive;
+    std::size_t textureCoordinateIndexCount = 0, normalIndexCount = 0;
+    bool success = true;
+    for(const ParsedChunk& parsed: state.parsed) {
+        if(!parsed.success || (primitive && parsed.primitive && *primitive != *parsed.primitive)) {
+            success = false;
+            break;
+        }
+        if(!primitive) primitive = parsed.primitive;
+        textureCoordinateIndexCount += parsed.textureCoordinateIndexCount;
+        normalIndexCount += parsed.normalIndexCount;
+    }
+    if(!success) {
+        if(chunks.size() != 1) {
+            Chunk whole{mesh.begin, mesh.end, {}, mesh.count, false};
+            ParsedChunk parsed{};
+            CORRADE_INTERNAL_ASSERT_OUTPUT(!parseMeshData(data, mesh, whole, Counts{}, positions, textureCoordinates, normals, indices, parsed, Error::output()));
+        }
         return Containers::NullOpt;
     }
 
@@ -431,8 +800,12 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
        index array has zeros, not affecting the uniqueness in any way. */
     Containers::Array<char> indexData{Containers::NoInit, indices.size()*sizeof(UnsignedInt)};
     const auto indexDataI = Containers::arrayCast<UnsignedInt>(indexData);
-    const std::size_t vertexCount = MeshTools::removeDuplicatesInPlaceInto(
-        Containers::arrayCast<2, char>(arrayView(indices)), indexDataI);
+    const std::size_t vertexCount = threadCount > 1 ?
+        MeshTools::removeDuplicatesInPlaceInto(
+            Containers::arrayCast<2, char>(arrayView(indices)), indexDataI,
+            threadExecutor, &threadCount) :
+        MeshTools::removeDuplicatesInPlaceInto(
+            Containers::arrayCast<2, char>(arrayView(indices)), indexDataI);
 
     /* Allocate attribute and vertex data */
     std::size_t attributeCount = 1;
@@ -455,7 +828,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
     {
         Containers::StridedArrayView1D<Vector3> view{vertexData,
             reinterpret_cast<Vector3*>(vertexData.data()), vertexCount, stride};
-        if(!checkAndDuplicateInto(indicesPerAttribute[0].prefix(vertexCount), positions, view, positionIndexOffset))
+        if(!checkAndDuplicateInto(indicesPerAttribute[0].prefix(vertexCount), positions, view, mesh.offset.positions + 1))
             return Containers::NullOpt;
         attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::Position, view};
         offset += sizeof(Vector3);
@@ -463,7 +836,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
     if(normalIndexCount) {
         Containers::StridedArrayView1D<Vector3> view{vertexData,
             reinterpret_cast<Vector3*>(vertexData.data() + offset), vertexCount, stride};
-        if(!checkAndDuplicateInto(indicesPerAttribute[1].prefix(vertexCount), normals, view, normalIndexOffset))
+        if(!checkAndDuplicateInto(indicesPerAttribute[1].prefix(vertexCount), normals, view, mesh.offset.normals + 1))
             return Containers::NullOpt;
         attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::Normal, view};
         offset += sizeof(Vector3);
@@ -471,7 +844,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
     if(textureCoordinateIndexCount) {
         Containers::StridedArrayView1D<Vector2> view{vertexData,
             reinterpret_cast<Vector2*>(vertexData.data() + offset), vertexCount, stride};
-        if(!checkAndDuplicateInto(indicesPerAttribute[2].prefix(vertexCount), textureCoordinates, view, textureCoordinateIndexOffset))
+        if(!checkAndDuplicateInto(indicesPerAttribute[2].prefix(vertexCount), textureCoordinates, view, mesh.offset.textureCoordinates + 1))
             return Containers::NullOpt;
         attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::TextureCoordinates, view};
         offset += sizeof(Vector2);
@@ -98,6 +98,39 @@ positions with optional @ref VertexFormat::Vector3 normals and
 @ref VertexFormat::Vector2 texture coordinates, if present in the source file.
 
 Polygons (quads etc.) and material properties are currently not supported.
+
+The whole file is read into memory on @ref openFile() and parsed in-place
+using a dedicated number parser, without any per-line allocations. Data passed
+to @ref openData() are copied first, unless @ref ImporterFlag::PersistentInput
+is set, in which case they're referenced directly. Upon @ref mesh() the vertex and index
+data are parsed directly into preallocated arrays sized from vertex and index
+counts gathered when opening the file.
+
+@section Trade-ObjImporter-configuration Plugin-specific configuration
+
+It's possible to tune various import options through @ref configuration(). See
+below for all options and their default values:
+
+@snippet MagnumPlugins/ObjImporter/ObjImporter.conf configuration_
+
+@subsection Trade-ObjImporter-configuration-threads Parallel parsing
+
+With the @cb{.ini} threads @ce option set to a value other than @cpp 1 @ce,
+both @ref openFile() / @ref openData() and @ref mesh() split the data into
+chunks at line boundaries and process them in parallel. When opening, each
+chunk counts vertex data and index tuples and records mesh names on its own.
+Global vertex numbering is recovered from a prefix sum of the counts in all
+preceding chunks. When importing a mesh, each chunk then parses its data
+directly into its own part of the output arrays and duplicate removal is
+parallelized as well. The output is the same as when parsing on a single
+thread, including error messages. Chunks are at least 256 kB large, so small
+files are always processed on a single thread.
+
+Worker threads parse with error output suppressed and an import failure is
+then reported by parsing the mesh again on the calling thread. The suppression
+relies on output redirection being thread-local, so values other than
+@cpp 1 @ce need Corrade built with @ref CORRADE_BUILD_MULTITHREADED, which is
+the default.
 */
 class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
     public:
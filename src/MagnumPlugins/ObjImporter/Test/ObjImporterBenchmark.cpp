@@ -0,0 +1,175 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/FormatStl.h>
+#include <Corrade/Utility/String.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/MeshData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct ObjImporterBenchmark: TestSuite::Tester {
+    explicit ObjImporterBenchmark();
+
+    void streamBaseline();
+    void openData();
+    void mesh();
+
+    private:
+        PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+        std::string _data;
+};
+
+/* A grid of 256x256 vertices with positions, texture coordinates and
+   normals, 130 thousand triangles in total, about 9 MB of text. Large enough
+   to be split into several chunks when parsing in parallel. */
+constexpr UnsignedInt GridSize = 256;
+constexpr UnsignedInt TriangleCount = (GridSize - 1)*(GridSize - 1)*2;
+
+const struct {
+    const char* name;
+    UnsignedInt threads;
+} ThreadsData[]{
+    {"1 thread", 1},
+    {"4 threads", 4}
+};
+
+ObjImporterBenchmark::ObjImporterBenchmark() {
+    addBenchmarks({&ObjImporterBenchmark::streamBaseline}, 5);
+
+    addInstancedBenchmarks({&ObjImporterBenchmark::openData,
+                            &ObjImporterBenchmark::mesh}, 5,
+        Containers::arraySize(ThreadsData));
+
+    #ifdef OBJIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(OBJIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    std::ostringstream out;
+    out << "o grid\n";
+    for(UnsignedInt y = 0; y != GridSize; ++y) for(UnsignedInt x = 0; x != GridSize; ++x)
+        out << Utility::formatString("v {} {} {}\n", x*0.125f, y*0.125f, (x ^ y)*0.0078125f);
+    for(UnsignedInt y = 0; y != GridSize; ++y) for(UnsignedInt x = 0; x != GridSize; ++x)
+        out << Utility::formatString("vt {} {}\n", Float(x)/(GridSize - 1), Float(y)/(GridSize - 1));
+    for(UnsignedInt y = 0; y != GridSize; ++y) for(UnsignedInt x = 0; x != GridSize; ++x)
+        out << Utility::formatString("vn {} {} {}\n", 0.0f, 0.0f, 1.0f);
+    for(UnsignedInt y = 0; y != GridSize - 1; ++y) for(UnsignedInt x = 0; x != GridSize - 1; ++x) {
+        const UnsignedInt a = y*GridSize + x + 1;
+        const UnsignedInt b = a + 1;
+        const UnsignedInt c = a + GridSize;
+        const UnsignedInt d = c + 1;
+        out << Utility::formatString("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", a, b, d)
+            << Utility::formatString("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", a, d, c);
+    }
+    _data = out.str();
+}
+
+void ObjImporterBenchmark::streamBaseline() {
+    /* Reproduces the tokenization the importer used to do before it switched
+       to parsing the data in-place -- a std::istream with a std::getline(),
+       std::string splitting and std::stof() / std::stoul(), appending to
+       growable arrays. Only the raw data are extracted, without the index
+       deduplication done by the importer, so this is a lower bound for the
+       original implementation. */
+    std::size_t indexCount = 0;
+    CORRADE_BENCHMARK(1) {
+        std::istringstream in{_data};
+        Containers::Array<Vector3> positions;
+        Containers::Array<Vector3> normals;
+        Containers::Array<Vector2> textureCoordinates;
+        Containers::Array<Vector3ui> indices;
+
+        std::string line;
+        while(std::getline(in, line)) {
+            line = Utility::String::trim(line);
+            if(line.empty() || line[0] == '#') continue;
+
+            const std::size_t keywordEnd = line.find(' ');
+            const std::string keyword = line.substr(0, keywordEnd);
+            const std::vector<std::string> contents = Utility::String::splitWithoutEmptyParts(line.substr(keywordEnd + 1), ' ');
+            if(keyword == "v")
+                arrayAppend(positions, Vector3{std::stof(contents[0]), std::stof(contents[1]), std::stof(contents[2])});
+            else if(keyword == "vt")
+                arrayAppend(textureCoordinates, Vector2{std::stof(contents[0]), std::stof(contents[1])});
+            else if(keyword == "vn")
+                arrayAppend(normals, Vector3{std::stof(contents[0]), std::stof(contents[1]), std::stof(contents[2])});
+            else if(keyword == "f") for(const std::string& indexTuple: contents) {
+                const std::vector<std::string> indexStrings = Utility::String::split(indexTuple, '/');
+                arrayAppend(indices, Vector3ui(std::stoul(indexStrings[0]), std::stoul(indexStrings[2]), std::stoul(indexStrings[1])));
+            }
+        }
+
+        indexCount = indices.size();
+    }
+
+    CORRADE_COMPARE(indexCount, TriangleCount*3);
+}
+
+void ObjImporterBenchmark::openData() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("threads", data.threads);
+
+    UnsignedInt meshCount = 0;
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(importer->openData({_data.data(), _data.size()}));
+        meshCount = importer->meshCount();
+    }
+
+    CORRADE_COMPARE(meshCount, 1);
+}
+
+void ObjImporterBenchmark::mesh() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("threads", data.threads);
+    CORRADE_VERIFY(importer->openData({_data.data(), _data.size()}));
+
+    UnsignedInt indexCount = 0;
+    CORRADE_BENCHMARK(1) {
+        Containers::Optional<MeshData> mesh = importer->mesh(0);
+        CORRADE_VERIFY(mesh);
+        indexCount = mesh->indexCount();
+    }
+
+    CORRADE_COMPARE(indexCount, TriangleCount*3);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterBenchmark)
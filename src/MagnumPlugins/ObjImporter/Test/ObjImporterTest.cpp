@@ -23,12 +23,16 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstdlib>
+#include <cstring>
 #include <sstream>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/FormatStl.h>
 
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Vector3.h"
@@ -58,6 +62,7 @@ struct ObjImporterTest: TestSuite::Tester {
     void moreMeshes();
     void unnamedFirstMesh();
 
+    void floatParsing();
     void wrongFloat();
     void wrongInteger();
     void unmergedIndexOutOfRange();
@@ -92,10 +97,75 @@ struct ObjImporterTest: TestSuite::Tester {
     void unsupportedKeyword();
     void unknownKeyword();
 
+    void parallel();
+    void parallelError();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
 
+const struct {
+    const char* name;
+    const char* value;
+} FloatParsingData[]{
+    {"integer", "-17"},
+    {"fraction", "0.1"},
+    {"more digits", "3.14159274"},
+    {"largest exact mantissa", "16777216"},
+    {"mantissa not exactly representable", "16777217"},
+    {"long mantissa", "0.30000001192092896"},
+    {"positive exponent", "1.5e10"},
+    {"negative exponent", "2.5E-10"},
+    {"large exponent", "1e30"},
+    {"denormal", "1.4e-45"},
+    {"leading zeros", "0.000123"},
+    {"explicit plus sign", "+7.75"}
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threads;
+} ParallelData[]{
+    {"2 threads", 2},
+    {"7 threads", 7},
+    {"all hardware threads", 0}
+};
+
+const struct {
+    const char* name;
+    const char* data;
+    const char* message;
+} ParallelErrorData[]{
+    {"in the last chunk", "f 1 2 3 4\n",
+        "polygons are not supported"},
+    {"mixed primitive in the last chunk", "l 1 2\n",
+        "mixed primitive MeshPrimitive::Triangles and MeshPrimitive::Lines"},
+    {"index out of range", "f 80001//80001 80002//80002 1000000//80001\n",
+        "index 1000000 out of range for 40000 vertices"}
+};
+
+/* Over 1 MB of data, enough to be split into several chunks. The first mesh
+   is unnamed and the index numbering continues across meshes. */
+std::string parallelData(const char* const appendToLastMesh = "") {
+    std::ostringstream out;
+    UnsignedInt offset = 1;
+    for(std::size_t mesh = 0; mesh != 3; ++mesh) {
+        if(mesh) out << "o Mesh" << mesh << "\n";
+        for(UnsignedInt i = 0; i != 40000; ++i)
+            out << "v " << i*0.25f << " " << mesh << " -" << (i % 10)*0.125f << "\n";
+        out << "# normals\n";
+        for(UnsignedInt i = 0; i != 40000; ++i)
+            out << "vn 0 " << (i % 2 ? "1" : "-1") << " 0\n";
+        for(UnsignedInt i = 0; i + 2 < 40000; i += 2)
+            out << "f " << offset + i << "//" << offset + i << " "
+                << offset + i + 1 << "//" << offset + i + 1 << "\t"
+                << offset + i + 2 << "//" << offset + i + 2 << "\n";
+        offset += 40000;
+    }
+    out << appendToLastMesh;
+    return out.str();
+}
+
 ObjImporterTest::ObjImporterTest() {
     addTests({&ObjImporterTest::pointMesh,
               &ObjImporterTest::lineMesh,
@@ -111,9 +181,12 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::unnamedMesh,
               &ObjImporterTest::namedMesh,
               &ObjImporterTest::moreMeshes,
-              &ObjImporterTest::unnamedFirstMesh,
+              &ObjImporterTest::unnamedFirstMesh});
+
+    addInstancedTests({&ObjImporterTest::floatParsing},
+        Containers::arraySize(FloatParsingData));
 
-              &ObjImporterTest::wrongFloat,
+    addTests({&ObjImporterTest::wrongFloat,
               &ObjImporterTest::wrongInteger,
               &ObjImporterTest::unmergedIndexOutOfRange,
               &ObjImporterTest::mergedIndexOutOfRange,
@@ -147,6 +220,12 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::unsupportedKeyword,
               &ObjImporterTest::unknownKeyword});
 
+    addInstancedTests({&ObjImporterTest::parallel},
+        Containers::arraySize(ParallelData));
+
+    addInstancedTests({&ObjImporterTest::parallelError},
+        Containers::arraySize(ParallelErrorData));
+
     #ifdef OBJIMPORTER_PLUGIN_FILENAME
     CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(OBJIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
     #endif
@@ -457,6 +536,29 @@ void ObjImporterTest::unnamedFirstMesh() {
     CORRADE_COMPARE(importer->meshForName("SecondMesh"), 1);
 }
 
+void ObjImporterTest::floatParsing() {
+    auto&& data = FloatParsingData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const std::string file = Utility::formatString("v {0} {0} {0}\np 1\n", data.value);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openData({file.data(), file.size()}));
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->vertexCount(), 1);
+
+    /* The result should be bit-exact with std::strtof(), regardless of
+       whether the fast path was taken or not */
+    const Float expected = std::strtof(data.value, nullptr);
+    const Float actual = mesh->attribute<Vector3>(MeshAttribute::Position)[0].x();
+    UnsignedInt expectedBits, actualBits;
+    std::memcpy(&expectedBits, &expected, 4);
+    std::memcpy(&actualBits, &actual, 4);
+    CORRADE_COMPARE(actualBits, expectedBits);
+}
+
 void ObjImporterTest::wrongFloat() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "wrongNumbers.obj")));
@@ -797,6 +899,64 @@ void ObjImporterTest::unknownKeyword() {
     CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh(): unknown keyword bleh\n");
 }
 
+void ObjImporterTest::parallel() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const std::string file = parallelData();
+
+    Containers::Pointer<AbstractImporter> serial = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(serial->openData({file.data(), file.size()}));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("threads", data.threads);
+    CORRADE_VERIFY(importer->openData({file.data(), file.size()}));
+
+    /* The output should be exactly the same as when parsed serially */
+    CORRADE_COMPARE(importer->meshCount(), 3);
+    CORRADE_COMPARE(importer->meshName(0), "");
+    CORRADE_COMPARE(importer->meshName(2), "Mesh2");
+    CORRADE_COMPARE(importer->meshForName("Mesh1"), 1);
+    for(UnsignedInt i = 0; i != importer->meshCount(); ++i) {
+        CORRADE_ITERATION(i);
+
+        const Containers::Optional<MeshData> expected = serial->mesh(i);
+        const Containers::Optional<MeshData> actual = importer->mesh(i);
+        CORRADE_VERIFY(expected);
+        CORRADE_VERIFY(actual);
+        CORRADE_COMPARE(actual->primitive(), MeshPrimitive::Triangles);
+        CORRADE_COMPARE(actual->indexCount(), 59997);
+        CORRADE_COMPARE(actual->vertexCount(), 39999);
+        CORRADE_COMPARE_AS(actual->indices<UnsignedInt>(),
+            expected->indices<UnsignedInt>(),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(actual->attribute<Vector3>(MeshAttribute::Position),
+            expected->attribute<Vector3>(MeshAttribute::Position),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(actual->attribute<Vector3>(MeshAttribute::Normal),
+            expected->attribute<Vector3>(MeshAttribute::Normal),
+            TestSuite::Compare::Container);
+    }
+}
+
+void ObjImporterTest::parallelError() {
+    auto&& data = ParallelErrorData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const std::string file = parallelData(data.data);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("threads", 4);
+    CORRADE_VERIFY(importer->openData({file.data(), file.size()}));
+    CORRADE_COMPARE(importer->meshCount(), 3);
+
+    /* The error should be the same as when parsed serially */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(2));
+    CORRADE_COMPARE(out.str(), Utility::formatString("Trade::ObjImporter::mesh(): {}\n", data.message));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterTest)
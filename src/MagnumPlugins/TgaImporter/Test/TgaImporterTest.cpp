@@ -56,6 +56,8 @@ struct TgaImporterTest: TestSuite::Tester {
     void color32Rle();
     void grayscale8();
     void grayscale8Rle();
+    void grayscale8PersistentInput();
+    void color24PersistentInput();
 
     void rleTooLarge();
 
@@ -145,6 +147,8 @@ TgaImporterTest::TgaImporterTest() {
 
     addTests({&TgaImporterTest::grayscale8,
               &TgaImporterTest::grayscale8Rle,
+              &TgaImporterTest::grayscale8PersistentInput,
+              &TgaImporterTest::color24PersistentInput,
 
               &TgaImporterTest::rleTooLarge});
 
@@ -373,6 +377,58 @@ void TgaImporterTest::grayscale8() {
         TestSuite::Compare::Container);
 }
 
+void TgaImporterTest::grayscale8PersistentInput() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->setFlags(ImporterFlag::PersistentInput);
+    const char data[] = {
+        0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        1, 2,
+        3, 4,
+        5, 6
+    };
+    const char pixels[] {
+        1, 2,
+        3, 4,
+        5, 6
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    /* The image should reference the input directly */
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlags{});
+    CORRADE_COMPARE(static_cast<const void*>(image->data().data()), static_cast<const void*>(data + 18));
+    CORRADE_COMPARE(image->storage().alignment(), 1);
+    CORRADE_COMPARE(image->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::color24PersistentInput() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->setFlags(ImporterFlag::PersistentInput);
+    const char data[] = {
+        0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 24, 0,
+        1, 2, 3,
+        4, 5, 6
+    };
+    const char pixels[] {
+        3, 2, 1,
+        6, 5, 4
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    /* Color data need to be swizzled, so they're still copied */
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(1, 2));
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
 void TgaImporterTest::grayscale8Rle() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
     const char data[] = {
@@ -65,8 +65,16 @@ void TgaImporter::doOpenData(const Containers::ArrayView<const char> data) {
         return;
     }
 
-    _in = Containers::Array<char>{data.size()};
-    std::copy(data.begin(), data.end(), _in.begin());
+    /* If the data are guaranteed to outlive us, reference them directly
+       instead of making a copy */
+    if(flags() & ImporterFlag::PersistentInput) {
+        _in = Containers::Array<char>{const_cast<char*>(data.data()), data.size(), [](char*, std::size_t) {}};
+        _persistentInput = true;
+    } else {
+        _in = Containers::Array<char>{data.size()};
+        std::copy(data.begin(), data.end(), _in.begin());
+        _persistentInput = false;
+    }
 }
 
 UnsignedInt TgaImporter::doImage2DCount() const { return 1; }
@@ -129,8 +137,12 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
     const std::size_t pixelSize = header.bpp/8;
     const std::size_t outputSize = std::size_t(size.product())*pixelSize;
 
+    /* Adjust pixel storage if row size is not four byte aligned */
+    PixelStorage storage;
+    if((size.x()*header.bpp/8)%4 != 0)
+        storage.setAlignment(1);
+
     /* Copy data directly if not RLE */
-    Containers::Array<char> data{outputSize};
     Containers::ArrayView<const char> srcPixels = _in.suffix(sizeof(Implementation::TgaHeader));
     if(!rle) {
         /* Files that are larger are allowed in this case (but not for RLE) */
@@ -139,6 +151,14 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
             return Containers::NullOpt;
         }
 
+        /* Grayscale pixels don't need any swizzling, so if the input is
+           guaranteed to outlive the image, reference it directly */
+        if(_persistentInput && format == PixelFormat::R8Unorm)
+            return ImageData2D{storage, format, size, DataFlags{}, srcPixels.prefix(outputSize)};
+    }
+
+    Containers::Array<char> data{outputSize};
+    if(!rle) {
         Utility::copy(srcPixels.prefix(data.size()), data);
 
     /* Otherwise decode */
@@ -183,11 +203,6 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
         }
     }
 
-    /* Adjust pixel storage if row size is not four byte aligned */
-    PixelStorage storage;
-    if((size.x()*header.bpp/8)%4 != 0)
-        storage.setAlignment(1);
-
     if(format == PixelFormat::RGB8Unorm) {
         if(flags() & ImporterFlag::Verbose)
             Debug{} << "Trade::TgaImporter::image2D(): converting from BGR to RGB";
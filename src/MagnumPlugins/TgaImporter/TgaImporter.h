@@ -98,6 +98,13 @@ are imported with default @ref PixelStorage parameters except for alignment,
 which may be changed to `1` if the data require it.
 
 RLE compression is supported, paletted images are not.
+
+If @ref ImporterFlag::PersistentInput is set, the importer references the
+input memory instead of copying it. Uncompressed grayscale images are then
+returned without a copy as well, with @ref ImageData::dataFlags() empty and
+the data pointing to the input. Color images are always copied as the BGR(A)
+input needs to be converted to RGB(A), and RLE-compressed images are always
+decoded into a newly allocated memory.
 */
 class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
     public:
@@ -118,6 +125,7 @@ class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
         Containers::Optional<ImageData2D> MAGNUM_TGAIMPORTER_LOCAL doImage2D(UnsignedInt id, UnsignedInt level) override;
 
         Containers::Array<char> _in;
+        bool _persistentInput{};
 };
 
 }}